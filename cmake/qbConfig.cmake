@@ -188,6 +188,7 @@ if(NOT QB_USE_SYSTEM_NLOHMANN MATCHES "^(AUTO|ON|OFF)$")
     message(FATAL_ERROR "[qb] QB_USE_SYSTEM_NLOHMANN must be AUTO, ON or OFF (got '${QB_USE_SYSTEM_NLOHMANN}')")
 endif()
 option(QB_WITH_PROFILING "Enable profiling support" OFF)
+option(QB_WITH_LOOP_PROFILER "Time event handlers, callbacks and I/O per core and per actor (see qb/core/Profiler.h)" OFF)
 
 # Debug options
 option(QB_DEBUG_MEMORY "Enable memory debugging (legacy alias for QB_SANITIZE=address,undefined)" OFF)
@@ -473,6 +474,9 @@ macro(qb_initialize_project_configuration)
     if(QB_DEBUG_ACTOR)
         list(APPEND QB_COMPILE_DEFINITIONS "QB_DEBUG_ACTOR=1")
     endif()
+    if(QB_WITH_LOOP_PROFILER)
+        list(APPEND QB_COMPILE_DEFINITIONS "QB_WITH_LOOP_PROFILER=1")
+    endif()
     if(QB_STDOUT_LOGGING)
         list(APPEND QB_COMPILE_DEFINITIONS "QB_STDOUT_LOGGING=1")
     endif()
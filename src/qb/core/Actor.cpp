@@ -143,6 +143,30 @@ Actor::Actor(no_default_events_t) noexcept
     // shutdown is SignalEvent, NOT KillEvent — see `qb::no_default_events_t` in Actor.h for why.
 }
 
+void *
+Actor::operator new(std::size_t const bytes) {
+    auto *const core = VirtualCore::_handler;
+    return ActorSlab::allocate(core ? &core->_actor_slab : nullptr, bytes);
+}
+
+void
+Actor::operator delete(void *const object) noexcept {
+    // Usually the owning core, from removeActor(). A core's own teardown runs after its thread
+    // left the engine (`_handler` is null): those blocks take the owner's return stack.
+    auto *const core = VirtualCore::_handler;
+    ActorSlab::deallocate(object, core ? &core->_actor_slab : nullptr);
+}
+
+void *
+Actor::operator new(std::size_t const bytes, std::align_val_t const alignment) {
+    return ::operator new(bytes, alignment);
+}
+
+void
+Actor::operator delete(void *const object, std::align_val_t const alignment) noexcept {
+    ::operator delete(object, alignment);
+}
+
 void
 Actor::on(PingEvent const &event) noexcept {
     // type 0 is the wildcard liveness probe (any live actor replies — qb::ping); otherwise the
@@ -289,6 +313,17 @@ Actor::kill() const noexcept {
     VirtualCore::_handler->killActor(id());
 }
 
+void
+Actor::migrate(ActorId const target, CoreId const to) const noexcept {
+    VirtualCore::_handler->__request_migration__(target, to, id());
+}
+
+std::unique_ptr<IActorFactory>
+Actor::onMigrate() {
+    // Not movable unless the actor opts in: see the contract on the declaration.
+    return {};
+}
+
 Actor::EventBuilder::EventBuilder(Pipe const &pipe) noexcept
     : dest_pipe(pipe) {}
 
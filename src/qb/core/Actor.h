@@ -35,6 +35,7 @@
 #include <stdexcept>
 #include <map>
 #include <memory>
+#include <new>
 #include <optional>
 #include <tuple>
 #include <utility>
@@ -46,6 +47,7 @@
 #include <qb/utility/type_traits.h>
 #include <qb/io/async/coroutine.h>
 #include "Event.h"
+#include "EventBatch.h"
 #include "ICallback.h"
 #include "Pipe.h"
 
@@ -62,7 +64,8 @@ class ActorProxy;
 class Service;
 class Event;
 class ICallback;
-class Actor;             // Forward declaration for concepts
+class IActorFactory; // Forward for Actor::onMigrate (defined after the Actor body)
+class Actor;         // Forward declaration for concepts
 class ScopedCoroContext; // Forward for Actor::context() (defined after the Actor body)
 template <typename _Actor>
 class ActorHandle; // Forward for Actor::addRefActor (RefActorHandle is an alias of this)
@@ -211,7 +214,8 @@ class Actor : nocopy {
      *       - This flag is **single-writer / single-reader**: both sides
      *         always run on the exact same `VirtualCore` worker thread (the
      *         one that hosts this actor). `VirtualCore` is strictly
-     *         thread-affine — an actor never migrates between cores, and
+     *         thread-affine — an actor object never moves between cores
+     *         (`migrate()` re-creates it on the destination), and
      *         remote senders only enqueue `KillEvent`s into the core's
      *         mailbox; they never flip this flag directly.
      *       - Therefore no atomicity, no memory fence and no lock is
@@ -356,7 +360,57 @@ protected:
         co_return true;
     }
 
+    /**
+     * @brief Migration hook — hand this actor's state over to a factory for the destination core.
+     * @return A one-shot factory that re-creates this actor on the destination core (typically
+     *         `qb::make_migration<MyActor>(std::move(_state)...)`), or an empty pointer — the
+     *         default — to refuse the migration.
+     * @details Called on the owning core when a `migrate()` request for this actor is accepted,
+     *          right before the actor is killed here. The factory travels to the destination
+     *          core inside an event and runs `create()` there, so the new instance is
+     *          constructed on its own worker thread and receives a fresh `ActorId`; its
+     *          `onInit()` runs as for any `addRefActor` (async inits are gated as usual).
+     *
+     *          Opting in is only sound for actors whose state can leave the core: nothing
+     *          else may hold a raw pointer to them (no `addRefActor` parents that keep the
+     *          pointer, no `ActorHandle` relied upon across the move), and they must not own
+     *          I/O bound to this core's listener (`qb::io::use<>` actors). A request is refused
+     *          before this hook runs for services, for actors still *Activating* and for
+     *          actors with coroutines in flight — their frames capture `this`.
+     */
+    virtual std::unique_ptr<IActorFactory>
+    onMigrate();
+
 public:
+    /**
+     * @name Storage
+     * @{
+     */
+
+    /**
+     * @brief Allocate an actor from the `ActorSlab` of the core constructing it.
+     * @details Every `new` of an actor type lands here, including the default
+     *          `qb::allocate_actor`, so the actor map's `std::unique_ptr<Actor>` frees it back
+     *          to the slab with its default deleter. Off a worker thread, and for an actor
+     *          bigger than `ActorSlab::kMaxBlockBytes`, the block comes from the heap. A
+     *          derived class that declares its own `operator new`/`operator delete` opts out.
+     */
+    static void *operator new(std::size_t bytes);
+    /// Return the storage to the slab it came from; another core's block goes back to its owner.
+    static void operator delete(void *object) noexcept;
+    /// Over-aligned actors bypass the slab.
+    static void *operator new(std::size_t bytes, std::align_val_t alignment);
+    static void  operator delete(void *object, std::align_val_t alignment) noexcept;
+    /// Placement forms, hidden otherwise by the class-scope overloads above.
+    static void *
+    operator new(std::size_t, void *where) noexcept {
+        return where;
+    }
+    static void
+    operator delete(void *, void *) noexcept {}
+
+    /** @} */
+
     /**
      * @brief Terminate this actor and mark it for removal from the system.
      *
@@ -372,6 +426,34 @@ public:
      */
     void kill() const noexcept;
 
+    /**
+     * @brief Ask the engine to move actor @p target to VirtualCore @p to.
+     * @param target The actor to move; may live on any core, including this one.
+     * @param to     Destination core; must be part of the engine's core set.
+     * @details Asynchronous. The request travels to @p target's core, which quiesces the
+     *          actor (its inbound unicast events are parked in a per-core redirection table),
+     *          asks it for a factory through `onMigrate()`, kills it and ships the factory to
+     *          @p to. The destination re-creates the actor under a new `ActorId`, and the
+     *          origin core then forwards — in order — everything parked meanwhile and every
+     *          later event still addressed to the old id, for
+     *          `VirtualCore::migration_redirect_grace_ns` (5 s by default). Senders holding the
+     *          old id therefore keep working meanwhile; they pay one extra hop until they learn
+     *          the new id.
+     *
+     *          The outcome is reported to the caller as a `qb::MigratedEvent` (register it
+     *          to receive it): `migrated` carries the new id, or `ActorId::NotFound` if the
+     *          request was refused (see `onMigrate()`) or the re-creation failed; `busy` is
+     *          set when the refusal is only temporary (the actor is still activating or has
+     *          coroutines in flight) and the request is worth retrying. A refused actor is
+     *          left untouched; a failed re-creation loses it, exactly like an
+     *          `addRefActor` whose `onInit()` fails.
+     * @note The old id stays reserved on its core during the grace period, so it cannot alias
+     *       a newcomer while it is still forwarded; after it, the id returns to the pool like a
+     *       dead actor's. Events sent to the new id may overtake events still being forwarded
+     *       from the old one.
+     */
+    void migrate(ActorId target, CoreId to) const noexcept;
+
     /**
      * @}
      */
@@ -935,7 +1017,7 @@ public:
      *         completed; `false` for an invalid id, an actor on another core, one whose async
      *         `onInit()` is still in flight, and one that has been killed.
      * @details
-     * The untyped counterpart of `qb::ActorHandle<T>::ready()`: one hash lookup, no
+     * The untyped counterpart of `qb::ActorHandle<T>::ready()`: one table lookup, no
      * `dynamic_cast`, no knowledge of the concrete type. It exists for bookkeeping that stores
      * bare `ActorId`s — a subscriber list, a routing table, a worker registry — and must drop
      * entries whose actor has gone. The framework prunes its **own** such map when an actor dies
@@ -1020,6 +1102,32 @@ public:
     template <typename _Event, typename... _Args>
     void broadcast(_Args &&...args) const noexcept;
 
+    /**
+     * @brief Send one event to a list of actors: one copy per destination core, not per actor.
+     * @tparam _Event The type of event to send (must derive from `qb::Event`).
+     * @tparam _Args Types of arguments to forward to the `_Event` constructor.
+     * @param dests Destination actors, on any cores; duplicates receive the event twice.
+     * @param args Arguments for the `_Event` constructor (copied once per destination core).
+     * @details
+     * The destinations are grouped by core. Each core receives a single copy carrying the list
+     * of its local targets and dispatches that copy to each of them in list order, then destroys
+     * it once; a core with a single target gets a plain `push()`. For 1000 subscribers over 8
+     * cores, that is 8 copies through the pipes and mailboxes instead of 1000.
+     *
+     * Ordering is that of `push()`: FIFO from this actor to each destination.
+     * Handlers receive the shared copy; `reply()` / `forward()` of it give the replier a copy of
+     * its own, so a handler may take either `on(E const&)` or `on(E&)`, but an in-place change
+     * to a non-const event is seen by the local targets dispatched after it.
+     * A target that is still Activating, or migrating away, receives a private copy re-queued
+     * on its core — it may then arrive after events this actor pushed to it later.
+     * @code
+     * // multicast<PriceTick>(subscribers, symbol, price);
+     * @endcode
+     * @see Actor::push, Actor::batch
+     */
+    template <event_type _Event, typename... _Args>
+    void multicast(ActorIdList const &dests, _Args &&...args) const noexcept;
+
     /**
      * @brief Reply to the source of a received event, reusing the event object.
      * @param event The event object that was received. This event will be modified
@@ -1095,6 +1203,28 @@ public:
      */
     [[nodiscard]] Pipe getPipe(ActorId dest) const noexcept;
 
+    /**
+     * @brief Open a batch of `_Event`s for actors on one core.
+     * @tparam _Event Event type of every event in the batch.
+     * @param core    Core hosting the destinations (`dest.index()` for a single one).
+     * @param reserve Expected number of events; the pipe space for them is reserved at once.
+     * @return A scoped `qb::EventBatch<_Event>`; its `push(dest, args...)` builds each event in
+     *         the reservation, and the unused rest is given back when it goes out of scope.
+     * @details
+     * For a fan-out of one event type to many actors on one core, this replaces N `push()`es
+     * — N pipe reservations — by one. Ordering is the same as `push()`.
+     * @code
+     * // auto out = batch<WorkItem>(workers_core, items.size());
+     * // for (std::size_t i = 0; i < items.size(); ++i)
+     * //     out.push(workers[i % workers.size()], items[i]);
+     * @endcode
+     * @attention Queue nothing else to `core` while the batch is open, and let it close before
+     *            the handler returns — see `qb::EventBatch`.
+     * @see qb::EventBatch
+     */
+    template <event_type _Event>
+    [[nodiscard]] EventBatch<_Event> batch(CoreId core, std::size_t reserve) const noexcept;
+
     /**
      * @brief Create a new referenced actor on the same VirtualCore and return a handle to it.
      * @tparam _Actor The concrete derived actor type to create (must inherit from `qb::Actor`).
@@ -1818,7 +1948,8 @@ public:
  * source compatibility). The handle captures the `ActorId` at creation and resolves the live
  * pointer **on demand** through `VirtualCore::findActor<T>()`, so it never hands back a dangling
  * pointer: `get()` is *phase-aware* and returns `nullptr` while the actor is still **Activating**
- * (its async `onInit()` is in flight), after a failed init, or once it has been destroyed.
+ * (its async `onInit()` is in flight), after a failed init, or once it has been destroyed — also
+ * when the id has since been recycled for another actor (the handle keeps its slot generation).
  *
  * Callers can:
  * - Cheaply send events to the referenced actor via `id()` — valid the instant `addRefActor`
@@ -1838,8 +1969,9 @@ public:
  */
 template <typename _Actor>
 class ActorHandle {
-    ActorId _id;
-    _Actor *_cached = nullptr;
+    ActorId       _id;
+    std::uint32_t _generation = 0; // of the id's slot when the handle was made
+    _Actor       *_cached     = nullptr;
 
 public:
     ActorHandle() noexcept = default;
@@ -1848,10 +1980,10 @@ public:
      * @brief Wrap a pointer returned by `VirtualCore::addReferencedActor<_Actor>(...)`.
      * @param actor Pointer to an actor on the current VirtualCore (may be nullptr, and may
      *        be one whose async `onInit()` is still in flight — see `ready()`).
+     * @details Records the generation of the actor's slot: once that actor is destroyed the
+     *          handle resolves nothing, even after its recycled id names a new actor.
      */
-    explicit ActorHandle(_Actor *actor) noexcept
-        : _id(actor ? actor->id() : ActorId{})
-        , _cached(actor) {}
+    explicit ActorHandle(_Actor *actor) noexcept;
 
     /**
      * @brief The ActorId of the referenced actor (may be invalid).
@@ -2157,16 +2289,17 @@ actor_factory_forward(T &&val) {
  * @return Pointer to a newly constructed `_Actor`, owned by the caller.
  *
  * @details
- * The default implementation simply calls `new _Actor(args...)`. Users may provide
- * their own specialization (for a specific actor type) or replace this function via
- * an overload discoverable by ADL to plug in a memory pool, arena, or
+ * The default implementation simply calls `new _Actor(args...)`, which goes through
+ * `Actor::operator new` and takes the storage from the constructing core's `ActorSlab`.
+ * Users may provide their own specialization (for a specific actor type) or replace this
+ * function via an overload discoverable by ADL to plug in a memory pool, arena, or
  * `std::pmr::polymorphic_allocator` for hot-path actor factories.
  *
  * The returned pointer **must be destructible via `delete` using the matching deallocator**
  * for whatever allocation strategy the override uses, because `std::unique_ptr<Actor>`
- * with the default deleter is used downstream. If a custom allocator requires a specific
- * deleter, wrap it via an intrusive `operator delete` override or request framework-level
- * customization beyond this hook.
+ * with the default deleter is used downstream, and that `delete` calls `Actor::operator delete`
+ * unless the actor type declares its own. Storage that did not come from `Actor::operator new`
+ * therefore needs an `operator delete` override on the actor type.
  *
  * @code
  * // Example: specialize for a specific actor to use a pool.
@@ -2228,6 +2361,64 @@ private:
     }
 };
 
+/**
+ * @class TMigrationFactory
+ * @brief One-shot factory carrying a migrating actor's state to its destination core.
+ * @ingroup Actor
+ * @tparam _Actor The concrete Actor type to re-create.
+ * @tparam _Args  The stored constructor argument types.
+ * @details The migration counterpart of `TActorFactory`: `create()` runs exactly once, on the
+ *          destination core, so the stored arguments are MOVED into the constructor — which
+ *          is what lets a move-only state (a `std::unique_ptr`, a large container) change
+ *          core without a copy. Build one with `qb::make_migration<_Actor>(...)` from
+ *          `Actor::onMigrate()`.
+ */
+template <typename _Actor, typename... _Args>
+class TMigrationFactory
+    : public IActorFactory
+    , public ActorProxy {
+    std::tuple<_Args...> _parameters;
+
+public:
+    template <typename... _Init>
+    explicit TMigrationFactory(_Init &&...args)
+        : _parameters(std::forward<_Init>(args)...) {}
+
+    Actor *
+    create() final {
+        return std::apply(
+            [](auto &...args) {
+                auto *actor = qb::allocate_actor<_Actor>(std::move(args)...);
+                ActorProxy::setTypeInfo<_Actor>(*actor);
+                return static_cast<Actor *>(actor);
+            },
+            _parameters);
+    }
+
+    [[nodiscard]] bool
+    isService() const final {
+        return service_type<_Actor>;
+    }
+};
+
+/**
+ * @brief Build the factory `Actor::onMigrate()` returns.
+ * @ingroup Actor
+ * @tparam _Actor The concrete Actor type to re-create on the destination core.
+ * @param args Constructor arguments, stored by value (move the actor's state in).
+ * @return The factory, ready to be handed to the engine.
+ * @code
+ * std::unique_ptr<qb::IActorFactory> onMigrate() override {
+ *     return qb::make_migration<Counter>(std::move(_totals), _hits);
+ * }
+ * @endcode
+ */
+template <typename _Actor, typename... _Args>
+[[nodiscard]] std::unique_ptr<IActorFactory>
+make_migration(_Args &&...args) {
+    return std::make_unique<TMigrationFactory<_Actor, std::decay_t<_Args>...>>(std::forward<_Args>(args)...);
+}
+
 /**
  * @typedef actor
  * @brief Alias for the Actor class
@@ -386,9 +386,11 @@ class ActorId {
 
     friend class CoreInitializer;
     friend class SharedCoreCommunication;
+    friend class LoopProfiler;
     friend class VirtualCore;
     friend class Actor;
     friend class Service;
+    friend class Replay;
 
 private:
     ServiceId _service_id;
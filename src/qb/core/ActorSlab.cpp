@@ -0,0 +1,136 @@
+/**
+ * @file qb/core/ActorSlab.cpp
+ * @brief Block management of `qb::ActorSlab`.
+ *
+ * `Actor::operator new` / `operator delete`, which pick the calling core's slab, live with the
+ * rest of `Actor` in `Actor.cpp`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <new>
+#include <utility>
+#include "ActorSlab.h"
+
+namespace qb {
+
+// Header of every block; the actor starts right after it. A free block links through the first
+// word of the actor storage, so the header only has to survive while the actor is alive.
+struct alignas(ActorSlab::kHeaderBytes) ActorSlab::Header {
+    ActorSlab    *owner;      // null for a heap block
+    std::uint32_t size_class; // kNbClasses for a heap block
+
+    [[nodiscard]] void *
+    object() noexcept {
+        return reinterpret_cast<std::byte *>(this) + kHeaderBytes;
+    }
+    [[nodiscard]] Header *&
+    next() noexcept {
+        return *static_cast<Header **>(object());
+    }
+    [[nodiscard]] static Header *
+    of(void *object) noexcept {
+        return reinterpret_cast<Header *>(static_cast<std::byte *>(object) - kHeaderBytes);
+    }
+};
+
+namespace {
+constexpr std::align_val_t kChunkAlignment{QB_LOCKFREE_CACHELINE_BYTES};
+} // namespace
+
+ActorSlab::~ActorSlab() noexcept {
+    // Every actor is gone by now: the chunks take every block with them.
+    for (auto *const chunk : _chunks)
+        ::operator delete(chunk, kChunkBytes, kChunkAlignment);
+}
+
+void *
+ActorSlab::allocate(ActorSlab *const slab, std::size_t const bytes) {
+    static_assert(sizeof(Header) == kHeaderBytes, "the actor must start right after the header");
+    static_assert(kHeaderBytes >= alignof(std::max_align_t), "actors need the alignment ::operator new gives");
+    const auto size_class = (bytes + kHeaderBytes - 1) / kClassBytes;
+    if (!slab || size_class >= kNbClasses) {
+        auto *const block = new (::operator new(kHeaderBytes + bytes)) Header{nullptr, kNbClasses};
+        return block->object();
+    }
+    if (!slab->_free[size_class])
+        slab->reclaim();
+    Header *block = slab->_free[size_class];
+    if (block)
+        slab->_free[size_class] = block->next();
+    else
+        block = new (slab->carve(size_class)) Header{slab, static_cast<std::uint32_t>(size_class)};
+    ++slab->_live;
+    return block->object();
+}
+
+void
+ActorSlab::deallocate(void *const object, ActorSlab *const local) noexcept {
+    if (!object)
+        return;
+    auto *const block = Header::of(object);
+    auto *const owner = block->owner;
+    if (!owner) {
+        block->~Header();
+        ::operator delete(block);
+    } else if (owner == local) {
+        owner->recycle(block);
+    } else {
+        // Treiber push onto the owner's stack. Only the owner pops, and it takes the whole stack
+        // at once, so there is no ABA window.
+        auto &returned = owner->_returned;
+        block->next()  = returned.load(std::memory_order_relaxed);
+        while (!returned.compare_exchange_weak(block->next(), block, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+void *
+ActorSlab::carve(std::size_t const size_class) {
+    const auto bytes = (size_class + 1) * kClassBytes;
+    if (static_cast<std::size_t>(_end - _cursor) < bytes) {
+        // The tail of the previous chunk is too short for this class: left unused.
+        auto *const chunk = static_cast<std::byte *>(::operator new(kChunkBytes, kChunkAlignment));
+        try {
+            _chunks.push_back(chunk);
+        } catch (...) {
+            ::operator delete(chunk, kChunkBytes, kChunkAlignment);
+            throw;
+        }
+        _cursor = chunk;
+        _end    = chunk + kChunkBytes;
+    }
+    return std::exchange(_cursor, _cursor + bytes);
+}
+
+void
+ActorSlab::reclaim() noexcept {
+    auto *block = _returned.exchange(nullptr, std::memory_order_acquire);
+    while (block) {
+        auto *const next = block->next();
+        recycle(block);
+        block = next;
+    }
+}
+
+void
+ActorSlab::recycle(Header *const block) noexcept {
+    block->next()            = _free[block->size_class];
+    _free[block->size_class] = block;
+    --_live;
+}
+
+} // namespace qb
@@ -0,0 +1,116 @@
+/**
+ * @file qb/core/ActorSlab.h
+ * @brief Per-core size-classed storage for actors.
+ *
+ * `Actor::operator new` takes actor storage from the `ActorSlab` of the core constructing it,
+ * and `Actor::operator delete` gives it back, so the `std::unique_ptr<Actor>` the core keeps in
+ * its actor map returns the block to the slab on `removeActor()` with the default deleter. A
+ * workload that spawns and kills actors at a high rate recycles the same blocks on the same
+ * core: no global-allocator lock shared with the other cores, and actors created together sit
+ * next to each other in memory that core first touched (NUMA-local under `setNumaLocal()`).
+ *
+ * An actor freed on another thread (the teardown of a core after its thread left the engine, a
+ * user who deletes one by hand) goes back to its owner through a lock-free stack, as
+ * `SharedSlab` blocks do. An actor built outside a running core, or larger than the biggest
+ * class, gets a heap block with the same header and is freed to the heap.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_ACTOR_SLAB_H
+#define QB_CORE_ACTOR_SLAB_H
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <qb/utility/nocopy.h>
+#include <qb/utility/prefix.h>
+
+namespace qb {
+
+/**
+ * @class ActorSlab
+ * @ingroup Core
+ * @brief Size-classed pool of actor blocks owned by one core.
+ * @details One per core, owned by `SharedCoreCommunication` so it outlives the `VirtualCore` and
+ *          every actor it destroys. `allocate()` is called by the owning core only; `deallocate()`
+ *          by any thread, which hands a block it does not own back through `_returned`.
+ *
+ *          A block is a 16-byte header followed by the actor, in classes of `kClassBytes` up to
+ *          `kMaxBlockBytes`, carved from `kChunkBytes` chunks. Freed blocks stay on the owner's
+ *          free lists, so a core holds on to its peak actor footprint until the engine stops.
+ */
+class ActorSlab : nocopy {
+public:
+    /// Class granularity: blocks are whole cache lines.
+    static constexpr std::size_t kClassBytes = QB_LOCKFREE_CACHELINE_BYTES;
+    /// Largest pooled block, header included; bigger actors go to the heap.
+    static constexpr std::size_t kMaxBlockBytes = 4096;
+    static constexpr std::size_t kNbClasses     = kMaxBlockBytes / kClassBytes;
+    /// Chunk the blocks of every class are carved from.
+    static constexpr std::size_t kChunkBytes = 64 * 1024;
+    /// Header in front of every actor; keeps the actor 16-byte aligned like `::operator new`.
+    static constexpr std::size_t kHeaderBytes = 16;
+
+    ActorSlab() = default;
+    ~ActorSlab() noexcept;
+
+    /**
+     * @brief Storage for an actor of @p bytes, from @p slab or, when it is null, from the heap.
+     * @details Called with the slab of the running core (`Actor::operator new`). Throws
+     *          `std::bad_alloc` like `::operator new`.
+     */
+    [[nodiscard]] static void *allocate(ActorSlab *slab, std::size_t bytes);
+
+    /**
+     * @brief Return storage obtained from `allocate()`.
+     * @param local The slab of the calling thread's core, or null: a block owned by another slab
+     *              is returned to its owner's stack instead of @p local's free lists.
+     */
+    static void deallocate(void *object, ActorSlab *local) noexcept;
+
+    /// Actors currently allocated from this slab (owner core only).
+    [[nodiscard]] std::size_t
+    live() const noexcept {
+        return _live;
+    }
+
+    /// Bytes of chunks this slab has mapped so far (owner core only).
+    [[nodiscard]] std::size_t
+    reserved() const noexcept {
+        return _chunks.size() * kChunkBytes;
+    }
+
+private:
+    struct Header;
+
+    [[nodiscard]] void *carve(std::size_t size_class);
+    void                reclaim() noexcept;
+    void                recycle(Header *block) noexcept;
+
+    std::array<Header *, kNbClasses> _free{};
+    std::vector<void *>              _chunks;
+    std::byte                       *_cursor = nullptr; // next free byte of the last chunk
+    std::byte                       *_end    = nullptr;
+    std::size_t                      _live   = 0;
+    // Written by every thread that frees a foreign actor: keep it off the owner's cache line.
+    alignas(QB_LOCKFREE_CACHELINE_BYTES) std::atomic<Header *> _returned{nullptr};
+};
+
+} // namespace qb
+
+#endif // QB_CORE_ACTOR_SLAB_H
@@ -24,8 +24,20 @@
 
 #include <limits>
 #include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <map>
 #include <numeric>
+#include <optional>
+#include <ranges>
+#include <sstream>
 #include <qb/core/CoreSet.h>
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace qb {
 
@@ -88,4 +100,327 @@ CoreSet::build(uint32_t const nb_core) noexcept {
         set.insert(static_cast<CoreId>(i));
     return CoreSet{set};
 }
-} // namespace qb
\ No newline at end of file
+int
+CoreSet::nodeOf(CoreId const id) const {
+    return topology().nodeOf(id);
+}
+
+CoreIdSet
+CoreSet::onNode(int const node) const {
+    CoreIdSet ret;
+    for (const auto id : _raw_set)
+        if (nodeOf(id) == node)
+            ret.insert(id);
+    return ret;
+}
+
+CpuTopology const &
+CoreSet::topology() {
+    return CpuTopology::host();
+}
+
+// CpuTopology
+namespace {
+namespace fs = std::filesystem;
+
+std::optional<std::string>
+read_line(fs::path const &path) {
+    std::ifstream in(path);
+    std::string   line;
+    if (!in || !std::getline(in, line))
+        return std::nullopt;
+    return line;
+}
+
+std::optional<int>
+read_int(fs::path const &path) {
+    const auto line = read_line(path);
+    if (!line)
+        return std::nullopt;
+    try {
+        return std::stoi(*line);
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+// A sysfs cpu list: "0-3,8,10-11".
+std::vector<int>
+parse_list(std::string const &text) {
+    std::vector<int>  out;
+    std::stringstream in(text);
+    std::string       item;
+    while (std::getline(in, item, ',')) {
+        try {
+            const auto dash  = item.find('-');
+            const int  first = std::stoi(item.substr(0, dash));
+            const int  last  = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int i = first; i <= last; ++i)
+                out.push_back(i);
+        } catch (...) {
+        }
+    }
+    return out;
+}
+
+// Entries `<prefix>N` of @p dir, by N.
+std::vector<int>
+numbered_entries(fs::path const &dir, std::string_view const prefix) {
+    std::vector<int> out;
+    std::error_code  ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        const auto name = it->path().filename().string();
+        if (name.size() > prefix.size() && name.starts_with(prefix)
+            && std::all_of(name.begin() + static_cast<std::ptrdiff_t>(prefix.size()), name.end(), [](char c) { return c >= '0' && c <= '9'; }))
+            out.push_back(std::stoi(name.substr(prefix.size())));
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+std::optional<int>
+l3_of(fs::path const &cache) {
+    for (const auto index : numbered_entries(cache, "index")) {
+        const auto dir = cache / ("index" + std::to_string(index));
+        if (read_int(dir / "level") != 3)
+            continue;
+        if (const auto id = read_int(dir / "id"))
+            return id;
+        if (const auto shared = read_line(dir / "shared_cpu_list")) {
+            const auto cpus = parse_list(*shared);
+            if (!cpus.empty())
+                return *std::min_element(cpus.begin(), cpus.end());
+        }
+    }
+    return std::nullopt;
+}
+} // namespace
+
+CpuTopology
+CpuTopology::discover(std::string const &root) {
+    const fs::path cpu_dir  = fs::path(root) / "cpu";
+    const fs::path node_dir = fs::path(root) / "node";
+    CpuTopology    topo;
+
+    std::vector<int> online;
+    if (const auto list = read_line(cpu_dir / "online"))
+        online = parse_list(*list);
+    if (online.empty())
+        online = numbered_entries(cpu_dir, "cpu");
+    if (online.empty()) {
+        online.resize(std::max(1u, std::thread::hardware_concurrency()));
+        std::iota(online.begin(), online.end(), 0);
+    }
+    for (const auto cpu : online) {
+        if (cpu < 0 || cpu >= static_cast<int>(MaxCores))
+            continue;
+        const auto dir = cpu_dir / ("cpu" + std::to_string(cpu));
+        CpuInfo    info;
+        info.cpu     = static_cast<CoreId>(cpu);
+        info.package = read_int(dir / "topology" / "physical_package_id").value_or(0);
+        info.core    = read_int(dir / "topology" / "core_id").value_or(cpu);
+        info.l3      = l3_of(dir / "cache").value_or(-1);
+        topo._cpus.push_back(info);
+    }
+
+    const auto nodes = numbered_entries(node_dir, "node");
+    for (const auto node : nodes) {
+        const auto list = read_line(node_dir / ("node" + std::to_string(node)) / "cpulist");
+        for (const auto cpu : list ? parse_list(*list) : std::vector<int>{})
+            for (auto &info : topo._cpus)
+                if (info.cpu == cpu)
+                    info.node = node;
+    }
+    if (!nodes.empty())
+        topo._nb_nodes = static_cast<std::size_t>(nodes.back()) + 1;
+    // Each node's distance row lists every node in id order.
+    topo._distance.assign(topo._nb_nodes * topo._nb_nodes, 0);
+    for (const auto from : nodes) {
+        const auto row = read_line(node_dir / ("node" + std::to_string(from)) / "distance");
+        if (!row)
+            continue;
+        std::stringstream in(*row);
+        int               value;
+        for (std::size_t i = 0; i < nodes.size() && in >> value; ++i)
+            topo._distance[static_cast<std::size_t>(from) * topo._nb_nodes + static_cast<std::size_t>(nodes[i])] = value;
+    }
+    return topo;
+}
+
+CpuTopology const &
+CpuTopology::host() {
+    static const CpuTopology topo = discover();
+    return topo;
+}
+
+std::vector<CpuInfo> const &
+CpuTopology::cpus() const noexcept {
+    return _cpus;
+}
+
+CpuInfo const *
+CpuTopology::find(CoreId const cpu) const noexcept {
+    const auto it = std::lower_bound(_cpus.begin(), _cpus.end(), cpu, [](CpuInfo const &info, CoreId id) { return info.cpu < id; });
+    return it != _cpus.end() && it->cpu == cpu ? &*it : nullptr;
+}
+
+int
+CpuTopology::nodeOf(CoreId const cpu) const noexcept {
+    const auto *info = find(cpu);
+    return info ? info->node : -1;
+}
+
+std::size_t
+CpuTopology::getNbNodes() const noexcept {
+    return _nb_nodes;
+}
+
+CoreIdSet
+CpuTopology::nodeCores(int const node) const {
+    CoreIdSet ret;
+    for (auto const &info : _cpus)
+        if (info.node == node)
+            ret.insert(info.cpu);
+    return ret;
+}
+
+CoreIdSet
+CpuTopology::packageCores(int const package) const {
+    CoreIdSet ret;
+    for (auto const &info : _cpus)
+        if (info.package == package)
+            ret.insert(info.cpu);
+    return ret;
+}
+
+CoreIdSet
+CpuTopology::l3Cores(CoreId const cpu) const {
+    CoreIdSet   ret;
+    auto const *self = find(cpu);
+    if (!self)
+        return ret;
+    ret.insert(cpu);
+    if (self->l3 < 0)
+        return ret;
+    for (auto const &info : _cpus)
+        if (info.l3 == self->l3 && info.package == self->package)
+            ret.insert(info.cpu);
+    return ret;
+}
+
+CoreIdSet
+CpuTopology::siblings(CoreId const cpu) const {
+    CoreIdSet   ret;
+    auto const *self = find(cpu);
+    if (!self)
+        return ret;
+    for (auto const &info : _cpus)
+        if (info.package == self->package && info.core == self->core)
+            ret.insert(info.cpu);
+    return ret;
+}
+
+int
+CpuTopology::nodeDistance(int const from, int const to) const noexcept {
+    if (from < 0 || to < 0 || static_cast<std::size_t>(from) >= _nb_nodes || static_cast<std::size_t>(to) >= _nb_nodes)
+        return 0;
+    return _distance[static_cast<std::size_t>(from) * _nb_nodes + static_cast<std::size_t>(to)];
+}
+
+std::vector<CoreId>
+CpuTopology::spread(CoreIdSet const &within, std::size_t const count) const {
+    // Physical cores of `within`, grouped by L3 domain: {package, l3} -> {package, core} -> threads.
+    std::map<std::pair<int, int>, std::map<std::pair<int, int>, std::vector<CoreId>>> domains;
+    std::vector<CoreId>                                                                 offline;
+    for (const auto id : within) {
+        if (auto const *info = find(id))
+            domains[{info->package, info->l3}][{info->package, info->core}].push_back(id);
+        else
+            offline.push_back(id);
+    }
+    // Round r takes the r-th thread of each physical core; within a round, cores alternate
+    // between domains so consecutive placements land on different L3s.
+    std::vector<std::vector<std::vector<CoreId> const *>> per_domain;
+    std::size_t                                           max_threads = 0;
+    for (auto const &cores : domains | std::views::values) {
+        auto &list = per_domain.emplace_back();
+        for (auto const &threads : cores | std::views::values) {
+            list.push_back(&threads);
+            max_threads = (std::max)(max_threads, threads.size());
+        }
+    }
+    std::vector<CoreId> order;
+    order.reserve(within.size());
+    for (std::size_t round = 0; round < max_threads; ++round) {
+        for (std::size_t i = 0;; ++i) {
+            bool any = false;
+            for (auto const &list : per_domain) {
+                if (i >= list.size())
+                    continue;
+                any = true;
+                if (round < list[i]->size())
+                    order.push_back((*list[i])[round]);
+            }
+            if (!any)
+                break;
+        }
+    }
+    order.insert(order.end(), offline.begin(), offline.end());
+
+    std::vector<CoreId> out;
+    if (order.empty())
+        return out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        out.push_back(order[i % order.size()]);
+    return out;
+}
+
+#if defined(__linux__)
+namespace {
+constexpr std::size_t kMaxNodes = 1024;
+using NodeMask                  = std::array<unsigned long, kMaxNodes / (8 * sizeof(unsigned long))>;
+
+bool
+node_mask(int const node, NodeMask &mask) noexcept {
+    if (node < 0 || static_cast<std::size_t>(node) >= kMaxNodes)
+        return false;
+    mask.fill(0);
+    mask[static_cast<std::size_t>(node) / (8 * sizeof(unsigned long))] |= 1ul << (static_cast<std::size_t>(node) % (8 * sizeof(unsigned long)));
+    return true;
+}
+} // namespace
+
+bool
+CpuTopology::bindMemory(void *const addr, std::size_t const bytes, int const node) noexcept {
+    NodeMask mask;
+    if (!addr || !bytes || !node_mask(node, mask))
+        return false;
+    // mbind works on whole pages: widen the range to the pages it touches.
+    const auto page  = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<std::uintptr_t>(addr) & ~(page - 1);
+    const auto end   = (reinterpret_cast<std::uintptr_t>(addr) + bytes + page - 1) & ~(page - 1);
+    return ::syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED, mask.data(), kMaxNodes, MPOL_MF_MOVE) == 0;
+}
+
+bool
+CpuTopology::preferNode(int const node) noexcept {
+    NodeMask mask;
+    if (!node_mask(node, mask))
+        return false;
+    return ::syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), kMaxNodes) == 0;
+}
+#else
+bool
+CpuTopology::bindMemory(void *, std::size_t, int) noexcept {
+    return false;
+}
+
+bool
+CpuTopology::preferNode(int) noexcept {
+    return false;
+}
+#endif
+// !CpuTopology
+
+} // namespace qb
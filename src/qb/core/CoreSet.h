@@ -36,6 +36,7 @@
 #include <cstdint>
 #include <qb/system/container/unordered_set.h>
 #include <qb/utility/type_traits.h>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -44,6 +45,86 @@
 
 namespace qb {
 
+/*!
+ * @struct CpuInfo
+ * @ingroup Engine
+ * @brief Where one logical CPU sits: NUMA node, socket, physical core and L3 domain.
+ */
+struct CpuInfo {
+    CoreId cpu     = 0;
+    int    node    = 0;  ///< NUMA node
+    int    package = 0;  ///< socket (`physical_package_id`)
+    int    core    = 0;  ///< physical core within the package; SMT siblings share it
+    int    l3      = -1; ///< L3 domain id, -1 when the CPU reports no L3
+};
+
+/*!
+ * @class CpuTopology core/CoreSet.h qb/coreset.h
+ * @ingroup Engine
+ * @brief The host's CPU layout, read from sysfs: NUMA nodes, sockets, L3 domains, SMT siblings.
+ * @details
+ * `discover()` reads `<root>/cpu/online`, `<root>/cpu/cpuN/topology/`, the level-3 entry of
+ * `<root>/cpu/cpuN/cache/` and `<root>/node/nodeN/{cpulist,distance}`; `root` is
+ * `/sys/devices/system` on a live host. A file it cannot read leaves the defaults: one node, one
+ * package, one physical core per CPU. On a host without sysfs that is the whole answer, with
+ * `std::thread::hardware_concurrency()` CPUs.
+ *
+ * The engine pins VirtualCore `N` to CPU `N` unless told otherwise
+ * (`CoreInitializer::setAffinity()`), so a `CoreId` is looked up here as a CPU number.
+ *
+ * ```cpp
+ * auto const &topo = qb::CoreSet::topology();
+ * // four workers on node 0, one per physical core before any SMT sibling
+ * main.spreadActors<Worker>(topo.nodeCores(0), 4);
+ * ```
+ */
+class CpuTopology {
+    std::vector<CpuInfo> _cpus;     ///< sorted by `cpu`
+    std::vector<int>     _distance; ///< node SLIT distances, row-major, `_nb_nodes` squared
+    std::size_t          _nb_nodes = 1;
+
+public:
+    /*!
+     * @brief Read the topology under @p root.
+     * @param root The sysfs `devices/system` directory; a test points it at a fake tree.
+     */
+    [[nodiscard]] static CpuTopology discover(std::string const &root = "/sys/devices/system");
+    /// This host's topology, discovered once.
+    [[nodiscard]] static CpuTopology const &host();
+
+    [[nodiscard]] std::vector<CpuInfo> const &cpus() const noexcept;
+    /// @return The CPU's entry, or nullptr if it is not online.
+    [[nodiscard]] CpuInfo const *find(CoreId cpu) const noexcept;
+    /// @return The CPU's NUMA node, or -1 if it is not online.
+    [[nodiscard]] int         nodeOf(CoreId cpu) const noexcept;
+    [[nodiscard]] std::size_t getNbNodes() const noexcept;
+    [[nodiscard]] CoreIdSet   nodeCores(int node) const;
+    [[nodiscard]] CoreIdSet   packageCores(int package) const;
+    /// CPUs sharing @p cpu's L3, itself included (just itself without an L3).
+    [[nodiscard]] CoreIdSet l3Cores(CoreId cpu) const;
+    /// SMT siblings of @p cpu, itself included.
+    [[nodiscard]] CoreIdSet siblings(CoreId cpu) const;
+    /// Relative memory distance between two nodes (ACPI SLIT: 10 is local), 0 if unknown.
+    [[nodiscard]] int nodeDistance(int from, int to) const noexcept;
+
+    /*!
+     * @brief Order @p count placements over the CPUs of @p within.
+     * @return `count` CPU ids: one per physical core first, alternating L3 domains, then the
+     *         SMT siblings in the same order; wraps around when `count` exceeds the set. Ids of
+     *         @p within that are not online are placed after every online CPU.
+     */
+    [[nodiscard]] std::vector<CoreId> spread(CoreIdSet const &within, std::size_t count) const;
+
+    /*!
+     * @brief Prefer @p node for the pages of `[addr, addr + bytes)`, and move those already
+     *        placed elsewhere (`mbind(MPOL_PREFERRED, MPOL_MF_MOVE)`).
+     * @return `false` off Linux, for a negative node, or if the kernel refused.
+     */
+    static bool bindMemory(void *addr, std::size_t bytes, int node) noexcept;
+    /// Prefer @p node for the calling thread's future allocations (`set_mempolicy`); as `bindMemory`.
+    static bool preferNode(int node) noexcept;
+};
+
 /*!
  * @class CoreSet core/CoreSet.h qb/coreset.h
  * @ingroup Engine
@@ -137,6 +218,21 @@ public:
      * @return Count of distinct `CoreId`s this `CoreSet` covers.
      */
     [[nodiscard]] uint32_t getNbCore() const noexcept;
+
+    /*!
+     * @brief The host's CPU topology (`CpuTopology::host()`).
+     */
+    [[nodiscard]] static CpuTopology const &topology();
+
+    /*!
+     * @brief NUMA node of member core @p id, read as a CPU number; -1 if that CPU is not online.
+     */
+    [[nodiscard]] int nodeOf(CoreId id) const;
+
+    /*!
+     * @brief The member cores that sit on NUMA node @p node.
+     */
+    [[nodiscard]] CoreIdSet onNode(int node) const;
 };
 
 } // namespace qb
@@ -283,6 +283,8 @@ prepare_event_storage([[maybe_unused]] void *const raw, [[maybe_unused]] std::si
     std::memset(raw, 0, bytes);
 #endif
 }
+
+struct packed_bucket;
 } // namespace detail
 
 /**
@@ -340,6 +342,9 @@ class QB_LOCKFREE_CACHELINE_ALIGNMENT Event {
     friend class Pipe;
     friend struct EventQOS0;
     friend struct ServiceEvent;
+    friend struct detail::packed_bucket;
+    friend class Recorder;
+    friend class Replay;
 
 public:
     using id_handler_type = ActorId;
@@ -405,11 +410,12 @@ private:
          *          Inside a struct the `: 16, : 8` padding declarators do their job and place
          *          `alive` at bit 24 — i.e. `prot[3]`, the one byte the default member
          *          initializer below actually encodes (`4` → `qos = 2`, `<< 3` → `factor =
-         *          bucket_bytes / 16`, `alive = 0`). `prot[0..2]` ("qb\0") stays an untouched
-         *          magic for the whole life of the event.
+         *          bucket_bytes / 16`, `alive = 0`). `owning`, `compact`, `packed`, `lane` and
+         *          `multicast` are the upper bits of `prot[2]`, zero in the "qb\0" magic: see
+         *          `is_priority_event`, `multicast_footer`, `packed_bucket`, `Recorder`.
          */
         struct {
-            uint32_t : 16, : 8, alive : 1, qos : 2, factor : 5;
+            uint32_t : 16, : 2, owning : 1, compact : 2, packed : 1, multicast : 1, lane : 1, alive : 1, qos : 2, factor : 5;
         } bits;
         uint8_t prot[4] = {'q', 'b', '\0', 4 | ((QB_LOCKFREE_EVENT_BUCKET_BYTES / 16) << 3)};
     } state;
@@ -493,7 +499,7 @@ event_type_name(Event::id_type const id) noexcept {
  * @brief An alias OF `qb::Event`, not a distinct type — and QoS is a drop policy, not a dispatch priority.
  * @details `qb::Event`'s own header already encodes `qos = 2` (:414), so this names the base class itself. The field is
  * read in exactly ONE place and as a BINARY gate: the cross-core flush drops a `qos == 0` event on backpressure and
- * retries every other one (`VirtualCore.cpp:348`). Events drain FIFO whatever their QoS; nothing is processed "before".
+ * retries every other one (`VirtualCore.cpp:348`). QoS orders nothing; dispatch priority is `qb::is_priority_event`.
  * @ingroup EventCore
  */
 using EventQOS2 = Event;
@@ -631,6 +637,22 @@ struct RequireEvent : public CorrelatedEvent {
     }
 };
 
+/*!
+ * @struct MigratedEvent
+ * @ingroup EventCore
+ * @brief Outcome of an `Actor::migrate()` request, delivered to the actor that issued it.
+ * @details `origin` is the id the request named; `migrated` is the id the actor now runs
+ *          under on the destination core, or `ActorId::NotFound` if the migration was refused
+ *          or the re-creation failed. `busy` marks a refusal that only holds for now (the
+ *          actor is still activating or has coroutines in flight): the same request may
+ *          succeed later. The requester must register this event to receive it.
+ */
+struct MigratedEvent : public Event {
+    ActorId origin;
+    ActorId migrated;
+    bool    busy = false; ///< refused for now only; a retry may succeed
+};
+
 /*!
  * @struct WithData
  * @ingroup EventCore
@@ -727,6 +749,8 @@ using service_event = ServiceEvent;
 // block, so no line of this header moves: Event.h carries cited anchors at :61, :314, :321,
 // :344 and :376, and an insertion higher up would shift all of them.
 // ============================================================================================
+#include <cstddef>
+#include <new>
 #include <type_traits>
 
 namespace qb {
@@ -739,6 +763,33 @@ namespace qb {
 template <typename T>
 concept service_event_type = std::is_base_of_v<ServiceEvent, T>;
 
+/**
+ * @brief Opt-in dispatch priority: specialise to `std::true_type` to send `T` through the priority lane.
+ * @ingroup EventCore
+ * @details QoS decides what may be dropped; this decides what goes first. A priority event is
+ *          written to a separate outbound pipe, crosses cores in a separate ring per sender, and
+ *          the receiving core drains those lanes before the normal ones and again between normal
+ *          batches (bounded per loop pass, so a priority flood cannot starve normal traffic).
+ *          Meant for control-plane events — kill, reload, health checks — that must not queue
+ *          behind a data-plane burst.
+ *
+ *          Ordering is kept WITHIN a lane: `push` stays FIFO from one source to one destination
+ *          among priority events, and among normal ones. A priority event MAY overtake normal
+ *          events pushed before it. The lane is stamped in the header by `Actor::push` / `send` /
+ *          `broadcast`, so `reply()` and `forward()` keep it; an event written through an
+ *          explicit `getPipe()` handle travels in the normal lane.
+ * @code
+ * struct ReloadConfig : qb::Event {};
+ * template <>
+ * struct qb::is_priority_event<ReloadConfig> : std::true_type {};
+ * @endcode
+ */
+template <typename T>
+struct is_priority_event : std::false_type {};
+
+template <typename T>
+inline constexpr bool is_priority_event_v = is_priority_event<std::remove_cvref_t<T>>::value;
+
 namespace detail {
 
 // ============================================================================================
@@ -911,6 +962,142 @@ routing_safe_type_id() noexcept {
     return Event::type_to_id<T>();
 }
 
+/**
+ * @brief Closes the bucket run of a multicast copy (`Actor::multicast`).
+ * @details One copy of the event goes to each destination core. Its run is laid out as the
+ *          event, padding, `count` destination `ServiceId`s, then this footer, so the receiving
+ *          core finds the list from `getSize()` alone; the header carries `state.bits.multicast`.
+ *          `clone` copy-constructs the payload into `buckets` fresh buckets: it gives one
+ *          destination an event of its own (`reply`, `forward`, an Activating or migrated
+ *          target) while the others keep sharing the copy.
+ */
+struct multicast_footer {
+    void (*clone)(Event const &from, void *to) noexcept;
+    uint16_t buckets; ///< Unicast size of the payload.
+    uint16_t count;   ///< Destination sids preceding the footer.
+
+    [[nodiscard]] static multicast_footer const &
+    of(Event const &event) noexcept {
+        return *reinterpret_cast<multicast_footer const *>(reinterpret_cast<std::byte const *>(&event) + event.getSize() -
+                                                           sizeof(multicast_footer));
+    }
+    [[nodiscard]] ServiceId const *
+    sids() const noexcept {
+        return reinterpret_cast<ServiceId const *>(this) - count;
+    }
+};
+
+/// `multicast_footer::clone` for `T`: the header is copied with the payload.
+template <typename T>
+void
+multicast_clone(Event const &from, void *to) noexcept {
+    new (to) T(static_cast<T const &>(from));
+}
+
+/// `T` standing in a `[[no_unique_address]]` member, followed by @p Spare bytes.
+template <typename T, std::size_t Spare>
+struct event_tail_probe {
+    [[no_unique_address]] T event;
+    unsigned char           spare[Spare];
+};
+
+/**
+ * @brief Several small events sharing one bucket of a mailbox ring.
+ * @details An event's `sizeof` is a whole number of buckets, but a derived event's members start
+ *          right after the 16-byte header, in the base's tail padding, so a notification with a
+ *          few bytes of payload fills a quarter or half of its single bucket. `fill_event` stores
+ *          that footprint, in `slots`, in `state.bits.compact`. When two or more such events
+ *          follow one another in an outbound pipe, `__flush_pipes__` copies their used slots
+ *          back to back into one bucket and sends that instead; each copied header carries
+ *          `state.bits.packed`, and zeroed slots close the bucket. The receiver rebuilds each
+ *          event in an aligned bucket of its own, zero-filled past its footprint, and
+ *          dispatches it from there. The pipes still hold one bucket per event: they are
+ *          written in place by `push`, which returns a reference the caller may keep writing.
+ *
+ *          The footprint is measured, not declared: `T` leaves `n` bytes of tail padding when a
+ *          `[[no_unique_address]]` member of type `T` followed by `n` bytes is no larger than
+ *          `T`. A compiler that ignores the attribute (MSVC) reports none, and nothing is packed.
+ */
+#ifndef NDEBUG
+/**
+ * @brief Debug guard of cross-core delivery: log and assert if @p event holds a pointer into its
+ *        own storage, which a `memcpy` relocation would leave dangling (see Main.cpp).
+ * @details `SharedCoreCommunication::send` runs it on what it enqueues, and `packed_bucket::pack`
+ *          on each event it copies: a packed bucket no longer holds the events' own bytes.
+ */
+void check_relocatable(Event const &event) noexcept;
+#endif
+
+struct packed_bucket {
+    static constexpr std::size_t slots      = 4;
+    static constexpr std::size_t slot_bytes = QB_LOCKFREE_EVENT_BUCKET_BYTES / slots;
+    static_assert(slot_bytes >= 16, "a slot must hold an event header");
+
+    /// Slots a `T` occupies when packed: 1 to `slots - 1`, or 0 when it does not gain from it.
+    template <typename T>
+    [[nodiscard]] static constexpr std::uint8_t
+    width() noexcept {
+        if constexpr (sizeof(T) != QB_LOCKFREE_EVENT_BUCKET_BYTES)
+            return 0;
+        else if constexpr (sizeof(event_tail_probe<T, (slots - 1) * slot_bytes>) == sizeof(T))
+            return 1;
+        else if constexpr (sizeof(event_tail_probe<T, (slots - 2) * slot_bytes>) == sizeof(T))
+            return 2;
+        else if constexpr (sizeof(event_tail_probe<T, (slots - 3) * slot_bytes>) == sizeof(T))
+            return 3;
+        else
+            return 0;
+    }
+
+    /**
+     * @brief Copy the packable events at the head of `[first, last)` into @p out.
+     * @return How many were packed. Fewer than two leaves nothing worth sending as a pack.
+     */
+    static std::size_t
+    pack(EventBucket &out, EventBucket const *first, EventBucket const *const last) noexcept {
+        auto *const bytes = reinterpret_cast<unsigned char *>(&out);
+        std::size_t used  = 0;
+        std::size_t count = 0;
+        for (; first < last; ++first, ++count) {
+            auto const       &event = *reinterpret_cast<Event const *>(first);
+            const std::size_t span  = event.state.bits.compact;
+            if (!span || event.bucket_size != 1 || event.state.bits.multicast || used + span > slots)
+                break;
+#ifndef NDEBUG
+            check_relocatable(event);
+#endif
+            std::memcpy(bytes + used * slot_bytes, first, span * slot_bytes);
+            // The copy is not bucket-aligned: mark its header word through a value.
+            auto header        = event.state;
+            header.bits.packed = 1;
+            std::memcpy(bytes + used * slot_bytes, &header, sizeof(header));
+            used += span;
+        }
+        std::memset(bytes + used * slot_bytes, 0, (slots - used) * slot_bytes);
+        return count;
+    }
+
+    /// Rebuild each event of @p in, in turn, in @p scratch and hand it to @p func.
+    template <typename Func>
+    static void
+    unpack(EventBucket const &in, EventBucket &scratch, Func const &func) {
+        auto const *const bytes = reinterpret_cast<unsigned char const *>(&in);
+        for (std::size_t used = 0; used < slots;) {
+            decltype(Event::state) header;
+            std::memcpy(&header, bytes + used * slot_bytes, sizeof(header));
+            const std::size_t span = header.bits.compact;
+            if (!header.bits.packed || !span || used + span > slots)
+                break;
+            std::memcpy(&scratch, bytes + used * slot_bytes, span * slot_bytes);
+            std::memset(reinterpret_cast<unsigned char *>(&scratch) + span * slot_bytes, 0, (slots - span) * slot_bytes);
+            auto &event             = *reinterpret_cast<Event *>(&scratch);
+            event.state.bits.packed = 0;
+            func(event);
+            used += span;
+        }
+    }
+};
+
 } // namespace detail
 
 } // namespace qb
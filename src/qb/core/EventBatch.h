@@ -0,0 +1,140 @@
+/**
+ * @file qb/core/EventBatch.h
+ * @brief Batched construction of same-type events bound for one destination core.
+ *
+ * `Actor::push<E>()` pays, per event, one `allocate_back` on the outbound `VirtualPipe` (capacity
+ * check, possible compaction or growth), one bucket-size computation, the debug zeroing of
+ * `detail::prepare_event_storage` and the disposer registration of `router::ensure_disposer`.
+ * A fan-out of N copies of one event type to actors on one core pays all of it N times, although
+ * the N events end up contiguous in the same pipe anyway.
+ *
+ * An `EventBatch<E>` opened with `Actor::batch<E>(core, n)` reserves room for `n` events in that
+ * core's pipe with ONE `allocate_back`, and each `push(dest, args...)` then only placement-news
+ * the next event into the reservation and fills its header. `commit()` (or the destructor) hands
+ * back the unused tail of the reservation; the flush at the end of the loop pass then enqueues
+ * the whole run into the destination mailbox, as it does for any pipe content.
+ *
+ * Ordering is that of `push()`: the batch writes the same pipe, in call order.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_EVENT_BATCH_H
+#define QB_CORE_EVENT_BATCH_H
+#include <cstddef>
+#include <type_traits>
+#include "ActorId.h"
+#include "Event.h"
+#include "SharedSlab.h"
+
+namespace qb {
+
+/*!
+ * @class EventBatch
+ * @ingroup PipeCore
+ * @brief Scoped builder that constructs many `_Event`s into one reservation of a core's pipe.
+ * @tparam _Event Event type of every event in the batch.
+ *
+ * @details
+ * Obtained from `Actor::batch<_Event>(core, n)`; never constructed directly. `n` is a hint:
+ * pushing more than `n` events reserves another run the size of the batch so far, so the number
+ * of pipe reservations stays logarithmic in the batch size.
+ *
+ * @code
+ * // Fan one tick out to every subscriber on this core.
+ * auto out = batch<PriceTick>(getIndex(), subscribers.size());
+ * for (auto const s : subscribers)
+ *     out.push(s, symbol, price);
+ * // committed when `out` goes out of scope
+ * @endcode
+ *
+ * @attention **Nothing else may be queued to the batch's core while the batch is open** — no
+ *            `push`/`send`/`broadcast`/`reply`/`forward` whose destination lives on that core,
+ *            from this actor or from any other actor called synchronously. The reservation is a
+ *            raw range of the pipe, and the next event queued to it lands after the
+ *            reservation, or compacts or regrows the buffer under it. This is the contract of
+ *            the reference `push()` returns, stretched over the batch's lifetime. Keep the batch
+ *            in one scope and commit it before the handler returns: the flush runs after the
+ *            handler and sends the pipe as it finds it.
+ *
+ * A `push()` whose destination lives on another core, and every push of an event large enough
+ * to cross cores by `SharedSlab` (`kSharedEventMinBuckets`), is forwarded to the plain
+ * `push()` path and is not batched.
+ *
+ * @see Actor::batch
+ * @see Actor::push
+ */
+template <typename _Event>
+class EventBatch {
+    friend class VirtualCore;
+
+    VirtualPipe *_pipe;
+    EventBucket *_next = nullptr; ///< Where the next event is built.
+    EventBucket *_end  = nullptr; ///< End of the current reservation; `_next == _end` when full.
+    ActorId      _source;
+    CoreId       _core;
+    std::size_t  _count = 0;
+
+    EventBatch(VirtualPipe &pipe, CoreId core, ActorId source, std::size_t reserve) noexcept;
+    void reserve(std::size_t events) noexcept;
+
+public:
+    /// Buckets taken by one `_Event` in the pipe.
+    static constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<_Event, EventBucket>();
+    /// False when every push is left to `Actor::push()` (shared-slab sized events).
+    static constexpr bool batched = BUCKET_SIZE < kSharedEventMinBuckets || std::is_base_of_v<EventQOS0, _Event>;
+
+    EventBatch()                              = delete;
+    EventBatch(EventBatch const &)            = delete;
+    EventBatch &operator=(EventBatch const &) = delete;
+    ~EventBatch() noexcept {
+        commit();
+    }
+
+    /*!
+     * @brief Construct the next event of the batch for `dest`.
+     * @param dest Destination actor; expected on the batch's core.
+     * @param args Arguments forwarded to the `_Event` constructor.
+     * @return Mutable reference to the event in the pipe. Unlike `Actor::push()`'s, it stays
+     *         valid across later pushes of the same batch that fit the current reservation —
+     *         but not across the one that opens the next reservation, nor past `commit()`.
+     */
+    template <typename... _Args>
+    _Event &push(ActorId dest, _Args &&...args) noexcept;
+
+    /*!
+     * @brief Close the batch: hand the unused part of the reservation back to the pipe.
+     * @details Idempotent; the destructor calls it. A `push()` after `commit()` opens a new
+     *          reservation of the batch's size so far.
+     */
+    void commit() noexcept;
+
+    /// Number of events pushed so far.
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _count;
+    }
+
+    /// Core whose pipe the batch writes.
+    [[nodiscard]] CoreId
+    core() const noexcept {
+        return _core;
+    }
+};
+
+} // namespace qb
+
+#endif // QB_CORE_EVENT_BATCH_H
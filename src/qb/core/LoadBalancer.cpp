@@ -0,0 +1,187 @@
+/**
+ * @file qb/core/LoadBalancer.cpp
+ * @brief Implementation of the `qb::LoadBalancer` engine service.
+ *
+ * Sampling reads the owning core's `VirtualCore::LoadSampler` (friend access, same thread);
+ * decisions are plain `Actor::migrate()` calls issued by the coordinator instance.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <algorithm>
+#include <qb/core/LoadBalancer.h>
+#include <qb/core/VirtualCore.h>
+
+namespace qb {
+
+LoadBalancer::LoadBalancer(LoadBalancerPolicy const policy) noexcept
+    : _policy(policy) {}
+
+LoadBalancer::~LoadBalancer() noexcept {
+    // Hand the core back its hot path: the sampler hooks are skipped again from the next pass.
+    auto &load   = VirtualCore::_handler->_load;
+    load.enabled = false;
+    load.reset();
+}
+
+qb::io::async::task<bool>
+LoadBalancer::onInit() {
+    if (!getCoreSet().contains(_policy.coordinator)) {
+        QB_LOG_CRIT(*this << " coordinator core " << _policy.coordinator << " is not part of the engine");
+        co_return false;
+    }
+    VirtualCore::_handler->_load.enabled = true;
+    _next_tick_ns                        = time() + static_cast<std::uint64_t>(std::chrono::nanoseconds(_policy.interval).count());
+    registerEvent<ReportEvent>(*this);
+    registerEvent<MigratedEvent>(*this);
+    registerCallback(*this);
+    co_return true;
+}
+
+CoreLoadSample
+LoadBalancer::sample() noexcept {
+    auto          &core = *VirtualCore::_handler;
+    auto          &load = core._load;
+    CoreLoadSample out;
+    out.core       = core.getIndex();
+    out.busy_ratio = load.window_ns ? static_cast<float>(static_cast<double>(load.busy_ns) / static_cast<double>(load.window_ns)) : 0.f;
+    out.events     = load.events;
+
+    // Keep the kMaxCandidates heaviest plain actors, heaviest first. Services never move, so
+    // they are not candidates (this instance included).
+    const auto nb_service = VirtualCore::_nb_service.load(std::memory_order_relaxed);
+    auto      &top        = out.candidates;
+    for (auto const &slot : core._actors.slots()) {
+        const auto id  = slot.id;
+        const auto sid = id.sid();
+        if (!slot.actor || sid <= nb_service || sid >= load.per_sid.size() || !slot.actor->is_alive())
+            continue;
+        const auto events = load.per_sid[sid];
+        if (events == 0u)
+            continue;
+        std::size_t pos = out.nb_candidates;
+        while (pos > 0 && top[pos - 1].events < events)
+            --pos;
+        if (pos >= CoreLoadSample::kMaxCandidates)
+            continue;
+        const auto last = std::min<std::size_t>(out.nb_candidates, CoreLoadSample::kMaxCandidates - 1);
+        std::move_backward(top.begin() + static_cast<std::ptrdiff_t>(pos), top.begin() + static_cast<std::ptrdiff_t>(last),
+                           top.begin() + static_cast<std::ptrdiff_t>(last + 1));
+        top[pos] = {id, events};
+        if (out.nb_candidates < CoreLoadSample::kMaxCandidates)
+            ++out.nb_candidates;
+    }
+    load.reset();
+    return out;
+}
+
+void
+LoadBalancer::on(LoopEvent const &loop) {
+    if (loop.now < _next_tick_ns)
+        return;
+    _next_tick_ns = loop.now + static_cast<std::uint64_t>(std::chrono::nanoseconds(_policy.interval).count());
+    const auto current = sample();
+    if (getIndex() == _policy.coordinator) {
+        _reports[current.core] = {current, true};
+        decide();
+    } else
+        push<ReportEvent>(getServiceId<LoadBalancerTag>(_policy.coordinator)).sample = current;
+}
+
+void
+LoadBalancer::on(ReportEvent const &event) noexcept {
+    _reports[event.sample.core] = {event.sample, true};
+}
+
+void
+LoadBalancer::on(MigratedEvent const &event) noexcept {
+    if (event.migrated.is_valid()) {
+        ++_stats.moved;
+        _resident[event.migrated] = time() + static_cast<std::uint64_t>(std::chrono::nanoseconds(_policy.min_residence).count());
+    } else if (event.busy) {
+        // Activating or awaiting coroutines: leave it be for a residence period, then retry.
+        ++_stats.refused;
+        _resident[event.origin] = time() + static_cast<std::uint64_t>(std::chrono::nanoseconds(_policy.min_residence).count());
+    } else {
+        // Not opted in, pinned or lost: stop proposing it.
+        ++_stats.refused;
+        _refused.insert(event.origin);
+    }
+    if (_in_flight && --_in_flight == 0)
+        _cooldown = _policy.cooldown;
+}
+
+void
+LoadBalancer::decide() noexcept {
+    if (_in_flight)
+        return;
+    if (_cooldown) {
+        --_cooldown;
+        return;
+    }
+
+    Report *hot  = nullptr;
+    Report *cold = nullptr;
+    for (auto &[core, report] : _reports) {
+        if (!report.fresh)
+            continue;
+        const auto ratio = static_cast<double>(report.sample.busy_ratio);
+        if (ratio >= _policy.hot_ratio && (!hot || report.sample.busy_ratio > hot->sample.busy_ratio))
+            hot = &report;
+        if (ratio <= _policy.cold_ratio && (!cold || report.sample.busy_ratio < cold->sample.busy_ratio))
+            cold = &report;
+    }
+    // Forget refused ids no report lists anymore: the actor is gone, and its SID may come back
+    // as a newcomer that deserves a fresh chance.
+    for (auto it = _refused.begin(); it != _refused.end();) {
+        const bool listed = std::ranges::any_of(_reports, [id = *it](auto const &entry) {
+            auto const &s = entry.second.sample;
+            return std::any_of(s.candidates.begin(), s.candidates.begin() + s.nb_candidates, [id](auto const &c) { return c.id == id; });
+        });
+        it = listed ? std::next(it) : _refused.erase(it);
+    }
+    for (auto it = _resident.begin(); it != _resident.end();)
+        it = it->second <= time() ? _resident.erase(it) : std::next(it);
+    for (auto &[core, report] : _reports)
+        report.fresh = false;
+    if (!hot || !cold || hot == cold)
+        return;
+
+    auto const &candidates = hot->sample.candidates;
+    const auto  end        = candidates.begin() + hot->sample.nb_candidates;
+    const auto  movable    = static_cast<std::size_t>(std::count_if(candidates.begin(), end, [this](auto const &c) { return !_refused.count(c.id); }));
+    if (movable < 2u)
+        return; // its only loaded actor: moving it would just move the hotspot
+    auto budget = std::min(_policy.max_moves, movable - 1u);
+    for (auto it = candidates.begin(); it != end && budget; ++it) {
+        if (_refused.count(it->id) || _resident.count(it->id))
+            continue;
+        QB_LOG_INFO(*this << " moving " << it->id << " (" << it->events << " events) from core " << hot->sample.core << " ("
+                          << hot->sample.busy_ratio << ") to core " << cold->sample.core << " (" << cold->sample.busy_ratio << ')');
+        migrate(it->id, cold->sample.core);
+        ++_in_flight;
+        --budget;
+    }
+    if (_in_flight)
+        ++_stats.decisions;
+}
+
+LoadBalancer::Stats const &
+LoadBalancer::stats() const noexcept {
+    return _stats;
+}
+
+} // namespace qb
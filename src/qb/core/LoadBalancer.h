@@ -0,0 +1,167 @@
+/**
+ * @file qb/core/LoadBalancer.h
+ * @brief Optional engine service that moves hot actors from saturated cores to idle ones.
+ *
+ * Placement chosen before `Main::start()` is otherwise frozen: a skewed workload leaves one
+ * core at 100 % while its peers sleep in `_mail_box.wait()`. `qb::LoadBalancer` is a
+ * `ServiceActor` — one instance per core — that samples its own core's busy ratio and
+ * per-actor event counts (`VirtualCore::LoadSampler`, off unless a balancer runs on the core),
+ * reports them to a coordinator instance, and has the coordinator `migrate()` the heaviest
+ * movable actors of the busiest core to the idlest one according to a `LoadBalancerPolicy`.
+ *
+ * Only actors that opt in through `Actor::onMigrate()` ever move; a refused candidate is
+ * remembered and skipped. Services never move.
+ *
+ * @code
+ * qb::LoadBalancerPolicy policy;
+ * policy.interval = std::chrono::milliseconds{50};
+ * for (qb::CoreId core = 0; core < 4; ++core)
+ *     main.addActor<qb::LoadBalancer>(core, policy); // one per balanced core, same policy
+ * @endcode
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_LOAD_BALANCER_H
+#define QB_CORE_LOAD_BALANCER_H
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <qb/system/container/unordered_map.h>
+#include <qb/system/container/unordered_set.h>
+#include "Actor.h"
+#include "ICallback.h"
+
+namespace qb {
+
+/**
+ * @struct LoadBalancerPolicy
+ * @ingroup Core
+ * @brief When the balancer samples, what it calls hot and cold, and how much it may move.
+ * @details Give every instance the same policy; only the coordinator's copy drives decisions.
+ */
+struct LoadBalancerPolicy {
+    /// Sampling period of every instance; the coordinator decides once per period.
+    std::chrono::milliseconds interval{100};
+    /// A core whose busy ratio is at least this is saturated and may give actors away.
+    double hot_ratio = 0.85;
+    /// A core whose busy ratio is at most this may receive actors.
+    double cold_ratio = 0.50;
+    /// Actors moved per decision. The busiest core always keeps at least one loaded actor:
+    /// moving its only hot actor would just move the hotspot.
+    std::size_t max_moves = 1;
+    /// Decisions skipped after a round of moves, so the next samples reflect the new placement.
+    unsigned cooldown = 2;
+    /// Time a moved actor stays on its new core before it may be moved again, so an actor
+    /// cannot bounce between two cores that both sit near the thresholds.
+    std::chrono::milliseconds min_residence{5000};
+    /// Core hosting the coordinator instance; it must run a `LoadBalancer` too.
+    CoreId coordinator = 0;
+};
+
+/**
+ * @struct CoreLoadSample
+ * @ingroup Core
+ * @brief One core's load over one sampling period, as reported to the coordinator.
+ */
+struct CoreLoadSample {
+    static constexpr std::size_t kMaxCandidates = 8;
+    struct Candidate {
+        ActorId       id;
+        std::uint32_t events = 0; ///< unicast events routed to it during the period
+    };
+    CoreId                                core          = 0;
+    float                                 busy_ratio    = 0.f; ///< 0..1, see `VirtualCore::LoadSampler`
+    std::uint64_t                         events        = 0;   ///< unicast events routed on the core
+    std::uint8_t                          nb_candidates = 0;   ///< heaviest first
+    std::array<Candidate, kMaxCandidates> candidates{};
+};
+
+/**
+ * @struct LoadBalancerTag
+ * @ingroup Core
+ * @brief Service tag of `qb::LoadBalancer`.
+ */
+struct LoadBalancerTag {};
+
+/**
+ * @class LoadBalancer
+ * @ingroup Core
+ * @brief Per-core load sampler; the instance on `policy.coordinator` also decides migrations.
+ * @details Every `interval`, each instance reads and resets its core's `LoadSampler` and sends
+ *          the resulting `CoreLoadSample` to the coordinator. On its own tick the coordinator
+ *          takes the busiest reported core at or above `hot_ratio` and the idlest one at or
+ *          below `cold_ratio`, and migrates up to `max_moves` of the hot core's heaviest
+ *          candidates there. It waits for every `MigratedEvent` and then `cooldown` periods
+ *          before deciding again, and leaves a moved actor where it is for `min_residence`.
+ *          A candidate refused for good (not opted in, pinned or gone) is never proposed
+ *          again; one that was only busy (`MigratedEvent::busy`) is retried after
+ *          `min_residence`. The sampler hooks cost one predictable branch per routed event
+ *          and two per loop pass on a core that runs a balancer, nothing elsewhere.
+ */
+class LoadBalancer final
+    : public ServiceActor<LoadBalancerTag>
+    , public ICallback {
+public:
+    /// Coordinator-side counters, readable from the coordinator's core.
+    struct Stats {
+        std::uint64_t decisions = 0; ///< rounds that issued at least one migration
+        std::uint64_t moved     = 0; ///< migrations that settled on the destination
+        std::uint64_t refused   = 0; ///< candidates that refused (for good or busy) or failed
+    };
+
+    explicit LoadBalancer(LoadBalancerPolicy policy = {}) noexcept;
+    ~LoadBalancer() noexcept final;
+
+    qb::io::async::task<bool> onInit() final;
+    void                      on(LoopEvent const &loop) final;
+
+    struct ReportEvent;
+    void on(ReportEvent const &event) noexcept;
+    void on(MigratedEvent const &event) noexcept;
+
+    [[nodiscard]] Stats const &stats() const noexcept;
+
+private:
+    struct Report {
+        CoreLoadSample sample;
+        bool           fresh = false;
+    };
+
+    [[nodiscard]] CoreLoadSample sample() noexcept;
+    void                         decide() noexcept;
+
+    const LoadBalancerPolicy                  _policy;
+    std::uint64_t                             _next_tick_ns = 0;
+    qb::unordered_map<CoreId, Report>         _reports;  ///< coordinator only: latest sample per core
+    qb::unordered_set<ActorId>                _refused;  ///< coordinator only: candidates never to retry
+    qb::unordered_map<ActorId, std::uint64_t> _resident; ///< coordinator only: moved or busy ids, until when they stay
+    std::size_t                               _in_flight = 0;
+    unsigned                                  _cooldown  = 0;
+    Stats                                     _stats;
+};
+
+/**
+ * @struct LoadBalancer::ReportEvent
+ * @brief A `CoreLoadSample` on its way to the coordinator.
+ */
+struct LoadBalancer::ReportEvent : public Event {
+    CoreLoadSample sample;
+};
+
+} // namespace qb
+
+#endif // QB_CORE_LOAD_BALANCER_H
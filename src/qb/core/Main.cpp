@@ -22,13 +22,23 @@
  * @ingroup Core
  */
 
+#include <algorithm>
 #include <cassert>
 #include <csignal>
 #include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <string>
 #include <qb/core/Main.h>
 #include <qb/core/VirtualCore.h>
 #include <qb/io/async/listener.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace qb {
 
@@ -41,7 +51,13 @@ CoreInitializer::CoreInitializer(CoreId const index)
     // acquire edge before this constructor runs.
     , _next_id(static_cast<ServiceId>(VirtualCore::_nb_service.load(std::memory_order_relaxed) + 1))
     , _affinity{index}
-    , _latency{} {}
+    , _latency{}
+    , _mailbox_capacity(DefaultMailboxCapacity)
+    , _mailbox_mode(MailboxMode::Backpressure)
+    , _idle_wait(IdleWait::Condition)
+    , _idle_policy(IdlePolicy::credit())
+    , _numa_local(false)
+    , _huge_pages(HugePages::Off) {}
 
 CoreInitializer::~CoreInitializer() noexcept {
     clear();
@@ -72,6 +88,48 @@ CoreInitializer::setLatency(qb::duration const latency) noexcept {
     return *this;
 }
 
+CoreInitializer &
+CoreInitializer::setMailboxCapacity(std::size_t const buckets) noexcept {
+    _mailbox_capacity = (std::max)(buckets, MinMailboxCapacity);
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setMailboxMode(MailboxMode const mode) noexcept {
+    _mailbox_mode = mode;
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setIdleWait(IdleWait const wait) noexcept {
+    _idle_wait = wait;
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setIdlePolicy(IdlePolicy const &policy) noexcept {
+    _idle_policy = policy;
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setNumaLocal(bool const local) noexcept {
+    _numa_local = local;
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setHugePages(HugePages const pages) noexcept {
+    _huge_pages = pages;
+    return *this;
+}
+
+CoreInitializer &
+CoreInitializer::setRecording(std::string file) {
+    _recording = std::move(file);
+    return *this;
+}
+
 CoreId
 CoreInitializer::getIndex() const noexcept {
     return _index;
@@ -87,6 +145,41 @@ CoreInitializer::getLatency() const noexcept {
     return _latency;
 }
 
+std::size_t
+CoreInitializer::getMailboxCapacity() const noexcept {
+    return _mailbox_capacity;
+}
+
+MailboxMode
+CoreInitializer::getMailboxMode() const noexcept {
+    return _mailbox_mode;
+}
+
+IdleWait
+CoreInitializer::getIdleWait() const noexcept {
+    return _idle_wait;
+}
+
+IdlePolicy const &
+CoreInitializer::getIdlePolicy() const noexcept {
+    return _idle_policy;
+}
+
+bool
+CoreInitializer::isNumaLocal() const noexcept {
+    return _numa_local;
+}
+
+HugePages
+CoreInitializer::getHugePages() const noexcept {
+    return _huge_pages;
+}
+
+std::string const &
+CoreInitializer::getRecording() const noexcept {
+    return _recording;
+}
+
 // !CoreInitializer
 
 // CoreInitializer::ActorBuilder
@@ -117,20 +210,171 @@ set_from_core_initializers(CoreInitializerMap const &core_initializers) {
     return core_ids;
 }
 
+// SharedCoreCommunication::Mailbox
+SharedCoreCommunication::Mailbox::Mailbox(std::size_t const nb_producer, std::size_t const capacity, MailboxMode const mode,
+                                          qb::duration const latency, IdleWait const idle_wait, HugePages const huge_pages)
+    : _capacity(capacity)
+    , _priority_capacity((std::min)(capacity, CoreInitializer::PriorityMailboxCapacity))
+    , _mode(mode)
+    , _latency(latency)
+    , _huge_pages(huge_pages) {
+    assert(nb_producer > 0 && "a mailbox needs at least one producer lane");
+    // Normal rings, then priority rings, then the receive buffer, end to end in one mapping: the
+    // consumer's sweep walks it in order. Without one, each ring and the buffer come from the heap.
+    EventBucket *next = nullptr;
+    if (huge_pages != HugePages::Off) {
+        const auto buckets = nb_producer * (_capacity + 1 + _priority_capacity + 1) + _capacity;
+        _pages = allocator::page_region(buckets * sizeof(EventBucket), huge_pages == HugePages::Explicit
+                                                                             ? allocator::page_kind::hugetlb
+                                                                             : allocator::page_kind::transparent);
+        next   = _pages.as<EventBucket>();
+    }
+    const auto carve = [&next](std::size_t const buckets) {
+        auto *const slice = next;
+        if (next)
+            next += buckets;
+        return slice;
+    };
+    _lanes.reserve(nb_producer);
+    _priority_lanes.reserve(nb_producer);
+    for (std::size_t i = 0; i < nb_producer; ++i)
+        _lanes.push_back(std::make_unique<Lane>(_capacity, carve(_capacity + 1)));
+    for (std::size_t i = 0; i < nb_producer; ++i)
+        _priority_lanes.push_back(std::make_unique<Lane>(_priority_capacity, carve(_priority_capacity + 1)));
+    if (!(_receive = carve(_capacity))) {
+        _receive_heap = std::make_unique_for_overwrite<EventBucket[]>(_capacity);
+        _receive      = _receive_heap.get();
+    }
+    if (idle_wait != IdleWait::EventLoop)
+        return;
+#if defined(__linux__)
+    _bell_read = _bell_write = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int fds[2];
+    if (::pipe(fds) == 0) {
+        for (const int fd : fds) {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        _bell_read  = fds[0];
+        _bell_write = fds[1];
+    }
+#endif
+    if (_bell_read < 0)
+        QB_LOG_WARN("no doorbell for IdleWait::EventLoop on this platform; the core waits on a condition variable");
+}
+
+SharedCoreCommunication::Mailbox::~Mailbox() noexcept {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    if (_bell_read >= 0)
+        ::close(_bell_read);
+    if (_bell_write >= 0 && _bell_write != _bell_read)
+        ::close(_bell_write);
+#endif
+}
+
+bool
+SharedCoreCommunication::Mailbox::park() noexcept {
+    _parked.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool pending = priority_pending();
+    for (auto const &lane : _lanes)
+        pending = pending || !lane->ring.empty() || lane->overflow.size();
+    if (pending)
+        _parked.store(false, std::memory_order_relaxed);
+    return !pending;
+}
+
+void
+SharedCoreCommunication::Mailbox::ring_doorbell() noexcept {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // A full counter (EAGAIN) already wakes the consumer: nothing to retry.
+    const std::uint64_t one = 1;
+    [[maybe_unused]] const auto written =
+        ::write(_bell_write, &one, _bell_write == _bell_read ? sizeof(one) : std::size_t{1});
+#endif
+}
+
+void
+SharedCoreCommunication::Mailbox::drain_doorbell() noexcept {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    std::uint64_t sink[8];
+    while (::read(_bell_read, sink, sizeof(sink)) > 0) {
+    }
+#endif
+}
+
+void
+SharedCoreCommunication::Mailbox::spill(std::size_t const index, EventBucket const *const buckets, std::size_t const size,
+                                        std::size_t const nb_events, bool const priority) {
+    auto   &target = lane(index, priority);
+    Segment segment{std::make_unique_for_overwrite<EventBucket[]>(size), size};
+    std::memcpy(static_cast<void *>(segment.buckets.get()), buckets, size * sizeof(EventBucket));
+    target.overflow.push(std::move(segment));
+    bump(target.spilled_segments);
+    bump(target.spilled_events, nb_events);
+    bump(target.spilled_buckets, size);
+    if (priority)
+        _priority_posted.fetch_add(1, std::memory_order_release);
+}
+
+bool
+SharedCoreCommunication::Mailbox::bind_memory(int const node) noexcept {
+    bool ok = true;
+    for (auto const *lanes : {&_lanes, &_priority_lanes})
+        for (auto const &lane : *lanes)
+            ok &= CpuTopology::bindMemory(lane->ring.data(), lane->ring.storage_size() * sizeof(EventBucket), node);
+    return ok && CpuTopology::bindMemory(_receive, _capacity * sizeof(EventBucket), node);
+}
+
+MailboxStats
+SharedCoreCommunication::Mailbox::stats() const noexcept {
+    MailboxStats total;
+    for (auto const *lanes : {&_lanes, &_priority_lanes}) {
+        for (auto const &lane : *lanes) {
+            total.backoffs += lane->backoffs.load(std::memory_order_relaxed);
+            total.stalled_flushes += lane->stalled_flushes.load(std::memory_order_relaxed);
+            total.spilled_segments += lane->spilled_segments.load(std::memory_order_relaxed);
+            total.spilled_events += lane->spilled_events.load(std::memory_order_relaxed);
+            total.spilled_buckets += lane->spilled_buckets.load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+// !SharedCoreCommunication::Mailbox
+
 // SharedCoreCommunication
 SharedCoreCommunication::SharedCoreCommunication(CoreInitializerMap const &core_initializers) noexcept
     : _core_set(set_from_core_initializers(core_initializers))
+    , _slabs(_core_set.getSize())
+    , _actor_slabs(_core_set.getSize())
     , _mail_boxes(_core_set.getSize())
+    , _task_queues(_core_set.getSize())
+    , _profilers(kLoopProfiler ? _core_set.getSize() : 0u)
     , _core_stopped(_core_set.getSize()) {
     for (auto &flag : _core_stopped)
         flag.store(false, std::memory_order_relaxed); // no core has stopped yet
     for (const auto &[index, initializer] : core_initializers) {
-        const auto nb_producers               = _core_set.getNbCore();
-        _mail_boxes[_core_set.resolve(index)] = std::make_unique<Mailbox>(nb_producers, initializer.getLatency());
+        const auto nb_producers                = _core_set.getNbCore();
+        _mail_boxes[_core_set.resolve(index)]  = std::make_unique<Mailbox>(nb_producers, initializer.getMailboxCapacity(),
+                                                                           initializer.getMailboxMode(), initializer.getLatency(),
+                                                                           initializer.getIdleWait(), initializer.getHugePages());
+        _slabs[_core_set.resolve(index)]       = std::make_unique<SharedSlab>();
+        _actor_slabs[_core_set.resolve(index)] = std::make_unique<ActorSlab>();
+        _task_queues[_core_set.resolve(index)] = std::make_unique<TaskQueue>();
+        if constexpr (kLoopProfiler)
+            _profilers[_core_set.resolve(index)] = std::make_unique<LoopProfiler>();
     }
 }
 
-SharedCoreCommunication::~SharedCoreCommunication() noexcept = default;
+SharedCoreCommunication::~SharedCoreCommunication() noexcept {
+    // Every core has joined: whatever is still queued will never run. Each group is freed by the
+    // abandon of its last outstanding chunk; one already completed travels in a TaskDoneEvent.
+    detail::pool_job *job = nullptr;
+    for (auto &queue : _task_queues)
+        while (queue && queue->pop(job))
+            job->group->abandon();
+}
 
 #ifndef NDEBUG
 namespace {
@@ -186,11 +430,9 @@ event_points_into_itself(Event const &event) noexcept {
     return false;
 }
 } // namespace
-#endif // !NDEBUG
 
-bool
-SharedCoreCommunication::send(CoreId const source_index, Event const &event) const noexcept {
-#ifndef NDEBUG
+void
+detail::check_relocatable(Event const &event) noexcept {
     if (unlikely(event_points_into_itself(event))) {
         QB_LOG_CRIT("Event[" << qb::event_type_name(event.getID()) << '#' << event.getID() << "] from " << event.getSource() << " to "
                              << event.getDestination()
@@ -203,6 +445,13 @@ SharedCoreCommunication::send(CoreId const source_index, Event const &event) con
                && "qb: event payload is not trivially relocatable (holds a pointer into itself) — "
                   "see the QB_LOG_CRIT above and Actor::push's @warning");
     }
+}
+#endif // !NDEBUG
+
+bool
+SharedCoreCommunication::send(CoreId const source_index, Event const &event) const noexcept {
+#ifndef NDEBUG
+    detail::check_relocatable(event);
 #endif
     // `source_index` MUST be the PHYSICAL core whose thread is calling (the
     // caller's `_resolved_index`), NOT `_core_set.resolve(event.source.index())`.
@@ -212,7 +461,8 @@ SharedCoreCommunication::send(CoreId const source_index, Event const &event) con
     // data race that tears the ring's write index / bucket bytes.
     const CoreId dest_index = _core_set.resolve(event.dest.index());
 
-    if (static_cast<bool>(_mail_boxes[dest_index]->enqueue(source_index, reinterpret_cast<const EventBucket *>(&event), event.bucket_size))) {
+    if (_mail_boxes[dest_index]->enqueue(source_index, reinterpret_cast<const EventBucket *>(&event), event.bucket_size,
+                                         event.state.bits.lane)) {
         _mail_boxes[dest_index]->notify();
         return true;
     }
@@ -225,6 +475,26 @@ SharedCoreCommunication::getMailBox(CoreId const id) const noexcept {
     return *_mail_boxes[_core_set.resolve(id)].get();
 }
 
+SharedSlab &
+SharedCoreCommunication::getSharedSlab(CoreId const id) const noexcept {
+    return *_slabs[_core_set.resolve(id)];
+}
+
+ActorSlab &
+SharedCoreCommunication::getActorSlab(CoreId const id) const noexcept {
+    return *_actor_slabs[_core_set.resolve(id)];
+}
+
+TaskQueue &
+SharedCoreCommunication::getTaskQueue(CoreId const id) const noexcept {
+    return *_task_queues[_core_set.resolve(id)];
+}
+
+LoopProfiler *
+SharedCoreCommunication::getProfiler(CoreId const id) const noexcept {
+    return _profilers.empty() ? nullptr : _profilers[_core_set.resolve(id)].get();
+}
+
 void
 SharedCoreCommunication::dispose_residual_mailbox_events() noexcept {
     // Type-erased disposal through the global static registry shared by every router::memh
@@ -244,24 +514,32 @@ SharedCoreCommunication::dispose_residual_mailbox_events() noexcept {
     // call reinterprets that event's TAIL buckets as a fresh event header and disposes a bogus
     // type. A saturated mailbox (exactly the state this teardown sweep exists for) is guaranteed
     // to wrap. Copying out first yields one contiguous, event-aligned batch per producer ring.
+    // Priority lanes and overflow segments are drained too: `Mailbox::consume_all` covers both.
     router::memh<Event>      disposer;
-    std::vector<EventBucket> scratch(MaxRingEvents);
+    std::vector<EventBucket> scratch;
+    EventBucket              unpacked;
+    const auto               dispose = [&disposer](Event &event) { disposer.dispose(event); };
     for (auto &mb : _mail_boxes) {
         if (!mb)
             continue;
+        scratch.resize(mb->capacity());
         mb->consume_all(
-            [&disposer](EventBucket *buffer, std::size_t const nb_buckets) {
+            [&](EventBucket *buffer, std::size_t const nb_buckets) {
                 std::size_t i = 0;
                 while (i < nb_buckets) {
                     auto      &event = *reinterpret_cast<Event *>(buffer + i);
                     const auto bsz   = event.bucket_size;
                     if (bsz == 0)
                         break; // defensive: malformed event, avoid a zero-stride infinite loop
-                    disposer.dispose(event);
+                    // Several small events in one bucket: each is disposed on its own.
+                    if (event.state.bits.packed)
+                        detail::packed_bucket::unpack(buffer[i], unpacked, dispose);
+                    else
+                        disposer.dispose(event);
                     i += bsz;
                 }
             },
-            scratch.data(), MaxRingEvents);
+            scratch.data(), scratch.size());
     }
 }
 
@@ -309,6 +587,8 @@ Main::start_thread(CoreSpawnerParameter const &params) noexcept {
     // Wire the engine-wide `qb::stop_token` so `__workflow__` can observe
     // cooperative cancellation requests issued via `qb::stop_source`.
     core.__set_stop_token__(params.stop_token);
+    core.__set_idle_policy__(initializer.getIdlePolicy());
+    core.__set_recording__(initializer.getRecording());
     VirtualCore::_handler = &core;
     io::async::init();
 
@@ -335,7 +615,7 @@ Main::start_thread(CoreSpawnerParameter const &params) noexcept {
     try {
         // Init VirtualCore
         auto &core_factory = initializer._actor_factories;
-        if (!core.__init__(initializer.getAffinity())) {
+        if (!core.__init__(initializer.getAffinity(), initializer.isNumaLocal())) {
             QB_LOG_CRIT(core << " Init Failed");
             params.sync_start.store(VirtualCore::Error::BadInit, std::memory_order_release);
         } else if (core_factory.empty()) {
@@ -383,6 +663,24 @@ Main::setLatency(qb::duration const latency) {
         initializer.setLatency(latency);
 }
 
+void
+Main::setNumaLocal(bool const local) {
+    for (auto &initializer : _core_initializers | std::views::values)
+        initializer.setNumaLocal(local);
+}
+
+void
+Main::setHugePages(HugePages const pages) {
+    for (auto &initializer : _core_initializers | std::views::values)
+        initializer.setHugePages(pages);
+}
+
+void
+Main::setRecording(std::string const &directory) {
+    for (auto &[index, initializer] : _core_initializers)
+        initializer.setRecording((std::filesystem::path(directory) / ("core-" + std::to_string(index) + ".qbrec")).string());
+}
+
 qb::CoreIdSet
 Main::usedCoreSet() const {
     qb::CoreIdSet ret;
@@ -391,6 +689,21 @@ Main::usedCoreSet() const {
     return ret;
 }
 
+MailboxStats
+Main::getMailboxStats(CoreId const index) const noexcept {
+    if (!_shared_com || _core_initializers.find(index) == _core_initializers.cend())
+        return {};
+    return _shared_com->getMailBox(index).stats();
+}
+
+CoreProfile
+Main::getCoreProfile(CoreId const index) const {
+    if (!_shared_com || _core_initializers.find(index) == _core_initializers.cend())
+        return {.core = index};
+    auto const *const profiler = _shared_com->getProfiler(index);
+    return profiler ? profiler->snapshot(index) : CoreProfile{.core = index};
+}
+
 void
 Main::start(bool async) noexcept {
     if (_is_running)
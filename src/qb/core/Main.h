@@ -33,14 +33,21 @@
 #include <condition_variable>
 #include <csignal>
 #include <qb/system/container/unordered_map.h>
+#include <string>
 #include <thread>
 #include <vector>
 // include from qb
+#include <qb/system/allocator/huge_pages.h>
 #include <qb/system/lockfree/mpsc.h>
+#include <qb/system/lockfree/mpsc_unbounded_queue.h>
 #include <qb/system/time.h>
 #include <qb/utility/compat.h>
 #include "CoreSet.h"
 #include "Event.h"
+#include "Profiler.h"
+#include "ActorSlab.h"
+#include "SharedSlab.h"
+#include "TaskPool.h"
 
 namespace qb {
 
@@ -103,6 +110,127 @@ class IActorFactory;
  */
 constexpr const CoreId NoAffinity = std::numeric_limits<CoreId>::max();
 
+/**
+ * @enum MailboxMode
+ * @brief What a sender does when its ring in a destination core's mailbox is full.
+ * @ingroup Engine
+ * @details Chosen per destination core with `CoreInitializer::setMailboxMode()`.
+ */
+enum class MailboxMode : std::uint8_t {
+    /// Keep the events in the sender's outbound pipe, spin/yield a bounded number of times, then
+    /// bail and retry on the next loop pass. The default: memory stays bounded, but a burst wider
+    /// than the ring stalls the sender and everything queued behind it for that core.
+    Backpressure,
+    /// Move the rest of the outbound pipe into one heap segment chained behind the ring, and carry
+    /// on. The sender never stalls; the receiver drains the ring, then the segments, in order.
+    /// Memory is bounded only by how far the receiver falls behind.
+    Overflow
+};
+
+/**
+ * @enum IdleWait
+ * @brief Where an idle VirtualCore with a non-zero latency blocks.
+ * @ingroup Engine
+ * @details Chosen per core with `CoreInitializer::setIdleWait()`. Either way the core blocks for at
+ *          most its latency and only once its spin credit is spent.
+ */
+enum class IdleWait : std::uint8_t {
+    /// On the mailbox's condition variable. Senders wake it; socket readiness waits for the
+    /// timeout, since the core's I/O loop is only polled between waits.
+    Condition,
+    /// Inside its I/O loop (`ev_run(EVRUN_ONCE)`, on epoll or io_uring), with the mailbox's
+    /// doorbell — an eventfd, or a pipe off Linux — among the watched descriptors. A socket event
+    /// or an event from another core wakes it at once, and senders only touch the doorbell while
+    /// the core is actually parked. Falls back to `Condition` where no doorbell can be made
+    /// (Windows).
+    EventLoop
+};
+
+/**
+ * @struct IdlePolicy
+ * @brief How an idle VirtualCore backs off between finding nothing to do and parking.
+ * @ingroup Engine
+ * @details Chosen per core with `CoreInitializer::setIdlePolicy()`; build one with the factories.
+ *          "Park" means the wait of `IdleWait`, bounded by the core's latency: a policy that would
+ *          park on a core whose latency is 0 yields instead.
+ *
+ *          - `credit()` (the default): each busy pass buys one idle poll per unit of work, then
+ *            the core parks. No pause, no yield; at latency 0 it busy-polls.
+ *          - `dedicated()`: never parks or yields, whatever the latency; each idle pass ends on
+ *            `qb::spin_loop_pause()`. For a core that owns its CPU.
+ *          - `adaptive()`: spins (`spin_loop_pause()`), then yields the CPU, then parks. The spin
+ *            and yield windows follow an EWMA of the core's inter-arrival gaps — the time from
+ *            its last busy pass to the pass that found work again. A gap that usually fits the
+ *            spin window is spun through; a longer one skips the spin and parks early.
+ *          - `power_saver()`: parks on the first idle pass.
+ */
+struct IdlePolicy {
+    enum class Mode : std::uint8_t { Credit, Dedicated, Adaptive, PowerSaver };
+
+    Mode mode = Mode::Credit;
+    /// Adaptive: spin at least this long after the last busy pass.
+    qb::duration min_spin = std::chrono::microseconds(1);
+    /// Adaptive: longest spin; a core whose gaps exceed it spins `min_spin` only.
+    qb::duration max_spin = std::chrono::microseconds(50);
+    /// Adaptive: longest spin-then-yield window before parking.
+    qb::duration max_yield = std::chrono::microseconds(500);
+    /// Adaptive: the EWMA weight of a new gap is `1 / 2^ewma_shift`.
+    std::uint8_t ewma_shift = 3;
+
+    [[nodiscard]] static constexpr IdlePolicy
+    credit() noexcept {
+        return {};
+    }
+    [[nodiscard]] static constexpr IdlePolicy
+    dedicated() noexcept {
+        return {.mode = Mode::Dedicated};
+    }
+    [[nodiscard]] static constexpr IdlePolicy
+    adaptive(qb::duration max_spin = std::chrono::microseconds(50),
+             qb::duration max_yield = std::chrono::microseconds(500)) noexcept {
+        return {.mode = Mode::Adaptive, .max_spin = max_spin, .max_yield = max_yield};
+    }
+    [[nodiscard]] static constexpr IdlePolicy
+    power_saver() noexcept {
+        return {.mode = Mode::PowerSaver};
+    }
+};
+
+/**
+ * @enum HugePages
+ * @brief Which pages back a VirtualCore's mailbox rings, receive buffer and outbound pipes.
+ * @ingroup Engine
+ * @details Chosen per core with `CoreInitializer::setHugePages()`. The rings of one mailbox are
+ *          one mapping, rounded up to whole 2 MiB pages: on a 64-core engine a consumer that
+ *          sweeps its 128 lanes touches a few huge pages instead of over a thousand base pages.
+ *          Pipes switch to huge pages only once they grow past one, since their steady-state
+ *          head is a few KiB. Every mode falls back silently, and the core logs what it got.
+ */
+enum class HugePages : std::uint8_t {
+    /// Base pages from the heap, as always. The default.
+    Off,
+    /// A 2 MiB-aligned mapping advised `MADV_HUGEPAGE`, which the kernel backs with transparent
+    /// huge pages when THP is `madvise` or `always` and it can find contiguous memory.
+    Transparent,
+    /// The reserved hugetlb pool (`MAP_HUGETLB`, sized by `vm.nr_hugepages`): guaranteed 2 MiB
+    /// pages, never split or swapped. Falls back to `Transparent` when the pool is empty.
+    Explicit
+};
+
+/**
+ * @struct MailboxStats
+ * @brief Backpressure and overflow counters of one core's inbound mailbox, summed over senders.
+ * @ingroup Engine
+ * @details Read with `Main::getMailboxStats()`; relaxed snapshots, exact once the engine joined.
+ */
+struct MailboxStats {
+    std::uint64_t backoffs         = 0; ///< Events a sender spun/yielded on because the ring was full (`Backpressure`).
+    std::uint64_t stalled_flushes  = 0; ///< Flushes that gave up on a full ring for this loop pass (`Backpressure`).
+    std::uint64_t spilled_segments = 0; ///< Overflow segments chained behind a full ring (`Overflow`).
+    std::uint64_t spilled_events   = 0; ///< Events carried by those segments.
+    std::uint64_t spilled_buckets  = 0; ///< Buckets carried by those segments.
+};
+
 /**
  * @class CoreInitializer
  * @brief Handles pre-start configuration for a single VirtualCore.
@@ -194,11 +322,26 @@ public:
         [[nodiscard]] ActorIdList idList() const noexcept;
     };
 
+    /// Default per-sender ring capacity, in buckets: the widest event a `uint16_t` byte count describes.
+    static constexpr std::size_t DefaultMailboxCapacity = ((std::numeric_limits<uint16_t>::max)()) / QB_LOCKFREE_EVENT_BUCKET_BYTES;
+    /// Smallest accepted ring capacity: one event just below the shared-slab threshold must fit.
+    static constexpr std::size_t MinMailboxCapacity = kSharedEventMinBuckets;
+    /// Per-sender ring capacity of the priority lane (`qb::is_priority_event`), in buckets, never
+    /// above the mailbox capacity: control-plane events are few and small.
+    static constexpr std::size_t PriorityMailboxCapacity = 256;
+
 private:
     const CoreId _index;
     ServiceId    _next_id;
     CoreIdSet    _affinity;
     qb::duration _latency;
+    std::size_t  _mailbox_capacity;
+    MailboxMode  _mailbox_mode;
+    IdleWait     _idle_wait;
+    IdlePolicy   _idle_policy;
+    bool         _numa_local;
+    HugePages    _huge_pages;
+    std::string  _recording;
 
     qb::unordered_set<ServiceId>                _registered_services;
     std::vector<std::unique_ptr<IActorFactory>> _actor_factories;
@@ -283,6 +426,78 @@ public:
      */
     CoreInitializer &setLatency(qb::duration latency = qb::duration::zero()) noexcept;
 
+    /*!
+     * @brief Set the capacity of each sender's ring in this VirtualCore's inbound mailbox.
+     * @param buckets Ring capacity in `EventBucket`s, per sending core. Clamped to at least
+     *                `MinMailboxCapacity`; defaults to `DefaultMailboxCapacity` (~64 KiB).
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note The mailbox holds one ring per sending core, so it costs `nb_cores * buckets * 64` bytes,
+     *       plus one receive buffer of `buckets` buckets on this core.
+     * @warning In `MailboxMode::Backpressure` a by-value event wider than the ring can never be
+     *          delivered to this core: the sender logs `LOG_CRIT` and drops it. `Overflow` carries it
+     *          in a segment instead.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setMailboxCapacity(std::size_t buckets = DefaultMailboxCapacity) noexcept;
+
+    /*!
+     * @brief Choose what senders do when their ring in this VirtualCore's mailbox is full.
+     * @param mode `MailboxMode::Backpressure` (default) or `MailboxMode::Overflow`.
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setMailboxMode(MailboxMode mode = MailboxMode::Backpressure) noexcept;
+
+    /*!
+     * @brief Choose where this VirtualCore blocks when idle; see `IdleWait`.
+     * @param wait `IdleWait::Condition` (default) or `IdleWait::EventLoop`.
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note Only matters with a non-zero `setLatency()`: at latency 0 the core never blocks.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setIdleWait(IdleWait wait = IdleWait::Condition) noexcept;
+
+    /*!
+     * @brief Choose how this VirtualCore backs off when idle; see `IdlePolicy`.
+     * @param policy `IdlePolicy::credit()` (default), `dedicated()`, `adaptive()` or `power_saver()`.
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note Parking still needs a non-zero `setLatency()`, which bounds it; `setIdleWait()` says where.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setIdlePolicy(IdlePolicy const &policy = IdlePolicy::credit()) noexcept;
+
+    /*!
+     * @brief Keep this VirtualCore's hot memory on its own NUMA node.
+     * @param local When `true`, once the core thread is pinned it prefers its node for every
+     *              allocation it makes (`CpuTopology::preferNode`), and binds its mailbox rings,
+     *              receive buffer and outbound pipes there (`CpuTopology::bindMemory`).
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note The node is that of the first CPU of `getAffinity()`; without affinity, or off Linux,
+     *       this does nothing. The mailbox rings are written by the senders, so without it their
+     *       pages land on the node of whichever sender touched them first.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setNumaLocal(bool local = true) noexcept;
+
+    /*!
+     * @brief Choose which pages back this VirtualCore's mailbox and pipes; see `HugePages`.
+     * @param pages `HugePages::Off` (default), `Transparent` or `Explicit`.
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note The mailbox is mapped whole, so a small engine pays up to 2 MiB per core for it.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setHugePages(HugePages pages = HugePages::Off) noexcept;
+
+    /*!
+     * @brief Record the events this VirtualCore receives and sends to @p file; see `Recorder`.
+     * @param file Path of the recording, created or truncated; empty (default) records nothing.
+     * @return Reference to this `CoreInitializer` for method chaining.
+     * @note A file that cannot be created or mapped is logged and the core runs unrecorded.
+     *       Replay a recording with `qb::Replay`.
+     * This setting takes effect when the engine starts.
+     */
+    CoreInitializer &setRecording(std::string file);
+
     /**
      * @brief Gets the CoreId associated with this initializer.
      * @return The `CoreId` (unsigned short) of the VirtualCore this initializer configures.
@@ -298,6 +513,34 @@ public:
      * @return `qb::duration` latency value. See `setLatency()` for interpretation.
      */
     [[nodiscard]] qb::duration getLatency() const noexcept;
+    /**
+     * @brief Gets the configured per-sender ring capacity (in buckets) of this core's mailbox.
+     */
+    [[nodiscard]] std::size_t getMailboxCapacity() const noexcept;
+    /**
+     * @brief Gets the configured full-ring behaviour of this core's mailbox.
+     */
+    [[nodiscard]] MailboxMode getMailboxMode() const noexcept;
+    /**
+     * @brief Gets where this core blocks when idle.
+     */
+    [[nodiscard]] IdleWait getIdleWait() const noexcept;
+    /**
+     * @brief Gets how this core backs off when idle.
+     */
+    [[nodiscard]] IdlePolicy const &getIdlePolicy() const noexcept;
+    /**
+     * @brief Gets whether this core binds its memory to its NUMA node.
+     */
+    [[nodiscard]] bool isNumaLocal() const noexcept;
+    /**
+     * @brief Gets which pages this core asks for its mailbox and pipes.
+     */
+    [[nodiscard]] HugePages getHugePages() const noexcept;
+    /**
+     * @brief Gets the file this core records its event stream to (empty: not recorded).
+     */
+    [[nodiscard]] std::string const &getRecording() const noexcept;
 };
 
 /**
@@ -323,27 +566,223 @@ using CoreInitializerMap = qb::unordered_map<CoreId, CoreInitializer>;
 class SharedCoreCommunication : nocopy {
     friend class VirtualCore;
     friend class Main;
-    constexpr static const uint64_t MaxRingEvents = (((std::numeric_limits<uint16_t>::max)()) / QB_LOCKFREE_EVENT_BUCKET_BYTES);
     //////// Types
-    class Mailbox : public lockfree::mpsc::ringbuffer<EventBucket, MaxRingEvents, 0> {
-        const qb::duration      _latency;
-        std::mutex              _mtx;
-        std::condition_variable _cv;
+    /**
+     * @brief Inbound mailbox of one VirtualCore: two single-producer lanes per sending core.
+     * @details Each normal lane is an SPSC ring of `capacity()` buckets, sized at runtime from the
+     *          core's `CoreInitializer`; each priority lane (`qb::is_priority_event`) a ring of
+     *          `capacity(true)`. In `MailboxMode::Overflow` a lane also chains heap segments
+     *          behind its ring: a sender that finds the ring full `spill()`s the rest of its
+     *          outbound pipe into one segment instead of stalling.
+     *
+     *          Per-lane FIFO holds because the two sides agree on one rule: while a lane has
+     *          segments pending, `enqueue()` refuses the ring, so everything newer goes to a
+     *          segment too; and the consumer re-drains the ring after it sees a segment and
+     *          before it takes one, so the ring events written before the spill go first.
+     */
+    class Mailbox : nocopy {
+    public:
+        /// Events spilled by one flush, contiguous and bucket-aligned like a ring batch.
+        struct Segment {
+            std::unique_ptr<EventBucket[]> buckets;
+            std::size_t                    size = 0;
+        };
+
+    private:
+        struct QB_LOCKFREE_CACHELINE_ALIGNMENT Lane {
+            lockfree::spsc::ringbuffer<EventBucket, 0> ring;
+            lockfree::mpsc_unbounded_queue<Segment>    overflow;
+            std::atomic<std::uint64_t>                 backoffs{0};
+            std::atomic<std::uint64_t>                 stalled_flushes{0};
+            std::atomic<std::uint64_t>                 spilled_segments{0};
+            std::atomic<std::uint64_t>                 spilled_events{0};
+            std::atomic<std::uint64_t>                 spilled_buckets{0};
+
+            /// @p storage: `capacity + 1` buckets carved from the mailbox's pages, or null for the heap.
+            Lane(std::size_t const capacity, EventBucket *const storage)
+                : ring(capacity, storage) {}
+        };
+
+        // With `HugePages`, one mapping backs every ring and the receive buffer; declared first,
+        // so it outlives the lanes that point into it.
+        allocator::page_region             _pages;
+        std::unique_ptr<EventBucket[]>     _receive_heap;
+        EventBucket                       *_receive = nullptr;
+        std::vector<std::unique_ptr<Lane>> _lanes;
+        std::vector<std::unique_ptr<Lane>> _priority_lanes;
+        // Bumped by every sender on each priority enqueue or spill; the consumer compares it with
+        // `_priority_seen`, so polling the priority lanes costs one load while they are idle.
+        std::uint64_t                                              _priority_seen = 0;
+        QB_LOCKFREE_CACHELINE_ALIGNMENT std::atomic<std::uint64_t> _priority_posted{0};
+        const std::size_t                                          _capacity;
+        const std::size_t                                          _priority_capacity;
+        const MailboxMode                                          _mode;
+        const qb::duration                                         _latency;
+        const HugePages                                            _huge_pages;
+        std::mutex                                                 _mtx;
+        std::condition_variable                                    _cv;
+        // IdleWait::EventLoop: the doorbell descriptors (one eventfd on Linux, so both are the
+        // same), -1 in Condition mode, and whether the consumer is blocked in its I/O loop.
+        int                                                     _bell_read  = -1;
+        int                                                     _bell_write = -1;
+        QB_LOCKFREE_CACHELINE_ALIGNMENT std::atomic<bool>       _parked{false};
+
+        static void
+        bump(std::atomic<std::uint64_t> &counter, std::uint64_t const n = 1) noexcept {
+            // Single writer per lane (its sending core): no read-modify-write needed.
+            counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] Lane &
+        lane(std::size_t const index, bool const priority) const noexcept {
+            return *(priority ? _priority_lanes : _lanes)[index];
+        }
+
+        /// Drain @p lane's ring, then the segments pending behind it.
+        template <typename Func>
+        static std::size_t
+        consume_lane(Lane &lane, Func const &func, EventBucket *scratch, std::size_t const chunk) {
+            std::size_t nb_consume = lane.ring.dequeue(func, scratch, chunk);
+            if (likely(!lane.overflow.size()))
+                return nb_consume;
+            // The sender stopped writing the ring when it spilled; whatever it wrote before
+            // that is visible now and must be delivered before the first segment.
+            nb_consume += lane.ring.dequeue(func, scratch, chunk);
+            // Only the segments counted here: one spilled after this point may follow ring
+            // events written once the lane looked empty, so it waits for the next pass.
+            for (auto pending = lane.overflow.size(); pending; --pending) {
+                Segment segment;
+                if (!lane.overflow.pop(segment))
+                    break;
+                func(segment.buckets.get(), segment.size);
+                nb_consume += segment.size;
+            }
+            return nb_consume;
+        }
 
     public:
-        explicit Mailbox(std::size_t const nb_producer, qb::duration const latency)
-            : lockfree::mpsc::ringbuffer<EventBucket, MaxRingEvents, 0>(nb_producer)
-            , _latency(latency) {}
+        Mailbox(std::size_t nb_producer, std::size_t capacity, MailboxMode mode, qb::duration latency,
+                IdleWait idle_wait = IdleWait::Condition, HugePages huge_pages = HugePages::Off);
+        ~Mailbox() noexcept;
+
+        /**
+         * @brief Append @p size buckets to a ring of producer @p index, all or nothing.
+         * @param priority Selects the priority lane rather than the normal one.
+         * @return `false` when the ring is full, or when the lane has segments pending (the
+         *         events must queue behind them — see `spill()`).
+         */
+        [[nodiscard]] bool
+        enqueue(std::size_t const index, EventBucket const *buckets, std::size_t const size, bool const priority = false) noexcept {
+            auto &target = lane(index, priority);
+            if (_mode == MailboxMode::Overflow && target.overflow.size())
+                return false;
+            if (!target.ring.template enqueue<true>(buckets, size))
+                return false;
+            if (priority)
+                _priority_posted.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Chain @p size buckets holding @p nb_events whole events behind a ring of producer @p index.
+         * @details `Overflow` mode only. The buckets are copied, so the caller may reset its pipe.
+         */
+        void spill(std::size_t index, EventBucket const *buckets, std::size_t size, std::size_t nb_events, bool priority = false);
+
+        /// Count an event producer @p index had to back off on (full ring).
+        void
+        backed_off(std::size_t const index, bool const priority = false) noexcept {
+            bump(lane(index, priority).backoffs);
+        }
+
+        /// Count a flush to this mailbox that producer @p index had to cut short.
+        void
+        stalled(std::size_t const index, bool const priority = false) noexcept {
+            bump(lane(index, priority).stalled_flushes);
+        }
+
+        /// Whether a priority event was enqueued or spilled since the priority lanes were last drained.
+        [[nodiscard]] bool
+        priority_pending() const noexcept {
+            return _priority_posted.load(std::memory_order_acquire) != _priority_seen;
+        }
+
+        /**
+         * @brief Drain every priority lane through @p scratch, if `priority_pending()`.
+         * @return Total buckets drained.
+         */
+        template <typename Func>
+        std::size_t
+        consume_priority(Func const &func, EventBucket *scratch) {
+            const auto posted = _priority_posted.load(std::memory_order_acquire);
+            if (likely(posted == _priority_seen))
+                return 0;
+            // Snapshot before draining: a post racing with the drain leaves the lanes pending.
+            _priority_seen         = posted;
+            std::size_t nb_consume = 0;
+            for (auto &priority_lane : _priority_lanes)
+                nb_consume += consume_lane(*priority_lane, func, scratch, _priority_capacity);
+            return nb_consume;
+        }
+
+        /**
+         * @brief Drain the normal lane of producer @p index through @p scratch: its ring, then its
+         *        pending segments.
+         * @details Same contract as `mpsc::ringbuffer::consume_all(func, scratch, chunk)`:
+         *          `func(batch, n)` once per non-empty ring, @p chunk must be at least
+         *          `capacity()` so a full ring comes out in one piece. Each segment is handed to
+         *          @p func in place, as a batch of its own.
+         * @return Total buckets drained.
+         */
+        template <typename Func>
+        std::size_t
+        consume(std::size_t const index, Func const &func, EventBucket *scratch, std::size_t const chunk) {
+            return consume_lane(*_lanes[index], func, scratch, chunk);
+        }
+
+        /**
+         * @brief Drain every lane through @p scratch: the priority lanes, then each producer's
+         *        normal lane; see `consume()` for @p chunk, a PER-LANE limit.
+         * @return Total buckets drained.
+         */
+        template <typename Func>
+        std::size_t
+        consume_all(Func const &func, EventBucket *scratch, std::size_t const chunk) {
+            std::size_t nb_consume = consume_priority(func, scratch);
+            for (std::size_t index = 0; index < _lanes.size(); ++index)
+                nb_consume += consume(index, func, scratch, chunk);
+            return nb_consume;
+        }
+
+        /// Number of sending cores, i.e. of lanes of each kind.
+        [[nodiscard]] std::size_t
+        producers() const noexcept {
+            return _lanes.size();
+        }
+
+        /// Per-sender ring capacity of the normal (or, with @p priority, the priority) lane, in buckets.
+        [[nodiscard]] std::size_t
+        capacity(bool const priority = false) const noexcept {
+            return priority ? _priority_capacity : _capacity;
+        }
+
+        [[nodiscard]] MailboxMode
+        mode() const noexcept {
+            return _mode;
+        }
+
+        /// Counters summed over every sender; see `MailboxStats`.
+        [[nodiscard]] MailboxStats stats() const noexcept;
 
         /**
          * @brief Waits for a notification on this mailbox, up to its configured latency.
          * @ingroup Engine
-         * @details If the mailbox is configured with a non-zero latency (`_latency > 0`),
-         *          this method blocks the calling thread (typically a VirtualCore's event loop)
-         *          using a `std::condition_variable` for a duration up to `_latency` nanoseconds,
-         *          or until `notify()` is called.
-         *          If `_latency` is 0, this method returns immediately (effectively a no-op for waiting).
-         *          This is used by VirtualCores to sleep when idle, reducing CPU usage.
+         * @details The `IdleWait::Condition` park: with a non-zero latency (`_latency > 0`) this
+         *          blocks the calling VirtualCore on a `std::condition_variable` for up to
+         *          `_latency`, or until `notify()` signals it; with a latency of 0 it returns at
+         *          once. A core in `IdleWait::EventLoop` mode with a doorbell never calls it: it
+         *          parks in its own I/O loop instead (`park()`), woken by the doorbell or by
+         *          `_latency` as a timeout.
          */
         void
         wait() noexcept {
@@ -354,20 +793,82 @@ class SharedCoreCommunication : nocopy {
         }
 
         /**
-         * @brief Notifies a waiting thread (VirtualCore) that an event might be available in this mailbox.
+         * @brief Notifies the consuming VirtualCore that an event might be available in this mailbox.
          * @ingroup Engine
-         * @details If the mailbox is configured with a non-zero latency (`_latency > 0`),
-         *          this method signals the `std::condition_variable` associated with this mailbox.
-         *          This wakes up a VirtualCore thread that might be sleeping in the `wait()` method,
-         *          prompting it to check the mailbox for new events.
-         *          If `_latency` is 0, this method is a no-op.
+         * @details When the mailbox has a doorbell (`IdleWait::EventLoop` on a platform with an
+         *          eventfd or a pipe), this rings it through `ring()` whatever the latency: the
+         *          doorbell is written only if the consumer is parked in its I/O loop, so a busy
+         *          consumer costs one fence. Otherwise (`IdleWait::Condition`, or no doorbell) it
+         *          signals the `std::condition_variable` that `wait()` blocks on when the latency
+         *          is non-zero, and is a no-op when it is 0, since the consumer never blocks then.
          */
         void
         notify() noexcept {
-            if (_latency > qb::duration::zero())
+            if (_bell_write >= 0)
+                ring();
+            else if (_latency > qb::duration::zero())
                 _cv.notify_all();
         }
 
+        /// Consumer scratch of `capacity()` buckets that lanes are drained through (`consume_all()`).
+        [[nodiscard]] EventBucket *
+        receive_buffer() const noexcept {
+            return _receive;
+        }
+
+        /// Pages the rings and receive buffer were asked to live on; see `HugePages`.
+        [[nodiscard]] HugePages
+        huge_pages() const noexcept {
+            return _huge_pages;
+        }
+
+        /// Pages they actually live on: `normal` when `HugePages::Off` or when every fallback failed.
+        [[nodiscard]] allocator::page_kind
+        pages() const noexcept {
+            return _pages.kind();
+        }
+
+        /// Bind the pages of every ring and of the receive buffer to NUMA @p node; see `CpuTopology::bindMemory`.
+        bool bind_memory(int node) noexcept;
+
+        /// Descriptor the consumer watches for the doorbell, or -1 in `IdleWait::Condition` mode.
+        [[nodiscard]] int
+        doorbell() const noexcept {
+            return _bell_read;
+        }
+
+        /**
+         * @brief Consumer: announce that it is about to block in its I/O loop.
+         * @return `false`, and nothing announced, when an event is already waiting in a lane.
+         * @details Pairs with `ring()`: the consumer publishes `_parked` and then looks at the
+         *          lanes, a sender publishes its event and then looks at `_parked`, each with a
+         *          full fence in between, so at least one of them sees the other and no wake-up is
+         *          lost.
+         */
+        [[nodiscard]] bool park() noexcept;
+
+        /// Consumer: back from its I/O loop.
+        void
+        unpark() noexcept {
+            _parked.store(false, std::memory_order_relaxed);
+        }
+
+        /// Consumer: consume the doorbell's pending wake-ups (from its watcher's callback).
+        void drain_doorbell() noexcept;
+
+        /// Sender: wake the consumer if it is parked; a no-op, bar one fence, otherwise.
+        void
+        ring() noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_parked.load(std::memory_order_relaxed) && _parked.exchange(false, std::memory_order_acq_rel))
+                ring_doorbell();
+        }
+
+    private:
+        void ring_doorbell() noexcept;
+
+    public:
+
         /**
          * @brief Get the latency setting for this mailbox.
          * @ingroup Engine
@@ -379,8 +880,18 @@ class SharedCoreCommunication : nocopy {
         }
     };
 
-    const CoreSet                         _core_set;
-    std::vector<std::unique_ptr<Mailbox>> _mail_boxes;
+    const CoreSet _core_set;
+    // Per-core slabs of the large-event path, indexed like _mail_boxes. Declared first so they
+    // are destroyed last: a mailbox still holding a SharedEventRef releases into one of them.
+    std::vector<std::unique_ptr<SharedSlab>> _slabs;
+    // Per-core actor storage, indexed like _mail_boxes: outlives every VirtualCore and its actors.
+    std::vector<std::unique_ptr<ActorSlab>>  _actor_slabs;
+    std::vector<std::unique_ptr<Mailbox>>    _mail_boxes;
+    // Per-core task queues (TaskPool.h), indexed like _mail_boxes: peers steal from them, and the
+    // jobs still queued when the engine stops are abandoned by the destructor.
+    std::vector<std::unique_ptr<TaskQueue>>  _task_queues;
+    // Per-core LoopProfilers, indexed like _mail_boxes; left empty unless kLoopProfiler.
+    std::vector<std::unique_ptr<LoopProfiler>> _profilers;
     // Per-core "has left __workflow__" flag, indexed by RESOLVED core index (parallel to
     // _mail_boxes). Set (release) by a VirtualCore as the last thing before its worker
     // thread returns — after its final mailbox drain — so it will no longer accept cross-core
@@ -453,6 +964,35 @@ public:
      */
     [[nodiscard]] Mailbox &getMailBox(CoreId id) const noexcept;
 
+    /**
+     * @brief Get the `SharedSlab` that carries large events sent by a specific VirtualCore.
+     * @ingroup Engine
+     * @param id The `CoreId` of the owning VirtualCore.
+     */
+    [[nodiscard]] SharedSlab &getSharedSlab(CoreId id) const noexcept;
+
+    /**
+     * @brief Get the `ActorSlab` the actors of a specific VirtualCore are allocated from.
+     * @ingroup Engine
+     * @param id The `CoreId` of the owning VirtualCore.
+     */
+    [[nodiscard]] ActorSlab &getActorSlab(CoreId id) const noexcept;
+
+    /**
+     * @brief Get the `TaskQueue` a specific VirtualCore submits its tasks to.
+     * @ingroup Engine
+     * @param id The `CoreId` of the owning VirtualCore.
+     */
+    [[nodiscard]] TaskQueue &getTaskQueue(CoreId id) const noexcept;
+
+    /**
+     * @brief Get the `LoopProfiler` a specific VirtualCore records into.
+     * @ingroup Engine
+     * @param id The `CoreId` of the owning VirtualCore.
+     * @return `nullptr` unless qb-core was built with `QB_WITH_LOOP_PROFILER`.
+     */
+    [[nodiscard]] LoopProfiler *getProfiler(CoreId id) const noexcept;
+
     /**
      * @brief Get the number of VirtualCores configured in the system.
      * @ingroup Engine
@@ -638,6 +1178,43 @@ public:
      */
     void setLatency(qb::duration latency = qb::duration::zero());
 
+    /*!
+     * @brief `CoreInitializer::setNumaLocal()` on every VirtualCore.
+     * @ingroup Engine
+     * @attention Like `setLatency()`, this overwrites each core's own setting, and it is only
+     *            available before the engine is running.
+     */
+    void setNumaLocal(bool local = true);
+
+    /*!
+     * @brief `CoreInitializer::setHugePages()` on every VirtualCore.
+     * @ingroup Engine
+     * @attention Like `setLatency()`, this overwrites each core's own setting, and it is only
+     *            available before the engine is running.
+     */
+    void setHugePages(HugePages pages);
+
+    /*!
+     * @brief `CoreInitializer::setRecording()` on every VirtualCore, to `<directory>/core-<id>.qbrec`.
+     * @ingroup Engine
+     * @attention Like `setLatency()`, this overwrites each core's own setting, and it is only
+     *            available before the engine is running.
+     */
+    void setRecording(std::string const &directory);
+
+    /*!
+     * @brief Add @p count actors of one type, placed by `CpuTopology::spread()` over @p cores.
+     * @ingroup Engine
+     * @param cores Engine cores to use, e.g. `CoreSet::topology().nodeCores(0)` for one NUMA node.
+     * @param count Number of actors; cores are reused round-robin past `cores.size()`.
+     * @param args Constructor arguments, copied to every actor.
+     * @return The id of each actor, in placement order (`ActorId::NotFound` for a failure).
+     * @details One actor per physical core first, alternating L3 domains, then on SMT siblings.
+     * @attention This function is only available before the engine is running.
+     */
+    template <typename _Actor, typename... _Args>
+    std::vector<ActorId> spreadActors(CoreIdSet const &cores, std::size_t count, _Args const &...args);
+
     /*!
      * @brief Get the set of `CoreId`s that are currently configured to be used by the engine.
      * @ingroup Engine
@@ -647,6 +1224,29 @@ public:
      */
     [[nodiscard]] qb::CoreIdSet usedCoreSet() const;
 
+    /*!
+     * @brief Backpressure and overflow counters of a VirtualCore's inbound mailbox.
+     * @ingroup Engine
+     * @param index The `CoreId` of the receiving VirtualCore.
+     * @return Counters of the current (or last) run; all zero before the first `start()` or for
+     *         a core that is not in `usedCoreSet()`.
+     * @details Callable from any thread while the engine runs (relaxed snapshot) and after
+     *          `join()` (exact), until the next `start()` builds fresh mailboxes.
+     */
+    [[nodiscard]] MailboxStats getMailboxStats(CoreId index) const noexcept;
+
+    /*!
+     * @brief Event-loop profile of a VirtualCore: handler, callback and I/O time histograms.
+     * @ingroup Engine
+     * @param index The `CoreId` of the profiled VirtualCore.
+     * @return Cumulative histograms of the current (or last) run, per event type and per actor;
+     *         `enabled == false` and empty unless qb-core was built with `QB_WITH_LOOP_PROFILER`,
+     *         before the first `start()`, or for a core that is not in `usedCoreSet()`.
+     * @details Same lifetime as `getMailboxStats()`: callable from any thread while the engine
+     *          runs, exact after `join()`, reset by the next `start()`. See `qb/core/Profiler.h`.
+     */
+    [[nodiscard]] CoreProfile getCoreProfile(CoreId index) const;
+
     /*!
      * @brief Register a system signal to be handled by the engine (results in graceful shutdown).
      * @ingroup Engine
@@ -779,5 +1379,15 @@ Main::addActor(CoreId const cid, _Args &&...args) {
     return core(cid).addActor<_Actor>(std::forward<_Args>(args)...);
 }
 
+template <typename _Actor, typename... _Args>
+std::vector<ActorId>
+Main::spreadActors(CoreIdSet const &cores, std::size_t const count, _Args const &...args) {
+    std::vector<ActorId> ids;
+    ids.reserve(count);
+    for (const auto cid : CoreSet::topology().spread(cores, count))
+        ids.push_back(core(cid).addActor<_Actor>(args...));
+    return ids;
+}
+
 } // namespace qb
 #endif // QB_MAIN_H
@@ -204,26 +204,26 @@ public:
      *       `EventHeader.AllocatedPushRoundingMatchesCeilDivide` in
      *       `source/core/tests/unit/core/event-header.cpp`.
      *
-     * @warning **Maximum event size.** An event's total in-pipe footprint must not
-     *          exceed the per-core mailbox ring capacity, which is
+     * @warning **Maximum event size.** A cross-core event of at least
+     *          `kSharedEventMinBuckets` buckets (1 KiB by default) is built in the sending
+     *          core's `SharedSlab` and only a descriptor crosses the mailbox ring, so its
+     *          limit is the `uint16_t` `bucket_size` header: **65535 buckets (≈4 MiB with
+     *          the default 64-byte, cache-line bucket)**. An event that travels by value
+     *          (`EventQOS0`, or `send()`) must still fit the per-core mailbox ring,
      *          `(std::numeric_limits<uint16_t>::max() / QB_LOCKFREE_EVENT_BUCKET_BYTES)`
-     *          buckets — i.e. **~1023 buckets (≈64 KiB with the default 64-byte,
-     *          cache-line bucket)**. A larger event cannot be enqueued into another
-     *          core's mailbox, so the cross-core flush **drops it**: it is disposed,
-     *          the pipe advances past it, and a `QB_LOG_CRIT` names the source,
-     *          destination and bucket count. Dropping is deliberate — the event is
-     *          undeliverable by construction rather than by timing, so retrying it
-     *          would hold the whole outbound stream to that core hostage
-     *          (head-of-line) and `Main::join()` would never return. The
-     *          `bucket_size` header field is also a `uint16_t`, so an event spanning
-     *          ≥ 65536 buckets wraps it; the value 65536 truncates to 0, and a
+     *          buckets — **~1023 buckets (≈64 KiB)**; a larger one cannot be enqueued, so
+     *          the cross-core flush **drops it**: it is disposed, the pipe advances past
+     *          it, and a `QB_LOG_CRIT` names the source, destination and bucket count.
+     *          Dropping is deliberate — retrying an event that is undeliverable by
+     *          construction would hold the whole outbound stream to that core hostage
+     *          (head-of-line) and `Main::join()` would never return. An event spanning
+     *          ≥ 65536 buckets wraps `bucket_size`; the value 65536 truncates to 0, and a
      *          zero-width event cannot be walked past, so the flush logs `QB_LOG_CRIT`
-     *          and **discards the rest of that pipe**. Either way the events are
+     *          and **discards the rest of that pipe**. Either way those events are
      *          lost, not delivered — the engine stays live, but the messages do not
-     *          arrive. For large payloads, put the data on the heap (e.g. a
-     *          `std::shared_ptr<std::vector<T>>` member) and keep the event itself
-     *          small — do **not** size `allocated_push` to the payload bytes.
-     *          Pinned by `OversizeEvent.OversizedEventDoesNotWedgeTheEngine` in
+     *          arrive. For payloads beyond that, put the data on the heap (e.g. a
+     *          `std::shared_ptr<std::vector<T>>` member) and keep the event itself small.
+     *          Pinned by `OversizeEvent.*` in
      *          `source/core/tests/system/messaging/oversize-event-probe.cpp`.
      */
     template <typename _Event, typename... _Args>
@@ -289,6 +289,7 @@ using pipe = Pipe;
 // .cpp.
 // ============================================================================================
 #include <qb/system/event/router.h>
+#include "SharedSlab.h"
 
 namespace qb {
 
@@ -297,12 +298,20 @@ T &
 Pipe::push(_Args &&...args) const noexcept {
     router::ensure_disposer<Event, T>();
     constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<T, EventBucket>();
-    // Raw + prepare + placement-new, not pipe->allocate_back<T>(...) — see
-    // detail::prepare_event_storage (Event.h): SharedCoreCommunication::send's self-pointer guard
-    // scans this whole bucket range, so the bytes the payload leaves untouched must be zero and
-    // not whatever the recycled pipe buffer happened to hold.
-    auto *const raw = pipe->allocate_back(BUCKET_SIZE);
-    detail::prepare_event_storage(raw, BUCKET_SIZE * sizeof(EventBucket));
+    // A large cross-core event is built in the sending core's SharedSlab and only its descriptor
+    // is queued (SharedSlab.h). QoS 0 stays by value: it can be dropped without disposal.
+    EventBucket *raw = nullptr;
+    if constexpr (BUCKET_SIZE >= kSharedEventMinBuckets && !std::is_base_of_v<EventQOS0, T>)
+        raw = detail::shared_event_storage(dest, BUCKET_SIZE);
+    const bool shared = raw != nullptr;
+    if (!shared) {
+        // Raw + prepare + placement-new, not pipe->allocate_back<T>(...) — see
+        // detail::prepare_event_storage (Event.h): SharedCoreCommunication::send's self-pointer
+        // guard scans this whole bucket range, so the bytes the payload leaves untouched must be
+        // zero and not whatever the recycled pipe buffer happened to hold.
+        raw = pipe->allocate_back(BUCKET_SIZE);
+        detail::prepare_event_storage(raw, BUCKET_SIZE * sizeof(EventBucket));
+    }
     auto &data  = *(new (reinterpret_cast<T *>(raw)) T(std::forward<_Args>(args)...));
     data.id     = detail::routing_safe_type_id<T>(); // == type_to_id<T>(), + the shadow guard
     data.dest   = dest;
@@ -313,7 +322,11 @@ Pipe::push(_Args &&...args) const noexcept {
         std::swap(data.id, data.service_event_id);
     }
 
-    data.bucket_size = BUCKET_SIZE;
+    data.state.bits.owning  = !std::is_trivially_destructible_v<T>;
+    data.state.bits.compact = detail::packed_bucket::width<T>();
+    data.bucket_size        = BUCKET_SIZE;
+    if (shared)
+        detail::shared_event_publish(*pipe, data);
     return data;
 }
 
@@ -323,11 +336,18 @@ Pipe::allocated_push(std::size_t size, _Args &&...args) const noexcept {
     router::ensure_disposer<Event, T>();
     size += sizeof(T);
     size = size / sizeof(EventBucket) + static_cast<bool>(size % sizeof(EventBucket));
-    // The trailing buckets an allocated_push reserves are legitimately uninitialised, and they are
-    // inside the range the cross-core guard scans — prepare them too. See
-    // detail::prepare_event_storage (Event.h).
-    auto *const raw = pipe->allocate_back(size);
-    detail::prepare_event_storage(raw, size * sizeof(EventBucket));
+    // Same large-event path as push(); here the size is only known at run time.
+    EventBucket *raw = nullptr;
+    if constexpr (!std::is_base_of_v<EventQOS0, T>)
+        raw = detail::shared_event_storage(dest, size);
+    const bool shared = raw != nullptr;
+    if (!shared) {
+        // The trailing buckets an allocated_push reserves are legitimately uninitialised, and they
+        // are inside the range the cross-core guard scans — prepare them too. See
+        // detail::prepare_event_storage (Event.h).
+        raw = pipe->allocate_back(size);
+        detail::prepare_event_storage(raw, size * sizeof(EventBucket));
+    }
     auto &data = *(new (reinterpret_cast<T *>(raw)) T(std::forward<_Args>(args)...));
 
     data.id     = detail::routing_safe_type_id<T>(); // == type_to_id<T>(), + the shadow guard
@@ -339,7 +359,10 @@ Pipe::allocated_push(std::size_t size, _Args &&...args) const noexcept {
         std::swap(data.id, data.service_event_id);
     }
 
-    data.bucket_size = static_cast<uint16_t>(size);
+    data.state.bits.owning = !std::is_trivially_destructible_v<T>;
+    data.bucket_size       = static_cast<uint16_t>(size);
+    if (shared)
+        detail::shared_event_publish(*pipe, data);
     return data;
 }
 
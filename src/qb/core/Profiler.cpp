@@ -0,0 +1,155 @@
+/**
+ * @file qb/core/Profiler.cpp
+ * @brief Recording and snapshot of `qb::LoopProfiler`.
+ *
+ * The hooks that feed it live in `VirtualCore.cpp`, behind `kLoopProfiler`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <chrono>
+#include "Profiler.h"
+
+namespace qb {
+
+namespace {
+// Single writer: a load and a store, no read-modify-write on the core's hot path.
+inline void
+bump(std::atomic<std::uint64_t> &counter, std::uint64_t const by) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+}
+} // namespace
+
+std::uint64_t
+LatencyHistogram::percentile(double const q) const noexcept {
+    if (!count)
+        return 0;
+    const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count));
+    std::uint64_t seen = 0;
+    for (std::size_t b = 0; b < Buckets; ++b) {
+        seen += buckets[b];
+        if (seen > rank || seen == count)
+            return upper_bound(b) < max_ns ? upper_bound(b) : max_ns;
+    }
+    return max_ns;
+}
+
+void
+LoopProfiler::Histogram::add(std::uint64_t const ns) noexcept {
+    bump(count, 1);
+    bump(total_ns, ns);
+    if (ns > max_ns.load(std::memory_order_relaxed))
+        max_ns.store(ns, std::memory_order_relaxed);
+    bump(buckets[LatencyHistogram::bucket_of(ns)], 1);
+}
+
+void
+LoopProfiler::Histogram::read(LatencyHistogram &out) const noexcept {
+    out.count    = count.load(std::memory_order_relaxed);
+    out.total_ns = total_ns.load(std::memory_order_relaxed);
+    out.max_ns   = max_ns.load(std::memory_order_relaxed);
+    for (std::size_t b = 0; b < LatencyHistogram::Buckets; ++b)
+        out.buckets[b] = buckets[b].load(std::memory_order_relaxed);
+}
+
+LoopProfiler::LoopProfiler()
+    : _types(std::make_unique<TypeSlot[]>(MaxEventTypes))
+    , _actors(std::make_unique<ActorSlot[]>(MaxActors)) {}
+
+LoopProfiler::~LoopProfiler() noexcept = default;
+
+std::uint64_t
+LoopProfiler::now() noexcept {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+template <typename Slot>
+Slot *
+LoopProfiler::find_or_claim(Slot *const slots, std::size_t const capacity, std::uint32_t const key) noexcept {
+    // Type ids and sids are small and mostly dense: their low bits are already a good hash.
+    for (std::size_t probe = 0, i = key & (capacity - 1); probe < capacity; ++probe, i = (i + 1) & (capacity - 1)) {
+        const auto current = slots[i].key.load(std::memory_order_relaxed);
+        if (current == key)
+            return &slots[i];
+        if (current == 0) {
+            // Only this thread writes keys: the slot is ours. Publish it after its (zeroed)
+            // counters, so a reader that sees the key sees a valid histogram.
+            slots[i].key.store(key, std::memory_order_release);
+            return &slots[i];
+        }
+    }
+    return nullptr;
+}
+
+void
+LoopProfiler::untracked() noexcept {
+    bump(_untracked, 1);
+}
+
+void
+LoopProfiler::record_event(Event::id_type const type, ActorId const dest, std::uint64_t const ns) noexcept {
+    static_assert(std::has_single_bit(MaxEventTypes) && std::has_single_bit(MaxActors));
+    if (auto *const slot = find_or_claim(_types.get(), MaxEventTypes, std::uint32_t{type} + 1u))
+        slot->handler.add(ns);
+    else
+        untracked();
+    if (dest.is_broadcast())
+        return;
+    if (auto *const slot = find_or_claim(_actors.get(), MaxActors, std::uint32_t{dest.sid()} + 1u))
+        slot->events.add(ns);
+    else
+        untracked();
+}
+
+void
+LoopProfiler::record_callback(ActorId const actor, std::uint64_t const ns) noexcept {
+    if (auto *const slot = find_or_claim(_actors.get(), MaxActors, std::uint32_t{actor.sid()} + 1u))
+        slot->callbacks.add(ns);
+    else
+        untracked();
+}
+
+CoreProfile
+LoopProfiler::snapshot(CoreId const core) const {
+    CoreProfile out;
+    out.core    = core;
+    out.enabled = true;
+    _io.read(out.io);
+    _callbacks.read(out.callbacks);
+    for (std::size_t i = 0; i < MaxEventTypes; ++i) {
+        const auto key = _types[i].key.load(std::memory_order_acquire);
+        if (!key)
+            continue;
+        auto &entry = out.event_types.emplace_back();
+        entry.id    = static_cast<Event::id_type>(key - 1);
+        entry.name  = event_type_name(entry.id);
+        _types[i].handler.read(entry.handler);
+    }
+    for (std::size_t i = 0; i < MaxActors; ++i) {
+        const auto key = _actors[i].key.load(std::memory_order_acquire);
+        if (!key)
+            continue;
+        auto &entry = out.actors.emplace_back();
+        entry.id    = ActorId(static_cast<ServiceId>(key - 1), core);
+        _actors[i].events.read(entry.events);
+        _actors[i].callbacks.read(entry.callbacks);
+    }
+    out.untracked = _untracked.load(std::memory_order_relaxed);
+    return out;
+}
+
+} // namespace qb
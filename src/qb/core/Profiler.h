@@ -0,0 +1,216 @@
+/**
+ * @file qb/core/Profiler.h
+ * @brief Opt-in per-core event-loop profiler: where a VirtualCore spends its time.
+ *
+ * `VirtualCore::Metrics` counts work per loop pass and forgets it at the next one. It cannot say
+ * which actor or which event type is eating a core. Built with `QB_WITH_LOOP_PROFILER` (the CMake
+ * option of the same name), every core times:
+ *
+ *   - each routed event — its handler, attributed to the event type and to the destination actor;
+ *   - each `on(LoopEvent)` callback, attributed to its actor, and the whole callback pass;
+ *   - each `listener::run` of the core's I/O loop.
+ *
+ * Samples land in log2 latency histograms held in a `LoopProfiler` owned by the engine, one per
+ * core. The core thread is the only writer and never waits; `Main::getCoreProfile()` copies one
+ * out from any thread as a `CoreProfile`. Totals are cumulative for the run: diff two snapshots
+ * for a rate.
+ *
+ * Without the option the hooks are discarded at compile time and no `LoopProfiler` is created;
+ * `getCoreProfile()` then returns a profile with `enabled == false`. The hooks live only in
+ * qb-core's own translation unit, so the option is a property of the qb-core build and does not
+ * change the layout of any class a consumer sees.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_PROFILER_H
+#define QB_CORE_PROFILER_H
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <qb/utility/nocopy.h>
+#include "ActorId.h"
+#include "Event.h"
+
+namespace qb {
+
+/**
+ * @brief Whether this qb-core was built with `QB_WITH_LOOP_PROFILER`.
+ * @ingroup Core
+ */
+#ifdef QB_WITH_LOOP_PROFILER
+inline constexpr bool kLoopProfiler = true;
+#else
+inline constexpr bool kLoopProfiler = false;
+#endif
+
+/**
+ * @struct LatencyHistogram
+ * @brief Count, sum, maximum and log2 distribution of a set of durations, in nanoseconds.
+ * @details Bucket `b` holds the samples whose `std::bit_width` is `b`: bucket 0 is exactly 0 ns,
+ *          bucket `b > 0` is `[2^(b-1), 2^b)`. The last bucket is open-ended (over ~4.6 min).
+ * @ingroup Core
+ */
+struct LatencyHistogram {
+    static constexpr std::size_t Buckets = 40;
+
+    std::uint64_t                      count    = 0;
+    std::uint64_t                      total_ns = 0;
+    std::uint64_t                      max_ns   = 0;
+    std::array<std::uint64_t, Buckets> buckets{};
+
+    [[nodiscard]] static constexpr std::size_t
+    bucket_of(std::uint64_t const ns) noexcept {
+        const auto b = static_cast<std::size_t>(std::bit_width(ns));
+        return b < Buckets ? b : Buckets - 1;
+    }
+
+    /// Largest duration bucket `b` can hold.
+    [[nodiscard]] static constexpr std::uint64_t
+    upper_bound(std::size_t const b) noexcept {
+        return b == 0 ? 0 : (std::uint64_t{1} << b) - 1;
+    }
+
+    void
+    add(std::uint64_t const ns) noexcept {
+        ++count;
+        total_ns += ns;
+        if (ns > max_ns)
+            max_ns = ns;
+        ++buckets[bucket_of(ns)];
+    }
+
+    [[nodiscard]] double
+    mean_ns() const noexcept {
+        return count ? static_cast<double>(total_ns) / static_cast<double>(count) : 0.;
+    }
+
+    /**
+     * @brief Upper bound of the bucket holding the `q`-quantile (0 < q <= 1), capped at `max_ns`.
+     * @details Accurate to a factor of two, which is the resolution of the buckets.
+     */
+    [[nodiscard]] std::uint64_t percentile(double q) const noexcept;
+};
+
+/**
+ * @struct CoreProfile
+ * @brief Copy of one core's `LoopProfiler`, returned by `Main::getCoreProfile()`.
+ * @ingroup Core
+ */
+struct CoreProfile {
+    /// Handler time of one event type, over every actor of the core that received it.
+    struct EventType {
+        Event::id_type   id   = 0;
+        char const      *name = nullptr; ///< `qb::event_type_name(id)`
+        LatencyHistogram handler;
+    };
+    /// Time spent in one actor of the core.
+    struct ActorEntry {
+        ActorId          id;
+        LatencyHistogram events;    ///< Handlers of unicast events addressed to it.
+        LatencyHistogram callbacks; ///< Its `on(LoopEvent)`.
+    };
+
+    CoreId                  core    = 0;
+    bool                    enabled = false; ///< `kLoopProfiler`, and the core was started.
+    LatencyHistogram        io;              ///< `listener::run` of one loop pass.
+    LatencyHistogram        callbacks;       ///< The whole callback dispatch of one loop pass.
+    std::vector<EventType>  event_types;     ///< Types that were routed at least once.
+    std::vector<ActorEntry> actors;          ///< Actors that handled an event or a callback.
+    /// Samples not attributed to a type or an actor because its table was full. They are still
+    /// counted by the other table and by the phase histograms.
+    std::uint64_t untracked = 0;
+};
+
+/**
+ * @class LoopProfiler
+ * @brief The histograms of one core: written by that core's thread, read from any thread.
+ * @details Owned by `SharedCoreCommunication`, one per core, and only created when
+ *          `kLoopProfiler`. Every counter is a relaxed atomic written by a plain load-add-store:
+ *          there is a single writer, so recording costs no read-modify-write, and a reader never
+ *          blocks it. A snapshot taken while the core runs may be torn between counters of one
+ *          histogram (a sample counted but not yet summed); it is exact after `Main::join()`.
+ *
+ *          Event types and actors are kept in fixed-size open-addressed tables; a key is
+ *          published (release) after its slot is claimed, so a reader sees only live slots.
+ * @ingroup Core
+ */
+class LoopProfiler : nocopy {
+public:
+    static constexpr std::size_t MaxEventTypes = 512;
+    static constexpr std::size_t MaxActors     = 1024;
+
+    LoopProfiler();
+    ~LoopProfiler() noexcept;
+
+    /// Monotonic nanoseconds for the hooks; only called when `kLoopProfiler`.
+    [[nodiscard]] static std::uint64_t now() noexcept;
+
+    /// One routed event. A broadcast destination is attributed to the type only.
+    void record_event(Event::id_type type, ActorId dest, std::uint64_t ns) noexcept;
+    /// One `on(LoopEvent)` callback of `actor`.
+    void record_callback(ActorId actor, std::uint64_t ns) noexcept;
+    /// One loop pass's `listener::run`.
+    void
+    record_io(std::uint64_t const ns) noexcept {
+        _io.add(ns);
+    }
+    /// One loop pass's whole callback dispatch.
+    void
+    record_callbacks(std::uint64_t const ns) noexcept {
+        _callbacks.add(ns);
+    }
+
+    [[nodiscard]] CoreProfile snapshot(CoreId core) const;
+
+private:
+    struct Histogram {
+        std::atomic<std::uint64_t>                                       count{0};
+        std::atomic<std::uint64_t>                                       total_ns{0};
+        std::atomic<std::uint64_t>                                       max_ns{0};
+        std::array<std::atomic<std::uint64_t>, LatencyHistogram::Buckets> buckets{};
+
+        void add(std::uint64_t ns) noexcept;
+        void read(LatencyHistogram &out) const noexcept;
+    };
+    struct TypeSlot {
+        std::atomic<std::uint32_t> key{0}; ///< type id + 1; 0 while free
+        Histogram                  handler;
+    };
+    struct ActorSlot {
+        std::atomic<std::uint32_t> key{0}; ///< sid + 1; 0 while free
+        Histogram                  events;
+        Histogram                  callbacks;
+    };
+
+    template <typename Slot>
+    static Slot *find_or_claim(Slot *slots, std::size_t capacity, std::uint32_t key) noexcept;
+    void         untracked() noexcept;
+
+    Histogram                    _io;
+    Histogram                    _callbacks;
+    std::unique_ptr<TypeSlot[]>  _types;
+    std::unique_ptr<ActorSlot[]> _actors;
+    std::atomic<std::uint64_t>   _untracked{0};
+};
+
+} // namespace qb
+
+#endif // QB_CORE_PROFILER_H
@@ -0,0 +1,409 @@
+/**
+ * @file qb/core/Recording.cpp
+ * @brief Implementation of `qb::Recorder`, `qb::Recording` and `qb::Replay`.
+ *
+ * The recorder runs on its core's thread, called from `VirtualCore::__record__`; the file is
+ * mapped a segment at a time, and reserved on disk before it is mapped, so a full disk stops
+ * the recording instead of raising `SIGBUS` in the loop. The reader maps the whole file.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <system_error>
+#include <qb/core/Recording.h>
+#include <qb/core/VirtualCore.h>
+
+#if defined(__linux__) || defined(__APPLE__) || defined(unix) || defined(__unix) || defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define QB_RECORDING_MMAP 1
+#endif
+
+namespace qb {
+
+namespace {
+constexpr char        kMagic[6]   = {'q', 'b', 'r', 'e', 'c', '\0'};
+constexpr std::size_t kRecordAlign = 16;
+constexpr std::size_t kTypeIds     = std::size_t{(std::numeric_limits<TypeId>::max)()} + 1;
+
+constexpr std::size_t
+aligned(std::size_t const bytes) noexcept {
+    return (bytes + kRecordAlign - 1) & ~(kRecordAlign - 1);
+}
+} // namespace
+
+// Recorder
+Recorder::~Recorder() noexcept {
+    close();
+}
+
+bool
+Recorder::open(std::string const &file, CoreId const core, std::uint64_t const origin_ns) noexcept {
+#if defined(QB_RECORDING_MMAP)
+    close();
+    std::error_code ignored;
+    if (const auto parent = std::filesystem::path(file).parent_path(); !parent.empty())
+        std::filesystem::create_directories(parent, ignored);
+    _fd = ::open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (_fd < 0) {
+        QB_LOG_WARN("cannot create recording " << file << ": " << std::strerror(errno));
+        return false;
+    }
+    _core    = core;
+    _segment = 0;
+    _records = 0;
+    _lost    = 0;
+    _described.assign(kTypeIds / 64, 0);
+    _held.clear();
+    if (!map_segment()) {
+        QB_LOG_WARN("cannot map recording " << file << ": " << std::strerror(errno));
+        ::close(_fd);
+        _fd = -1;
+        return false;
+    }
+    RecordingHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version       = kVersion;
+    header.bucket_bytes  = QB_LOCKFREE_EVENT_BUCKET_BYTES;
+    header.core          = core;
+    header.segment_bytes = kSegmentBytes;
+    header.origin_ns     = origin_ns;
+    std::memcpy(_map, &header, sizeof(header));
+    _cursor = sizeof(header);
+    return true;
+#else
+    static_cast<void>(core);
+    static_cast<void>(origin_ns);
+    QB_LOG_WARN("cannot record to " << file << ": recording needs mmap");
+    return false;
+#endif
+}
+
+bool
+Recorder::map_segment() noexcept {
+#if defined(QB_RECORDING_MMAP)
+    const auto offset = static_cast<off_t>(_segment * kSegmentBytes);
+#if defined(__linux__)
+    // Reserve the blocks: a sparse segment on a full disk would fault (SIGBUS) on first write.
+    if (const int error = ::posix_fallocate(_fd, offset, static_cast<off_t>(kSegmentBytes)); error != 0) {
+        errno = error;
+        return false;
+    }
+#else
+    if (::ftruncate(_fd, offset + static_cast<off_t>(kSegmentBytes)) != 0)
+        return false;
+#endif
+    int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+    flags |= MAP_POPULATE; // fault the segment in now rather than a page at a time from the loop
+#endif
+    void *const map = ::mmap(nullptr, kSegmentBytes, PROT_READ | PROT_WRITE, flags, _fd, offset);
+    if (map == MAP_FAILED)
+        return false;
+    _map    = static_cast<std::byte *>(map);
+    _cursor = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+Recorder::close() noexcept {
+#if defined(QB_RECORDING_MMAP)
+    if (_fd < 0)
+        return;
+    std::uint64_t length = _segment * kSegmentBytes;
+    if (_map) {
+        ::munmap(_map, kSegmentBytes);
+        _map = nullptr;
+        length += _cursor;
+    }
+    static_cast<void>(::ftruncate(_fd, static_cast<off_t>(length)));
+    ::close(_fd);
+    _fd = -1;
+#endif
+}
+
+void
+Recorder::append(RecordEntry const &entry, void const *const payload, std::size_t const bytes) noexcept {
+#if defined(QB_RECORDING_MMAP)
+    const std::size_t size = sizeof(RecordEntry) + aligned(bytes);
+    if (unlikely(!_map)) {
+        ++_lost;
+        return;
+    }
+    if (unlikely(_cursor + size > kSegmentBytes)) {
+        if (kSegmentBytes - _cursor >= sizeof(RecordEntry)) {
+            RecordEntry skip{};
+            skip.kind = RecordKind::Skip;
+            std::memcpy(_map + _cursor, &skip, sizeof(skip));
+        }
+        ::munmap(_map, kSegmentBytes);
+        _map = nullptr;
+        ++_segment;
+        if (!map_segment()) {
+            QB_LOG_WARN("recording of core(" << _core << ") stopped: cannot grow its file: " << std::strerror(errno));
+            ++_lost;
+            return;
+        }
+    }
+    std::memcpy(_map + _cursor, &entry, sizeof(entry));
+    // The segment was zero-filled on reservation: the padding up to `size` is already zero.
+    std::memcpy(_map + _cursor + sizeof(entry), payload, bytes);
+    _cursor += size;
+    ++_records;
+#else
+    static_cast<void>(entry);
+    static_cast<void>(payload);
+    static_cast<void>(bytes);
+#endif
+}
+
+void
+Recorder::describe(TypeId const type) noexcept {
+    _described[type / 64] |= std::uint64_t{1} << (type % 64);
+    char const *const name = qb::event_type_name(type);
+    RecordEntry       entry{};
+    entry.type  = type;
+    entry.bytes = static_cast<std::uint32_t>(std::strlen(name) + 1);
+    entry.kind  = RecordKind::Type;
+    append(entry, name, entry.bytes);
+}
+
+void
+Recorder::record(RecordKind const kind, Event const &event, std::uint64_t const now_ns) noexcept {
+    if (unlikely(!(_described[event.id / 64] >> (event.id % 64) & 1u)))
+        describe(event.id);
+    // The unicast size of a multicast copy; what the loop stores of a packable event.
+    const std::size_t buckets = event.state.bits.multicast ? detail::multicast_footer::of(event).buckets : event.bucket_size;
+    const std::size_t bytes   = buckets == 1 && event.state.bits.compact ? event.state.bits.compact * detail::packed_bucket::slot_bytes
+                                                                         : buckets * sizeof(EventBucket);
+    RecordEntry       entry{};
+    entry.time_ns = now_ns;
+    entry.dest    = event.dest;
+    entry.source  = event.source;
+    entry.type    = event.id;
+    entry.buckets = static_cast<std::uint16_t>(buckets);
+    entry.bytes   = static_cast<std::uint32_t>(bytes);
+    entry.kind    = kind;
+    entry.flags   = static_cast<std::uint8_t>((event.state.bits.owning ? RecordEntry::Owning : 0) |
+                                              (kind == RecordKind::Inbound && event.source.index() == _core ? RecordEntry::Local : 0));
+    append(entry, &event, bytes);
+}
+
+// Recording
+Recording::~Recording() noexcept {
+    close();
+}
+
+bool
+Recording::open(std::string const &file) noexcept {
+#if defined(QB_RECORDING_MMAP)
+    close();
+    const int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+    struct stat info{};
+    void       *map = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(RecordingHeader))
+        map = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        return false;
+    _map  = static_cast<std::byte const *>(map);
+    _size = static_cast<std::size_t>(info.st_size);
+    auto const &head = header();
+    if (std::memcmp(head.magic, kMagic, sizeof(kMagic)) != 0 || head.version != Recorder::kVersion
+        || head.bucket_bytes != QB_LOCKFREE_EVENT_BUCKET_BYTES || head.segment_bytes < sizeof(RecordingHeader) + sizeof(RecordEntry)
+        || head.segment_bytes % kRecordAlign) {
+        close();
+        return false;
+    }
+    _names.assign(kTypeIds, nullptr);
+    rewind();
+    return true;
+#else
+    static_cast<void>(file);
+    return false;
+#endif
+}
+
+void
+Recording::close() noexcept {
+#if defined(QB_RECORDING_MMAP)
+    if (_map)
+        ::munmap(const_cast<std::byte *>(_map), _size);
+#endif
+    _map  = nullptr;
+    _size = 0;
+    _names.clear();
+}
+
+bool
+Recording::next(RecordView &record) noexcept {
+    if (!_map)
+        return false;
+    const std::size_t segment = header().segment_bytes;
+    while (true) {
+        const std::size_t left = segment - _cursor % segment;
+        if (left < sizeof(RecordEntry)) {
+            _cursor += left;
+            continue;
+        }
+        if (_cursor + sizeof(RecordEntry) > _size)
+            return false;
+        auto const &entry = *reinterpret_cast<RecordEntry const *>(_map + _cursor);
+        if (entry.kind == RecordKind::End)
+            return false;
+        if (entry.kind == RecordKind::Skip) {
+            _cursor += left;
+            continue;
+        }
+        const std::size_t size = sizeof(RecordEntry) + aligned(entry.bytes);
+        if (size > left || _cursor + size > _size)
+            return false; // torn: the writer died mid-record
+        auto const *const payload = _map + _cursor + sizeof(RecordEntry);
+        _cursor += size;
+        if (entry.kind == RecordKind::Type) {
+            if (entry.bytes && payload[entry.bytes - 1] == std::byte{0})
+                _names[entry.type] = reinterpret_cast<char const *>(payload);
+            continue;
+        }
+        record.entry   = &entry;
+        record.payload = payload;
+        return true;
+    }
+}
+
+// Replay
+Replay::Replay(ReplayPolicy policy) noexcept
+    : _policy(std::move(policy)) {}
+
+qb::io::async::task<bool>
+Replay::onInit() {
+    if (!_recording.open(_policy.file)) {
+        QB_LOG_CRIT(*this << " cannot replay " << _policy.file << ": missing, or not a recording of this build");
+        co_return false;
+    }
+    _types.assign(kTypeIds, 0);
+    _resolved.assign(kTypeIds, false);
+    registerCallback(*this);
+    co_return true;
+}
+
+bool
+Replay::wanted(RecordEntry const &entry) const noexcept {
+    return entry.kind == _policy.kind && (_policy.local || !(entry.flags & RecordEntry::Local));
+}
+
+TypeId
+Replay::local_type(TypeId const recorded) noexcept {
+    if (_resolved[recorded])
+        return _types[recorded];
+    // Resolved when first met, not in onInit(): the replayed actors register their types as
+    // they initialise, and may do so after this one.
+    _resolved[recorded] = true;
+    if (char const *const name = _recording.type_name(recorded)) {
+        for (auto const *slot = detail::_type_id_registry.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+            if (std::strcmp(slot->name, name) == 0) {
+                _types[recorded] = slot->id;
+                break;
+            }
+        }
+    }
+    return _types[recorded];
+}
+
+ActorId
+Replay::route(ActorId const recorded) const {
+    if (_policy.route)
+        return _policy.route(recorded);
+    return recorded.is_broadcast() ? BroadcastId(getIndex()) : ActorId(recorded.sid(), getIndex());
+}
+
+void
+Replay::inject(RecordView const &record) {
+    auto const  &entry = *record.entry;
+    const TypeId type  = local_type(entry.type);
+    const auto   dest  = route(ActorId(entry.dest));
+    if (!type || (entry.flags & RecordEntry::Owning) || type == Event::type_to_id<KillEvent>()
+        || static_cast<std::uint32_t>(dest) == ActorId::NotFound) {
+        ++_skipped;
+        return;
+    }
+    const auto source = route(ActorId(entry.source));
+    _scratch.assign(entry.buckets, EventBucket{});
+    std::memcpy(_scratch.data(), record.payload, (std::min)(std::size_t{entry.bytes}, _scratch.size() * sizeof(EventBucket)));
+    auto &event = *reinterpret_cast<Event *>(_scratch.data());
+    event.id                   = type;
+    event.dest                 = dest;
+    event.source               = static_cast<std::uint32_t>(source) == ActorId::NotFound ? ActorId(entry.source) : source;
+    event.bucket_size          = entry.buckets;
+    event.state.bits.multicast = 0;
+    event.state.bits.packed    = 0;
+    push(event);
+    ++_injected;
+}
+
+void
+Replay::finish() noexcept {
+    if (static_cast<std::uint32_t>(_policy.notify) != ActorId::NotFound) {
+        auto &done    = push<ReplayDone>(_policy.notify);
+        done.injected = _injected;
+        done.skipped  = _skipped;
+    }
+    kill();
+}
+
+void
+Replay::on(LoopEvent const &loop) {
+    if (!is_alive())
+        return;
+    for (std::size_t n = 0; n < _policy.batch;) {
+        if (!_has_pending) {
+            if (!_recording.next(_pending)) {
+                finish();
+                return;
+            }
+            if (!wanted(*_pending.entry))
+                continue;
+            _has_pending = true;
+            if (!_started) {
+                _started  = true;
+                _first_ns = _pending.entry->time_ns;
+                _start_ns = loop.now;
+            }
+        }
+        if (_policy.speed > 0) {
+            const auto recorded = _pending.entry->time_ns > _first_ns ? _pending.entry->time_ns - _first_ns : 0u;
+            if (static_cast<double>(recorded) / _policy.speed > static_cast<double>(loop.now - _start_ns))
+                return;
+        }
+        _has_pending = false;
+        inject(_pending);
+        ++n;
+    }
+}
+
+} // namespace qb
@@ -0,0 +1,326 @@
+/**
+ * @file qb/core/Recording.h
+ * @brief Per-core recording of the event stream to a mapped file, and its replay.
+ *
+ * A regression that only shows under production traffic is hard to chase with a synthetic load:
+ * the mix of event types, sizes, fan-in and burst shape is what the dispatch path is tuned for.
+ * `CoreInitializer::setRecording()` gives a core a `Recorder` that appends every event it
+ * receives and every event it flushes to another core — header, payload bytes, loop timestamp —
+ * to an append-only memory-mapped file. `qb::Replay` reads such a file back and re-injects the
+ * stream into an engine, at the recorded pace or faster.
+ *
+ * @code
+ * // record
+ * main.setRecording("/var/tmp/capture"); // core-<id>.qbrec per core
+ * // replay core 0's inbound stream into a one-core engine holding the same actors
+ * qb::ReplayPolicy policy;
+ * policy.file  = "/var/tmp/capture/core-0.qbrec";
+ * policy.speed = 4.0;
+ * replay.addActor<qb::Replay>(0, policy);
+ * @endcode
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_RECORDING_H
+#define QB_CORE_RECORDING_H
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Actor.h"
+#include "ICallback.h"
+#include "Main.h"
+
+namespace qb {
+
+/**
+ * @enum RecordKind
+ * @ingroup Core
+ * @brief What a record of a `.qbrec` file holds.
+ */
+enum class RecordKind : std::uint8_t {
+    End      = 0,    ///< Unwritten space: the recording stops here.
+    Inbound  = 1,    ///< An event the core received, before its gates and handlers.
+    Outbound = 2,    ///< An event the core flushed towards another core, a QoS-0 drop included.
+    Type     = 3,    ///< The `typeid` name of a recorded type id; precedes its first use.
+    Skip     = 0xFF, ///< The rest of the segment is unused.
+};
+
+/**
+ * @struct RecordingHeader
+ * @ingroup Core
+ * @brief First bytes of a `.qbrec` file.
+ */
+struct RecordingHeader {
+    char          magic[6];      ///< "qbrec"
+    std::uint16_t version;       ///< `Recorder::kVersion`
+    std::uint16_t bucket_bytes;  ///< `QB_LOCKFREE_EVENT_BUCKET_BYTES` of the recording build
+    CoreId        core;          ///< the recorded core
+    std::uint32_t reserved;
+    std::uint64_t segment_bytes; ///< records never straddle a multiple of this
+    std::uint64_t origin_ns;     ///< wall clock when recording started
+};
+
+/**
+ * @struct RecordEntry
+ * @ingroup Core
+ * @brief Header of one record; `bytes` of payload follow it.
+ * @details For an event record the payload is the event as it sat in its buckets, header
+ *          included: `compact * 16` bytes for a one-bucket event that fits a `packed_bucket`
+ *          slot run, `buckets * bucket_bytes` otherwise. `dest`, `source` and `type` repeat the
+ *          header fields so a reader need not parse the payload. Records are 16-byte aligned.
+ */
+struct RecordEntry {
+    std::uint64_t time_ns; ///< `Actor::time()` of the loop pass that saw the event
+    std::uint32_t dest;    ///< `ActorId` as recorded (the target sid for a multicast copy)
+    std::uint32_t source;
+    TypeId        type;    ///< recording-process type id: resolve it with the `Type` records
+    std::uint16_t buckets; ///< unicast `bucket_size` of the event
+    std::uint32_t bytes;   ///< payload bytes following this entry
+    RecordKind    kind;
+    std::uint8_t  flags;   ///< `RecordEntry::Owning`, `RecordEntry::Local`
+    std::uint8_t  reserved[6];
+
+    /// The event's type is not trivially destructible: its payload points at heap it owned.
+    static constexpr std::uint8_t Owning = 1;
+    /// An `Inbound` event the recorded core sent itself.
+    static constexpr std::uint8_t Local = 2;
+};
+static_assert(sizeof(RecordingHeader) == 32 && sizeof(RecordEntry) == 32, "the file layout is fixed");
+
+/**
+ * @class Recorder
+ * @ingroup Core
+ * @brief Appends one core's event stream to a memory-mapped file.
+ * @details Owned by the `VirtualCore` it records (`CoreInitializer::setRecording()`) and only
+ *          touched by its thread. The file grows a segment at a time: each segment is reserved
+ *          on disk and mapped when the previous one is full, so a record is two `memcpy` into
+ *          mapped memory and the loop never calls into the kernel between segments. Closing
+ *          unmaps and trims the file to what was written; a process that dies before leaves
+ *          zeroes after the last record, which read as `RecordKind::End`.
+ *
+ *          Timestamps are the loop pass's `Actor::time()`, so events of one pass share one. When
+ *          a segment cannot be reserved (disk full) recording stops and `lost()` counts what
+ *          was not written; the core keeps running.
+ */
+class Recorder {
+public:
+    static constexpr std::uint16_t kVersion      = 1;
+    static constexpr std::size_t   kSegmentBytes = std::size_t{16} << 20;
+
+    Recorder() noexcept = default;
+    ~Recorder() noexcept;
+    Recorder(Recorder const &)            = delete;
+    Recorder &operator=(Recorder const &) = delete;
+
+    /// Create or truncate @p file and write its header. False, logged, when it cannot.
+    [[nodiscard]] bool open(std::string const &file, CoreId core, std::uint64_t origin_ns) noexcept;
+    /// Append @p event, seen by the pass that started at @p now_ns.
+    void record(RecordKind kind, Event const &event, std::uint64_t now_ns) noexcept;
+    /// Unmap and trim the file to its records; `open()` may follow.
+    void close() noexcept;
+
+    /// A flush left lane @p lane with its first event recorded but not sent.
+    void
+    hold(std::size_t const lane) {
+        if (lane >= _held.size())
+            _held.resize(lane + 1, false);
+        _held[lane] = true;
+    }
+    /// Whether lane @p lane's first event was recorded by the flush that left it; clears it.
+    [[nodiscard]] bool
+    release(std::size_t const lane) noexcept {
+        if (lane >= _held.size() || !_held[lane])
+            return false;
+        _held[lane] = false;
+        return true;
+    }
+
+    [[nodiscard]] std::uint64_t
+    records() const noexcept {
+        return _records;
+    }
+    [[nodiscard]] std::uint64_t
+    lost() const noexcept {
+        return _lost;
+    }
+
+private:
+    [[nodiscard]] bool map_segment() noexcept;
+    void               append(RecordEntry const &entry, void const *payload, std::size_t bytes) noexcept;
+    void               describe(TypeId type) noexcept;
+
+    int                        _fd      = -1;
+    std::byte                 *_map     = nullptr; ///< the current segment
+    std::uint64_t              _segment = 0;
+    std::size_t                _cursor  = 0; ///< within the current segment
+    CoreId                     _core    = 0;
+    std::vector<std::uint64_t> _described; ///< one bit per type id with a `Type` record
+    std::vector<bool>          _held;
+    std::uint64_t              _records = 0;
+    std::uint64_t              _lost    = 0;
+};
+
+/**
+ * @struct RecordView
+ * @ingroup Core
+ * @brief One event record of a `Recording`: its entry and its payload bytes, in the mapping.
+ */
+struct RecordView {
+    RecordEntry const *entry   = nullptr;
+    std::byte const   *payload = nullptr;
+};
+
+/**
+ * @class Recording
+ * @ingroup Core
+ * @brief Read-only cursor over a `.qbrec` file, mapped whole.
+ */
+class Recording {
+public:
+    Recording() noexcept = default;
+    ~Recording() noexcept;
+    Recording(Recording const &)            = delete;
+    Recording &operator=(Recording const &) = delete;
+
+    /// Map @p file and check its header. False when it is missing, foreign, or was recorded
+    /// with another bucket size.
+    [[nodiscard]] bool open(std::string const &file) noexcept;
+    void               close() noexcept;
+    [[nodiscard]] bool
+    is_open() const noexcept {
+        return _map != nullptr;
+    }
+    [[nodiscard]] RecordingHeader const &
+    header() const noexcept {
+        return *reinterpret_cast<RecordingHeader const *>(_map);
+    }
+
+    /// Advance to the next event record; false at the end of the recording.
+    [[nodiscard]] bool next(RecordView &record) noexcept;
+    /// Back to the first record.
+    void
+    rewind() noexcept {
+        _cursor = sizeof(RecordingHeader);
+    }
+    /// `typeid` name of recorded type id @p type, once its `Type` record was read; else nullptr.
+    [[nodiscard]] char const *
+    type_name(TypeId const type) const noexcept {
+        return type < _names.size() ? _names[type] : nullptr;
+    }
+
+private:
+    std::byte const          *_map    = nullptr;
+    std::size_t               _size   = 0;
+    std::size_t               _cursor = 0;
+    std::vector<char const *> _names;
+};
+
+/**
+ * @struct ReplayPolicy
+ * @ingroup Core
+ * @brief What `qb::Replay` injects, where, and how fast.
+ */
+struct ReplayPolicy {
+    /// A file written by `CoreInitializer::setRecording()`.
+    std::string file;
+    /// 1 replays at the recorded pace, 4 four times faster; 0 as fast as the loop allows.
+    double speed = 1.0;
+    /// Most events injected per loop pass.
+    std::size_t batch = 4096;
+    /// Which side of the recorded core: what it received, or what it sent to other cores.
+    RecordKind kind = RecordKind::Inbound;
+    /// Also inject the inbound events the recorded core sent itself. Turn it off when the
+    /// replayed actors send those again on their own.
+    bool local = true;
+    /// Destination of a recorded destination; `ActorId::NotFound` skips the event. Empty: the
+    /// same sid (or broadcast) on the replaying core.
+    std::function<ActorId(ActorId recorded)> route;
+    /// Sent a `ReplayDone` when the recording is exhausted.
+    ActorId notify;
+};
+
+/**
+ * @struct ReplayDone
+ * @ingroup Core
+ * @brief End of a `qb::Replay`: what it injected and what it could not.
+ */
+struct ReplayDone : public Event {
+    std::uint64_t injected = 0;
+    std::uint64_t skipped  = 0;
+};
+
+/**
+ * @class Replay
+ * @ingroup Core
+ * @brief Re-injects a recorded event stream into the engine it runs in.
+ * @details Each loop pass it pushes the records that are due — their recorded offset from the
+ *          first record, divided by `speed`, has elapsed — up to `batch`, then kills itself
+ *          after notifying `ReplayDone`. Type ids differ between runs, so each recorded id is
+ *          mapped to this process's id for the same type name when first met; the types must
+ *          be registered (an actor subscribed to them, or one was sent) by then.
+ *
+ *          Only payload bytes were recorded, so some records cannot be replayed and are counted
+ *          in `skipped`: types this process does not know, types that own heap (the pointers
+ *          in their bytes are dead — give such hot events a trivially destructible shape, or
+ *          replay a stand-in), and `KillEvent`s, which would stop the replaying engine. Ids and
+ *          pointers inside a payload are injected as recorded.
+ */
+class Replay final
+    : public Actor
+    , public ICallback {
+public:
+    explicit Replay(ReplayPolicy policy) noexcept;
+    ~Replay() noexcept final = default;
+
+    qb::io::async::task<bool> onInit() final;
+    void                      on(LoopEvent const &loop) final;
+
+    [[nodiscard]] std::uint64_t
+    injected() const noexcept {
+        return _injected;
+    }
+    [[nodiscard]] std::uint64_t
+    skipped() const noexcept {
+        return _skipped;
+    }
+
+private:
+    [[nodiscard]] bool    wanted(RecordEntry const &entry) const noexcept;
+    [[nodiscard]] TypeId  local_type(TypeId recorded) noexcept;
+    [[nodiscard]] ActorId route(ActorId recorded) const;
+    void                  inject(RecordView const &record);
+    void                  finish() noexcept;
+
+    const ReplayPolicy       _policy;
+    Recording                _recording;
+    std::vector<TypeId>      _types; ///< recorded id -> local id; 0 unknown
+    std::vector<bool>        _resolved;
+    std::vector<EventBucket> _scratch;
+    RecordView               _pending;
+    bool                     _has_pending = false;
+    bool                     _started     = false;
+    std::uint64_t            _first_ns    = 0; ///< recorded time of the first record
+    std::uint64_t            _start_ns    = 0; ///< loop time it was injected
+    std::uint64_t            _injected    = 0;
+    std::uint64_t            _skipped     = 0;
+};
+
+} // namespace qb
+
+#endif // QB_CORE_RECORDING_H
@@ -0,0 +1,131 @@
+/**
+ * @file qb/core/SharedSlab.cpp
+ * @brief Block management of `qb::SharedSlab` and the drop path of `qb::SharedEventRef`.
+ *
+ * The enqueue and receive sides live with the rest of the transport in `VirtualCore.cpp`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <new>
+#include <qb/system/event/router.h>
+#include "SharedSlab.h"
+
+namespace qb {
+
+// Header of every block; the event storage starts right after it, bucket-aligned.
+struct QB_LOCKFREE_CACHELINE_ALIGNMENT SharedSlab::Block {
+    SharedSlab                *owner;
+    Block                     *next;
+    std::atomic<std::uint32_t> refs;
+    std::uint32_t              size_class;
+
+    [[nodiscard]] EventBucket *
+    storage() noexcept {
+        return reinterpret_cast<EventBucket *>(this + 1);
+    }
+    [[nodiscard]] static Block *
+    of(Event const &payload) noexcept {
+        return reinterpret_cast<Block *>(const_cast<Event *>(&payload)) - 1;
+    }
+    [[nodiscard]] static std::size_t
+    bytes(std::size_t const size_class) noexcept {
+        return sizeof(Block) + (kSharedEventMinBuckets << size_class) * sizeof(EventBucket);
+    }
+};
+
+namespace {
+constexpr std::align_val_t kBlockAlignment{QB_LOCKFREE_CACHELINE_BYTES};
+} // namespace
+
+SharedSlab::~SharedSlab() noexcept {
+    reclaim();
+    for (std::size_t c = 0; c < kNbClasses; ++c) {
+        while (auto *block = _free[c]) {
+            _free[c] = block->next;
+            block->~Block();
+            ::operator delete(block, Block::bytes(c), kBlockAlignment);
+        }
+    }
+}
+
+EventBucket *
+SharedSlab::allocate(std::size_t const buckets) noexcept {
+    static_assert(sizeof(Block) % sizeof(EventBucket) == 0, "the event storage must stay bucket-aligned");
+    const auto size_class = static_cast<std::uint32_t>(std::bit_width((buckets - 1) / kSharedEventMinBuckets));
+    if (!_free[size_class])
+        reclaim();
+    Block *block = _free[size_class];
+    if (block) {
+        _free[size_class] = block->next;
+        --_cached[size_class];
+    } else {
+        block = new (::operator new(Block::bytes(size_class), kBlockAlignment)) Block{this, nullptr, {0}, size_class};
+    }
+    block->refs.store(1, std::memory_order_relaxed);
+    return block->storage();
+}
+
+void
+SharedSlab::retain(Event const &payload, std::uint32_t const count) noexcept {
+    Block::of(payload)->refs.fetch_add(count, std::memory_order_relaxed);
+}
+
+void
+SharedSlab::release(Event const &payload) noexcept {
+    auto *const block = Block::of(payload);
+    if (block->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+    // Treiber push onto the owner's stack. Only the owner pops, and it takes the whole stack at
+    // once, so there is no ABA window.
+    auto &returned = block->owner->_returned;
+    block->next    = returned.load(std::memory_order_relaxed);
+    while (!returned.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+void
+SharedSlab::reclaim() noexcept {
+    auto *block = _returned.exchange(nullptr, std::memory_order_acquire);
+    while (block) {
+        auto *const next = block->next;
+        recycle(block);
+        block = next;
+    }
+}
+
+void
+SharedSlab::recycle(Block *const block) noexcept {
+    const auto size_class = block->size_class;
+    if (_cached[size_class] >= kMaxCachedPerClass) {
+        block->~Block();
+        ::operator delete(block, Block::bytes(size_class), kBlockAlignment);
+        return;
+    }
+    block->next       = _free[size_class];
+    _free[size_class] = block;
+    ++_cached[size_class];
+}
+
+SharedEventRef::~SharedEventRef() noexcept {
+    // Only reached when the descriptor itself is disposed, i.e. the event was never delivered.
+    if (payload) {
+        router::memh<Event>{}.dispose(*payload);
+        SharedSlab::release(*payload);
+    }
+}
+
+} // namespace qb
@@ -0,0 +1,168 @@
+/**
+ * @file qb/core/SharedSlab.h
+ * @brief Per-core reference-counted slab that carries large cross-core events by reference.
+ *
+ * A cross-core event normally travels by value: it is constructed in the sender's outbound
+ * `VirtualPipe`, copied bucket by bucket into the destination `Mailbox` ring on flush, copied
+ * again into the receiver's scratch buffer, and dispatched from there. For a multi-KB event the
+ * two copies dominate, and an event wider than the ring (`Mailbox::capacity()`) cannot travel
+ * at all.
+ *
+ * An event of at least `kSharedEventMinBuckets` buckets pushed to another core is instead
+ * constructed in a block of the SENDING core's `SharedSlab`, and only a one-bucket
+ * `SharedEventRef` descriptor goes through the pipe and the ring. The receiver dispatches the
+ * event in place, in the sender's block, then releases the block; the last release returns it to
+ * the owning core's free lists through a lock-free stack. Ordering is unchanged — the descriptor
+ * occupies the event's place in the FIFO pipe.
+ *
+ * Taken only by the ordered enqueue paths (`Actor::push`, `Pipe::push`, `Pipe::allocated_push`,
+ * and the engine's own re-push of a received event, e.g. `reply`/`forward`). `send()`/`broadcast()`
+ * and `EventQOS0` events keep the by-value path: a QoS-0 event may be dropped without disposal.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_SHARED_SLAB_H
+#define QB_CORE_SHARED_SLAB_H
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <qb/utility/nocopy.h>
+#include <qb/utility/prefix.h>
+#include "ActorId.h"
+#include "Event.h"
+
+namespace qb {
+
+/**
+ * @brief Smallest event, in buckets, that crosses cores through a `SharedSlab`.
+ * @details 1 KiB with the default 64-byte bucket. Below it the two bucket copies cost less than
+ *          a slab block round trip (allocation, release, return to the owner).
+ * @ingroup EventCore
+ */
+inline constexpr std::size_t kSharedEventMinBuckets = 1024u / QB_LOCKFREE_EVENT_BUCKET_BYTES;
+
+/**
+ * @class SharedSlab
+ * @ingroup Core
+ * @brief Size-classed pool of reference-counted event blocks owned by one core.
+ * @details One per core, owned by `SharedCoreCommunication` so it outlives every `VirtualCore`
+ *          and the teardown mailbox sweep. `allocate()` is called by the owning core only;
+ *          `release()` by whichever core finished with the event. A block whose last reference
+ *          is released on another core is pushed onto the owner's `_returned` stack (lock-free,
+ *          multi-producer) and moved back to the owner's free lists on its next allocation miss.
+ *
+ *          Classes are powers of two from `kSharedEventMinBuckets` up to the 65535-bucket limit
+ *          of `Event::bucket_size`; each class keeps at most `kMaxCachedPerClass` idle blocks.
+ */
+class SharedSlab : nocopy {
+public:
+    /// Enough classes for the widest event `bucket_size` can describe.
+    static constexpr std::size_t kNbClasses =
+        std::bit_width(((std::numeric_limits<std::uint16_t>::max)() + kSharedEventMinBuckets - 1) / kSharedEventMinBuckets - 1) + 1;
+    static constexpr std::size_t kMaxCachedPerClass = 64;
+
+    SharedSlab() = default;
+    ~SharedSlab() noexcept;
+
+    /**
+     * @brief Storage for an event of @p buckets buckets, with one reference held by the caller.
+     * @details Owner core only. Terminates on allocation failure, like every enqueue path.
+     */
+    [[nodiscard]] EventBucket *allocate(std::size_t buckets) noexcept;
+
+    /**
+     * @brief Add @p count references to the block holding @p payload.
+     * @details For a sender that hands the same block to several receivers.
+     */
+    static void retain(Event const &payload, std::uint32_t count = 1) noexcept;
+
+    /**
+     * @brief Drop one reference to the block holding @p payload; the last one returns it.
+     * @details Any core. Frees memory only — the event's destructor is the caller's business.
+     */
+    static void release(Event const &payload) noexcept;
+
+    /**
+     * @class Lease
+     * @brief Releases a shared event when the receive loop is done with it.
+     */
+    class Lease : nocopy {
+        Event *_payload;
+
+    public:
+        explicit Lease(Event *payload) noexcept
+            : _payload(payload) {}
+        ~Lease() noexcept {
+            if (_payload)
+                SharedSlab::release(*_payload);
+        }
+        [[nodiscard]] Event *
+        get() const noexcept {
+            return _payload;
+        }
+    };
+
+private:
+    struct Block;
+
+    void reclaim() noexcept;
+    void recycle(Block *block) noexcept;
+
+    std::array<Block *, kNbClasses>       _free{};
+    std::array<std::uint32_t, kNbClasses> _cached{};
+    // Written by every peer core: keep it off the owner's cache line.
+    alignas(QB_LOCKFREE_CACHELINE_BYTES) std::atomic<Block *> _returned{nullptr};
+};
+
+/**
+ * @struct SharedEventRef
+ * @ingroup EventCore
+ * @brief The one-bucket descriptor that travels in place of a slab-resident event.
+ * @details Carries the payload's destination (mailbox routing), source and QoS. The receive loop
+ *          dispatches `*payload` and releases it; the destructor only runs on the drop paths
+ *          (undeliverable at teardown), where it disposes the payload and releases its block.
+ */
+struct SharedEventRef : public Event {
+    Event *payload = nullptr;
+
+    SharedEventRef() = default;
+    explicit SharedEventRef(Event *event) noexcept
+        : payload(event) {}
+    ~SharedEventRef() noexcept;
+};
+
+namespace detail {
+/**
+ * @brief Slab storage for an event of @p buckets buckets pushed to @p dest by the calling core.
+ * @return `nullptr` when the event must take the bucket path: same core, too small, or no
+ *         running `VirtualCore` on this thread.
+ */
+[[nodiscard]] EventBucket *shared_event_storage(ActorId dest, std::size_t buckets) noexcept;
+
+/**
+ * @brief Queue the `SharedEventRef` for @p payload — built in `shared_event_storage()` storage —
+ *        at the back of @p pipe.
+ */
+void shared_event_publish(VirtualPipe &pipe, Event const &payload) noexcept;
+} // namespace detail
+
+} // namespace qb
+
+#endif // QB_CORE_SHARED_SLAB_H
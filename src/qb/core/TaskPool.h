@@ -0,0 +1,147 @@
+/**
+ * @file qb/core/TaskPool.h
+ * @brief Per-core work-stealing task queues: the engine half of `qb::offload` / `qb::parallel_for`.
+ *
+ * A task is a `detail::task_group` cut into chunks. The submitting core pushes one `pool_job` per
+ * chunk onto its own `TaskQueue`, a Chase-Lev deque owned by `SharedCoreCommunication`. Every
+ * `VirtualCore` runs at most one job per loop pass. It pops its own queue first, and an idle pass
+ * steals from a peer's. The core that finishes the last chunk calls `complete()`, which reports
+ * back to the spawning actor with an ordinary event push, so the result reaches the actor on its
+ * own core, in its own event order, and nothing else crosses threads.
+ *
+ * Jobs are short, CPU-bound closures: a job holds its core for its whole run, exactly like an
+ * event handler. Blocking or long-running work still belongs on its own actor or thread.
+ * The awaitable helpers built on this live in `qb/core/patterns/parallel.h`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_TASK_POOL_H
+#define QB_CORE_TASK_POOL_H
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <qb/system/lockfree/work_stealing_deque.h>
+#include <qb/utility/nocopy.h>
+#include "ActorId.h"
+#include "Event.h"
+
+namespace qb {
+
+namespace detail {
+
+class task_group;
+
+/// One chunk of a `task_group`, the unit a `TaskQueue` holds and a core steals.
+struct pool_job {
+    task_group   *group = nullptr;
+    std::uint32_t index = 0;
+};
+
+/**
+ * @class task_group
+ * @brief A submitted task: `chunks()` independent pieces and one completion.
+ * @details Allocated by the submitter and owned by nobody while in flight; `complete()` takes
+ *          ownership once the last chunk has run (it usually hands itself to an event). Chunks
+ *          run on any core, concurrently, so `run()` must only touch its own chunk's state.
+ */
+class task_group : nocopy {
+    std::unique_ptr<pool_job[]> _jobs;
+    const std::uint32_t         _chunks;
+    std::atomic<std::uint32_t>  _pending;
+
+protected:
+    /// Execute chunk @p index. Must not throw: store the exception for `complete()` to forward.
+    virtual void run(std::uint32_t index) noexcept = 0;
+    /// Called once, on the core that ran the last chunk; owns `this` from here on.
+    virtual void complete() noexcept = 0;
+
+public:
+    const ActorId owner; ///< the spawning actor, where `complete()` reports
+
+    task_group(ActorId const owner_id, std::uint32_t const chunks)
+        : _jobs(new pool_job[chunks])
+        , _chunks(chunks)
+        , _pending(chunks)
+        , owner(owner_id) {
+        for (std::uint32_t i = 0; i < chunks; ++i)
+            _jobs[i] = pool_job{this, i};
+    }
+    virtual ~task_group() = default;
+
+    [[nodiscard]] std::uint32_t
+    chunks() const noexcept {
+        return _chunks;
+    }
+    [[nodiscard]] pool_job *
+    job(std::uint32_t const index) const noexcept {
+        return &_jobs[index];
+    }
+
+    /// Run chunk @p index; the last one to finish completes the group.
+    void
+    execute(std::uint32_t const index) noexcept {
+        run(index);
+        if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            complete();
+    }
+
+    /// Teardown: drop chunk @p index without running it; the last one frees the group.
+    void
+    abandon() noexcept {
+        if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+};
+
+/**
+ * @brief Queue every chunk of @p group on the calling core and wake parked peers to steal.
+ * @return false, and @p group untouched, when no `VirtualCore` runs on this thread or its task
+ *         queue could not grow.
+ */
+[[nodiscard]] bool task_submit(task_group *group) noexcept;
+
+/// Number of cores that run tasks: the engine's core count, or 1 outside a running core.
+[[nodiscard]] std::size_t task_workers() noexcept;
+
+} // namespace detail
+
+/// A core's task queue: chunk pointers, pushed and popped by its owner, stolen by its peers.
+using TaskQueue = lockfree::work_stealing_deque<detail::pool_job *>;
+
+/**
+ * @struct TaskDoneEvent
+ * @ingroup EventCore
+ * @brief Carries a completed `task_group` back to the actor awaiting it.
+ * @details Engine-private like the migration control events: no actor subscribes it, so it reaches
+ *          `VirtualCore::__on_unrouted__`, which resolves the awaiting continuation through its
+ *          `correlation_id`. The group travels with the event and dies with it when nobody waits
+ *          any more (the coroutine was cancelled, the actor died, the engine stopped).
+ */
+struct TaskDoneEvent : public CorrelatedEvent {
+    std::unique_ptr<detail::task_group> group;
+
+    TaskDoneEvent() = default;
+    TaskDoneEvent(std::uint64_t const id, detail::task_group *const done) noexcept
+        : group(done) {
+        correlation_id = id;
+    }
+};
+
+} // namespace qb
+
+#endif // QB_CORE_TASK_POOL_H
@@ -0,0 +1,250 @@
+/**
+ * @file qb/core/Telemetry.cpp
+ * @brief Implementation of the `qb::Telemetry` engine service.
+ *
+ * Sampling reads the owning core's `VirtualCore::Totals`, mailbox and I/O loop (friend access,
+ * same thread); publishing is plain file and socket I/O on the collector's core.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <qb/core/Telemetry.h>
+#include <qb/core/VirtualCore.h>
+#include <qb/json.h>
+
+namespace qb {
+
+namespace {
+// How often the collector accepts scrapers on its Unix socket, independently of `interval`.
+constexpr std::uint64_t kServePeriodNs = 10'000'000u;
+// How long a scraper that stopped reading keeps its unsent tail before it is dropped.
+constexpr std::uint64_t kScrapeTimeoutNs = 5'000'000'000u;
+
+std::uint64_t
+to_ns(std::chrono::milliseconds const period) noexcept {
+    return static_cast<std::uint64_t>(std::chrono::nanoseconds(period).count());
+}
+} // namespace
+
+Telemetry::Telemetry(TelemetryPolicy policy) noexcept
+    : _policy(std::move(policy)) {}
+
+Telemetry::~Telemetry() noexcept {
+    if (getIndex() != _policy.collector)
+        return;
+    // Last word at shutdown: this core's final counters next to the peers' last reports.
+    try {
+        _latest[getIndex()] = sample();
+        publish(time());
+    } catch (...) {
+    }
+    if (_server.is_open()) {
+        _server.close();
+        std::error_code ignored;
+        std::filesystem::remove(_policy.unix_socket, ignored);
+    }
+}
+
+qb::io::async::task<bool>
+Telemetry::onInit() {
+    if (!getCoreSet().contains(_policy.collector)) {
+        QB_LOG_CRIT(*this << " collector core " << _policy.collector << " is not part of the engine");
+        co_return false;
+    }
+    if (getIndex() == _policy.collector && !_policy.unix_socket.empty()) {
+        std::error_code ignored;
+        std::filesystem::remove(_policy.unix_socket, ignored); // a socket left by a previous run
+        if (_server.listen_un(_policy.unix_socket) != 0 || _server.set_nonblocking(true) != 0) {
+            QB_LOG_CRIT(*this << " cannot listen on unix socket " << _policy.unix_socket);
+            co_return false;
+        }
+    }
+    _next_tick_ns = time() + to_ns(_policy.interval);
+    registerEvent<ReportEvent>(*this);
+    registerCallback(*this);
+    co_return true;
+}
+
+CoreTelemetry
+Telemetry::sample() const noexcept {
+    auto const   &core   = *VirtualCore::_handler;
+    auto const   &totals = core._totals;
+    CoreTelemetry out;
+    out.core                      = core.getIndex();
+    out.sampled_ns                = time();
+    out.loop_passes               = core._loop_count;
+    out.actors                    = core._actors.size();
+    out.free_ids                  = core._ids.size();
+    out.events_received           = totals.events_received;
+    out.buckets_received          = totals.buckets_received;
+    out.events_sent               = totals.events_sent;
+    out.buckets_sent              = totals.buckets_sent;
+    out.flush_retries             = totals.flush_retries;
+    out.stalled_flushes           = totals.stalled_flushes;
+    out.qos0_drops                = totals.qos0_drops;
+    out.oversize_drops            = totals.oversize_drops;
+    out.packed_events             = totals.packed_events;
+    out.mailbox_capacity          = core._mail_box.capacity();
+    out.mailbox_priority_capacity = core._mail_box.capacity(true);
+    out.mailbox_high_water        = totals.mailbox_high;
+    out.inbound                   = core._mail_box.stats();
+    out.activating                = core._activating.size();
+    for (auto const id : core._activating)
+        out.activation_stashed += core._actors.at(id)->activation->stash.size();
+    out.redirects    = core._redirects.size();
+    out.tasks_run    = totals.tasks_run;
+    out.tasks_stolen = totals.tasks_stolen;
+    out.tasks_queued = core._tasks.size();
+    auto &loop   = io::async::listener::current;
+    out.watchers = loop.size();
+    if (loop.has_coro_scheduler()) {
+        auto const &scheduler = loop.coro_scheduler();
+        out.coro_ready        = scheduler.pending_count();
+        out.coro_active       = scheduler.active_count();
+    }
+    return out;
+}
+
+void
+Telemetry::on(LoopEvent const &loop) {
+    if (_server.is_open() && loop.now >= _next_serve_ns) {
+        _next_serve_ns = loop.now + kServePeriodNs;
+        serve();
+    }
+    if (loop.now < _next_tick_ns)
+        return;
+    _next_tick_ns      = loop.now + to_ns(_policy.interval);
+    const auto current = sample();
+    if (getIndex() == _policy.collector) {
+        _latest[current.core] = current;
+        publish(loop.now);
+    } else
+        push<ReportEvent>(getServiceId<TelemetryTag>(_policy.collector)).sample = current;
+}
+
+void
+Telemetry::on(ReportEvent const &event) noexcept {
+    _latest[event.sample.core] = event.sample;
+}
+
+std::vector<CoreTelemetry>
+Telemetry::snapshot() const {
+    std::vector<CoreTelemetry> out;
+    out.reserve(_latest.size());
+    for (auto const &[core, sample] : _latest)
+        out.push_back(sample);
+    return out;
+}
+
+std::string const &
+Telemetry::json() const noexcept {
+    return _document;
+}
+
+std::string
+Telemetry::render(std::vector<CoreTelemetry> const &cores, std::uint64_t const timestamp_ns) {
+    qb::json doc;
+    doc["timestamp_ns"] = timestamp_ns;
+    auto &list          = doc["cores"] = qb::json::array();
+    for (auto const &c : cores) {
+        list.push_back({
+            {"core", c.core},
+            {"sampled_ns", c.sampled_ns},
+            {"loop_passes", c.loop_passes},
+            {"actors", c.actors},
+            {"free_ids", c.free_ids},
+            {"events",
+             {{"received", c.events_received},
+              {"buckets_received", c.buckets_received},
+              {"sent", c.events_sent},
+              {"buckets_sent", c.buckets_sent}}},
+            {"flush",
+             {{"retries", c.flush_retries},
+              {"stalled", c.stalled_flushes},
+              {"qos0_drops", c.qos0_drops},
+              {"oversize_drops", c.oversize_drops},
+              {"packed", c.packed_events}}},
+            {"mailbox",
+             {{"capacity", c.mailbox_capacity},
+              {"priority_capacity", c.mailbox_priority_capacity},
+              {"high_water", c.mailbox_high_water},
+              {"backoffs", c.inbound.backoffs},
+              {"stalled_flushes", c.inbound.stalled_flushes},
+              {"spilled_segments", c.inbound.spilled_segments},
+              {"spilled_events", c.inbound.spilled_events},
+              {"spilled_buckets", c.inbound.spilled_buckets}}},
+            {"activating", {{"actors", c.activating}, {"stashed_events", c.activation_stashed}}},
+            {"migration", {{"redirects", c.redirects}}},
+            {"tasks", {{"run", c.tasks_run}, {"stolen", c.tasks_stolen}, {"queued", c.tasks_queued}}},
+            {"io", {{"watchers", c.watchers}, {"coro_ready", c.coro_ready}, {"coro_active", c.coro_active}}},
+        });
+    }
+    return doc.dump();
+}
+
+void
+Telemetry::publish(std::uint64_t const now_ns) {
+    _document = render(snapshot(), now_ns);
+    if (_policy.file.empty())
+        return;
+    // Write aside and rename over: a reader sees the previous document or this one, never half.
+    const std::string staging = _policy.file + ".tmp";
+    std::error_code   ec;
+    {
+        std::ofstream out(staging, std::ios::binary | std::ios::trunc);
+        out << _document << '\n';
+        if (!out)
+            ec = std::make_error_code(std::errc::io_error);
+    }
+    if (!ec)
+        std::filesystem::rename(staging, _policy.file, ec);
+    if (ec && !_file_failed)
+        QB_LOG_WARN(*this << " cannot publish to " << _policy.file << ": " << ec.message());
+    _file_failed = static_cast<bool>(ec);
+}
+
+void
+Telemetry::serve() {
+    const auto now = time();
+    // Nothing sampled yet: new clients wait in the backlog for the first period.
+    while (!_document.empty()) {
+        qb::io::tcp::socket client;
+        if (_server.accept(client) != 0)
+            break;
+        client.set_nonblocking(true);
+        _scrapes.push_back({std::move(client), _document, 0, now + kScrapeTimeoutNs});
+    }
+    // Never block the core on a scraper: write what each socket takes, keep the rest for the
+    // next poll, and close only once the whole document is out -- or the scraper gave up.
+    std::erase_if(_scrapes, [now](Scrape &scrape) {
+        while (scrape.written < scrape.document.size()) {
+            const auto n = scrape.socket.write(scrape.document.data() + scrape.written, scrape.document.size() - scrape.written);
+            if (n > 0)
+                scrape.written += static_cast<std::size_t>(n);
+            else if (now < scrape.deadline_ns && (!n || qb::io::socket::not_send_error(qb::io::socket::get_last_errno())))
+                return false;
+            else
+                break;
+        }
+        scrape.socket.disconnect();
+        return true;
+    });
+}
+
+} // namespace qb
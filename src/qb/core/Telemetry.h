@@ -0,0 +1,191 @@
+/**
+ * @file qb/core/Telemetry.h
+ * @brief Optional engine service that exports every core's cumulative counters as JSON.
+ *
+ * A core that drops QoS-0 events, stalls on a full mailbox or piles up events for an actor that
+ * is still initializing says nothing about it outside a log line. `qb::Telemetry` is a
+ * `ServiceActor` — one instance per core — that samples its own core every `interval` and
+ * reports a `CoreTelemetry` to a collector instance. The collector renders the latest sample of
+ * every core as one JSON document (`qb::json`) and publishes it to a file, replaced atomically,
+ * and/or to a Unix socket that hands the document to each client that connects.
+ *
+ * @code
+ * qb::TelemetryPolicy policy;
+ * policy.file        = "/run/myapp/telemetry.json";
+ * policy.unix_socket = "/run/myapp/telemetry.sock"; // socat - UNIX-CONNECT:/run/myapp/telemetry.sock
+ * for (qb::CoreId core = 0; core < 4; ++core)
+ *     main.addActor<qb::Telemetry>(core, policy); // one per core, same policy
+ * @endcode
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Core
+ */
+
+#ifndef QB_CORE_TELEMETRY_H
+#define QB_CORE_TELEMETRY_H
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include <qb/io/tcp/listener.h>
+#include "Actor.h"
+#include "ICallback.h"
+#include "Main.h"
+
+namespace qb {
+
+/**
+ * @struct TelemetryPolicy
+ * @ingroup Core
+ * @brief How often the cores are sampled and where the collector publishes.
+ * @details Give every instance the same policy; only the collector's copy of `file` and
+ *          `unix_socket` is used. Both empty is valid: the snapshot is then only readable
+ *          in-process, through `Telemetry::snapshot()` / `Telemetry::json()`.
+ */
+struct TelemetryPolicy {
+    /// Sampling period of every instance; the collector publishes once per period.
+    std::chrono::milliseconds interval{1000};
+    /// Core hosting the collector instance; it must run a `Telemetry` too.
+    CoreId collector = 0;
+    /// File rewritten with the document every period (written aside, then renamed over it).
+    std::string file;
+    /// Unix socket path: each client that connects is sent the latest document and closed.
+    /// A document the socket cannot take at once is finished on later polls; a client that
+    /// stops reading is dropped after a few seconds. A stale socket file at this path is replaced.
+    std::string unix_socket;
+};
+
+/**
+ * @struct CoreTelemetry
+ * @ingroup Core
+ * @brief One core's counters, as sampled by its `Telemetry` instance.
+ * @details Counters are cumulative since the core started; gauges (`actors`, `free_ids`,
+ *          `activating`, `redirects`, `coro_*`, `watchers`) are the value at sampling time. Outbound counters are what this
+ *          core did as a sender; `inbound` is what its senders met at this core's mailbox.
+ */
+struct CoreTelemetry {
+    CoreId        core         = 0;
+    std::uint64_t sampled_ns   = 0; ///< `Actor::time()` of the sample
+    std::uint64_t loop_passes  = 0;
+    std::uint64_t actors       = 0;
+    std::uint64_t free_ids     = 0; ///< actor ids left in the core's pool
+    // Events through the loop
+    std::uint64_t events_received  = 0;
+    std::uint64_t buckets_received = 0;
+    std::uint64_t events_sent      = 0; ///< includes the drops below, which the loop counts as sent
+    std::uint64_t buckets_sent     = 0;
+    // Outbound flush
+    std::uint64_t flush_retries   = 0; ///< send attempts repeated on a full ring (QoS >= 1)
+    std::uint64_t stalled_flushes = 0; ///< flushes that gave up for the pass after their retries
+    std::uint64_t qos0_drops      = 0; ///< QoS-0 events discarded on a full ring
+    std::uint64_t oversize_drops  = 0; ///< events wider than the destination ring, discarded
+    std::uint64_t packed_events   = 0; ///< small events sent several to a ring bucket
+    // Inbound mailbox
+    std::uint64_t mailbox_capacity          = 0; ///< buckets per normal lane
+    std::uint64_t mailbox_priority_capacity = 0; ///< buckets per priority lane
+    std::uint64_t mailbox_high_water        = 0; ///< most buckets drained from one normal lane in one pass
+    MailboxStats  inbound;
+    // Actors in an async `onInit()`
+    std::uint64_t activating         = 0;
+    std::uint64_t activation_stashed = 0; ///< events parked for them
+    // Actors that migrated away (`Actor::migrate`)
+    std::uint64_t redirects = 0; ///< old ids still forwarded (or parked, transfer in flight)
+    // Task pool (TaskPool.h)
+    std::uint64_t tasks_run    = 0; ///< chunks this core executed
+    std::uint64_t tasks_stolen = 0; ///< of which taken from a peer's queue
+    std::uint64_t tasks_queued = 0; ///< chunks waiting in this core's queue
+    // I/O loop
+    std::uint64_t coro_ready  = 0; ///< coroutines queued to resume
+    std::uint64_t coro_active = 0; ///< ready plus suspended
+    std::uint64_t watchers    = 0; ///< registered `listener` watchers
+};
+
+/**
+ * @struct TelemetryTag
+ * @ingroup Core
+ * @brief Service tag of `qb::Telemetry`.
+ */
+struct TelemetryTag {};
+
+/**
+ * @class Telemetry
+ * @ingroup Core
+ * @brief Per-core counter sampler; the instance on `policy.collector` also publishes.
+ * @details Every `interval`, each instance samples its own core (friend access, same thread) and
+ *          sends the `CoreTelemetry` to the collector. On its own tick the collector renders the
+ *          latest sample of each core it heard from and publishes the document. The Unix socket
+ *          is polled for clients every few milliseconds, so a scraper waits at most that long.
+ *          The counters it reads are maintained whether a `Telemetry` runs or not; the service
+ *          itself costs one callback per loop pass on each core.
+ *
+ *          Document shape: `{"timestamp_ns": …, "cores": [{"core": 0, "loop_passes": …,
+ *          "events": {…}, "flush": {…}, "mailbox": {…}, "activating": {…}, "migration": {…}, "io": {…}}, …]}`.
+ */
+class Telemetry final
+    : public ServiceActor<TelemetryTag>
+    , public ICallback {
+public:
+    explicit Telemetry(TelemetryPolicy policy = {}) noexcept;
+    ~Telemetry() noexcept final;
+
+    qb::io::async::task<bool> onInit() final;
+    void                      on(LoopEvent const &loop) final;
+
+    struct ReportEvent;
+    void on(ReportEvent const &event) noexcept;
+
+    /// Collector only: latest sample of each core, by core id.
+    [[nodiscard]] std::vector<CoreTelemetry> snapshot() const;
+    /// Collector only: the last published document (empty before the first period).
+    [[nodiscard]] std::string const &json() const noexcept;
+
+    /// Render @p cores as the published JSON document.
+    [[nodiscard]] static std::string render(std::vector<CoreTelemetry> const &cores, std::uint64_t timestamp_ns);
+
+private:
+    /// A scraper still being sent the document it connected to.
+    struct Scrape {
+        qb::io::tcp::socket socket;
+        std::string         document;
+        std::size_t         written     = 0;
+        std::uint64_t       deadline_ns = 0; ///< dropped, unfinished, past this
+    };
+
+    [[nodiscard]] CoreTelemetry sample() const noexcept;
+    void                        publish(std::uint64_t now_ns);
+    void                        serve();
+
+    const TelemetryPolicy           _policy;
+    std::uint64_t                   _next_tick_ns  = 0;
+    std::uint64_t                   _next_serve_ns = 0;
+    std::map<CoreId, CoreTelemetry> _latest; ///< collector only
+    std::string                     _document;
+    qb::io::tcp::listener           _server;
+    std::vector<Scrape>             _scrapes;             ///< collector only, oldest first
+    bool                            _file_failed = false; ///< last write failed (logged once per failure run)
+};
+
+/**
+ * @struct Telemetry::ReportEvent
+ * @brief A `CoreTelemetry` on its way to the collector.
+ */
+struct Telemetry::ReportEvent : public Event {
+    CoreTelemetry sample;
+};
+
+} // namespace qb
+
+#endif // QB_CORE_TELEMETRY_H
@@ -23,7 +23,9 @@
  */
 
 #include <climits>
+#include <new>
 #include <ostream>
+#include <qb/core/Recording.h>
 #include <qb/core/VirtualCore.h>
 #include <qb/event.h>
 #include <qb/io/async/listener.h>
@@ -94,28 +96,114 @@ pthread_setaffinity_np(pthread_t thread, size_t cpu_size, cpu_set_t *cpu_set) {
 #endif
 
 namespace qb {
+// Watchers of an `IdleWait::EventLoop` core, on its own I/O loop. They are plain libev
+// watchers, not `listener` registrations, so they never count as pending I/O work.
+struct VirtualCore::Parking {
+    ev::io    bell;
+    ev::timer timeout;
+    Mailbox  &mailbox;
+
+    Parking(ev::loop_ref loop, Mailbox &box)
+        : bell(loop)
+        , timeout(loop)
+        , mailbox(box) {
+        bell.set<Parking, &Parking::on_bell>(this);
+        bell.start(mailbox.doorbell(), ev::READ);
+        timeout.set<Parking, &Parking::on_timeout>(this);
+    }
+    void
+    on_bell(ev::io &, int) noexcept {
+        mailbox.drain_doorbell();
+    }
+    void
+    on_timeout(ev::timer &, int) noexcept {}
+};
+
 VirtualCore::VirtualCore(CoreId const id, SharedCoreCommunication &engine) noexcept
     : _index(id)
     , _resolved_index(engine._core_set.resolve(id))
     , _engine(engine)
     , _mail_box(engine.getMailBox(id))
-    , _event_buffer(std::make_unique<EventBuffer>())
+    , _event_buffer(_mail_box.receive_buffer())
+    , _shared_slab(engine.getSharedSlab(id))
+    , _shared_ref_id(Event::type_to_id<SharedEventRef>())
+    , _tasks(engine.getTaskQueue(id))
+    , _profiler(engine.getProfiler(id))
     , _pipes(engine.getNbCore())
     , _mono_pipe_swap(_pipes[_resolved_index])
-    , _mono_pipe(std::make_unique<VirtualPipe>()) {
+    , _mono_pipe(std::make_unique<VirtualPipe>())
+    , _priority_pipes(engine.getNbCore())
+    , _mono_priority_pipe_swap(_priority_pipes[_resolved_index])
+    , _mono_priority_pipe(std::make_unique<VirtualPipe>())
+    , _actor_slab(engine.getActorSlab(id)) {
     // Seed the pool after the last statically-registered service id. The
     // atomic load is relaxed because every writer publishes through the
     // magic-static acquire edge of `Actor::registerIndex<Tag>()` (2.3).
     _ids.init(static_cast<ServiceId>(_nb_service.load(std::memory_order_relaxed) + 1));
+    // A descriptor is only ever disposed on a drop path, where its destructor frees the payload.
+    router::ensure_disposer<Event, SharedEventRef>();
+    if (_mail_box.huge_pages() != HugePages::Off) {
+        for (auto *const pipes : {&_pipes, &_priority_pipes})
+            for (auto &pipe : *pipes)
+                pipe.huge_pages(true);
+        _mono_pipe->huge_pages(true);
+        _mono_priority_pipe->huge_pages(true);
+    }
 }
 
-VirtualCore::~VirtualCore() noexcept = default;
+VirtualCore::~VirtualCore() noexcept {
+    // A migration still in flight at teardown leaves byte-copied events parked in its redirect
+    // entry; free their payloads like every other drop path does.
+    for (auto &[sid, redirect] : _redirects)
+        for (auto &buckets : redirect.stash)
+            _router.dispose(*reinterpret_cast<Event *>(buckets.data()));
+}
 
 void
 VirtualCore::__set_stop_token__(qb::stop_token token) noexcept {
     _stop_token = std::move(token);
 }
 
+void
+VirtualCore::__set_idle_policy__(IdlePolicy const &policy) noexcept {
+    _idle.configure(policy, _mail_box.getLatency() > qb::duration::zero());
+}
+
+void
+VirtualCore::__set_recording__(std::string const &file) noexcept {
+    if (file.empty())
+        return;
+    auto recorder = std::make_unique<Recorder>();
+    if (recorder->open(file, _index, static_cast<uint64_t>(qb::unix_nanos(qb::wall_now()))))
+        _recorder = std::move(recorder);
+    else
+        QB_LOG_WARN(*this << " runs unrecorded");
+}
+
+void
+VirtualCore::__record__(RecordKind const kind, Event const &event) noexcept {
+    // A SharedEventRef is recorded as the event it stands for, which this core can still read:
+    // inbound it holds the lease, outbound the receiver has not seen it yet.
+    if (event.id == _shared_ref_id)
+        _recorder->record(kind, *static_cast<SharedEventRef const &>(event).payload, _metrics._nanotimer);
+    else
+        _recorder->record(kind, event, _metrics._nanotimer);
+}
+
+void
+VirtualCore::IdleBackoff::configure(IdlePolicy const &policy, bool const parkable) noexcept {
+    const auto ns = [](qb::duration const d) noexcept {
+        return static_cast<std::uint64_t>((std::max)(d, qb::duration::zero()).count());
+    };
+    mode         = policy.mode;
+    can_park     = parkable;
+    ewma_shift   = (std::min)(policy.ewma_shift, std::uint8_t{16});
+    min_spin_ns  = ns(policy.min_spin);
+    max_spin_ns  = (std::max)(ns(policy.max_spin), min_spin_ns);
+    max_yield_ns = (std::max)(ns(policy.max_yield), max_spin_ns);
+    gap_ewma_ns  = min_spin_ns;
+}
+
 ActorId
 VirtualCore::__generate_id__() noexcept {
     if (_ids.empty())
@@ -133,8 +221,8 @@ VirtualCore::unregisterEvents(ActorId const id) const noexcept {
 }
 
 VirtualPipe &
-VirtualCore::__getPipe__(CoreId const core) noexcept {
-    return _pipes[_engine._core_set.resolve(core)];
+VirtualCore::__getPipe__(CoreId const core, bool const priority) noexcept {
+    return (priority ? _priority_pipes : _pipes)[_engine._core_set.resolve(core)];
 }
 
 void
@@ -144,18 +232,54 @@ VirtualCore::__receive_events__(std::span<EventBucket> events) {
     while (i < nb_events) {
         // Safe reinterpret_cast: `events` is a contiguous view over EventBucket
         // storage, and Event objects are placement-constructed within it.
-        auto event = reinterpret_cast<Event *>(events.data() + i);
+        auto *const slot = reinterpret_cast<Event *>(events.data() + i);
 
         // Defensive: a well-formed event always spans at least one bucket. A
         // zero bucket_size (only reachable via a malformed / oversized
         // allocated_push whose uint16 size field wrapped to 0) would make
         // `i += 0` spin forever, re-routing the same event and hanging the
         // core. Stop draining this batch instead of looping indefinitely.
-        if (unlikely(event->bucket_size == 0)) {
+        if (unlikely(slot->bucket_size == 0)) {
             QB_LOG_CRIT(*this << " received event with bucket_size==0 (malformed or "
                                  "oversized event); aborting batch");
             break;
         }
+        // Several small events in one bucket (detail::packed_bucket): each is rebuilt in a bucket
+        // of its own and takes the path below from there.
+        if (unlikely(slot->state.bits.packed)) {
+            detail::packed_bucket::unpack(events[i], _unpacked, [this](Event &event) {
+                __receive_events__(std::span<EventBucket>{reinterpret_cast<EventBucket *>(&event), 1});
+            });
+            ++i;
+            continue;
+        }
+        // `width` is what this entry occupies in the batch. A SharedEventRef stands for an event
+        // that lives in the sender's slab: everything below sees that event, handled in place,
+        // and the lease releases its block whichever way this iteration ends. The stash and
+        // redirect paths byte-copy it first, like any other event.
+        const std::size_t width = slot->bucket_size;
+        SharedSlab::Lease lease{unlikely(slot->id == _shared_ref_id) ? static_cast<SharedEventRef *>(slot)->payload : nullptr};
+        auto *const       event = lease.get() ? lease.get() : slot;
+        // Recorded as it arrived, before any gate; a multicast copy once per target it reaches.
+        if (unlikely(_recorder != nullptr) && !event->state.bits.multicast)
+            __record__(RecordKind::Inbound, *event);
+        // One copy for several local actors: it passes the gates below per target.
+        if (unlikely(event->state.bits.multicast)) {
+            __receive_multicast__(*event);
+            ++_metrics._nb_event_received;
+            _metrics._nb_bucket_received += width;
+            i += width;
+            continue;
+        }
+        // Redirection gate: unicast addressed to an actor that migrated away from this core is
+        // parked (transfer in flight) or re-addressed and pushed to its new id, so senders that
+        // still hold the old id keep working. Empty-guarded like the activation gate below.
+        if (unlikely(!_redirects.empty()) && __redirect_event__(event)) {
+            ++_metrics._nb_event_received;
+            _metrics._nb_bucket_received += width;
+            i += width;
+            continue;
+        }
         // Activation gate: while the destination actor is still Activating (an
         // `onInit()` performed a `co_await`), defer its inbound *unicast business*
         // events into the actor's FIFO stash — replayed in order once it becomes
@@ -192,40 +316,138 @@ VirtualCore::__receive_events__(std::span<EventBucket> events) {
                         _router.dispose(*event);
                 }
                 ++_metrics._nb_event_received;
-                _metrics._nb_bucket_received += event->bucket_size;
-                i += event->bucket_size;
+                _metrics._nb_bucket_received += width;
+                i += width;
                 continue;
             }
         }
+        if (unlikely(_load.enabled))
+            __count_load__(event->getDestination());
         event->state.bits.alive = 0;
-        _router.route(*event, [this](auto &event) {
-            // `this` is read only by the log statement below, which compiles to nothing when
-            // QB_WITH_LOGGING=OFF -- and an explicit capture that ends up unused is
-            // -Wunused-lambda-capture on Apple clang. Keep the capture (the ON build needs it)
-            // and mark it used, rather than warning in every logging-off build.
-            static_cast<void>(this);
+        const auto on_unknown = [this](auto &event) {
+            // Unknown types land here: the engine's own migration control events are consumed
+            // first (they are never subscribed), anything else is a misaddressed event.
+            if (__on_unrouted__(event))
+                return;
             if (!event.getDestination().is_broadcast())
                 QB_LOG_WARN(*this << " failed to send event[" << qb::event_type_name(event.getID()) << '#' << event.getID() << "] sent from "
                                   << event.getSource());
-        });
+        };
+        if constexpr (kLoopProfiler) {
+            // Read before routing: the handler may release the event.
+            const auto type  = event->getID();
+            const auto dest  = event->getDestination();
+            const auto start = LoopProfiler::now();
+            _router.route(*event, on_unknown);
+            _profiler->record_event(type, dest, LoopProfiler::now() - start);
+        } else
+            _router.route(*event, on_unknown);
         ++_metrics._nb_event_received;
-        _metrics._nb_bucket_received += event->bucket_size;
-        i += event->bucket_size;
+        _metrics._nb_bucket_received += width;
+        i += width;
+    }
+}
+
+void
+VirtualCore::__receive_multicast__(Event &event) noexcept {
+    auto const        &footer = detail::multicast_footer::of(event);
+    ServiceId const   *sids   = footer.sids();
+    const std::size_t  count  = footer.count;
+    const ActorId      source = event.source;
+    const bool         gated  = !_redirects.empty() || !_activating.empty();
+    for (std::size_t k = 0; k < count; ++k) {
+        // Handlers see a unicast event: their own id as destination, whatever a previous
+        // target's reply()/forward() did to the header.
+        event.dest   = ActorId(sids[k], _index);
+        event.source = source;
+        if (unlikely(gated) && (_redirects.find(sids[k]) != _redirects.end() || __is_activating__(event.dest))) {
+            // A private unicast copy through this core's own pipe meets the gates of
+            // __receive_events__ on the next pass, at the cost of arriving after anything
+            // already queued to that target.
+            static_cast<void>(__multicast_detach__(event));
+            continue;
+        }
+        if (unlikely(_recorder != nullptr))
+            __record__(RecordKind::Inbound, event);
+        if (unlikely(_load.enabled))
+            __count_load__(event.dest);
+        event.state.bits.alive = 0;
+        if constexpr (kLoopProfiler) {
+            const auto start = LoopProfiler::now();
+            _router.deliver(event);
+            _profiler->record_event(event.getID(), ActorId(sids[k], _index), LoopProfiler::now() - start);
+        } else
+            _router.deliver(event);
+    }
+    _router.dispose(event);
+}
+
+void
+VirtualCore::__count_load__(ActorId const dest) noexcept {
+    if (dest.is_broadcast())
+        return;
+    if (unlikely(dest._service_id >= _load.per_sid.size()))
+        _load.per_sid.resize(static_cast<std::size_t>(dest._service_id) + 1u, 0u);
+    ++_load.per_sid[dest._service_id];
+    ++_load.events;
+}
+
+void
+VirtualCore::__account_pass__(std::uint64_t const now_ns) noexcept {
+    // Charges the pass that just ended: `_metrics._nanotimer` still holds its start time.
+    const auto elapsed = now_ns > _metrics._nanotimer ? now_ns - _metrics._nanotimer : 0u;
+    _load.window_ns += elapsed;
+    if (_load.last_active)
+        _load.busy_ns += elapsed;
+}
+
+namespace {
+// Starvation guard of the priority lanes. They are drained at the start of every pass and, when
+// something landed there meanwhile, again after a normal batch — at most this many extra times
+// per pass. Every normal lane is still drained once per pass, so a priority flood can slow the
+// normal traffic down but never stop it.
+constexpr std::uint32_t kPriorityPreemptionsPerPass = 8;
+} // namespace
+
+void
+VirtualCore::__receive_priority__() {
+    if (_mono_priority_pipe_swap.size()) {
+        _mono_priority_pipe->swap(_mono_priority_pipe_swap);
+        __receive_events__(std::span<EventBucket>{_mono_priority_pipe->begin(), _mono_priority_pipe->size()});
+        _mono_priority_pipe->reset();
     }
+    _mail_box.consume_priority(
+        [this](EventBucket *buffer, std::size_t const nb_events) { __receive_events__(std::span<EventBucket>{buffer, nb_events}); },
+        _event_buffer);
 }
 
 void
 VirtualCore::__receive__() {
+    __receive_priority__();
+    std::uint32_t preemptions = 0;
+    const auto    preempt     = [&] {
+        if (unlikely(preemptions < kPriorityPreemptionsPerPass && (_mono_priority_pipe_swap.size() || _mail_box.priority_pending()))) {
+            ++preemptions;
+            __receive_priority__();
+        }
+    };
     // from same core
     _mono_pipe->swap(_mono_pipe_swap);
     __receive_events__(std::span<EventBucket>{_mono_pipe->begin(), _mono_pipe->size()});
     _mono_pipe->reset();
-    // global_core_events. `consume_all(func, scratch, chunk)`, not `dequeue(T*, n)`: the third
-    // argument is a PER-PRODUCER batch limit, so every peer core's ring is drained on every
-    // turn. A shared budget would let one saturated producer consume it and starve the rest.
-    _mail_box.consume_all(
-        [this](EventBucket *buffer, std::size_t const nb_events) { __receive_events__(std::span<EventBucket>{buffer, nb_events}); },
-        _event_buffer->data(), MaxRingEvents);
+    // global_core_events. One `consume(index, func, scratch, chunk)` per producer, not a shared
+    // `dequeue(T*, n)`: the chunk is a PER-PRODUCER batch limit, so every peer core's ring is
+    // drained on every turn. A shared budget would let one saturated producer consume it and
+    // starve the rest. Overflow segments come after their lane's ring, each as a batch of its own.
+    for (std::size_t index = 0; index < _mail_box.producers(); ++index) {
+        preempt();
+        const auto drained = _mail_box.consume(
+            index,
+            [this](EventBucket *buffer, std::size_t const nb_events) { __receive_events__(std::span<EventBucket>{buffer, nb_events}); },
+            _event_buffer, _mail_box.capacity());
+        if (unlikely(drained > _totals.mailbox_high))
+            _totals.mailbox_high = drained;
+    }
 }
 
 //    void VirtualCore::__receive_from__(CoreId const index) noexcept {
@@ -271,18 +493,31 @@ constexpr std::uint32_t kFlushYieldAttempts = 512; // total budget per event.
 static_assert(kFlushSpinAttempts < kFlushYieldAttempts, "spin phase must precede yield phase");
 } // namespace
 
-// Widest event a destination mailbox ring can EVER accept — `kMaxDeliverableBuckets`,
-// declared with the class in VirtualCore.h. Single source of truth:
-// `SharedCoreCommunication::MaxRingEvents` sizes every per-producer SPSC ring, and
-// `spsc::enqueue<_All = true>` is all-or-nothing, so an event wider than this is not
-// "backpressured" — it is permanently unsendable however much the consumer drains.
-// Separating the two cases is what keeps `__flush_all__` terminating (see below).
+// Widest event a destination mailbox ring can EVER accept: its `capacity()`, set per core by
+// `CoreInitializer::setMailboxCapacity()` — for the priority lane, `capacity(true)`, at most
+// `CoreInitializer::PriorityMailboxCapacity`. `spsc::enqueue<_All = true>` is all-or-nothing, so
+// in `Backpressure` mode an event wider than that is not "backpressured" — it is permanently
+// unsendable however much the consumer drains. Separating the two cases is what keeps
+// `__flush_all__` terminating (see below).
+//
+// A destination in `MailboxMode::Overflow` never backpressures: the first event its ring
+// refuses and everything behind it in the pipe are moved into one overflow segment, which
+// carries events of any width, and the pipe is emptied in the same pass.
 
 bool
 VirtualCore::__flush_all__() noexcept {
+    // Priority pipes first: their events reach the peers' priority rings before anything queued
+    // in the normal pipes this pass, and a full normal ring never holds them back.
+    const bool priority_work = __flush_pipes__(_priority_pipes);
+    return __flush_pipes__(_pipes) || priority_work;
+}
+
+bool
+VirtualCore::__flush_pipes__(PipeMap &pipes) noexcept {
+    const bool  priority = &pipes == &_priority_pipes;
     bool        any_work = false;
     std::size_t pipe_idx = 0;
-    for (auto &pipe : _pipes) {
+    for (auto &pipe : pipes) {
         // Skip the self-core pipe (local delivery bypasses the mailbox layer)
         // and any empty outbound pipe.
         if (pipe_idx == _resolved_index || !pipe.size()) {
@@ -292,9 +527,12 @@ VirtualCore::__flush_all__() noexcept {
         any_work = true;
 
         auto *const base    = pipe.data();
-        auto       *cur     = pipe.begin();
+        auto *const first   = pipe.begin();
+        auto       *cur     = first;
         auto *const end     = pipe.end();
         bool        partial = false;
+        // The recorder's key for this pipe (Recorder::hold).
+        const std::size_t lane = pipe_idx * 2 + priority;
 
         while (cur < end) {
             // Non-const: an undeliverable event is disposed here (its payload must be freed
@@ -302,6 +540,27 @@ VirtualCore::__flush_all__() noexcept {
             auto &event = *reinterpret_cast<Event *>(cur);
             ++_metrics._nb_event_sent_try;
 
+            // Recorded before the first send attempt: once sent, a slab-resident payload belongs
+            // to the receiver. An event left at the head by a stalled flush was recorded then.
+            if (unlikely(_recorder != nullptr) && !(cur == first && _recorder->release(lane)))
+                __record__(RecordKind::Outbound, event);
+
+            // A run of small events goes out as one ring bucket. Any failure takes the per-event
+            // path below, which owns the backpressure, drop and spill decisions.
+            if (event.state.bits.compact) {
+                const std::size_t nb_packed = detail::packed_bucket::pack(_packed, cur, end);
+                if (nb_packed > 1 && try_send(*reinterpret_cast<Event const *>(&_packed))) {
+                    if (unlikely(_recorder != nullptr))
+                        for (std::size_t k = 1; k < nb_packed; ++k)
+                            __record__(RecordKind::Outbound, *reinterpret_cast<Event const *>(cur + k));
+                    _metrics._nb_event_sent += nb_packed;
+                    _metrics._nb_bucket_sent += nb_packed;
+                    _totals.packed_events += nb_packed;
+                    cur += nb_packed;
+                    continue;
+                }
+            }
+
             if (try_send(event)) {
                 ++_metrics._nb_event_sent;
                 _metrics._nb_bucket_sent += event.bucket_size;
@@ -334,13 +593,37 @@ VirtualCore::__flush_all__() noexcept {
                                   << "discarding the rest of the pipe");
                 break;
             }
-            if (unlikely(event.bucket_size > kMaxDeliverableBuckets)) {
+            auto &mail_box = *_engine._mail_boxes[pipe_idx];
+            if (mail_box.mode() == MailboxMode::Overflow) {
+                // Spill this event and everything behind it as one segment; the lane refuses its
+                // ring until the receiver has drained it, so later flushes queue behind it too.
+                auto       *spill_end = cur;
+                std::size_t nb_spilled = 0;
+                while (spill_end < end && reinterpret_cast<Event const *>(spill_end)->bucket_size) {
+                    if (unlikely(_recorder != nullptr) && spill_end != cur)
+                        __record__(RecordKind::Outbound, *reinterpret_cast<Event const *>(spill_end));
+                    spill_end += reinterpret_cast<Event const *>(spill_end)->bucket_size;
+                    ++nb_spilled;
+                }
+                if (unlikely(spill_end < end))
+                    QB_LOG_CRIT(*this << " outbound pipe to core(" << pipe_idx << ") holds a zero-width event (bucket_size overflowed); "
+                                      << "discarding the rest of the pipe");
+                const auto nb_buckets = static_cast<std::size_t>(spill_end - cur);
+                mail_box.spill(_resolved_index, cur, nb_buckets, nb_spilled, priority);
+                mail_box.notify();
+                _metrics._nb_event_sent += nb_spilled;
+                _metrics._nb_bucket_sent += nb_buckets;
+                break;
+            }
+            if (unlikely(event.bucket_size > mail_box.capacity(priority))) {
                 QB_LOG_CRIT(*this << " dropping event[" << qb::event_type_name(event.getID()) << '#' << event.getID() << "] from "
                                   << event.getSource() << " to " << event.getDestination() << ": " << event.bucket_size
-                                  << " buckets exceeds the " << kMaxDeliverableBuckets
+                                  << " buckets exceeds the " << mail_box.capacity(priority)
                                   << "-bucket mailbox ring, so it can never be delivered cross-core. Keep events small and move bulk "
-                                     "data behind a pointer member (see Pipe::allocated_push).");
+                                     "data behind a pointer member (see Pipe::allocated_push), or give the destination core "
+                                     "MailboxMode::Overflow.");
                 _router.dispose(event);
+                ++_totals.oversize_drops;
                 ++_metrics._nb_event_sent;
                 _metrics._nb_bucket_sent += event.bucket_size;
                 cur += event.bucket_size;
@@ -352,6 +635,7 @@ VirtualCore::__flush_all__() noexcept {
                 // original fire-and-forget semantics for QoS-0 events such as
                 // metrics or heartbeats). The "sent" counter is advanced to
                 // remain consistent with the previous behaviour.
+                ++_totals.qos0_drops;
                 ++_metrics._nb_event_sent;
                 _metrics._nb_bucket_sent += event.bucket_size;
                 cur += event.bucket_size;
@@ -359,9 +643,11 @@ VirtualCore::__flush_all__() noexcept {
             }
 
             // QoS-guaranteed event: bounded backoff.
+            mail_box.backed_off(_resolved_index, priority);
             bool sent = false;
             for (std::uint32_t attempt = 1; attempt <= kFlushYieldAttempts; ++attempt) {
                 ++_metrics._nb_event_sent_try;
+                ++_totals.flush_retries;
                 if (try_send(event)) {
                     sent = true;
                     break;
@@ -383,7 +669,11 @@ VirtualCore::__flush_all__() noexcept {
             // Budget exhausted — surrender cleanly. The destination's consumer
             // is woken so it runs immediately (no-op when its mailbox is in
             // zero-latency spin mode).
-            _engine.getMailBox(event.dest.index()).notify();
+            mail_box.stalled(_resolved_index, priority);
+            mail_box.notify();
+            ++_totals.stalled_flushes;
+            if (unlikely(_recorder != nullptr))
+                _recorder->hold(lane);
             pipe.reset(static_cast<std::size_t>(cur - base));
             partial = true;
             break;
@@ -400,7 +690,7 @@ VirtualCore::__flush_all__() noexcept {
 
 // Workflow
 bool
-VirtualCore::__init__(CoreIdSet const &affinity_cores) {
+VirtualCore::__init__(CoreIdSet const &affinity_cores, bool const numa_local) {
     bool ret(true);
     // Filter out the public `qb::NoAffinity` sentinel (== CoreId::max()) and
     // any out-of-range CoreId so users can pass `CoreIdSet{qb::NoAffinity}`
@@ -450,18 +740,58 @@ VirtualCore::__init__(CoreIdSet const &affinity_cores) {
 #endif
 #endif
     }
+    if (_mail_box.huge_pages() != HugePages::Off) {
+        const auto asked = _mail_box.huge_pages() == HugePages::Explicit ? allocator::page_kind::hugetlb
+                                                                           : allocator::page_kind::transparent;
+        if (_mail_box.pages() == asked)
+            QB_LOG_INFO(*this << " mailbox on " << allocator::to_string(asked) << " huge pages");
+        else
+            QB_LOG_WARN(*this << " mailbox on " << allocator::to_string(_mail_box.pages()) << " pages, not "
+                              << allocator::to_string(asked) << " huge pages");
+    }
+    // After pinning: the node is the one this thread now runs on.
+    if (numa_local)
+        __bind_to_node__(affinity_cores);
+    if (_mail_box.doorbell() >= 0)
+        _parking = std::make_unique<Parking>(io::async::listener::current.loop(), _mail_box);
     _actor_to_remove.reserve(_actors.size());
     return ret;
 }
 
+void
+VirtualCore::__bind_to_node__(CoreIdSet const &affinity_cores) noexcept {
+    auto const &topology = CpuTopology::host();
+    int         node     = -1;
+    for (const auto cpu : affinity_cores)
+        if ((node = topology.nodeOf(cpu)) >= 0)
+            break;
+    if (node < 0) {
+        QB_LOG_WARN(*this << " NUMA-local memory requested, but no affinity CPU is online");
+        return;
+    }
+    // Later allocations of this thread (pipe growth, actors, coroutine frames) follow the
+    // policy; the buffers that already exist are moved.
+    bool bound = CpuTopology::preferNode(node);
+    bound &= _mail_box.bind_memory(node);
+    for (auto *const pipes : {&_pipes, &_priority_pipes})
+        for (auto &pipe : *pipes)
+            if (pipe.data())
+                bound &= CpuTopology::bindMemory(pipe.data(), pipe.capacity() * sizeof(EventBucket), node);
+    if (bound)
+        QB_LOG_INFO(*this << " memory bound to NUMA node " << node);
+    else
+        QB_LOG_WARN(*this << " could not bind all of its memory to NUMA node " << node);
+}
+
 bool
 VirtualCore::__init__actors__() {
     // Snapshot the actor pointers first: driving an `onInit()` may itself create
     // referenced actors (`addRefActor`), mutating `_actors` mid-iteration.
     std::vector<Actor *> actors_to_init;
     actors_to_init.reserve(_actors.size());
-    for (const auto &actor : _actors | std::views::values)
-        actors_to_init.push_back(actor.get());
+    for (auto const &slot : _actors.slots())
+        if (slot.actor)
+            actors_to_init.push_back(slot.actor.get());
     for (auto *actor : actors_to_init) {
         qb::io::async::task<bool> init = actor->onInit();
         switch (__drive_init__(*actor, init)) {
@@ -525,31 +855,33 @@ VirtualCore::__begin_activation__(Actor &actor, qb::io::async::task<bool> &&init
     // The actor is now Activating: gate its inbound unicast and keep its frame alive.
     actor._activated = false;
     const auto now   = static_cast<std::uint64_t>(qb::unix_nanos(qb::wall_now()));
-    Activation act;
+    // Runs from initActor(), before appendActor() inserts the actor: reserve its slot.
+    auto &act       = *(_actors.reserve(actor.id()).activation = std::make_unique<Activation>());
     act.init        = std::move(init);
     act.deadline_ns = activation_deadline_ns ? now + activation_deadline_ns : 0; // 0 ⇒ no deadline
-    _activating.emplace(actor.id(), std::move(act));
+    _activating.push_back(actor.id());
     QB_LOG_INFO(actor << " activating (async onInit in flight)");
 }
 
 bool
 VirtualCore::__is_activating__(ActorId const id) const noexcept {
-    return _activating.find(id) != _activating.end();
+    const auto *slot = _actors.at(id);
+    return slot && slot->activation;
 }
 
 bool
 VirtualCore::__stash_event__(ActorId const dest, Event *event) noexcept {
-    auto it = _activating.find(dest);
-    if (unlikely(it == _activating.end()))
+    auto *slot = _actors.at(dest);
+    if (unlikely(!slot || !slot->activation))
         return false; // not actually activating — caller already filtered, defensive only
-    auto &stash = it->second.stash;
+    auto &stash = slot->activation->stash;
     if (unlikely(stash.size() >= kActivationStashCap)) {
         // A wedged-in-init actor must not OOM the core: drop the overflow and fail the
         // activation on the next pump by forcing its deadline to expire now. Report `false`
         // so the caller disposes the dropped event's payload (it is not taken into the stash).
         QB_LOG_WARN(*this << " activation stash full for actor(" << dest.index() << "." << dest.sid() << "); dropping event["
                           << qb::event_type_name(event->getID()) << '#' << event->getID() << "] and failing activation");
-        it->second.deadline_ns = 1; // already in the past ⇒ pump cancels + fails it
+        slot->activation->deadline_ns = 1; // already in the past ⇒ pump cancels + fails it
         return false;
     }
     // Byte-copy the event's buckets out of the transient receive buffer into owned
@@ -570,7 +902,8 @@ VirtualCore::__pump_activations__() noexcept {
     // Collect ids to finalize/expire first; finalizing mutates `_activating`.
     thread_local std::vector<ActorId> done_ids;
     done_ids.clear();
-    for (auto &[id, act] : _activating) {
+    for (auto const id : _activating) {
+        auto &act = *_actors.at(id)->activation;
         if (act.init.done()) {
             done_ids.push_back(id);
         } else if (!act.cancelling && act.deadline_ns && now >= act.deadline_ns) {
@@ -578,21 +911,22 @@ VirtualCore::__pump_activations__() noexcept {
             // (its cancellation-aware awaiters throw `cancelled_error`); it then reports
             // `done()` on a later pump and is finalized as a failure below.
             act.cancelling = true;
-            if (const auto ait = _actors.find(id); ait != _actors.end()) {
-                QB_LOG_WARN(*ait->second << " activation deadline expired — cancelling onInit");
-                ait->second->__cancel_coro_scope__();
+            if (auto *const actor = _actors.find(id)) {
+                QB_LOG_WARN(*actor << " activation deadline expired — cancelling onInit");
+                actor->__cancel_coro_scope__();
             }
         }
     }
 
     for (auto const id : done_ids) {
-        auto it = _activating.find(id);
-        if (it == _activating.end())
+        auto *slot = _actors.at(id);
+        if (!slot || !slot->activation)
             continue;
-        Activation act = std::move(it->second);
-        _activating.erase(it);
+        Activation act = std::move(*slot->activation);
+        slot->activation.reset();
+        std::erase(_activating, id);
 
-        const bool dying = _dying_with_frame.erase(id) != 0;
+        const bool dying = std::exchange(slot->dying, false);
         // Read the init verdict (frame is done): a clean `co_return false`, a thrown
         // exception, or a deadline/kill cancellation all resolve to "not successful".
         bool ok = false;
@@ -603,8 +937,8 @@ VirtualCore::__pump_activations__() noexcept {
         // Free the onInit frame now that it has fully unwound (no awaiter references it).
         act.init = qb::io::async::task<bool>{};
 
-        const auto ait = _actors.find(id);
-        if (dying || !ok || ait == _actors.end()) {
+        auto *const actor = _actors.find(id);
+        if (dying || !ok || !actor) {
             // Killed during init, failed init, or already gone → complete teardown now
             // (the deferred-destroy: the actor outlived its own coroutine frame).
             // Dispose the never-replayed stash so any non-trivial event payload (std::string /
@@ -615,23 +949,24 @@ VirtualCore::__pump_activations__() noexcept {
                 auto *ev = reinterpret_cast<Event *>(buckets.data());
                 _router.dispose(*ev);
             }
-            if (ait != _actors.end()) {
+            if (actor) {
                 if (!dying && !ok)
-                    QB_LOG_CRIT(*ait->second << " async onInit failed — removing");
+                    QB_LOG_CRIT(*actor << " async onInit failed — removing");
                 removeActor(id);
             }
             continue;
         }
         // Success: flip Active, then replay the stashed inbound unicast FIFO.
-        ait->second->_activated = true;
-        QB_LOG_INFO(*ait->second << " activated");
+        actor->_activated = true;
+        QB_LOG_INFO(*actor << " activated");
         for (auto &buckets : act.stash) {
             auto *ev             = reinterpret_cast<Event *>(buckets.data());
             ev->state.bits.alive = 0; // mark consumed, exactly as __receive_events__ does pre-route
             _router.route(*ev, [this](auto &e) {
-                // See the note on the sibling handler in __receive_events__: `this` is used only
-                // by the log statement, so mark it used for the QB_WITH_LOGGING=OFF build.
-                static_cast<void>(this);
+                // Same unknown-type hook as the sibling handler in __receive_events__: a migration
+                // request parked while its target was Activating is honoured on replay.
+                if (__on_unrouted__(e))
+                    return;
                 if (!e.getDestination().is_broadcast())
                     QB_LOG_WARN(*this << " failed to deliver stashed event[" << qb::event_type_name(e.getID()) << '#' << e.getID() << "]");
             });
@@ -643,7 +978,10 @@ void
 VirtualCore::__workflow__() {
     QB_LOG_INFO(*this << " Init Success " << static_cast<uint32_t>(_actors.size()) << " actor(s)");
     while (likely(true)) {
-        _metrics._nanotimer = static_cast<uint64_t>(qb::unix_nanos(qb::wall_now()));
+        const auto pass_start = static_cast<uint64_t>(qb::unix_nanos(qb::wall_now()));
+        if (unlikely(_load.enabled))
+            __account_pass__(pass_start);
+        _metrics._nanotimer = pass_start;
         ++_loop_count; // 1-based loop-pass index surfaced to callbacks via qb::LoopEvent
 
         // Poll for pending signal (signal-handler-safe lock-free atomic read)
@@ -688,7 +1026,12 @@ VirtualCore::__workflow__() {
             || io::async::listener::current.has_deferred()) {
             // Hot path: call `listener::run` directly — no `async::run` wrapper
             // (avoids redundant checks; metrics match `nb_invoked_event()` contract).
-            io::async::listener::current.run(EVRUN_NOWAIT);
+            if constexpr (kLoopProfiler) {
+                const auto start = LoopProfiler::now();
+                io::async::listener::current.run(EVRUN_NOWAIT);
+                _profiler->record_io(LoopProfiler::now() - start);
+            } else
+                io::async::listener::current.run(EVRUN_NOWAIT);
             _metrics._nb_event_io = io::async::listener::current.nb_invoked_event();
         }
 
@@ -700,6 +1043,10 @@ VirtualCore::__workflow__() {
                 break; // the last actor was an activating-then-dying one
         }
 
+        // Settled migrations whose grace period is over give their old id back.
+        if (unlikely(!_retiring.empty()))
+            __expire_redirects__();
+
         // send core events
         __flush_all__();
         // receive core events
@@ -708,9 +1055,9 @@ VirtualCore::__workflow__() {
         if (unlikely(!_actor_to_remove.empty()))
             goto removeActors;
         // Dispatch callbacks from a flat, cache-friendly snapshot (2.6). The
-        // master list `_callback_list` is kept in sync with the hashmap on
-        // register / unregister, so building the per-iteration snapshot is now a
-        // single contiguous copy instead of an `unordered_map` walk. A local
+        // master list `_callback_list` is kept in sync with the actor table on
+        // register / unregister, so building the per-iteration snapshot is a
+        // single contiguous copy instead of a walk over every slot. A local
         // snapshot is still required because the tick handler `on(LoopEvent&)` may
         // register or unregister actors during dispatch (e.g. via `addRefActor`).
         {
@@ -719,6 +1066,7 @@ VirtualCore::__workflow__() {
             const qb::LoopEvent                     loop_ev{_metrics._nanotimer, _loop_count};
             thread_local std::vector<CallbackEntry> cb_snapshot;
             cb_snapshot = _callback_list;
+            [[maybe_unused]] const auto pass_start = kLoopProfiler && !cb_snapshot.empty() ? LoopProfiler::now() : 0u;
             for (auto const &entry : cb_snapshot) {
                 // Skip the callback of an actor killed earlier in this same
                 // dispatch pass (e.g. by an earlier actor's tick). The
@@ -727,41 +1075,79 @@ VirtualCore::__workflow__() {
                 // a killed actor must not get another tick, matching the
                 // event-kill path which skips the whole callback phase. The
                 // empty() fast-path keeps the common (nothing killed) case free.
-                if (likely(_actor_to_remove.empty()) || !_actor_to_remove.count(entry.id))
-                    entry.cb->on(loop_ev);
+                if (likely(_actor_to_remove.empty()) || !_actors.reaping(entry.id)) {
+                    if constexpr (kLoopProfiler) {
+                        const auto start = LoopProfiler::now();
+                        entry.cb->on(loop_ev);
+                        _profiler->record_callback(entry.id, LoopProfiler::now() - start);
+                    } else
+                        entry.cb->on(loop_ev);
+                }
+            }
+            if constexpr (kLoopProfiler) {
+                if (!cb_snapshot.empty())
+                    _profiler->record_callbacks(LoopProfiler::now() - pass_start);
             }
         }
         // check if callbacks killed actors
         if (unlikely(!_actor_to_remove.empty())) {
         removeActors:
             // Reap dead actors. `removeActor()` destroys the actor, running user code that may `kill()`
-            // ANOTHER actor and so re-enter `killActor()` → `_actor_to_remove.insert()`. The scratch
-            // buffer keeps that re-entrant insert off the container being iterated (a growth rehash of
-            // the release flat set reallocates its entries and invalidates a live iterator) and keeps
-            // late kills from being discarded by the clear (which stranded a `!is_alive()` actor in
-            // `_actors`, so `_actors.empty()` never held and the core never terminated). Terminates:
+            // ANOTHER actor and so re-enter `killActor()` → `_actor_to_remove.push_back()`. The scratch
+            // buffer keeps that re-entrant push off the container being iterated (a growth reallocates
+            // its entries and invalidates a live iterator) and keeps late kills from being discarded by
+            // the clear (which stranded a `!is_alive()` actor in `_actors`, so `_actors.empty()` never
+            // held and the core never terminated). Terminates:
             // only that user code refills the set and it runs at most once per actor — once an id has
             // left `_actors`, `removeActor()` destroys nothing — so a pass that destroys nothing ends it.
             // Pinned by `KillDuringReap.ActorKilledFromAnotherDestructorIsStillReaped`.
             while (!_actor_to_remove.empty()) {
                 _actor_remove_batch.clear();
                 _actor_remove_batch.swap(_actor_to_remove);
-                for (auto const &actor : _actor_remove_batch)
-                    removeActor(actor);
+                for (auto const id : _actor_remove_batch) {
+                    // A slot that no longer reaps was emptied since the kill (a failed activation):
+                    // its id may already name the next actor, which nobody killed.
+                    if (auto *const slot = _actors.at(id); slot && std::exchange(slot->reaping, false))
+                        removeActor(id);
+                }
             }
             _actor_remove_batch.clear(); // drop the last batch's ids (capacity is kept for reuse)
             if (_actors.empty()) {
                 break;
             }
         }
-        // Adaptive backoff: a busy iteration refills the spin credit; otherwise we
-        // burn through the remaining credit before blocking on the mailbox (2.15).
+        // One task-pool chunk per pass bounds the delay it adds to the events behind it. The
+        // `empty()` checks are two relaxed loads, so a core without tasks pays nothing more.
+        if (__run_task__(!_metrics.had_activity()))
+            ++_metrics._nb_task;
+        const bool active = _metrics.had_activity();
+        if (unlikely(_load.enabled))
+            _load.last_active = active;
+        _totals.absorb(_metrics);
         _metrics.carry_over();
-        if (_mail_box.getLatency() > qb::duration::zero()) {
-            if (likely(_metrics._spin_credit))
-                --_metrics._spin_credit;
-            else
-                _mail_box.wait();
+        // Idle backoff (IdlePolicy). Credit: a busy iteration refills the spin credit; otherwise
+        // we burn through the remaining credit before blocking on the mailbox (2.15).
+        switch (_idle.next(active, _metrics._nanotimer)) {
+            case IdleBackoff::Step::Poll:
+                break;
+            case IdleBackoff::Step::Pause:
+                qb::spin_loop_pause();
+                break;
+            case IdleBackoff::Step::Yield:
+                std::this_thread::yield();
+                break;
+            case IdleBackoff::Step::Credit:
+                if (likely(_metrics._spin_credit)) {
+                    --_metrics._spin_credit;
+                    break;
+                }
+                [[fallthrough]];
+            case IdleBackoff::Step::Park:
+                if (_parking)
+                    __park__();
+                else
+                    _mail_box.wait();
+                break;
         }
     }
     // Receive and flush residual events, guaranteed to terminate without dropping anything
@@ -796,11 +1182,82 @@ VirtualCore::__workflow__() {
     QB_LOG_INFO(*this << " Stopped normally");
 }
 
+void
+VirtualCore::__park__() {
+    auto &listener = io::async::listener::current;
+    // Work this core queued for itself never rings the doorbell; neither do ready coroutines or
+    // deferred callbacks. Only park when all of them are empty and the mailbox is, once the
+    // senders can see the flag (`Mailbox::park()`).
+    if (_mono_pipe_swap.size() || _mono_priority_pipe_swap.size() || listener.has_deferred()
+        || (listener.has_coro_scheduler() && listener.coro_scheduler().pending_count()) || !_tasks.empty()
+        || !_mail_box.park())
+        return;
+    _parking->timeout.start(std::chrono::duration<double>(_mail_box.getLatency()).count());
+    listener.run(EVRUN_ONCE);
+    _parking->timeout.stop();
+    _mail_box.unpark();
+    // I/O handled while parked buys the same spin credit as a busy pass.
+    _metrics._spin_credit += listener.nb_invoked_event();
+}
+
+bool
+VirtualCore::__run_task__(bool const idle) noexcept {
+    detail::pool_job *job = nullptr;
+    if (_tasks.empty() || !_tasks.pop(job)) {
+        if (!idle)
+            return false;
+        // Oldest first from the first peer that has work; the cursor spreads the thieves.
+        auto const &queues = _engine._task_queues;
+        const auto  nb     = queues.size();
+        for (std::size_t k = 1; k < nb && !job; ++k) {
+            auto &peer = *queues[(_resolved_index + _steal_cursor + k) % nb];
+            if (!peer.empty())
+                (void) peer.steal(job);
+        }
+        if (!job)
+            return false;
+        ++_steal_cursor;
+        ++_totals.tasks_stolen;
+    }
+    job->group->execute(job->index);
+    return true;
+}
+
+bool
+VirtualCore::__submit_task__(detail::task_group &group) noexcept {
+    // Grow the queue up front: a push() that cannot allocate would otherwise leave the group
+    // half queued, with no way to hand it back.
+    try {
+        _tasks.reserve(group.chunks());
+    } catch (std::bad_alloc const &) {
+        return false;
+    }
+    for (std::uint32_t i = 0; i < group.chunks(); ++i)
+        _tasks.push(group.job(i));
+    // This core takes one chunk on its next pass; a peer parked on its mailbox would never see
+    // the rest, so wake as many as there are chunks left. A no-op for a spinning peer.
+    auto const &boxes = _engine._mail_boxes;
+    const auto  nb    = boxes.size();
+    for (std::size_t k = 1; k < nb && k < group.chunks(); ++k)
+        boxes[(_resolved_index + k) % nb]->notify();
+    return true;
+}
+
 bool
 VirtualCore::__dispose_residual_to_stopped_cores__() noexcept {
+    bool any_live_pending = false;
+    for (auto *const pipes : {&_priority_pipes, &_pipes}) {
+        if (__dispose_residual_pipes__(*pipes))
+            any_live_pending = true;
+    }
+    return any_live_pending;
+}
+
+bool
+VirtualCore::__dispose_residual_pipes__(PipeMap &pipes) noexcept {
     bool        any_live_pending = false;
     std::size_t pipe_idx         = 0;
-    for (auto &pipe : _pipes) {
+    for (auto &pipe : pipes) {
         // The self-core pipe is delivered locally (never via the mailbox) and is already
         // drained by __receive__; an empty pipe has nothing pending.
         if (pipe_idx == _resolved_index || !pipe.size()) {
@@ -866,12 +1323,12 @@ VirtualCore::appendActor(std::unique_ptr<Actor> actor_ptr, bool const doInit) no
     const ActorId id    = actor.id();
     // Reject duplicates *before* driving `onInit()`: a suspended (async) init must never
     // coexist with an append failure, otherwise its still-live frame would be orphaned.
-    if (unlikely(_actors.find(id) != _actors.end())) {
+    if (unlikely(_actors.find(id) != nullptr)) {
         QB_LOG_CRIT("Error Cannot add Service Actor multiple times" << actor);
         return ActorId::NotFound;
     }
     if (initActor(actor, doInit).is_valid()) {
-        _actors.emplace(id, std::move(actor_ptr));
+        _actors.insert(std::move(actor_ptr));
         QB_LOG_INFO("New " << actor);
         return id;
     }
@@ -885,21 +1342,21 @@ VirtualCore::removeActor(ActorId const id) noexcept {
     // the actor dying, and let `__pump_activations__` complete the teardown once the
     // frame reports `done()`. Re-entry from the pump (after the frame unwound and the
     // activation was dropped) falls straight through to the normal teardown below.
-    if (const auto ait = _activating.find(id); unlikely(ait != _activating.end())) {
-        if (const auto act = _actors.find(id); act != _actors.end())
-            act->second->__cancel_coro_scope__();
-        if (!ait->second.init.done()) {
-            _dying_with_frame.insert(id);
+    if (auto *const slot = _actors.at(id); unlikely(slot && slot->activation)) {
+        if (slot->actor)
+            slot->actor->__cancel_coro_scope__();
+        if (!slot->activation->init.done()) {
+            slot->dying = true;
             return;
         }
-        _activating.erase(ait);
-        _dying_with_frame.erase(id);
+        slot->activation.reset();
+        slot->dying = false;
+        std::erase(_activating, id);
     }
     __unregisterCallback(id);
     unregisterEvents(id);
-    const auto it = _actors.find(id);
-    if (it != _actors.end()) {
-        auto &actor = it->second;
+    // Out of the table before it is destroyed: its destructor may create actors of its own.
+    if (auto actor = _actors.release(id)) {
         // Catch-all cancel-on-destroy: every destruction path funnels through here
         // (kill, onInit failure, engine shutdown). Cancelling the scope wakes scoped
         // coroutines so they unwind cleanly; idempotent with kill()'s cancel.
@@ -914,37 +1371,238 @@ VirtualCore::removeActor(ActorId const id) noexcept {
                                    << " active coroutines - coroutines must not access actor state!");
         }
         QB_LOG_INFO("Delete " << *actor);
-        _actors.erase(it);
+        actor.reset();
         // Only non-service ids are recycled into the pool: a ServiceActor's
         // id is assigned at static init (see 2.3) and must remain reserved
         // for the lifetime of the process to keep `ServiceIndex` stable.
-        if (id._service_id > _nb_service.load(std::memory_order_relaxed))
+        // An id that migrated away stays reserved too while it keys a redirect entry; the
+        // entry's expiry (`__expire_redirects__`) or a failed migration releases it instead.
+        if (id._service_id > _nb_service.load(std::memory_order_relaxed)
+            && (likely(_redirects.empty()) || _redirects.find(id._service_id) == _redirects.end()))
             _ids.release(id._service_id);
     }
 }
 
+// Runtime migration
+//
+// Three hops, all ordinary pushes: the request travels to the actor's core behind whatever was
+// already queued for it; the origin core parks the actor's inbound traffic in `_redirects`,
+// kills it and ships its `onMigrate()` factory to the destination core; the destination
+// re-creates it and reports the new id back; the origin then re-addresses everything it parked,
+// and everything that still arrives for the old id, in arrival order. The requester hears the
+// outcome as a `MigratedEvent` from the origin core once the redirect is settled.
+void
+VirtualCore::__request_migration__(ActorId const target, CoreId const to, ActorId const requester) noexcept {
+    if (unlikely(!target.is_valid() || target.is_broadcast())) {
+        QB_LOG_WARN(*this << " refused migration of " << target << ": not an actor id");
+        __notify_migrated__(requester, target, ActorId::NotFound);
+        return;
+    }
+    push<MigrateRequestEvent>(target, requester).to = to;
+}
+
+bool
+VirtualCore::__on_unrouted__(Event &event) noexcept {
+    const auto id = event.getID();
+    if (id == Event::type_to_id<MigrateRequestEvent>())
+        __migrate_out__(static_cast<MigrateRequestEvent const &>(event));
+    else if (id == Event::type_to_id<MigrationTransferEvent>())
+        __migrate_in__(static_cast<MigrationTransferEvent &>(event));
+    else if (id == Event::type_to_id<MigrationSettledEvent>())
+        __migration_settled__(static_cast<MigrationSettledEvent const &>(event));
+    else if (id == Event::type_to_id<TaskDoneEvent>()) {
+        // Resumes the awaiting coroutine, which takes the group; a miss (it was cancelled, its
+        // actor is gone) leaves the group in the event, and the router's dispose frees it.
+        auto &done = static_cast<TaskDoneEvent &>(event);
+        (void) detail::ask_deliver(done.correlation_id, done.getDestination(), done);
+    } else
+        return false;
+    return true;
+}
+
+bool
+VirtualCore::__redirect_event__(Event *event) noexcept {
+    const ActorId dest = event->getDestination();
+    if (dest.is_broadcast())
+        return false;
+    const auto it = _redirects.find(dest._service_id);
+    if (it == _redirects.end())
+        return false;
+    auto &redirect = it->second;
+    if (redirect.to.is_valid()) {
+        event->dest             = redirect.to;
+        event->state.bits.alive = 1;
+        push(*event); // ordered: byte-copied behind everything already forwarded
+    } else if (unlikely(redirect.stash.size() >= kActivationStashCap)) {
+        QB_LOG_WARN(*this << " migration stash full for " << dest << "; dropping event[" << qb::event_type_name(event->getID()) << '#'
+                          << event->getID() << ']');
+        _router.dispose(*event);
+    } else {
+        // Same ownership rule as `__stash_event__`: the copy now owns any non-trivial payload.
+        auto *buckets = reinterpret_cast<EventBucket *>(event);
+        redirect.stash.emplace_back(buckets, buckets + event->bucket_size);
+    }
+    return true;
+}
+
+void
+VirtualCore::__migrate_out__(MigrateRequestEvent const &event) noexcept {
+    const ActorId origin    = event.getDestination();
+    const ActorId requester = event.getSource();
+    const CoreId  to        = event.to;
+    Actor *const  actor     = _actors.find(origin);
+
+    const char *refusal = nullptr;
+    bool        busy    = false;
+    if (!actor || !actor->is_alive())
+        refusal = "no such live actor";
+    else if (to == _index) {
+        __notify_migrated__(requester, origin, origin); // already there: a no-op success
+        return;
+    } else if (!_engine._core_set.raw().contains(to))
+        refusal = "destination core is not part of the engine";
+    else if (origin._service_id <= _nb_service.load(std::memory_order_relaxed))
+        refusal = "service actors are pinned to their core";
+    else if (__is_activating__(origin)) {
+        refusal = "actor is still activating";
+        busy    = true;
+    } else if (actor->has_active_coroutines()) {
+        refusal = "actor has coroutines in flight";
+        busy    = true;
+    }
+
+    std::unique_ptr<IActorFactory> factory;
+    if (!refusal) {
+        try {
+            factory = actor->onMigrate();
+        } catch (...) {
+            factory.reset();
+        }
+        if (!factory || factory->isService()) {
+            factory.reset();
+            refusal = "actor does not opt in (onMigrate)";
+        }
+    }
+    if (refusal) {
+        QB_LOG_WARN(*this << " refused migration of " << origin << " to core " << to << ": " << refusal);
+        __notify_migrated__(requester, origin, ActorId::NotFound, busy);
+        return;
+    }
+
+    QB_LOG_INFO(*actor << " migrating to core " << to);
+    // Park before the kill: from here on nothing addressed to the old id reaches the old actor.
+    _redirects[origin._service_id] = Redirect{};
+    actor->kill();
+    auto &transfer     = push<MigrationTransferEvent>(BroadcastId(to), origin);
+    transfer.factory   = std::move(factory);
+    transfer.origin    = origin;
+    transfer.requester = requester;
+}
+
+void
+VirtualCore::__migrate_in__(MigrationTransferEvent &event) noexcept {
+    ActorId migrated = ActorId::NotFound;
+    // Moved out so the factory (and whatever state it still holds) is released here, whatever
+    // happens; route() then disposes an event whose factory is already empty.
+    if (const auto factory = std::move(event.factory)) {
+        std::unique_ptr<Actor> actor;
+        try {
+            actor.reset(factory->create());
+        } catch (...) {
+            QB_LOG_CRIT(*this << " failed to re-create migrated " << event.origin << ": factory threw");
+        }
+        // An exhausted id pool yields a NotFound id: never append such an actor.
+        if (actor && actor->id().is_valid())
+            migrated = appendActor(std::move(actor), true);
+    }
+    if (!migrated.is_valid())
+        QB_LOG_CRIT(*this << " failed to re-create migrated " << event.origin);
+    auto &settled     = push<MigrationSettledEvent>(BroadcastId(event.origin._core_id), BroadcastId(_index));
+    settled.origin    = event.origin;
+    settled.migrated  = migrated;
+    settled.requester = event.requester;
+}
+
+void
+VirtualCore::__migration_settled__(MigrationSettledEvent const &event) noexcept {
+    const auto it = _redirects.find(event.origin._service_id);
+    if (likely(it != _redirects.end())) {
+        auto &redirect = it->second;
+        if (event.migrated.is_valid()) {
+            redirect.to = event.migrated;
+            for (auto &buckets : redirect.stash) {
+                auto *ev             = reinterpret_cast<Event *>(buckets.data());
+                ev->dest             = redirect.to;
+                ev->state.bits.alive = 1;
+                push(*ev);
+            }
+            redirect.stash      = {};
+            redirect.expires_ns = time() + migration_redirect_grace_ns;
+            _retiring.push_back(event.origin._service_id);
+        } else {
+            // The actor is gone for good: drop what was parked for it and give its id back.
+            for (auto &buckets : redirect.stash)
+                _router.dispose(*reinterpret_cast<Event *>(buckets.data()));
+            _redirects.erase(it);
+            if (!_actors.find(event.origin))
+                _ids.release(event.origin._service_id);
+        }
+    }
+    __notify_migrated__(event.requester, event.origin, event.migrated);
+}
+
+void
+VirtualCore::__expire_redirects__() noexcept {
+    const auto  now     = time();
+    std::size_t expired = 0;
+    for (const auto sid : _retiring) {
+        const auto it = _redirects.find(sid);
+        if (it != _redirects.end()) {
+            if (it->second.expires_ns > now)
+                break;
+            _redirects.erase(it);
+        }
+        // Reaped long ago in practice; if not, the reap releases the id once the entry is gone.
+        if (!_actors.find(ActorId(sid, _index)))
+            _ids.release(sid);
+        ++expired;
+    }
+    _retiring.erase(_retiring.begin(), _retiring.begin() + static_cast<std::ptrdiff_t>(expired));
+}
+
+void
+VirtualCore::__notify_migrated__(ActorId const requester, ActorId const origin, ActorId const migrated, bool const busy) noexcept {
+    if (!requester.is_valid() || requester.is_broadcast())
+        return;
+    auto &notice    = push<MigratedEvent>(requester, origin);
+    notice.origin   = origin;
+    notice.migrated = migrated;
+    notice.busy     = busy;
+}
+
 //! Actor Management
 
 bool
 VirtualCore::isActorAlive(ActorId const id) const noexcept {
     if (!id.is_valid())
         return false;
-    const auto it = _actors.find(id);
+    const auto *actor = _actors.find(id);
     // Same phase oracle as findActor<T>(): an actor whose async onInit() is still in flight is
     // addressable but not yet active, and one that has been killed is skipped even though its
     // destruction is deferred to the reap phase.
-    return it != _actors.end() && it->second->is_active();
+    return actor && actor->is_active();
 }
 
 void
 VirtualCore::killActor(ActorId const id) noexcept {
-    _actor_to_remove.insert(id);
+    // Reserves the slot of an actor killed from its constructor, before appendActor() inserts it.
+    if (auto &slot = _actors.reserve(id); !std::exchange(slot.reaping, true))
+        _actor_to_remove.push_back(id);
 }
 void
 VirtualCore::__unregisterCallback(ActorId const id) noexcept {
-    auto it = _actor_callbacks.find(id);
-    if (it != _actor_callbacks.end()) {
-        _actor_callbacks.erase(it);
+    if (auto *const slot = _actors.at(id); slot && slot->callback) {
+        slot->callback = nullptr;
         // Keep the flat callback snapshot in sync (2.6).
         auto vit = std::ranges::find_if(_callback_list, [id](CallbackEntry const &e) { return e.id == id; });
         if (vit != _callback_list.end()) {
@@ -976,18 +1634,81 @@ VirtualCore::try_send(Event const &event) const noexcept {
 
 void
 VirtualCore::send(Event const &event) noexcept {
+    if (unlikely(event.state.bits.multicast)) {
+        static_cast<void>(__multicast_detach__(event));
+        return;
+    }
+    if (unlikely(event.bucket_size >= kSharedEventMinBuckets) && event.dest._core_id != _index && event.state.bits.qos) {
+        static_cast<void>(__share_copy__(__getPipe__(event.dest._core_id, event.state.bits.lane), event));
+        return;
+    }
     if (event.dest._core_id == _index || !try_send(event)) {
-        auto &pipe = __getPipe__(event.dest._core_id);
+        auto &pipe = __getPipe__(event.dest._core_id, event.state.bits.lane);
         pipe.recycle(event, event.bucket_size);
     }
 }
 
 Event &
 VirtualCore::push(Event const &event) noexcept {
-    auto &pipe = __getPipe__(event.dest._core_id);
+    if (unlikely(event.state.bits.multicast))
+        return __multicast_detach__(event);
+    auto &pipe = __getPipe__(event.dest._core_id, event.state.bits.lane);
+    if (unlikely(event.bucket_size >= kSharedEventMinBuckets) && event.dest._core_id != _index && event.state.bits.qos)
+        return __share_copy__(pipe, event);
     return pipe.recycle_back(event, event.bucket_size);
 }
 
+EventBucket *
+VirtualCore::__shared_storage__(ActorId const dest, std::size_t const buckets) noexcept {
+    // Wider than `bucket_size` can say: leave it to the bucket path, which reports it.
+    if (buckets < kSharedEventMinBuckets || buckets > (std::numeric_limits<uint16_t>::max)() || dest._core_id == _index)
+        return nullptr;
+    return _shared_slab.allocate(buckets);
+}
+
+void
+VirtualCore::__shared_publish__(VirtualPipe &pipe, Event const &payload) noexcept {
+    constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<SharedEventRef, EventBucket>();
+    auto *const           raw         = pipe.allocate_back(BUCKET_SIZE);
+    detail::prepare_event_storage(raw, BUCKET_SIZE * sizeof(EventBucket));
+    auto &ref           = *(new (reinterpret_cast<SharedEventRef *>(raw)) SharedEventRef(const_cast<Event *>(&payload)));
+    ref.id              = _shared_ref_id;
+    ref.dest            = payload.dest;
+    ref.source          = payload.source;
+    ref.state.bits.qos  = payload.state.bits.qos;
+    ref.state.bits.lane = payload.state.bits.lane;
+    ref.bucket_size     = static_cast<uint16_t>(BUCKET_SIZE);
+}
+
+Event &
+VirtualCore::__share_copy__(VirtualPipe &pipe, Event const &event) noexcept {
+    // One copy instead of two (pipe -> ring -> receive buffer), and no ring-width ceiling.
+    auto *const raw  = _shared_slab.allocate(event.bucket_size);
+    auto       &copy = *reinterpret_cast<Event *>(std::memcpy(raw, &event, event.getSize()));
+    __shared_publish__(pipe, copy);
+    return copy;
+}
+
+Event &
+VirtualCore::__multicast_detach__(Event const &event) noexcept {
+    // The copy is shared by the other targets and disposed once they all saw it: re-pushing it
+    // by bytes would double-own its payload. Clone the payload alone, without sids or footer.
+    auto const &footer = detail::multicast_footer::of(event);
+    auto       &pipe   = __getPipe__(event.dest._core_id, event.state.bits.lane);
+    auto       *raw    = event.state.bits.qos ? __shared_storage__(event.dest, footer.buckets) : nullptr;
+    const bool  shared = raw != nullptr;
+    if (!shared)
+        raw = pipe.allocate_back(footer.buckets);
+    detail::prepare_event_storage(raw, footer.buckets * sizeof(EventBucket));
+    footer.clone(event, raw);
+    auto &copy                = *reinterpret_cast<Event *>(raw);
+    copy.bucket_size          = footer.buckets;
+    copy.state.bits.multicast = 0;
+    if (shared)
+        __shared_publish__(pipe, copy);
+    return copy;
+}
+
 void
 VirtualCore::reply(Event &event) noexcept {
     std::swap(event.dest, event.source);
@@ -1018,6 +1739,31 @@ VirtualCore::time() const noexcept {
     return _metrics._nanotimer;
 }
 
+EventBucket *
+detail::shared_event_storage(ActorId const dest, std::size_t const buckets) noexcept {
+    auto *const core = VirtualCore::_handler;
+    return core ? core->__shared_storage__(dest, buckets) : nullptr;
+}
+
+void
+detail::shared_event_publish(VirtualPipe &pipe, Event const &payload) noexcept {
+    VirtualCore::_handler->__shared_publish__(pipe, payload);
+}
+
+bool
+detail::task_submit(task_group *const group) noexcept {
+    auto *const core = VirtualCore::_handler;
+    if (!core)
+        return false;
+    return core->__submit_task__(*group);
+}
+
+std::size_t
+detail::task_workers() noexcept {
+    auto *const core = VirtualCore::_handler;
+    return core ? core->_engine.getNbCore() : 1u;
+}
+
 // `_nb_service`, `_handler` and `activation_deadline_ns` used to be defined HERE. All three are
 // process-wide state -- the ServiceActor id counter, the per-thread current core, and a public
 // knob a consumer sets before Main::start() -- and an out-of-line definition makes each of them
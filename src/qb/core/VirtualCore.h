@@ -26,12 +26,16 @@
 
 #ifndef QB_CORE_H
 #define QB_CORE_H
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <span>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -60,12 +64,17 @@
 #include <qb/utility/compat.h>
 #include "Actor.h"
 #include "Event.h"
+#include "EventBatch.h"
 #include "ICallback.h"
 #include "Main.h"
 #include "Pipe.h"
+#include "TaskPool.h"
 
 namespace qb {
 
+class Recorder;
+enum class RecordKind : std::uint8_t;
+
 /*!
  * @class VirtualCore
  * @ingroup Engine
@@ -146,19 +155,17 @@ private:
     friend class Service;
     friend class CoreInitializer;
     friend class Main;
+    friend class LoadBalancer;
+    friend class Telemetry;
+    template <typename>
+    friend class EventBatch;
     template <typename>
     friend class ActorHandle; // RefActorHandle is an alias of ActorHandle
     ////////////
-    constexpr static const uint64_t MaxRingEvents = ((std::numeric_limits<uint16_t>::max)() + 1) / QB_LOCKFREE_EVENT_BUCKET_BYTES;
-    /// Widest event a destination mailbox ring can ever accept — see VirtualCore.cpp.
-    static constexpr std::size_t kMaxDeliverableBuckets = SharedCoreCommunication::MaxRingEvents;
     // Types
     using Mailbox         = SharedCoreCommunication::Mailbox;
-    using EventBuffer     = std::array<EventBucket, MaxRingEvents>;
-    using ActorMap        = qb::unordered_map<ActorId, std::unique_ptr<Actor>>;
-    using CallbackMap     = qb::unordered_map<ActorId, ICallback *>;
     using PipeMap         = std::vector<VirtualPipe>;
-    using RemoveActorList = qb::unordered_set<ActorId>;
+    using RemoveActorList = std::vector<ActorId>;
 
     /**
      * @class ServiceIdPool
@@ -255,6 +262,139 @@ private:
     };
     using AvailableIdList = ServiceIdPool;
 
+    /// An actor whose `onInit()` is suspended (see "Asynchronous actor initialization" below).
+    struct Activation {
+        qb::io::async::task<bool>             init;                ///< owns the suspended onInit frame
+        std::uint64_t                         deadline_ns = 0;     ///< wall-clock deadline (0 = none)
+        bool                                  cancelling  = false; ///< deadline fired → scope cancelled, awaiting unwind
+        std::vector<std::vector<EventBucket>> stash;               ///< FIFO of byte-copied inbound unicast events
+    };
+
+    /**
+     * @class ActorTable
+     * @ingroup Engine
+     * @brief This core's actors in a flat array indexed by `ServiceId`.
+     * @details
+     * Replaces the `ActorId`-keyed hash maps and sets the core used to keep side by
+     * side (actors, callbacks, the reap set, the Activating map): what the workflow
+     * knows about one actor lives in its `Slot`, reached with a bounds check and one
+     * compare instead of a hash probe per container. `ServiceIdPool` hands out the
+     * smallest free id, so the array stays as dense as the core's peak actor count;
+     * it grows by powers of two and never shrinks.
+     *
+     * A slot can be *reserved* before it holds its actor: the constructor may
+     * register a callback or kill the actor, and `initActor()` starts an activation,
+     * all before `appendActor()` inserts it. `release()` empties the slot and, if it
+     * held an actor, bumps its generation. Service ids are recycled, so the same
+     * `ActorId` names the next actor of that slot; an `ActorHandle` keeps the
+     * generation it was created under and resolves nothing once it changed.
+     *
+     * Thread-model: owned exclusively by a single `VirtualCore` worker thread;
+     * no synchronization is performed.
+     */
+    class ActorTable {
+    public:
+        struct Slot {
+            std::unique_ptr<Actor>      actor;                ///< null while only reserved
+            std::unique_ptr<Activation> activation;           ///< set while the actor is Activating
+            ICallback                  *callback   = nullptr; ///< registered `ICallback`, if any
+            ActorId                     id;                   ///< `NotFound` while vacant
+            std::uint32_t               generation = 0;       ///< actors this slot has released
+            bool                        reaping    = false;   ///< queued in `_actor_to_remove`
+            bool                        dying      = false;   ///< killed while its onInit frame was still suspended
+        };
+
+    private:
+        std::vector<Slot> _slots;
+        std::size_t       _size = 0; ///< slots holding an actor
+
+    public:
+        /// The slot of @p id, holding its actor or only reserved; nullptr if it has none.
+        [[nodiscard]] Slot *
+        at(ActorId id) noexcept {
+            const std::size_t sid = id._service_id;
+            return sid < _slots.size() && _slots[sid].id == id ? &_slots[sid] : nullptr;
+        }
+        [[nodiscard]] Slot const *
+        at(ActorId id) const noexcept {
+            return const_cast<ActorTable *>(this)->at(id);
+        }
+
+        /// The actor @p id names on this core, or nullptr.
+        [[nodiscard]] Actor *
+        find(ActorId id) const noexcept {
+            const auto *slot = at(id);
+            return slot ? slot->actor.get() : nullptr;
+        }
+
+        /// True iff @p id was killed and waits for the reap phase.
+        [[nodiscard]] bool
+        reaping(ActorId id) const noexcept {
+            const auto *slot = at(id);
+            return slot && slot->reaping;
+        }
+
+        /// The slot of @p id, reserved if it has none yet. Terminates on allocation failure.
+        [[nodiscard]] Slot &
+        reserve(ActorId id) noexcept {
+            const std::size_t sid = id._service_id;
+            if (sid >= _slots.size())
+                _slots.resize(std::max<std::size_t>(std::bit_ceil(sid + 1), 64u));
+            auto &slot = _slots[sid];
+            slot.id    = id;
+            return slot;
+        }
+
+        /// Store @p actor in its slot. The caller checked the slot holds none.
+        void
+        insert(std::unique_ptr<Actor> actor) noexcept {
+            auto &slot = reserve(actor->id());
+            slot.actor = std::move(actor);
+            ++_size;
+        }
+
+        /**
+         * @brief Empty the slot of @p id and hand its actor back.
+         * @details The table no longer names the actor when the caller destroys it, so
+         *          whatever its destructor creates or looks up sees a consistent table.
+         */
+        [[nodiscard]] std::unique_ptr<Actor>
+        release(ActorId id) noexcept {
+            auto *slot = at(id);
+            if (!slot)
+                return nullptr;
+            auto actor = std::move(slot->actor);
+            if (actor) {
+                --_size;
+                ++slot->generation;
+            }
+            *slot = Slot{.generation = slot->generation};
+            return actor;
+        }
+
+        /// Generation of the slot @p id maps to; 0 for a slot never used.
+        [[nodiscard]] std::uint32_t
+        generation(ActorId id) const noexcept {
+            const std::size_t sid = id._service_id;
+            return sid < _slots.size() ? _slots[sid].generation : 0u;
+        }
+
+        /// Every slot, reserved and vacant ones included.
+        [[nodiscard]] std::span<Slot>
+        slots() noexcept {
+            return _slots;
+        }
+
+        [[nodiscard]] std::size_t
+        size() const noexcept {
+            return _size;
+        }
+        [[nodiscard]] bool
+        empty() const noexcept {
+            return _size == 0;
+        }
+    };
+
     //! Types
 
 private:
@@ -263,21 +403,46 @@ private:
     const CoreId             _resolved_index;
     SharedCoreCommunication &_engine;
     // event reception
-    Mailbox                     &_mail_box;
-    std::unique_ptr<EventBuffer> _event_buffer;
-    router::memh<Event>          _router;
+    Mailbox                        &_mail_box;
+    // IdleWait::EventLoop: the doorbell watcher and latency timer; null otherwise
+    struct Parking;
+    std::unique_ptr<Parking>       _parking;
+    // Receive scratch, one ring's worth: the mailbox's `receive_buffer()`, next to its rings.
+    EventBucket *const             _event_buffer;
+    // detail::packed_bucket: the bucket a flush packs into, and the one a packed event is rebuilt in
+    EventBucket                    _packed;
+    EventBucket                    _unpacked;
+    router::dense_memh<Event>      _router;
+    // large cross-core events: built in this slab, released by the receiving core
+    SharedSlab                     &_shared_slab;
+    const Event::id_type           _shared_ref_id;
+    // this core's task queue (TaskPool.h); `_steal_cursor` rotates the first peer an idle pass robs
+    TaskQueue                      &_tasks;
+    std::size_t                    _steal_cursor = 0;
+    // loop profiler (Profiler.h): nullptr unless kLoopProfiler
+    LoopProfiler *const            _profiler;
+    // event stream recorder (Recording.h): null unless CoreInitializer::setRecording
+    std::unique_ptr<Recorder>      _recorder;
     // event flush
-    PipeMap                      _pipes;
-    VirtualPipe                 &_mono_pipe_swap;
-    std::unique_ptr<VirtualPipe> _mono_pipe;
+    PipeMap                        _pipes;
+    VirtualPipe                    &_mono_pipe_swap;
+    std::unique_ptr<VirtualPipe>   _mono_pipe;
+    // priority lane (qb::is_priority_event): flushed and received before the pipes above
+    PipeMap                        _priority_pipes;
+    VirtualPipe                    &_mono_priority_pipe_swap;
+    std::unique_ptr<VirtualPipe>   _mono_priority_pipe;
+    // multicast: the destinations of the current call, grouped by core
+    std::vector<ActorId>           _multicast_targets;
     // actors management
     AvailableIdList _ids;
-    ActorMap        _actors;
-    CallbackMap     _actor_callbacks;
+    // storage of this core's actors (Actor::operator new), owned by the engine
+    ActorSlab      &_actor_slab;
+    // actors, their callbacks, kill and activation state, by ServiceId
+    ActorTable      _actors;
     /**
      * @brief Flat, cache-friendly snapshot of registered callbacks.
      * @details
-     * Maintained in sync with `_actor_callbacks` on register / unregister so the
+     * Maintained in sync with the slots' `callback` on register / unregister so the
      * workflow loop can iterate without rebuilding a thread-local vector on every
      * iteration (finding 2.6). Each entry pairs the callback pointer (owned by the
      * actor instance) with the actor id, so the workflow loop can skip the
@@ -290,22 +455,21 @@ private:
         ActorId    id;
     };
     std::vector<CallbackEntry> _callback_list;
+    // killed actors awaiting the reap phase; a slot's `reaping` flag keeps each id in once
     RemoveActorList            _actor_to_remove;
     /**
      * @brief Scratch buffer the reap loop drains `_actor_to_remove` into.
      * @details
      * `removeActor()` destroys the actor, which runs arbitrary user code (its destructor,
      * and any referenced actor it owns). That code may `kill()` a *different* actor, which
-     * re-enters `killActor()` → `_actor_to_remove.insert()`. Iterating `_actor_to_remove`
-     * directly therefore mutates the container mid-iteration: a growth rehash of
-     * `qb::unordered_set` rebuilds the bucket array and invalidates every live iterator
-     * (node-based storage keeps *references* valid, not iterators), and even where the
-     * iterator survives, an id landing behind the cursor is silently dropped by the
-     * subsequent `clear()`, leaving a `!is_alive()` actor in `_actors` forever so the core
-     * never terminates. Neither half depends on the build mode. The loop swaps into this buffer
-     * instead and repeats until no new kill appears. Member (not `thread_local`) because the
-     * reap block is a `goto` target — jumping across a block-scope thread_local's
-     * initialization is best avoided.
+     * re-enters `killActor()` → `_actor_to_remove.push_back()`. Iterating `_actor_to_remove`
+     * directly therefore mutates the container mid-iteration: a growth reallocation
+     * invalidates every live iterator, and even where the iterator survives, an id landing
+     * behind the cursor is silently dropped by the subsequent `clear()`, leaving a
+     * `!is_alive()` actor in `_actors` forever so the core never terminates. Neither half
+     * depends on the build mode. The loop swaps into this buffer instead and repeats until
+     * no new kill appears. Member (not `thread_local`) because the reap block is a `goto`
+     * target — jumping across a block-scope thread_local's initialization is best avoided.
      */
     RemoveActorList _actor_remove_batch;
 
@@ -319,7 +483,7 @@ private:
     //     FIFO once it becomes active (the dispatch gate in `__receive_events__`),
     //   - an activation deadline bounds the window (mutual-init deadlock-proof).
     //
-    // The dispatch gate's oracle is membership in THIS map (`__is_activating__`), NOT
+    // The dispatch gate's oracle is a slot's `activation` (`__is_activating__`), NOT
     // `Actor::is_active()` — the two agree on `_activated` but the gate never reads
     // `_alive`, and it DEFERS rather than withholds. `is_active()` gates the two lookups
     // (`findActor`, `isActorAlive`); `getService` gates on nothing at all. Three things
@@ -327,20 +491,48 @@ private:
     // and the reply to a `qb::ask` this actor issued from its own `onInit()` (stashing it
     // would deadlock the init on its own reply). Full inventory: `qb::Actor::is_active()`.
     // The common case — `onInit()` completes synchronously (no `co_await`) — never
-    // enters this map: it is the `empty()`-guarded slow path, mirroring the
+    // enters this list: it is the `empty()`-guarded slow path, mirroring the
     // `_actor_to_remove` fast-path discipline so non-async actors pay nothing.
-    struct Activation {
-        qb::io::async::task<bool>             init;                ///< owns the suspended onInit frame
-        std::uint64_t                         deadline_ns = 0;     ///< wall-clock deadline (0 = none)
-        bool                                  cancelling  = false; ///< deadline fired → scope cancelled, awaiting unwind
-        std::vector<std::vector<EventBucket>> stash;               ///< FIFO of byte-copied inbound unicast events
-    };
-    qb::unordered_map<ActorId, Activation> _activating;
-    RemoveActorList                        _dying_with_frame; ///< killed while their onInit frame was still suspended
+    std::vector<ActorId> _activating; ///< ids whose slot holds an `Activation`
 
     /// Per-actor stash cap: a wedged-in-init actor must not OOM the core.
     static constexpr std::size_t kActivationStashCap = 4096u;
 
+    // --- Runtime migration (`Actor::migrate`) --------------------------------
+    //
+    // Control plane: three engine-private event types that no actor ever subscribes, so they
+    // reach `__on_unrouted__` through the router's unknown-type branch and the dispatch hot
+    // path pays nothing for them. The request is unicast to the migrating actor (so it lands
+    // on that actor's core, behind whatever was already queued for it); the transfer and the
+    // settlement are addressed to the destination / origin core as broadcasts.
+    struct MigrateRequestEvent : Event {
+        CoreId to = 0; ///< destination core; the requester is the event source
+    };
+    struct MigrationTransferEvent : Event {
+        std::unique_ptr<IActorFactory> factory; ///< one-shot, from `Actor::onMigrate()`
+        ActorId                        origin;
+        ActorId                        requester;
+    };
+    struct MigrationSettledEvent : Event {
+        ActorId origin;
+        ActorId migrated; ///< NotFound if the destination failed to re-create the actor
+        ActorId requester;
+    };
+    // Redirection table, keyed by the SID of an actor that migrated away from this core. While
+    // the transfer is in flight (`to` not yet valid) inbound unicast for the old id is
+    // byte-copied into `stash`, exactly like an activation stash; once settled the stash and
+    // every later event are re-addressed to `to` and pushed in order. A settled entry lives for
+    // `migration_redirect_grace_ns` — it keeps the old SID out of the pool meanwhile, so the id
+    // cannot alias a newcomer — then `__expire_redirects__` erases it and releases the SID. The
+    // gate is `empty()`-guarded, so a core with no migration in its grace window pays nothing.
+    struct Redirect {
+        ActorId                               to;
+        std::vector<std::vector<EventBucket>> stash;
+        std::uint64_t                         expires_ns = 0; ///< set once settled
+    };
+    qb::unordered_map<ServiceId, Redirect> _redirects;
+    std::vector<ServiceId>                 _retiring; ///< settled redirects, oldest first
+
 public:
     /**
      * @brief Activation deadline in nanoseconds — bounds a suspended `onInit()`.
@@ -352,6 +544,16 @@ public:
      */
     QB_ABI_ANCHOR static inline std::uint64_t activation_deadline_ns = 5ull * 1000u * 1000u * 1000u; // 5 s
 
+    /**
+     * @brief How long a core keeps forwarding an old id after its actor migrated away, in ns.
+     * @details Once the destination has reported the new id, the origin core re-addresses
+     *          events still sent to the old id for this long, then drops the redirection entry
+     *          and returns the old id to its pool; later events to the old id are dropped like
+     *          those to any dead actor. Senders learn the new id from `MigratedEvent` or from
+     *          any reply. Default 5 s. Set it (in ns) **before** `qb::Main::start()`.
+     */
+    QB_ABI_ANCHOR static inline std::uint64_t migration_redirect_grace_ns = 5ull * 1000u * 1000u * 1000u; // 5 s
+
 private:
     // --- loop
 
@@ -374,6 +576,7 @@ private:
         std::uint64_t _nb_event_sent_try  = 0;
         std::uint64_t _nb_event_sent      = 0;
         std::uint64_t _nb_bucket_sent     = 0;
+        std::uint64_t _nb_task            = 0; ///< task-pool chunks run (own or stolen)
         std::uint64_t _nanotimer          = static_cast<std::uint64_t>(qb::unix_nanos(qb::wall_now())); ///< seeded: onInit precedes pass 1
 
         /**
@@ -381,7 +584,7 @@ private:
          */
         [[nodiscard]] bool
         had_activity() const noexcept {
-            return (_nb_event_sent + _nb_event_received + _nb_event_io + _nb_event_sent_try) != 0;
+            return (_nb_event_sent + _nb_event_received + _nb_event_io + _nb_event_sent_try + _nb_task) != 0;
         }
 
         /**
@@ -393,7 +596,7 @@ private:
          */
         void
         carry_over() noexcept {
-            const auto activity = _nb_event_sent + _nb_event_received + _nb_event_io + _nb_event_sent_try;
+            const auto activity = _nb_event_sent + _nb_event_received + _nb_event_io + _nb_event_sent_try + _nb_task;
             const auto ts       = _nanotimer;
             const auto credit   = _spin_credit + activity;
             *this               = {};
@@ -401,6 +604,124 @@ private:
             _nanotimer          = ts;
         }
     } _metrics;
+    /**
+     * @struct LoadSampler
+     * @brief Per-core load accounting read by `qb::LoadBalancer`.
+     * @details Off unless a `LoadBalancer` runs on this core (it sets `enabled` from its
+     *          `onInit()`), and every hook on the loop is behind one `unlikely(enabled)` test.
+     *          `busy_ns` sums the wall time of loop passes that moved at least one event or I/O
+     *          (`Metrics::had_activity()`), `window_ns` the time of all passes, so their ratio is
+     *          the share of the sampling window this core spent working rather than polling or
+     *          parked in `_mail_box.wait()`. `per_sid` counts routed unicast events per
+     *          destination SID. The balancer reads and resets the sampler on its own core only.
+     */
+    struct LoadSampler {
+        bool                       enabled     = false;
+        bool                       last_active = false; ///< had_activity() of the previous pass
+        std::uint64_t              busy_ns     = 0;
+        std::uint64_t              window_ns   = 0;
+        std::uint64_t              events      = 0;
+        std::vector<std::uint32_t> per_sid; ///< grown on demand to the highest SID seen
+
+        void
+        reset() noexcept {
+            busy_ns = window_ns = events = 0;
+            std::fill(per_sid.begin(), per_sid.end(), 0u);
+        }
+    } _load;
+    /**
+     * @struct IdleBackoff
+     * @brief What an idle loop pass does before the next one, per `IdlePolicy`.
+     * @details `next()` runs once per pass with whether the pass had activity and its start
+     *          time. `Credit` keeps the `Metrics::_spin_credit` scheme; the other modes answer
+     *          directly. Adaptive keeps `gap_ewma_ns`, the moving average of the time from one
+     *          busy pass to the next busy pass that followed at least one idle pass, and sizes
+     *          its spin and yield windows from it. `Park` is only returned when the mailbox has a
+     *          latency to park for; otherwise such a pass yields.
+     */
+    struct IdleBackoff {
+        enum class Step : std::uint8_t { Poll, Credit, Pause, Yield, Park };
+
+        IdlePolicy::Mode mode         = IdlePolicy::Mode::Credit;
+        bool             can_park     = false;
+        bool             was_idle     = false;
+        std::uint8_t     ewma_shift   = 3;
+        std::uint64_t    min_spin_ns  = 0;
+        std::uint64_t    max_spin_ns  = 0;
+        std::uint64_t    max_yield_ns = 0;
+        std::uint64_t    last_busy_ns = 0;
+        std::uint64_t    gap_ewma_ns  = 0;
+
+        void configure(IdlePolicy const &policy, bool parkable) noexcept;
+
+        [[nodiscard]] Step
+        next(bool const active, std::uint64_t const now_ns) noexcept {
+            switch (mode) {
+                case IdlePolicy::Mode::Credit:
+                    return can_park ? Step::Credit : Step::Poll;
+                case IdlePolicy::Mode::Dedicated:
+                    return active ? Step::Poll : Step::Pause;
+                case IdlePolicy::Mode::PowerSaver:
+                    return active ? Step::Poll : park_or_yield();
+                case IdlePolicy::Mode::Adaptive:
+                    break;
+            }
+            if (active) {
+                if (was_idle) {
+                    const auto gap = static_cast<std::int64_t>(now_ns - last_busy_ns);
+                    gap_ewma_ns    = static_cast<std::uint64_t>(static_cast<std::int64_t>(gap_ewma_ns)
+                                                             + ((gap - static_cast<std::int64_t>(gap_ewma_ns)) >> ewma_shift));
+                    was_idle       = false;
+                }
+                last_busy_ns = now_ns;
+                return Step::Poll;
+            }
+            was_idle           = true;
+            const auto idle_ns = now_ns - last_busy_ns;
+            const auto expect  = 2 * gap_ewma_ns;
+            const auto spin    = expect <= max_spin_ns ? (std::max)(expect, min_spin_ns) : min_spin_ns;
+            if (idle_ns < spin)
+                return Step::Pause;
+            const auto yield = expect <= max_yield_ns ? (std::max)(expect, spin) : spin;
+            return idle_ns < yield ? Step::Yield : park_or_yield();
+        }
+
+    private:
+        [[nodiscard]] Step
+        park_or_yield() const noexcept {
+            return can_park ? Step::Park : Step::Yield;
+        }
+    } _idle;
+    /**
+     * @struct Totals
+     * @brief Cumulative counters of this core since start, read by `qb::Telemetry`.
+     * @details Always on. `Metrics` is folded in once per loop pass, before `carry_over()`
+     *          clears it; the flush counters are bumped on the backpressure paths of
+     *          `__flush_pipes__`, which are already cold. Only this core's thread touches them.
+     */
+    struct Totals {
+        std::uint64_t events_received  = 0;
+        std::uint64_t buckets_received = 0;
+        std::uint64_t events_sent      = 0; ///< handed to a peer's mailbox or dropped, as `Metrics` counts them
+        std::uint64_t buckets_sent     = 0;
+        std::uint64_t flush_retries    = 0; ///< `try_send` attempts repeated on a full ring (QoS >= 1)
+        std::uint64_t stalled_flushes  = 0; ///< flushes cut short after the retry budget ran out
+        std::uint64_t qos0_drops       = 0; ///< QoS-0 events discarded on a full ring
+        std::uint64_t oversize_drops   = 0; ///< events wider than the destination ring, discarded
+        std::uint64_t packed_events    = 0; ///< events sent several to a ring bucket (`detail::packed_bucket`)
+        std::uint64_t mailbox_high     = 0; ///< most buckets drained from one normal lane in one pass
+        std::uint64_t tasks_run        = 0; ///< task-pool chunks this core executed
+        std::uint64_t tasks_stolen     = 0; ///< of which taken from a peer's queue
+
+        void
+        absorb(Metrics const &pass) noexcept {
+            events_received += pass._nb_event_received;
+            buckets_received += pass._nb_bucket_received;
+            events_sent += pass._nb_event_sent;
+            buckets_sent += pass._nb_bucket_sent;
+            tasks_run += pass._nb_task;
+        }
+    } _totals;
     unsigned int _last_signal_generation =
         0; ///< `Main::_signal_generation` value at this core's last SignalEvent synthesis; a newer value (a fresh signal or `Main::stop()`)
            ///< re-triggers delivery. Replaces the old single-shot `_signal_consumed` latch that dropped every signal after the first.
@@ -430,6 +751,12 @@ private:
      *          `__workflow__`. The token is polled once per iteration.
      */
     void __set_stop_token__(qb::stop_token token) noexcept;
+    /// Apply the core's `IdlePolicy`; called like `__set_stop_token__`, before `__workflow__`.
+    void __set_idle_policy__(IdlePolicy const &policy) noexcept;
+    /// Open the core's `Recorder` on @p file (`CoreInitializer::setRecording`); empty: none.
+    void __set_recording__(std::string const &file) noexcept;
+    /// Write @p event to the recorder, the slab-resident payload for a `SharedEventRef`.
+    void __record__(RecordKind kind, Event const &event) noexcept;
 
     /*!
      * @brief Generate a new actor ID
@@ -446,9 +773,10 @@ private:
     /*!
      * @brief Get or create a pipe to a specific core
      * @param core Target core ID
+     * @param priority Select the priority-lane pipe (`qb::is_priority_event`) instead
      * @return Reference to the virtual pipe for communication with the target core
      */
-    [[nodiscard]] VirtualPipe &__getPipe__(CoreId core) noexcept;
+    [[nodiscard]] VirtualPipe &__getPipe__(CoreId core, bool priority = false) noexcept;
     /**
      * @brief Dispatch a contiguous batch of events from a raw bucket buffer.
      * @param events A `std::span` view of the event buckets to route.
@@ -457,8 +785,15 @@ private:
      *          construction and aggregate iteration without any runtime cost.
      */
     void __receive_events__(std::span<EventBucket> events);
+    /// Load sampler hooks (see `LoadSampler`); only called while `_load.enabled`.
+    void __count_load__(ActorId dest) noexcept;
+    void __account_pass__(std::uint64_t now_ns) noexcept;
     void __receive__();
+    /// Same-core priority pipe, then every priority lane of the mailbox.
+    void __receive_priority__();
     bool __flush_all__() noexcept;
+    /// One `__flush_all__` sweep over @p pipes, the normal or the priority set.
+    bool __flush_pipes__(PipeMap &pipes) noexcept;
     //! Shutdown residual drain helper: dispose the events queued in this core's outbound
     //! pipes whose destination core has already left __workflow__ (published its "stopped"
     //! flag) and will never drain its mailbox again — those events can never be delivered, so
@@ -466,12 +801,27 @@ private:
     //! still-live (backpressured) peers are left untouched for retry. Returns true if any
     //! non-empty pipe still targets a live core. Shutdown path only.
     [[nodiscard]] bool __dispose_residual_to_stopped_cores__() noexcept;
+    //! The same, over one pipe set: the normal or the priority one.
+    [[nodiscard]] bool __dispose_residual_pipes__(PipeMap &pipes) noexcept;
     //! Event Management
 
     // Workflow
-    bool __init__(CoreIdSet const &cores);
+    bool __init__(CoreIdSet const &cores, bool numa_local = false);
+    /// `CoreInitializer::setNumaLocal`: prefer the node of @p cores, bind the hot buffers to it.
+    void __bind_to_node__(CoreIdSet const &cores) noexcept;
     bool __init__actors__();
     void __workflow__();
+    /// Idle wait of `IdleWait::EventLoop`: block in the I/O loop until a doorbell, I/O or the latency.
+    void __park__();
+    /**
+     * @brief Run at most one task-pool chunk: this core's newest, else (on an @p idle pass only)
+     *        the oldest of the first peer queue that has one.
+     * @return true if a chunk ran.
+     */
+    bool __run_task__(bool idle) noexcept;
+    /// `detail::task_submit`: queue every chunk of @p group here, wake the parked peers.
+    /// @return false, nothing queued, if the task queue could not grow.
+    bool __submit_task__(detail::task_group &group) noexcept;
     //! Workflow
 
     // Actor Management
@@ -515,6 +865,22 @@ private:
     [[nodiscard]] bool __stash_event__(ActorId dest, Event *event) noexcept;
     /// Per-iteration pump: complete finished inits, replay stashes, enforce deadlines.
     void __pump_activations__() noexcept;
+
+    // --- Runtime migration ----------------------------------------------------
+    /// Backs `Actor::migrate`: validate, then push a `MigrateRequestEvent` to @p target.
+    void __request_migration__(ActorId target, CoreId to, ActorId requester) noexcept;
+    /// Unknown-type hook of every `route()` on this core: consumes the migration control
+    /// events. @return true if @p event was one of them (the caller must not log it).
+    [[nodiscard]] bool __on_unrouted__(Event &event) noexcept;
+    /// Redirection gate: park or forward a unicast event addressed to a migrated-away SID.
+    /// @return true if the event was taken (stashed, forwarded or dropped-and-disposed).
+    [[nodiscard]] bool __redirect_event__(Event *event) noexcept;
+    void               __migrate_out__(MigrateRequestEvent const &event) noexcept;
+    void               __migrate_in__(MigrationTransferEvent &event) noexcept;
+    void               __migration_settled__(MigrationSettledEvent const &event) noexcept;
+    /// Erase the settled redirects whose grace period is over and release their old SIDs.
+    void               __expire_redirects__() noexcept;
+    void               __notify_migrated__(ActorId requester, ActorId origin, ActorId migrated, bool busy = false) noexcept;
     //! Actor Management
 
 private:
@@ -605,6 +971,17 @@ private:
     void   reply(Event &event) noexcept;
     void   forward(ActorId dest, Event &event) noexcept;
 
+    // Large-event path (SharedSlab.h). The two `detail` entry points are what the template
+    // bodies of Pipe.h can reach; they land on these members.
+    [[nodiscard]] EventBucket *__shared_storage__(ActorId dest, std::size_t buckets) noexcept;
+    void                       __shared_publish__(VirtualPipe &pipe, Event const &payload) noexcept;
+    /// Byte-copy an already-built event (a re-push) into the slab and publish it.
+    Event                     &__share_copy__(VirtualPipe &pipe, Event const &event) noexcept;
+    friend EventBucket        *detail::shared_event_storage(ActorId dest, std::size_t buckets) noexcept;
+    friend void                detail::shared_event_publish(VirtualPipe &pipe, Event const &payload) noexcept;
+    friend bool                detail::task_submit(detail::task_group *group) noexcept;
+    friend std::size_t         detail::task_workers() noexcept;
+
     template <typename T>
     static inline void fill_event(T &data, ActorId dest, ActorId source) noexcept;
     template <typename T, typename... _Init>
@@ -622,6 +999,18 @@ private:
      */
     template <typename T, typename... _Init>
     T &push(ActorId dest, ActorId source, _Init &&...init) noexcept;
+    /// Open an `EventBatch<T>` on `core`'s pipe (the priority pipe for a priority type).
+    template <typename T>
+    EventBatch<T> batch(CoreId core, ActorId source, std::size_t reserve) noexcept;
+    template <typename T, typename... _Init>
+    void multicast(ActorIdList const &dests, ActorId source, _Init &&...init) noexcept;
+    /// One multicast copy of `T` for `count` targets, all on one core. See `detail::multicast_footer`.
+    template <typename T, typename... _Init>
+    void __multicast_to__(ActorId const *targets, std::size_t count, ActorId source, _Init &&...init) noexcept;
+    /// Receiving side: deliver a multicast copy to each of its local targets, then dispose it.
+    void __receive_multicast__(Event &event) noexcept;
+    /// Queue a unicast copy of a multicast copy to its current `dest`, on the ordered path.
+    Event &__multicast_detach__(Event const &event) noexcept;
     //! Event Api
 
 public:
@@ -726,10 +1115,9 @@ _Actor *
 VirtualCore::findActor(ActorId const id) const noexcept {
     if (!id.is_valid())
         return nullptr;
-    const auto it = _actors.find(id);
-    if (it == _actors.end())
+    Actor *raw = _actors.find(id);
+    if (!raw)
         return nullptr;
-    Actor *raw = it->second.get();
     // Phase-aware: an actor whose async `onInit()` is still in flight (Activating) is NOT
     // yet handed out — a handle resolves it only once `is_active()`. For the sync-init
     // majority `is_active() == is_alive()`, so this is unchanged for them.
@@ -745,8 +1133,8 @@ VirtualCore::findActor(ActorId const id) const noexcept {
 template <typename _ServiceActor>
 _ServiceActor *
 VirtualCore::getService() const noexcept {
-    const auto &it = _actors.find(ActorId(_ServiceActor::ServiceIndex, _index));
-    if (it == _actors.end()) {
+    Actor *const service = _actors.find(ActorId(_ServiceActor::ServiceIndex, _index));
+    if (!service) {
         QB_LOG_CRIT("Failed to get Service[" << typeid(_ServiceActor).name() << "]"
                                              << " in Core(" << _index << ")"
                                              << " : does not exist");
@@ -764,7 +1152,7 @@ VirtualCore::getService() const noexcept {
     // kills itself from a handler stays reachable for the rest of that turn — and both are
     // the caller's problem: what you get back may be mid-init or dying. Ask it (an event, or
     // `co_await qb::ask(...)`) rather than reading its state if that matters.
-    return dynamic_cast<_ServiceActor *>(it->second.get());
+    return dynamic_cast<_ServiceActor *>(service);
 }
 
 template <typename _Actor>
@@ -775,8 +1163,10 @@ VirtualCore::registerCallback(_Actor &actor) noexcept {
     // destroyed by appendActor()).
     if (unlikely(!actor.id().is_valid()))
         return;
-    auto [it, inserted] = _actor_callbacks.insert({actor.id(), &actor});
-    if (inserted) {
+    // Reserves the slot when called from the constructor, before appendActor() inserts it.
+    auto &slot = _actors.reserve(actor.id());
+    if (!slot.callback) {
+        slot.callback = &actor;
         // Maintain the flat snapshot for the workflow loop (2.6).
         _callback_list.push_back({&actor, actor.id()});
     }
@@ -800,14 +1190,21 @@ VirtualCore::fill_event(T &data, ActorId const dest, ActorId const source) noexc
         std::swap(data.id, data.service_event_id);
     }
 
-    data.bucket_size = static_cast<uint16_t>(allocator::getItemSize<T, EventBucket>());
+    // Carried in the header so a runtime re-push (reply, forward) keeps the lane.
+    if constexpr (is_priority_event_v<T>)
+        data.state.bits.lane = 1;
+
+    // A Recorder writes payload bytes; heap a payload owns is not in them.
+    data.state.bits.owning  = !std::is_trivially_destructible_v<T>;
+    data.state.bits.compact = detail::packed_bucket::width<T>();
+    data.bucket_size        = static_cast<uint16_t>(allocator::getItemSize<T, EventBucket>());
 }
 
 template <typename T, typename... _Init>
 void
 VirtualCore::send(ActorId const dest, ActorId const source, _Init &&...init) noexcept {
     router::ensure_disposer<Event, T>(); // no-op for the trivially-destructible events send requires
-    auto                 &pipe        = __getPipe__(dest._core_id);
+    auto                 &pipe        = __getPipe__(dest._core_id, is_priority_event_v<T>);
     constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<T, EventBucket>();
     // Allocate raw + prepare + placement-new rather than pipe.allocate<T>(...): the bucket range
     // must be deterministic BEFORE the payload runs. See detail::prepare_event_storage.
@@ -839,8 +1236,18 @@ VirtualCore::push(ActorId const dest, ActorId const source, _Init &&...init) noe
     // THE enqueue funnel for Actor::push / to().push / reply / forward: guarantee this type can
     // be freed on any drop path even if no actor ever subscribes to it. See Pipe.h.
     router::ensure_disposer<Event, T>();
-    auto                 &pipe        = __getPipe__(dest._core_id);
+    auto                 &pipe        = __getPipe__(dest._core_id, is_priority_event_v<T>);
     constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<T, EventBucket>();
+    // Large and cross-core: built in this core's SharedSlab, only its descriptor enters the pipe.
+    // Decided at compile time for every smaller type. QoS 0 stays by value (dropped undisposed).
+    if constexpr (BUCKET_SIZE >= kSharedEventMinBuckets && !event_qos0_type<T>) {
+        if (auto *const shared = __shared_storage__(dest, BUCKET_SIZE)) {
+            auto &data = *(new (reinterpret_cast<T *>(shared)) T(std::forward<_Init>(init)...));
+            fill_event(data, dest, source);
+            __shared_publish__(pipe, data);
+            return data;
+        }
+    }
     // Raw + prepare + placement-new, not pipe.allocate_back<T>(...) — see
     // detail::prepare_event_storage: the guard in SharedCoreCommunication::send scans this whole
     // range, so every byte the payload does not write must be deterministic.
@@ -852,6 +1259,131 @@ VirtualCore::push(ActorId const dest, ActorId const source, _Init &&...init) noe
 
     return data;
 }
+
+template <typename T, typename... _Init>
+void
+VirtualCore::multicast(ActorIdList const &dests, ActorId const source, _Init &&...init) noexcept {
+    static_assert(!service_event_type<T>, "a service event is routed by its forward id and cannot be multicast");
+    static_assert(std::is_copy_constructible_v<T>, "a multicast event is cloned for reply/forward");
+    // Group by core, keeping the caller's order within each core (it is the delivery order).
+    auto &targets = _multicast_targets;
+    targets.assign(dests.begin(), dests.end());
+    std::stable_sort(targets.begin(), targets.end(), [](ActorId const a, ActorId const b) { return a._core_id < b._core_id; });
+    // A bound on the sid list, so a copy stays a small multiple of the event on huge lists.
+    constexpr std::size_t kChunk = 1024;
+    for (auto first = targets.begin(); first != targets.end();) {
+        const CoreId core = first->_core_id;
+        const auto   last = std::find_if(first, targets.end(), [core](ActorId const id) { return id._core_id != core; });
+        while (first != last) {
+            const auto count = (std::min)(static_cast<std::size_t>(last - first), kChunk);
+            assert(!first->is_broadcast() && "multicast takes unicast ids; use broadcast()");
+            // As in broadcast: arguments as lvalues, so every core copy-constructs T from them.
+            if (count == 1)
+                static_cast<void>(push<T>(*first, source, init...));
+            else
+                __multicast_to__<T>(&*first, count, source, init...);
+            first += static_cast<std::ptrdiff_t>(count);
+        }
+    }
+}
+
+template <typename T, typename... _Init>
+void
+VirtualCore::__multicast_to__(ActorId const *targets, std::size_t const count, ActorId const source, _Init &&...init) noexcept {
+    using footer_t = detail::multicast_footer;
+    router::ensure_disposer<Event, T>();
+    constexpr std::size_t BUCKET_SIZE = allocator::getItemSize<T, EventBucket>();
+    // event | padding | sids | footer, the footer closing the last bucket.
+    const std::size_t run  = (sizeof(T) + count * sizeof(ServiceId) + sizeof(footer_t) + sizeof(EventBucket) - 1) / sizeof(EventBucket);
+    const ActorId     dest = targets[0];
+    auto             &pipe = __getPipe__(dest._core_id, is_priority_event_v<T>);
+    // Same storage rule as push(): large and cross-core goes through the SharedSlab.
+    EventBucket *raw = nullptr;
+    if constexpr (!event_qos0_type<T>)
+        raw = __shared_storage__(dest, run);
+    const bool shared = raw != nullptr;
+    if (!shared)
+        raw = pipe.allocate_back(run);
+    detail::prepare_event_storage(raw, run * sizeof(EventBucket));
+    auto &data = *(new (reinterpret_cast<T *>(raw)) T(std::forward<_Init>(init)...));
+
+    fill_event(data, dest, source);
+    data.bucket_size          = static_cast<uint16_t>(run);
+    data.state.bits.multicast = 1;
+
+    auto *const footer = new (reinterpret_cast<std::byte *>(raw + run) - sizeof(footer_t))
+        footer_t{&detail::multicast_clone<T>, static_cast<uint16_t>(BUCKET_SIZE), static_cast<uint16_t>(count)};
+    auto *const sids = const_cast<ServiceId *>(footer->sids());
+    for (std::size_t k = 0; k < count; ++k)
+        sids[k] = targets[k]._service_id;
+
+    if (shared)
+        __shared_publish__(pipe, data);
+}
+
+template <typename T>
+EventBatch<T>
+VirtualCore::batch(CoreId const core, ActorId const source, std::size_t const reserve) noexcept {
+    router::ensure_disposer<Event, T>(); // once per batch, not per event
+    return EventBatch<T>(__getPipe__(core, is_priority_event_v<T>), core, source, reserve);
+}
+
+template <typename _Event>
+EventBatch<_Event>::EventBatch(VirtualPipe &pipe, CoreId const core, ActorId const source, std::size_t const reserve) noexcept
+    : _pipe(&pipe)
+    , _source(source)
+    , _core(core) {
+    if (batched && reserve)
+        this->reserve(reserve);
+}
+
+template <typename _Event>
+void
+EventBatch<_Event>::reserve(std::size_t const events) noexcept {
+    // One allocate_back and one prepare for the whole run; see VirtualCore::push for why the
+    // range is prepared before any payload is built in it.
+    _next = _pipe->allocate_back(events * BUCKET_SIZE);
+    _end  = _next + events * BUCKET_SIZE;
+    detail::prepare_event_storage(_next, events * BUCKET_SIZE * sizeof(EventBucket));
+}
+
+template <typename _Event>
+template <typename... _Args>
+_Event &
+EventBatch<_Event>::push(ActorId const dest, _Args &&...args) noexcept {
+    // Either path would have to allocate in a pipe other than the reservation: leave it to push().
+    if constexpr (!batched) {
+        ++_count;
+        return VirtualCore::_handler->template push<_Event>(dest, _source, std::forward<_Args>(args)...);
+    } else {
+        if (unlikely(dest.index() != _core)) {
+            ++_count;
+            return VirtualCore::_handler->template push<_Event>(dest, _source, std::forward<_Args>(args)...);
+        }
+        if (_next == _end) {
+            // Reservation exhausted (or never made): it ends at the pipe's end, so the next run
+            // is contiguous with it whenever the pipe does not have to move.
+            assert(_next == nullptr || _pipe->end() == _end);
+            reserve((std::max)(_count, std::size_t{1}));
+        }
+        auto &data = *(new (reinterpret_cast<_Event *>(_next)) _Event(std::forward<_Args>(args)...));
+        VirtualCore::fill_event(data, dest, _source);
+        _next += BUCKET_SIZE;
+        ++_count;
+        return data;
+    }
+}
+
+template <typename _Event>
+void
+EventBatch<_Event>::commit() noexcept {
+    if (_next != _end) {
+        // Only sound while the reservation is still the tail of the pipe: see the class contract.
+        assert(_pipe->end() == _end);
+        _pipe->free_back(static_cast<std::size_t>(_end - _next));
+    }
+    _next = _end = nullptr;
+}
 //! Event Api
 
 template <typename Tag>
@@ -950,6 +1482,12 @@ Actor::addRefActor(_Args &&...args) const {
     return ActorHandle<_Actor>(VirtualCore::_handler->template addReferencedActor<_Actor>(std::forward<_Args>(args)...));
 }
 
+template <typename _Actor>
+ActorHandle<_Actor>::ActorHandle(_Actor *actor) noexcept
+    : _id(actor ? actor->id() : ActorId{})
+    , _generation(actor && VirtualCore::_handler ? VirtualCore::_handler->_actors.generation(_id) : 0u)
+    , _cached(actor) {}
+
 template <typename _Actor>
 _Actor *
 ActorHandle<_Actor>::get() const noexcept {
@@ -961,7 +1499,8 @@ ActorHandle<_Actor>::get() const noexcept {
         return nullptr;
     // findActor is phase-aware: nullptr while the actor is still Activating, and after it
     // failed init / died. So `get()` returns a usable pointer only for an *active* actor.
-    auto *resolved = handler->template findActor<_Actor>(_id);
+    // The generation check turns down the next actor given the same recycled id.
+    auto *resolved = handler->_actors.generation(_id) == _generation ? handler->template findActor<_Actor>(_id) : nullptr;
     // Keep the cache fresh if it drifted (e.g. handle copied after kill).
     const_cast<ActorHandle<_Actor> *>(this)->_cached = resolved;
     return resolved;
@@ -979,6 +1518,18 @@ Actor::send(ActorId const &dest, _Args &&...args) const noexcept {
     VirtualCore::_handler->template send<_Event, _Args...>(dest, id(), std::forward<_Args>(args)...);
 }
 
+template <event_type _Event, typename... _Args>
+void
+Actor::multicast(ActorIdList const &dests, _Args &&...args) const noexcept {
+    VirtualCore::_handler->template multicast<_Event>(dests, id(), std::forward<_Args>(args)...);
+}
+
+template <event_type _Event>
+EventBatch<_Event>
+Actor::batch(CoreId const core, std::size_t const reserve) const noexcept {
+    return VirtualCore::_handler->template batch<_Event>(core, id(), reserve);
+}
+
 template <typename _Event, typename... _Args>
 _Event
 Actor::build_event(ActorId const source, _Args &&...args) const noexcept {
@@ -25,7 +25,13 @@
 
 #include "ActorId.cpp"
 #include "Event.cpp"
+#include "SharedSlab.cpp"
+#include "ActorSlab.cpp"
+#include "Profiler.cpp"
 #include "VirtualCore.cpp"
 #include "Actor.cpp"
 #include "CoreSet.cpp"
-#include "Main.cpp"
\ No newline at end of file
+#include "Main.cpp"
+#include "LoadBalancer.cpp"
+#include "Telemetry.cpp"
+#include "Recording.cpp"
\ No newline at end of file
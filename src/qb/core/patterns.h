@@ -38,6 +38,7 @@
 #include "VirtualCore.h"
 
 #include "patterns/request.h"
+#include "patterns/parallel.h"
 #include "patterns/discovery.h"
 #include "patterns/idempotency.h"
 #include "patterns/aggregate.h"
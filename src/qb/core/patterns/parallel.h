@@ -0,0 +1,453 @@
+/**
+ * @file qb/core/patterns/parallel.h
+ * @brief Data-parallel work on the engine's cores: `qb::offload`, `qb::parallel_for`, `qb::map_reduce`.
+ *
+ * These helpers run short CPU-bound closures on the work-stealing task queues of
+ * `qb/core/TaskPool.h`: the calling core queues the chunks, every core runs them between loop
+ * passes (idle cores steal), and the result comes back to the calling actor on its own core, as
+ * a coroutine resume or as an event of its choosing. No foreign thread pool is involved.
+ *
+ * The closures run on **other cores' threads**, concurrently with every actor: capture inputs by
+ * value (or point at data nobody mutates until the result is back) and never touch actor state.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Patterns
+ */
+
+#ifndef QB_CORE_PATTERNS_PARALLEL_H
+#define QB_CORE_PATTERNS_PARALLEL_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <qb/core/Actor.h>
+#include <qb/core/TaskPool.h>
+#include <qb/core/VirtualCore.h> // CoroContext::push, report_unhandled_coroutine_exception
+#include <qb/io/async/coroutine.h>
+
+namespace qb {
+
+namespace detail {
+
+/**
+ * @brief A `task_group` whose completion resumes a coroutine awaiting it in `task_awaiter`.
+ * @details `complete()` pushes a `TaskDoneEvent` carrying the group to the owner, from the core
+ *          that ran the last chunk; `VirtualCore::__on_unrouted__` hands it to the awaiter.
+ */
+class awaited_group : public task_group {
+    CoroContext         _ctx;
+    const std::uint64_t _correlation;
+
+protected:
+    void
+    complete() noexcept final {
+        _ctx.template push<TaskDoneEvent>(_correlation, this);
+    }
+
+public:
+    awaited_group(CoroContext const &ctx, std::uint32_t const chunks)
+        : task_group(ctx.id(), chunks)
+        , _ctx(ctx)
+        , _correlation(ask_next_id(ctx.id())) {}
+
+    [[nodiscard]] std::uint64_t
+    correlation() const noexcept {
+        return _correlation;
+    }
+};
+
+/// `[first, last)` cut into chunks of `grain` indices; `grain == 0` sizes them for the core count.
+struct chunking {
+    std::size_t   first  = 0;
+    std::size_t   count  = 0;
+    std::size_t   grain  = 1;
+    std::uint32_t chunks = 0;
+
+    chunking(std::size_t const from, std::size_t const to, std::size_t const requested)
+        : first(from)
+        , count(to > from ? to - from : 0) {
+        if (!count)
+            return;
+        grain = requested ? requested : (count + task_workers() * 4 - 1) / (task_workers() * 4);
+        grain = (std::max)(grain, (count + (std::numeric_limits<std::uint32_t>::max)() - 1) / (std::numeric_limits<std::uint32_t>::max)());
+        chunks = static_cast<std::uint32_t>((count + grain - 1) / grain);
+    }
+
+    [[nodiscard]] std::pair<std::size_t, std::size_t>
+    range(std::uint32_t const index) const noexcept {
+        const auto begin = first + std::size_t{index} * grain;
+        return {begin, (std::min)(begin + grain, first + count)};
+    }
+};
+
+template <class Fn>
+class offload_group final : public awaited_group {
+    using R          = std::invoke_result_t<Fn &>;
+    using value_type = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+    Fn                        _fn;
+    std::optional<value_type> _value;
+    std::exception_ptr        _error;
+
+protected:
+    void
+    run(std::uint32_t) noexcept final {
+        try {
+            if constexpr (std::is_void_v<R>) {
+                _fn();
+                _value.emplace();
+            } else
+                _value.emplace(_fn());
+        } catch (...) {
+            _error = std::current_exception();
+        }
+    }
+
+public:
+    offload_group(CoroContext const &ctx, Fn fn)
+        : awaited_group(ctx, 1)
+        , _fn(std::move(fn)) {}
+
+    R
+    result() {
+        if (_error)
+            std::rethrow_exception(_error);
+        if constexpr (!std::is_void_v<R>)
+            return std::move(*_value);
+    }
+};
+
+template <class Fn>
+class for_group final : public awaited_group {
+    Fn                              _fn;
+    chunking                        _split;
+    std::vector<std::exception_ptr> _errors;
+
+protected:
+    void
+    run(std::uint32_t const index) noexcept final {
+        const auto [begin, end] = _split.range(index);
+        try {
+            for (auto i = begin; i < end; ++i)
+                std::as_const(_fn)(i);
+        } catch (...) {
+            _errors[index] = std::current_exception();
+        }
+    }
+
+public:
+    for_group(CoroContext const &ctx, chunking const &split, Fn fn)
+        : awaited_group(ctx, split.chunks)
+        , _fn(std::move(fn))
+        , _split(split)
+        , _errors(split.chunks) {}
+
+    void
+    result() const {
+        for (auto const &error : _errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+};
+
+template <class T, class Map, class Reduce>
+class map_reduce_group final : public awaited_group {
+    Map                             _map;
+    Reduce                          _reduce;
+    chunking                        _split;
+    std::vector<std::optional<T>>   _partials;
+    std::vector<std::exception_ptr> _errors;
+
+protected:
+    void
+    run(std::uint32_t const index) noexcept final {
+        const auto [begin, end] = _split.range(index);
+        try {
+            T acc = std::as_const(_map)(begin);
+            for (auto i = begin + 1; i < end; ++i)
+                acc = std::as_const(_reduce)(std::move(acc), std::as_const(_map)(i));
+            _partials[index].emplace(std::move(acc));
+        } catch (...) {
+            _errors[index] = std::current_exception();
+        }
+    }
+
+public:
+    map_reduce_group(CoroContext const &ctx, chunking const &split, Map map, Reduce reduce)
+        : awaited_group(ctx, split.chunks)
+        , _map(std::move(map))
+        , _reduce(std::move(reduce))
+        , _split(split)
+        , _partials(split.chunks)
+        , _errors(split.chunks) {}
+
+    /// Folds the partials in chunk order, on the caller's core: the result does not depend on
+    /// which core ran which chunk.
+    T
+    result(T init) {
+        for (auto const &error : _errors)
+            if (error)
+                std::rethrow_exception(error);
+        for (auto &partial : _partials)
+            init = _reduce(std::move(init), std::move(*partial));
+        return init;
+    }
+};
+
+/**
+ * @brief Awaits a submitted `awaited_group`: resumed by its `TaskDoneEvent` or by the actor scope.
+ * @details The same shape as `ask_awaiter` minus the timer, and registered through the same
+ *          per-core continuation registry, so a task awaited inside an async `onInit()` is not
+ *          stashed behind the activation gate. It owns the group until submission; after that
+ *          the group is in flight and comes back in the event. On cancellation the chunks still
+ *          run to completion — nothing preempts them — and their result is discarded.
+ */
+template <class Group>
+struct task_awaiter {
+    ask_slot                                   slot{};
+    qb::io::async::cancellation_token          token;
+    std::unique_ptr<Group>                     group;
+    std::unique_ptr<task_group>                done;
+    std::uint64_t                              id;
+    std::coroutine_handle<>                    cont;
+    bool                                       registered = false;
+    std::shared_ptr<bool>                      alive      = std::make_shared<bool>(true);
+    qb::io::async::cancellation_token::id_type cancel_id  = 0;
+
+    task_awaiter(std::unique_ptr<Group> submitted, qb::io::async::cancellation_token tok)
+        : token(std::move(tok))
+        , group(std::move(submitted))
+        , id(group->correlation()) {
+        slot.owner   = group->owner;
+        slot.self    = this;
+        slot.deliver = &task_awaiter::deliver_thunk;
+        ask_register_type(qb::Event::type_to_id<TaskDoneEvent>());
+    }
+    task_awaiter(const task_awaiter &)            = delete;
+    task_awaiter(task_awaiter &&)                 = delete;
+    task_awaiter &operator=(const task_awaiter &) = delete;
+
+    [[nodiscard]] bool
+    await_ready() const noexcept {
+        return token.is_cancelled();
+    }
+
+    void
+    await_suspend(std::coroutine_handle<> h) {
+        cont = h;
+        if (token.is_cancelled()) {
+            qb::io::async::schedule_via_current(h);
+            return;
+        }
+        if (!task_submit(group.get())) {
+            // No running core on this thread, or its task queue could not grow: resumes as cancelled.
+            qb::io::async::schedule_via_current(h);
+            return;
+        }
+        // Registered before the first chunk can complete: completion is an event, delivered on
+        // a later pass of this core.
+        ask_register(id, &slot);
+        registered = true;
+        (void) group.release(); // in flight: it comes back in the TaskDoneEvent
+        auto a    = alive;
+        cancel_id = token.on_cancel([this, a]() {
+            if (*a && !slot.done) {
+                slot.done = true;
+                qb::io::async::schedule_via_current(cont);
+            }
+        });
+    }
+
+    std::unique_ptr<Group>
+    await_resume() {
+        finish();
+        if (!done)
+            throw qb::io::async::cancelled_error();
+        return std::unique_ptr<Group>(static_cast<Group *>(done.release()));
+    }
+
+    ~task_awaiter() {
+        *alive = false;
+        finish();
+    }
+
+private:
+    void
+    finish() noexcept {
+        if (registered) {
+            ask_unregister(id);
+            registered = false;
+        }
+        token.remove_on_cancel(cancel_id);
+        cancel_id = 0;
+    }
+
+    static void
+    deliver_thunk(void *self, qb::Event &resp) noexcept {
+        auto *me = static_cast<task_awaiter *>(self);
+        if (me->slot.done)
+            return;
+        me->slot.done = true;
+        me->done      = std::move(static_cast<TaskDoneEvent &>(resp).group);
+        qb::io::async::schedule_via_current(me->cont);
+    }
+};
+
+/// Fire-and-forget variant: the core that ran it pushes `E{result}` to the owner.
+template <class E, class Fn>
+class event_offload_group final : public task_group {
+    using R          = std::invoke_result_t<Fn &>;
+    using value_type = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+    CoroContext               _ctx;
+    Fn                        _fn;
+    std::optional<value_type> _value;
+    std::exception_ptr        _error;
+
+protected:
+    void
+    run(std::uint32_t) noexcept final {
+        try {
+            if constexpr (std::is_void_v<R>) {
+                _fn();
+                _value.emplace();
+            } else
+                _value.emplace(_fn());
+        } catch (...) {
+            _error = std::current_exception();
+        }
+    }
+
+    void
+    complete() noexcept final {
+        if (_error)
+            report_unhandled_coroutine_exception(owner, "offload", _error);
+        else if constexpr (std::is_void_v<R>)
+            _ctx.template push<E>();
+        else
+            _ctx.template push<E>(std::move(*_value));
+        delete this;
+    }
+
+public:
+    event_offload_group(CoroContext const &ctx, Fn fn)
+        : task_group(ctx.id(), 1)
+        , _ctx(ctx)
+        , _fn(std::move(fn)) {}
+};
+
+} // namespace detail
+
+/**
+ * @brief Run @p fn on whichever core gets to it first and `co_await` its result.
+ * @ingroup Patterns
+ * @param ctx The calling coroutine's context (its scope cancels the wait).
+ * @param fn A short, CPU-bound `R()` callable. Runs on another core's thread: capture by value.
+ * @return `task<R>` resolving to `fn()`; an exception thrown by `fn` is rethrown here.
+ * @throws qb::io::async::cancelled_error if the actor is killed while waiting (`fn` still runs).
+ * @code
+ * auto doc = co_await qb::offload(ctx, [raw = std::move(raw)] { return qb::json::parse(raw); });
+ * @endcode
+ */
+template <class Fn>
+[[nodiscard]] qb::io::async::task<std::invoke_result_t<Fn &>>
+offload(qb::ScopedCoroContext ctx, Fn fn) {
+    using Group = detail::offload_group<Fn>;
+    auto group  = co_await detail::task_awaiter<Group>{std::make_unique<Group>(ctx, std::move(fn)), ctx.token()};
+    co_return group->result();
+}
+
+/**
+ * @brief Run @p fn on whichever core gets to it first and push `E` built from its result to @p self.
+ * @ingroup Patterns
+ * @tparam E The event delivered to `self`: constructed from `fn()`'s result, or default for `void`.
+ * @param self The actor that receives `E` (it must `registerEvent<E>`).
+ * @param fn A short, CPU-bound callable. Runs on another core's thread: capture by value.
+ * @return false if called outside a running core, or the core's task queue could not grow; in
+ *         either case nothing was queued.
+ * @details For handlers that are not coroutines. An exception escaping `fn` is reported like one
+ *          escaping a spawned coroutine, and no `E` is sent.
+ */
+template <class E, class Fn>
+bool
+offload(qb::Actor const &self, Fn fn) {
+    auto group = std::make_unique<detail::event_offload_group<E, Fn>>(CoroContext(&self), std::move(fn));
+    if (!detail::task_submit(group.get()))
+        return false;
+    (void) group.release();
+    return true;
+}
+
+/**
+ * @brief Call `fn(i)` for every `i` in `[first, last)`, spread over the engine's cores.
+ * @ingroup Patterns
+ * @param ctx The calling coroutine's context.
+ * @param first,last The index range.
+ * @param fn `void(std::size_t)`, invoked concurrently through a const reference.
+ * @param grain Indices per chunk; `0` cuts about four chunks per core.
+ * @return `task<void>` completing once every index ran; the first failing chunk's exception, in
+ *         index order, is rethrown.
+ */
+template <class Fn>
+requires std::invocable<Fn const &, std::size_t>
+[[nodiscard]] qb::io::async::task<void>
+parallel_for(qb::ScopedCoroContext ctx, std::size_t first, std::size_t last, Fn fn, std::size_t grain = 0) {
+    const detail::chunking split{first, last, grain};
+    if (!split.chunks)
+        co_return;
+    using Group = detail::for_group<Fn>;
+    auto group  = co_await detail::task_awaiter<Group>{std::make_unique<Group>(ctx, split, std::move(fn)), ctx.token()};
+    group->result();
+}
+
+/**
+ * @brief `reduce(... reduce(reduce(init, map(first)), map(first + 1)) ..., map(last - 1))`,
+ *        with the maps and chunk-local reductions spread over the engine's cores.
+ * @ingroup Patterns
+ * @param ctx The calling coroutine's context.
+ * @param first,last The index range.
+ * @param init The starting value, folded in first.
+ * @param map `T(std::size_t)`, invoked concurrently through a const reference.
+ * @param reduce `T(T, T)`, associative; invoked concurrently through a const reference.
+ * @param grain Indices per chunk; `0` cuts about four chunks per core.
+ * @return `task<T>`. Chunk results are folded in index order, so a non-commutative `reduce` is fine.
+ * @code
+ * auto total = co_await qb::map_reduce(ctx, 0, rows.size(), std::uint64_t{0},
+ *                                      [&rows](std::size_t i) { return checksum(rows[i]); },
+ *                                      [](std::uint64_t a, std::uint64_t b) { return a + b; });
+ * @endcode
+ */
+template <class T, class Map, class Reduce>
+requires std::convertible_to<std::invoke_result_t<Map const &, std::size_t>, T> && std::invocable<Reduce const &, T, T>
+[[nodiscard]] qb::io::async::task<T>
+map_reduce(qb::ScopedCoroContext ctx, std::size_t first, std::size_t last, T init, Map map, Reduce reduce, std::size_t grain = 0) {
+    const detail::chunking split{first, last, grain};
+    if (!split.chunks)
+        co_return init;
+    using Group = detail::map_reduce_group<T, Map, Reduce>;
+    auto group  = co_await detail::task_awaiter<Group>{std::make_unique<Group>(ctx, split, std::move(map), std::move(reduce)), ctx.token()};
+    co_return group->result(std::move(init));
+}
+
+} // namespace qb
+
+#endif // QB_CORE_PATTERNS_PARALLEL_H
@@ -133,7 +133,7 @@ public:
         // a measured 10-14% of dispatch throughput (one hash lookup per subscriber per publish,
         // plus a second traversal to compact), which is not a price a fan-out hot path should pay
         // for bookkeeping. `_subscribers` only ever GROWS in `subscribe()`, so that is where the
-        // bound belongs, and that is where it now is. This loop is left exactly as it was.
+        // bound belongs, and that is where it now is. The fan-out itself stays one pass.
         //
         // The rare sweep below is the belt-and-braces for the one case `subscribe()` cannot cover:
         // every subscriber dies and no new one ever arrives, so nothing calls `subscribe()` again.
@@ -145,8 +145,10 @@ public:
             _publishes_since_prune = 0;
             prune_dead();
         }
+        // Every subscriber is on this core: one batch, one pipe reservation for the whole fan-out.
+        auto out = this->template batch<Topic>(this->getIndex(), _subscribers.size());
         for (auto const s : _subscribers)
-            this->template push<Topic>(s, args...);
+            out.push(s, args...);
     }
 };
 
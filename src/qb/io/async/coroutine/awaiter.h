@@ -71,6 +71,7 @@
 
 // scheduler.h must be included before task.h to get schedule_via_current
 #include "scheduler.h"
+#include "../timer_wheel.h"
 
 namespace qb::io::async {
 
@@ -445,6 +446,92 @@ struct timer_awaiter : awaiter_base {
     }
 };
 
+/**
+ * @brief Timer-wheel awaiter
+ *
+ * Suspends the coroutine until a specified duration elapses, like
+ * `timer_awaiter`, but on the listener's coarse `TimerWheel` instead of a
+ * dedicated `ev_timer`: suspending and cancelling are O(1), and the coroutine
+ * resumes up to one wheel tick after the deadline (never before). Meant for
+ * the many-sleepers case — per-session keepalives, polling loops, backoff.
+ *
+ * Always construct via `coarse_sleep()` (qb/io/async/coroutine/utils.h), which
+ * passes `listener::current.timer_wheel()`.
+ *
+ * @ingroup Coroutine
+ */
+struct wheel_timer_awaiter : awaiter_base {
+    /**
+     * @brief Wheel the deadline is armed on
+     */
+    TimerWheel &wheel_;
+
+    /**
+     * @brief Deadline handle; destroying it cancels the deadline
+     */
+    TimerWheel::node node_;
+
+    /**
+     * @brief Requested delay in seconds
+     */
+    ev_tstamp after_;
+
+    /**
+     * @brief Zero/negative sleep is a cooperative yield (see `timer_awaiter`)
+     */
+    bool yield_only_;
+
+    wheel_timer_awaiter(qb::duration duration, TimerWheel &wheel) noexcept
+        : wheel_(wheel)
+        , after_(qb::detail::to_ev_seconds(duration))
+        , yield_only_(duration.count() <= 0) {
+        node_.set<wheel_timer_awaiter, &wheel_timer_awaiter::on_expired>(this);
+    }
+
+    void
+    await_suspend(std::coroutine_handle<> h) override {
+        handle_    = h;
+        scheduler_ = CoroutineScheduler::current_ptr();
+        if (!scheduler_) {
+            scheduler_ = &CoroutineScheduler::current();
+        }
+        if (yield_only_) {
+            enqueue_for_later_via_current(h);
+            return;
+        }
+        register_suspended();
+        // Same stale-`mn_now` hazard as `timer_awaiter::await_suspend`.
+        ev_now_update(static_cast<struct ev_loop *>(wheel_.loop()));
+        wheel_.arm(node_, after_);
+    }
+
+    void
+    await_resume() {
+        if (yield_only_) {
+            awaiter_base::await_resume();
+            return;
+        }
+        // The wheel calls back directly (no libev pending window), so cancelling
+        // here only matters for a resume that did not come from the deadline.
+        node_.cancel();
+        unregister_suspended();
+        awaiter_base::await_resume();
+    }
+
+    ~wheel_timer_awaiter() override {
+        unschedule(); // full scrub, see timer_awaiter
+        node_.cancel();
+    }
+
+    /**
+     * @brief Wheel callback when the deadline expires
+     */
+    void
+    on_expired() noexcept {
+        on_event_ready();
+    }
+};
+
 /**
  * @brief Socket I/O awaiter
  *
@@ -104,6 +104,23 @@ sleep(qb::duration duration) {
     return timer_awaiter{duration, listener::current.loop()};
 }
 
+/**
+ * @brief Suspend coroutine for a duration on the coarse timer wheel
+ *
+ * Like `sleep()`, but the deadline lives on `listener::current.timer_wheel()`
+ * instead of its own libev timer: O(1) to arm and cancel, resumed up to one
+ * wheel tick (10 ms by default) late. Prefer it when many coroutines sleep at
+ * once and millisecond precision does not matter.
+ *
+ * @param duration The time to sleep
+ * @return wheel_timer_awaiter that suspends until duration elapses
+ * @ingroup Coroutine
+ */
+inline wheel_timer_awaiter
+coarse_sleep(qb::duration duration) {
+    return wheel_timer_awaiter{duration, listener::current.timer_wheel()};
+}
+
 /**
  * @brief Suspend until socket is readable
  *
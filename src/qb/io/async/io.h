@@ -36,6 +36,7 @@
 #include <qb/utility/abi.h> /* QB_ABI_ANCHOR */
 #include <qb/utility/type_traits.h>
 #include "../config.h"
+#include "../shared_frame.h"
 #include "../system/sys__socket.h"
 #include "event/all.h"
 #include "listener.h"
@@ -49,6 +50,31 @@
 
 namespace qb::io::async {
 
+namespace detail {
+
+/**
+ * @brief Append one `publish()` argument to @p d's output.
+ * @return false when @p d's output queue refused a `shared_frame` (output limit reached).
+ * @details A `shared_frame` is queued by reference when @p d's transport can gather-write
+ *          (`stream::enqueue()`), and copied into `out()` otherwise; anything else is streamed
+ *          into `out()` as before.
+ */
+template <typename D, typename T>
+inline bool
+publish_one(D &d, T &&arg) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<T>, qb::io::shared_frame>) {
+        if constexpr (qb::has_enqueue<D, qb::io::shared_frame>)
+            return d.enqueue(std::forward<T>(arg));
+        else
+            d.out().put(arg.data(), arg.size());
+    } else {
+        d.out() << std::forward<T>(arg);
+    }
+    return true;
+}
+
+} // namespace detail
+
 /**
  * @class base
  * @ingroup Async
@@ -105,12 +131,40 @@ protected:
  * It allows the derived class to set a timeout, after which an `on(event::timer&)` method
  * in the derived class is triggered if no activity (signaled by `updateTimeout()`) is detected.
  *
+ * By default the deadline is a libev `ev_timer` of its own. `useTimerWheel()` moves it onto
+ * the listener's `TimerWheel` instead: arming and re-arming become O(1) at the wheel's
+ * resolution (the deadline may fire up to one tick late, never early), which is what a
+ * server holding one idle timeout per connection wants. The derived `on(event::timer&)`
+ * is reached exactly as before — the wheel feeds the same `event::timer` through the loop.
+ *
  * @tparam _Derived The derived class type (CRTP pattern) that will handle the timeout event.
  */
 template <typename _Derived>
 class with_timeout : public base<with_timeout<_Derived>, event::timer> {
-    ev_tstamp _timeout;       /**< Timeout value in seconds. If 0, timeout is disabled. */
-    ev_tstamp _last_activity; /**< Timestamp of the last recorded activity, used to check against timeout. */
+    ev_tstamp        _timeout;       /**< Timeout value in seconds. If 0, timeout is disabled. */
+    ev_tstamp        _last_activity; /**< Timestamp of the last recorded activity, used to check against timeout. */
+    TimerWheel::node _wheel_node;    /**< Deadline on the listener's wheel, when `_coarse`. */
+    bool             _coarse = false;
+
+    /** @brief Arm the deadline `after` seconds from now on the active clock source. */
+    void
+    _arm(ev_tstamp after) noexcept {
+        if (_coarse)
+            listener::current.timer_wheel().arm(_wheel_node, after);
+        else {
+            this->_async_event.set(after);
+            this->_async_event.start();
+        }
+    }
+
+    /** @brief Wheel expiry: deliver the timer event through the loop like an `ev_timer` would. */
+    void
+    _on_wheel_expired() noexcept {
+        // A watcher detached by `listener::clear()` no longer receives events; its wheel
+        // node is not known to `clear()`, so the drop happens here instead.
+        if (listener::current.is_registered(this->_async_event._interface))
+            this->_async_event.feed_event(EV_TIMER);
+    }
 
 public:
     /**
@@ -121,6 +175,7 @@ public:
     explicit with_timeout(qb::duration timeout = std::chrono::seconds(3))
         : _timeout(qb::detail::to_ev_seconds(timeout))
         , _last_activity(0) {
+        _wheel_node.set<with_timeout, &with_timeout::_on_wheel_expired>(this);
         if (_timeout > 0.) {
             ev_now_update(static_cast<struct ev_loop *>(listener::current.loop()));
             this->_async_event.start(_timeout);
@@ -151,10 +206,11 @@ public:
         if (_timeout > 0.) { // Check against 0, not just if(_timeout)
             ev_now_update(static_cast<struct ev_loop *>(listener::current.loop()));
             _last_activity = this->_async_event.loop.now();
-            this->_async_event.set(_timeout);
-            this->_async_event.start();
-        } else
+            _arm(_timeout);
+        } else {
+            _wheel_node.cancel();
             this->_async_event.stop();
+        }
     }
 
     /**
@@ -166,6 +222,41 @@ public:
         return qb::detail::from_ev_seconds(_timeout);
     }
 
+    /**
+     * @brief Move the deadline onto (or off) the listener's coarse `TimerWheel`.
+     * @param enable `true` to use the wheel, `false` to return to a dedicated `ev_timer`.
+     * @details A pending deadline carries over with the time it had left. A pending
+     *          `event::timer` delivery that has not been dispatched yet is dropped and
+     *          re-armed for its remaining (zero) time, so it still fires once.
+     */
+    void
+    useTimerWheel(bool enable = true) noexcept {
+        if (enable == _coarse)
+            return;
+        bool      armed;
+        ev_tstamp left = 0.;
+        if (_coarse) {
+            armed = _wheel_node.armed() || this->_async_event.is_pending();
+            if (_wheel_node.armed())
+                left = listener::current.timer_wheel().remaining(_wheel_node);
+            _wheel_node.cancel();
+        } else {
+            armed = this->_async_event.is_active() || this->_async_event.is_pending();
+            if (this->_async_event.is_active())
+                left = this->_async_event.remaining();
+        }
+        this->_async_event.stop(); // also drops a pending feed
+        _coarse = enable;
+        if (armed)
+            _arm(left);
+    }
+
+    /** @brief Whether the deadline currently runs on the listener's `TimerWheel`. */
+    [[nodiscard]] bool
+    usesTimerWheel() const noexcept {
+        return _coarse;
+    }
+
 private:
     friend class listener::RegisteredKernelEvent<event::timer, with_timeout>;
 
@@ -183,10 +274,8 @@ private:
 
         if (after <= 0.)
             Derived.on(event);
-        else {
-            this->_async_event.set(after);
-            this->_async_event.start();
-        }
+        else
+            _arm(after);
     }
 };
 
@@ -614,8 +703,8 @@ public:
      *       Assumes `_protocol` is not null if messages are expected.
      *
      * @note **Protocol Validation:** If `_protocol` is null or becomes invalid during processing,
-     *       the method returns `-1` immediately. This ensures that invalid protocol states are
-     *       detected and handled appropriately.
+     *       the method calls `_Derived::eof()` and returns `-1`. This ensures that invalid protocol
+     *       states are detected and handled appropriately.
      */
     int
     read_all() {
@@ -627,8 +716,12 @@ public:
                 return -1;
             // Stop if the protocol is invalid — or absent: a cleared/unset protocol is the
             // NoProtocol sentinel whose ok() is false (so no separate null check is needed).
-            if (unlikely(!this->_protocol->ok()))
+            // The protocol exits below skip the Derived.eof() at the end of the batch, which is
+            // what hands a pooled-input stream's lent read buffer back: call it on the way out.
+            if (unlikely(!this->_protocol->ok())) {
+                Derived.eof();
                 return -1;
+            }
             // Use a separate variable for the framing loop: reusing `ret` here
             // (previous code) left it at 0 after the inner loop, so the outer
             // do/while never iterated and only one read() chunk was processed
@@ -637,11 +730,14 @@ public:
             while ((msg_size = this->_protocol->getMessageSize()) > 0) {
                 if (unlikely(msg_size > _max_message_size)) {
                     this->_protocol->not_ok();
+                    Derived.eof();
                     return -1;
                 }
                 this->_protocol->onMessage(msg_size);
-                if (unlikely(!this->_protocol->ok()))
+                if (unlikely(!this->_protocol->ok())) {
+                    Derived.eof();
                     return -1;
+                }
                 Derived.flush(msg_size);
             }
             Derived.eof();
@@ -1370,7 +1466,8 @@ private:
      * and the protocol is valid (`_protocol->ok()`):
      * 1. If `EV_READ` is set in `event._revents`, it attempts to read data from `_Derived::read()` into the input buffer.
      * 2. If the read is successful (returns >= 0 bytes), it processes messages via `process_messages()`.
-     * 3. After processing, it calls `_Derived::eof()` and handles pending_read/eof events.
+     * 3. After processing, it calls `_Derived::eof()` and handles pending_read/eof events. A
+     *    processing error also calls `_Derived::eof()`, before `dispose()`.
      * If any OS-level read error occurs (read returns < 0) or if `_reason` is set (due to `disconnect()` call), it calls `dispose()`.
      */
     void
@@ -1434,8 +1531,11 @@ private:
             // Update statistics
             _bytes_read += ret;
 
-            if (!process_messages())
+            if (!process_messages()) {
+                // dispose() does not close a standalone client: hand a lent read buffer back here.
+                Derived.eof();
                 goto error;
+            }
 
             Derived.eof();
             handle_post_read();
@@ -1791,9 +1891,13 @@ public:
      * @brief Publishes data to the output buffer and ensures write readiness.
      * @tparam _Args Variadic template arguments for the data to be published.
      * @param args Data arguments to stream into `_Derived::out()` buffer (typically a `qb::allocator::pipe<char>`).
+     *             A `qb::io::shared_frame` argument is queued by reference when the transport can
+     *             gather-write (`stream::enqueue()`), and copied into `out()` otherwise.
      * @return A reference to the `_Derived::out()` buffer after the data has been added.
      * @details Calls `ready_to_write()` to ensure the event loop is monitoring for write readiness,
      *          then streams all `args` into the output buffer provided by `_Derived::out()`.
+     *          A frame the output queue refuses disconnects with `buffer_overflow`, like an
+     *          overflowing `out()`.
      */
     template <typename... _Args>
     inline auto &
@@ -1809,17 +1913,20 @@ public:
 
         ready_to_write();
         if constexpr (sizeof...(_Args)) {
-            const auto before = Derived.pendingWrite();
-            (Derived.out() << ... << std::forward<_Args>(args));
+            const auto before   = Derived.pendingWrite();
+            const auto buffered = Derived.out().size();
+            bool       accepted = true;
+            ((accepted = detail::publish_one(Derived, std::forward<_Args>(args)) && accepted), ...);
             const auto after = Derived.pendingWrite();
-            if (unlikely(max_write != static_cast<std::size_t>(-1) && after > max_write)) {
+            if (unlikely(!accepted || (max_write != static_cast<std::size_t>(-1) && after > max_write))) {
                 // Best-effort rollback of the just-appended tail to keep the
                 // write buffer bounded even when callers stream without
-                // checking publish(char*, size) return codes.
+                // checking publish(char*, size) return codes. Bytes published
+                // ahead of a queued frame are counted by that frame and stay.
                 const auto added    = after - before;
-                const auto overflow = after - max_write;
+                const auto overflow = after > max_write ? after - max_write : 0;
                 if constexpr (requires { Derived.out().free_back(std::size_t{}); }) {
-                    if (overflow <= added)
+                    if (overflow <= added && Derived.out().size() - buffered == added)
                         Derived.out().free_back(overflow);
                 }
                 _system_error = 0;
@@ -2506,7 +2613,9 @@ public:
     /**
      * @brief Publishes data to the output buffer and ensures write readiness.
      * @tparam _Args Types of data to publish.
-     * @param args Data arguments to stream into `_Derived::out()`.
+     * @param args Data arguments to stream into `_Derived::out()`. A `qb::io::shared_frame`
+     *             argument is queued by reference instead (`stream::enqueue()`) and goes out in
+     *             order with the rest, without being copied.
      * @return Reference to `_Derived::out()` buffer.
      */
     template <typename... _Args>
@@ -2523,14 +2632,18 @@ public:
 
         ready_to_write();
         if constexpr (sizeof...(_Args)) {
-            const auto before = Derived.pendingWrite();
-            (Derived.out() << ... << std::forward<_Args>(args));
+            const auto before   = Derived.pendingWrite();
+            const auto buffered = Derived.out().size();
+            bool       accepted = true;
+            ((accepted = detail::publish_one(Derived, std::forward<_Args>(args)) && accepted), ...);
             const auto after = Derived.pendingWrite();
-            if (unlikely(max_write != static_cast<std::size_t>(-1) && after > max_write)) {
+            if (unlikely(!accepted || (max_write != static_cast<std::size_t>(-1) && after > max_write))) {
                 const auto added    = after - before;
-                const auto overflow = after - max_write;
+                const auto overflow = after > max_write ? after - max_write : 0;
+                // Roll back only when every added byte is in the buffer's tail: bytes published
+                // ahead of a queued frame are counted by that frame and must stay.
                 if constexpr (requires { Derived.out().free_back(std::size_t{}); }) {
-                    if (overflow <= added)
+                    if (overflow <= added && Derived.out().size() - buffered == added)
                         Derived.out().free_back(overflow);
                 }
                 _system_error = 0;
@@ -2787,8 +2900,11 @@ private:
             // Update statistics
             _bytes_read += ret;
 
-            if (!process_messages())
+            if (!process_messages()) {
+                // dispose() does not close a standalone client: hand a lent read buffer back here.
+                Derived.eof();
                 goto error;
+            }
 
             Derived.eof();
             handle_post_read();
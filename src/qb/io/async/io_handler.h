@@ -25,12 +25,17 @@
 #ifndef QB_IO_ASYNC_IO_HANDLER_H
 #define QB_IO_ASYNC_IO_HANDLER_H
 
+#include <algorithm>
+#include <span>
+#include <type_traits>
 #include <vector>
+#include <qb/system/allocator/pipe.h>
 #include <qb/system/container/unordered_map.h>
 #include <qb/utility/type_traits.h> // qb::has_on — the two dispatch if-constexpr below test it
 #include <qb/uuid.h>
 #include <qb/io/async/event/extracted.h>
 #include <qb/io/config.h>
+#include <qb/io/shared_frame.h>
 
 namespace qb::io::async {
 
@@ -115,6 +120,42 @@ private:
      */
     mutable std::vector<std::shared_ptr<_Session>> _broadcast_scratch;
     mutable bool                                   _broadcast_in_progress = false;
+    /**
+     * @brief Reusable serialization buffer for broadcast frames (see `broadcast_frame()`).
+     */
+    qb::allocator::pipe<char> _broadcast_bytes;
+
+    /**
+     * @brief Serialize a broadcast once, into the frame every recipient shares.
+     *
+     * The arguments are streamed into @p bytes exactly as `*session << args...` streams them into
+     * a session's output buffer, then copied once into a `shared_frame`; each session then queues
+     * a reference to it (or copies it, below `QB_IO_GATHER_MIN_SIZE` or on a transport without
+     * gather write). A lone `shared_frame` argument is shared as is.
+     */
+    template <typename... _Args>
+    static qb::io::shared_frame
+    broadcast_frame(qb::allocator::pipe<char> &bytes, _Args &&...args) {
+        if constexpr (sizeof...(_Args) == 1 &&
+                      (std::is_same_v<std::remove_cvref_t<_Args>, qb::io::shared_frame> && ...)) {
+            return (qb::io::shared_frame(args), ...);
+        } else {
+            bytes.reset();
+            (serialize_into(bytes, std::forward<_Args>(args)), ...);
+            auto frame = qb::io::shared_frame::copy_of(bytes.begin(), bytes.size());
+            bytes.reset();
+            return frame;
+        }
+    }
+
+    template <typename T>
+    static void
+    serialize_into(qb::allocator::pipe<char> &bytes, T &&arg) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<T>, qb::io::shared_frame>)
+            bytes.put(arg.data(), arg.size());
+        else
+            bytes << std::forward<T>(arg);
+    }
 
 public:
     /**
@@ -248,6 +289,27 @@ public:
         return &registered;
     }
 
+    /**
+     * @brief Register a batch of accepted connections
+     * @param batch Open transports; each one registered is moved out of its slot
+     * @return The number of sessions registered
+     *
+     * Same per-session contract as `registerSession()` (session cap included:
+     * sockets past the cap are closed), but the registry is grown once for the
+     * whole batch instead of rehashing as a connection burst lands.
+     */
+    std::size_t
+    registerSessions(std::span<typename _Session::transport_io_type> batch) {
+        auto wanted = _sessions.size() + batch.size();
+        if (_max_sessions > 0 && wanted > _max_sessions)
+            wanted = (std::max)(_max_sessions, _sessions.size());
+        _sessions.reserve(wanted);
+        std::size_t registered = 0;
+        for (auto &new_io : batch)
+            registered += registerSession(std::move(new_io)) != nullptr;
+        return registered;
+    }
+
     /**
      * @brief Unregister a session
      *
@@ -287,7 +349,9 @@ public:
     /**
      * @brief Broadcast data to all sessions
      *
-     * Sends the provided data to all active sessions.
+     * Sends the provided data to all active sessions. The data is serialized once, into a
+     * `shared_frame` that every session's output queue references until its socket has written
+     * it, so a large payload is not copied per recipient (see `broadcast_frame()`).
      *
      * @tparam _Args Types of data to send
      * @param args Data to send to all sessions
@@ -296,13 +360,17 @@ public:
     template <typename... _Args>
     _Derived &
     stream(_Args &&...args) {
+        if (_sessions.empty())
+            return static_cast<_Derived &>(*this);
         if (_broadcast_in_progress) {
+            qb::allocator::pipe<char> bytes;
+            const auto frame = broadcast_frame(bytes, std::forward<_Args>(args)...);
             std::vector<std::shared_ptr<_Session>> local_snapshot;
             local_snapshot.reserve(_sessions.size());
             for (auto &[key, session] : _sessions)
                 local_snapshot.push_back(session);
             for (auto &session : local_snapshot)
-                (*session << ... << args);
+                *session << frame;
             return static_cast<_Derived &>(*this);
         }
 
@@ -311,12 +379,13 @@ public:
         // The snapshot is still mandatory to keep session shared-ptrs alive if a
         // handler disconnects the broadcaster's peers mid-iteration.
         try {
+            const auto frame = broadcast_frame(_broadcast_bytes, std::forward<_Args>(args)...);
             _broadcast_scratch.clear();
             _broadcast_scratch.reserve(_sessions.size());
             for (auto &[key, session] : _sessions)
                 _broadcast_scratch.push_back(session);
             for (auto &session : _broadcast_scratch)
-                (*session << ... << args);
+                *session << frame;
             _broadcast_scratch.clear();
             _broadcast_in_progress = false;
         } catch (...) {
@@ -330,7 +399,8 @@ public:
     /**
      * @brief Broadcast data to selected sessions
      *
-     * Sends the provided data to sessions that match the given predicate.
+     * Sends the provided data to sessions that match the given predicate, serialized once as in
+     * `stream()` (and only if some session matches).
      *
      * @tparam _Func Type of the selection predicate
      * @tparam _Args Types of data to send
@@ -342,25 +412,40 @@ public:
     _Derived &
     stream_if(_Func const &func, _Args &&...args) {
         if (_broadcast_in_progress) {
+            qb::allocator::pipe<char> bytes;
+            qb::io::shared_frame      frame;
+            bool                      serialized = false;
             std::vector<std::shared_ptr<_Session>> local_snapshot;
             local_snapshot.reserve(_sessions.size());
             for (auto &[key, session] : _sessions)
                 local_snapshot.push_back(session);
             for (auto &session : local_snapshot)
-                if (func(*session))
-                    (*session << ... << args);
+                if (func(*session)) {
+                    if (!serialized) {
+                        frame      = broadcast_frame(bytes, args...);
+                        serialized = true;
+                    }
+                    *session << frame;
+                }
             return static_cast<_Derived &>(*this);
         }
 
         _broadcast_in_progress = true;
         try {
+            qb::io::shared_frame frame;
+            bool                 serialized = false;
             _broadcast_scratch.clear();
             _broadcast_scratch.reserve(_sessions.size());
             for (auto &[key, session] : _sessions)
                 _broadcast_scratch.push_back(session);
             for (auto &session : _broadcast_scratch)
-                if (func(*session))
-                    (*session << ... << args);
+                if (func(*session)) {
+                    if (!serialized) {
+                        frame      = broadcast_frame(_broadcast_bytes, args...);
+                        serialized = true;
+                    }
+                    *session << frame;
+                }
             _broadcast_scratch.clear();
             _broadcast_in_progress = false;
         } catch (...) {
@@ -40,6 +40,7 @@
 #include <vector>
 #include "event/base.h"
 #include "coroutine/scheduler.h"
+#include "timer_wheel.h"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -297,6 +298,10 @@ private:
     // Coroutine support
     std::unique_ptr<class CoroutineScheduler> _coro_scheduler; /**< Coroutine scheduler */
 
+    // Coarse timeouts: created on first `timer_wheel()` call, so a listener that never
+    // opts in pays nothing (no driver watcher, no slot table).
+    std::unique_ptr<TimerWheel> _timer_wheel;
+
     // ---- Deferred callbacks (next-tick post queue) --------------------------
     // Callbacks queued via `async::defer()`: each runs once, at the tail of the
     // same `run()` iteration — right after every libev watcher for this turn has
@@ -874,6 +879,42 @@ public:
         return !_deferred.empty();
     }
 
+    /**
+     * @brief Whether `e` is currently registered with this listener.
+     * @details `false` once `clear()` detached it, even though its owner (and the
+     *          wrapper) are still alive. Lets watchers that are not driven by libev
+     *          directly — a `with_timeout` on the timer wheel — drop a delivery that
+     *          would otherwise reach an object the loop has already let go of.
+     */
+    [[nodiscard]] inline bool
+    is_registered(IRegisteredKernelEvent const *e) const noexcept {
+        return e && (e->_list_prev != nullptr || _registered_head == e);
+    }
+
+    /**
+     * @brief Get the coarse timer wheel for this listener.
+     * @return Reference to the `TimerWheel` driven by this listener's loop.
+     *
+     * Created on first access with `TimerWheel::kDefaultResolution`. Timeouts opt
+     * into it through `with_timeout::useTimerWheel()` and `async::coarse_sleep()`;
+     * everything else keeps its own `ev_timer`.
+     */
+    [[nodiscard]] inline TimerWheel &
+    timer_wheel() {
+        if (!_timer_wheel)
+            _timer_wheel = std::make_unique<TimerWheel>(_loop);
+        return *_timer_wheel;
+    }
+
+    /**
+     * @brief Check if the timer wheel is initialized
+     * @return true if `timer_wheel()` was called on this listener
+     */
+    [[nodiscard]] inline bool
+    has_timer_wheel() const noexcept {
+        return _timer_wheel != nullptr;
+    }
+
     /**
      * @brief Get the coroutine scheduler for this listener
      * @return Reference to the CoroutineScheduler
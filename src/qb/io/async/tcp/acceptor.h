@@ -83,6 +83,11 @@ public:
      */
     using accepted_socket_type = typename _Prot::socket_type;
 
+    /**
+     * @brief Connections accepted on one readiness event, oldest first
+     */
+    using accepted_batch_type = typename Protocol::batch;
+
 public:
     /**
      * @brief Constructor
@@ -118,6 +123,26 @@ public:
         static_cast<_Derived &>(*this).on(std::forward<typename Protocol::message>(new_socket));
     }
 
+    /**
+     * @brief Handler for the connections accepted on one readiness event
+     *
+     * The transport drains up to `accept_budget()` connections per wakeup. A
+     * derived class that declares its own `on(accepted_batch_type)` receives
+     * them in one call (to reserve once, or to ship them to other cores in one
+     * event) and must move out every socket it keeps; the others get one
+     * `on(accepted_socket_type&&)` per connection.
+     *
+     * @param batch The accepted sockets
+     */
+    void
+    on(accepted_batch_type &&batch) {
+        if constexpr (qb::has_own_on<_Derived, acceptor, accepted_batch_type>)
+            static_cast<_Derived &>(*this).on(std::move(batch));
+        else
+            for (auto &new_socket : batch)
+                static_cast<_Derived &>(*this).on(std::move(new_socket));
+    }
+
     /**
      * @brief Listen for incoming connections on a given URI.
      * @param uri The URI to listen on.
@@ -154,6 +179,36 @@ public:
     [[nodiscard]] bool
     listen_no_start(qb::io::uri uri, [[maybe_unused]] std::filesystem::path cert_file = {},
                     [[maybe_unused]] std::filesystem::path key_file = {}, [[maybe_unused]] std::vector<std::string> alpn_protocols = {}) {
+        if (!init_context(std::move(cert_file), std::move(key_file), std::move(alpn_protocols)))
+            return false;
+        return !this->transport().listen(std::move(uri));
+    }
+
+    /**
+     * @brief Listen on a port shared with other acceptors, one per core (`SO_REUSEPORT`).
+     *
+     * Same contract as `listen()`, auto-start included, but binds through
+     * `tcp::listener::listen_shared()`: run one such acceptor (or `server`) per
+     * `VirtualCore` on the same URI and the kernel spreads incoming connections
+     * over their accept queues, so each core accepts and serves its own share with
+     * no handoff. See `tcp::listener::steer_by_cpu()` to pin the spread to the
+     * receiving CPU.
+     */
+    [[nodiscard]] bool
+    listen_shared(qb::io::uri uri, [[maybe_unused]] std::filesystem::path cert_file = {},
+                  [[maybe_unused]] std::filesystem::path key_file = {}, [[maybe_unused]] std::vector<std::string> alpn_protocols = {}) {
+        if (!init_context(std::move(cert_file), std::move(key_file), std::move(alpn_protocols)))
+            return false;
+        if (this->transport().listen_shared(std::move(uri)))
+            return false;
+        this->start();
+        return true;
+    }
+
+private:
+    bool
+    init_context([[maybe_unused]] std::filesystem::path cert_file, [[maybe_unused]] std::filesystem::path key_file,
+                 [[maybe_unused]] std::vector<std::string> alpn_protocols) {
 #ifdef QB_HAS_SSL
         using tpt = std::decay_t<decltype(this->transport())>;
         if constexpr (tpt::is_secure()) {
@@ -164,7 +219,7 @@ public:
             }
         }
 #endif
-        return !this->transport().listen(std::move(uri));
+        return true;
     }
 };
 
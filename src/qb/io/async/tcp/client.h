@@ -55,6 +55,10 @@ public:
     using transport_io_type = typename _Transport::transport_io_type; /**< Transport I/O type */
     using _Transport::in;                                             /**< Import the in method from the transport */
     using _Transport::out;                                            /**< Import the out method from the transport */
+    using _Transport::enqueue;                                        /**< Import the zero-copy frame queue from the transport */
+    using _Transport::pendingFrames;                                  /**< Import the frame queue depth from the transport */
+    using _Transport::pooled_input;                                   /**< Import the pooled-input mode query from the transport */
+    using _Transport::set_pooled_input;                               /**< Import the pooled-input mode switch from the transport */
     using _Transport::transport;                                      /**< Import the transport method from the transport */
     using base_t::publish;                                            /**< Import the publish method from the base class */
 
@@ -190,6 +194,10 @@ public:
     using transport_io_type = typename _Transport::transport_io_type; /**< Transport I/O type */
     using _Transport::in;                                             /**< Import the in method from the transport */
     using _Transport::out;                                            /**< Import the out method from the transport */
+    using _Transport::enqueue;                                        /**< Import the zero-copy frame queue from the transport */
+    using _Transport::pendingFrames;                                  /**< Import the frame queue depth from the transport */
+    using _Transport::pooled_input;                                   /**< Import the pooled-input mode query from the transport */
+    using _Transport::set_pooled_input;                               /**< Import the pooled-input mode switch from the transport */
     using _Transport::transport;                                      /**< Import the transport method from the transport */
     using base_t::publish;                                            /**< Import the publish method from the base class */
 
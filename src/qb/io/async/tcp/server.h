@@ -69,6 +69,19 @@ public:
         this->registerSession(std::forward<typename acceptor_type::accepted_socket_type>(new_io));
     }
 
+    /**
+     * @brief Handler for the connections accepted on one readiness event
+     *
+     * Registers them all through `registerSessions()`, which sizes the
+     * session registry once for the whole batch.
+     *
+     * @param batch The sockets accepted on this wakeup
+     */
+    void
+    on(typename acceptor_type::accepted_batch_type &&batch) {
+        this->registerSessions(batch);
+    }
+
     /**
      * @brief Handler for server disconnection events
      *
@@ -0,0 +1,400 @@
+/**
+ * @file qb/io/async/timer_wheel.h
+ * @brief Hierarchical timing wheel for coarse, high-volume timeouts.
+ *
+ * This file defines `TimerWheel`, a per-listener hashed hierarchical timing wheel
+ * driven by a single libev `ev_timer`. It trades the precision of individual
+ * `ev_timer` watchers (kept by libev in a 4-ary heap, O(log n) per start/stop)
+ * for O(1) arm, rearm and cancel at a fixed tick resolution — the shape needed
+ * by one idle timeout per connection on servers holding hundreds of thousands
+ * of sessions.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Async
+ */
+
+#ifndef QB_IO_ASYNC_TIMER_WHEEL_H_
+#define QB_IO_ASYNC_TIMER_WHEEL_H_
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <qb/ev/ev++.h>
+#include <qb/system/time.h> // qb::duration, qb::detail::to_ev_seconds
+
+namespace qb::io::async {
+
+/**
+ * @class TimerWheel
+ * @ingroup Async
+ * @brief Four-level hierarchical timing wheel multiplexed onto one libev timer.
+ *
+ * Time is cut into ticks of `resolution()` (10 ms by default). Level 0 holds the
+ * 64 ticks ahead of the wheel's current tick, level 1 the next 64 x 64, and so
+ * on: four levels of 64 slots cover 2^24 ticks (~46 h at 10 ms) before a timer
+ * is parked in the last slot and re-placed when it cascades. Every slot is an
+ * intrusive circular list, so arming, re-arming and cancelling a `node` is a
+ * handful of pointer writes with no allocation and no comparison against other
+ * timers.
+ *
+ * A timer never fires early: its deadline is rounded UP to the next tick
+ * boundary, so it fires between 0 and one tick after the requested delay. The
+ * driving `ev_timer` only runs while at least one node is armed, and sleeps to
+ * the next non-empty level-0 slot or the next cascade boundary, whichever comes
+ * first — an armed far-away timeout costs one wakeup per 64 ticks, not one per
+ * tick.
+ *
+ * @note Like `listener`, a wheel is strictly single-threaded. Each listener owns
+ *       at most one, created on first use by `listener::timer_wheel()`.
+ */
+class TimerWheel {
+    struct link {
+        link *_prev = this;
+        link *_next = this;
+    };
+
+public:
+    static constexpr std::size_t  kLevelBits         = 6;
+    static constexpr std::size_t  kSlots             = std::size_t{1} << kLevelBits;
+    static constexpr std::size_t  kLevels            = 4;
+    static constexpr qb::duration kDefaultResolution = std::chrono::milliseconds(10);
+
+    /**
+     * @class node
+     * @brief Intrusive timer handle embedded in the object that owns the timeout.
+     *
+     * A node is bound to its expiry callback once with `set<K, &K::method>(obj)`
+     * and can then be armed any number of times. Destroying an armed node
+     * cancels it.
+     */
+    class node : private link {
+        friend class TimerWheel;
+
+        TimerWheel   *_wheel  = nullptr; /**< Owning wheel while armed, else null. */
+        std::uint64_t _expiry = 0;       /**< Absolute expiry tick. */
+        void         *_target = nullptr;
+        void (*_thunk)(void *) noexcept = nullptr;
+
+        template <class K, void (K::*method)() noexcept>
+        static void
+        method_thunk(void *target) noexcept {
+            (static_cast<K *>(target)->*method)();
+        }
+
+    public:
+        node() noexcept               = default;
+        node(node const &)            = delete;
+        node &operator=(node const &) = delete;
+
+        ~node() noexcept {
+            cancel();
+        }
+
+        /**
+         * @brief Bind the expiry callback.
+         * @tparam K      Type of the receiving object.
+         * @tparam method Member function invoked, once per expiry, from the wheel's tick.
+         */
+        template <class K, void (K::*method)() noexcept>
+        void
+        set(K *object) noexcept {
+            _target = object;
+            _thunk  = &method_thunk<K, method>;
+        }
+
+        /** @brief Whether the node is currently armed on a wheel. */
+        [[nodiscard]] bool
+        armed() const noexcept {
+            return _wheel != nullptr;
+        }
+
+        /** @brief Disarm the node if it is armed. Idempotent. */
+        void
+        cancel() noexcept {
+            if (_wheel)
+                _wheel->cancel(*this);
+        }
+    };
+
+    /**
+     * @brief Construct a wheel ticking on @p loop.
+     * @param loop       Loop the driving `ev_timer` is registered with.
+     * @param resolution Tick length; values below 1 ms are raised to 1 ms.
+     */
+    explicit TimerWheel(ev::loop_ref loop, qb::duration resolution = kDefaultResolution) noexcept
+        : _loop(loop)
+        , _driver(loop) {
+        _driver.set<TimerWheel, &TimerWheel::_on_tick>(this);
+        _set_resolution(resolution);
+        _origin = _loop.now();
+    }
+
+    TimerWheel(TimerWheel const &)            = delete;
+    TimerWheel &operator=(TimerWheel const &) = delete;
+
+    ~TimerWheel() noexcept {
+        clear();
+    }
+
+    /**
+     * @brief Arm (or re-arm) @p n to expire @p after seconds from the loop's cached time.
+     * @details O(1). Re-arming an armed node moves it; it fires once, for the latest
+     *          deadline. Like a libev timer, the deadline is relative to `ev_now()`:
+     *          callers that may run after a long stall outside the loop refresh it with
+     *          `ev_now_update()` first, exactly as the `ev_timer` paths do.
+     */
+    void
+    arm(node &n, ev_tstamp after) noexcept {
+        if (n._wheel)
+            _unlink(n);
+        const ev_tstamp now = _loop.now();
+        if (!_count)
+            _now_tick = _tick_floor(now); // idle wheel: nothing to expire on the way
+        const double  ticks  = std::ceil((now + (after > 0. ? after : 0.) - _origin) / _resolution);
+        std::uint64_t expiry = ticks > 0. ? static_cast<std::uint64_t>(ticks) : 0;
+        if (expiry <= _now_tick)
+            expiry = _now_tick + 1;
+        n._expiry = expiry;
+        n._wheel  = this;
+        ++_count;
+        _place(n);
+        if (!_driver.is_active() || expiry < _wake_tick)
+            _wake_at(expiry);
+    }
+
+    /** @brief `qb::duration` overload of `arm()`. */
+    void
+    arm(node &n, qb::duration after) noexcept {
+        arm(n, qb::detail::to_ev_seconds(after));
+    }
+
+    /** @brief Disarm @p n. O(1); a no-op when the node is not armed on this wheel. */
+    void
+    cancel(node &n) noexcept {
+        if (n._wheel != this)
+            return;
+        _unlink(n);
+        if (!_count)
+            _driver.stop();
+    }
+
+    /**
+     * @brief Seconds left before @p n fires (0 when due or not armed).
+     */
+    [[nodiscard]] ev_tstamp
+    remaining(node const &n) const noexcept {
+        if (n._wheel != this)
+            return 0.;
+        const ev_tstamp left = _origin + static_cast<double>(n._expiry) * _resolution - _loop.now();
+        return left > 0. ? left : 0.;
+    }
+
+    /**
+     * @brief Disarm every node without firing it.
+     * @details Used on teardown: nodes that outlive the wheel see themselves disarmed and
+     *          never touch it again.
+     */
+    void
+    clear() noexcept {
+        for (auto &level : _slots)
+            for (auto &slot : level)
+                while (slot._next != &slot)
+                    _unlink(*static_cast<node *>(slot._next));
+        _driver.stop();
+    }
+
+    /**
+     * @brief Change the tick length. Only honoured while no node is armed.
+     * @return `true` when the new resolution is in effect.
+     */
+    bool
+    set_resolution(qb::duration resolution) noexcept {
+        if (_count)
+            return false;
+        _set_resolution(resolution);
+        return true;
+    }
+
+    /** @brief Current tick length. */
+    [[nodiscard]] qb::duration
+    resolution() const noexcept {
+        return qb::detail::from_ev_seconds(_resolution);
+    }
+
+    /** @brief Number of armed nodes. */
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _count;
+    }
+
+    /** @brief Loop the wheel is driven by. */
+    [[nodiscard]] ev::loop_ref
+    loop() const noexcept {
+        return _loop;
+    }
+
+private:
+    ev::loop_ref  _loop;
+    ev::timer     _driver;
+    ev_tstamp     _resolution = 0.;
+    ev_tstamp     _origin     = 0.; /**< Loop time of tick 0. */
+    std::uint64_t _now_tick   = 0;  /**< Last tick whose slot was expired. */
+    std::uint64_t _wake_tick  = 0;  /**< Tick the driver is armed for. */
+    std::size_t   _count      = 0;
+    link          _slots[kLevels][kSlots];
+
+    void
+    _set_resolution(qb::duration resolution) noexcept {
+        const auto floor = std::chrono::milliseconds(1);
+        _resolution      = qb::detail::to_ev_seconds(resolution < floor ? qb::duration(floor) : resolution);
+    }
+
+    [[nodiscard]] std::uint64_t
+    _tick_floor(ev_tstamp t) const noexcept {
+        // The epsilon absorbs the rounding of `_origin + tick * _resolution` so the driver,
+        // woken exactly on a boundary, never lands one tick short and re-arms for ~0 s.
+        const double ticks = std::floor((t - _origin) / _resolution + 1e-6);
+        return ticks > 0. ? static_cast<std::uint64_t>(ticks) : 0;
+    }
+
+    static void
+    _push(link &slot, link &l) noexcept {
+        l._prev           = slot._prev;
+        l._next           = &slot;
+        slot._prev->_next = &l;
+        slot._prev        = &l;
+    }
+
+    void
+    _unlink(node &n) noexcept {
+        n._prev->_next = n._next;
+        n._next->_prev = n._prev;
+        n._prev = n._next = &n;
+        n._wheel          = nullptr;
+        --_count;
+    }
+
+    /** Link an armed node into the slot its expiry maps to, relative to `_now_tick`. */
+    void
+    _place(node &n) noexcept {
+        const std::uint64_t delta = n._expiry > _now_tick ? n._expiry - _now_tick : 0;
+        std::size_t         level = 0;
+        while (level + 1 < kLevels && delta >= (std::uint64_t{1} << (kLevelBits * (level + 1))))
+            ++level;
+        std::uint64_t when = n._expiry;
+        // Beyond the top level's span: park in its farthest slot; the real expiry is kept
+        // and the node is placed again when that slot cascades.
+        constexpr std::uint64_t span = std::uint64_t{1} << (kLevelBits * kLevels);
+        if (delta >= span)
+            when = _now_tick + span - 1;
+        _push(_slots[level][(when >> (kLevelBits * level)) & (kSlots - 1)], n);
+    }
+
+    /** Re-place every node of a higher-level slot; each lands one level (or more) lower. */
+    void
+    _cascade(std::size_t level) noexcept {
+        link &slot = _slots[level][(_now_tick >> (kLevelBits * level)) & (kSlots - 1)];
+        link  moving;
+        _splice(slot, moving);
+        while (moving._next != &moving) {
+            auto &n = *static_cast<node *>(moving._next);
+            n._prev->_next = n._next;
+            n._next->_prev = n._prev;
+            _place(n);
+        }
+    }
+
+    /** Move every element of @p from to the (empty) list @p to. */
+    static void
+    _splice(link &from, link &to) noexcept {
+        if (from._next == &from)
+            return;
+        to._next        = from._next;
+        to._prev        = from._prev;
+        to._next->_prev = &to;
+        to._prev->_next = &to;
+        from._next = from._prev = &from;
+    }
+
+    /** Fire the due nodes of the current level-0 slot. */
+    void
+    _expire() noexcept {
+        link pending;
+        _splice(_slots[0][_now_tick & (kSlots - 1)], pending);
+        // Pop one node at a time: a callback may cancel or re-arm any node, including
+        // one still waiting in `pending`, and unlinking works on whichever list holds it.
+        while (pending._next != &pending) {
+            auto &n = *static_cast<node *>(pending._next);
+            if (n._expiry > _now_tick) {
+                n._prev->_next = n._next;
+                n._next->_prev = n._prev;
+                _place(n);
+                continue;
+            }
+            _unlink(n);
+            n._thunk(n._target);
+        }
+    }
+
+    void
+    _advance(std::uint64_t target) noexcept {
+        while (_count && _now_tick < target) {
+            ++_now_tick;
+            // Cascade from the highest level whose index just wrapped down to level 1, so a
+            // node moving two levels at once is picked up by the lower cascade of the same tick.
+            std::size_t top = 0;
+            while (top + 1 < kLevels && (_now_tick & ((std::uint64_t{1} << (kLevelBits * (top + 1))) - 1)) == 0)
+                ++top;
+            for (std::size_t level = top; level > 0; --level)
+                _cascade(level);
+            _expire();
+        }
+        if (_now_tick < target)
+            _now_tick = target;
+    }
+
+    /** Arm the driver for the next tick that has work: a due level-0 slot or a cascade. */
+    void
+    _reschedule() noexcept {
+        if (!_count) {
+            _driver.stop();
+            return;
+        }
+        std::uint64_t tick = _now_tick + 1;
+        for (; (tick & (kSlots - 1)) != 0; ++tick)
+            if (_slots[0][tick & (kSlots - 1)]._next != &_slots[0][tick & (kSlots - 1)])
+                break;
+        _wake_at(tick);
+    }
+
+    void
+    _wake_at(std::uint64_t tick) noexcept {
+        _wake_tick            = tick;
+        const ev_tstamp after = _origin + static_cast<double>(tick) * _resolution - _loop.now();
+        _driver.stop();
+        _driver.start(after > 0. ? after : 0.);
+    }
+
+    void
+    _on_tick(ev::timer &, int) noexcept {
+        _advance(_tick_floor(_loop.now()));
+        _reschedule();
+    }
+};
+
+} // namespace qb::io::async
+
+#endif // QB_IO_ASYNC_TIMER_WHEEL_H_
@@ -220,6 +220,63 @@
  */
 #define QB_MAX_IO_SIZE (static_cast<std::size_t>(1) << 30) // 1GB
 
+/**
+ * @def QB_IO_MAX_SLICES
+ * @brief Maximum number of buffers gathered into one `sendmsg()` / `WSASend()` call
+ * @details A stream whose output queue holds more pieces than this writes the first
+ *          `QB_IO_MAX_SLICES` and leaves the rest for the next write readiness event. Kept well
+ *          below the POSIX `IOV_MAX` floor (1024) so the slice array fits on the stack.
+ * @ingroup IO
+ */
+#ifndef QB_IO_MAX_SLICES
+#define QB_IO_MAX_SLICES 64
+#endif
+
+/**
+ * @def QB_IO_GATHER_MIN_SIZE
+ * @brief Smallest `shared_frame` a stream queues by reference
+ * @details `stream::enqueue()` copies a shorter frame into the contiguous output buffer and drops
+ *          the reference at once: below this size the copy costs less than the extra slice and
+ *          the deferred release. Set to 0 to queue every frame by reference.
+ * @ingroup IO
+ */
+#ifndef QB_IO_GATHER_MIN_SIZE
+#define QB_IO_GATHER_MIN_SIZE 1024
+#endif
+
+/**
+ * @def QB_IO_POOLED_INPUT
+ * @brief Whether streams start in pooled-input mode
+ * @details In pooled-input mode (`istream::set_pooled_input()`) a stream reads into its thread's
+ *          scratch buffer and keeps only an unconsumed tail, in a buffer from `input_pool`, so an
+ *          idle connection holds no input buffer. Off by default: each stream then keeps a
+ *          `QB_DEFAULT_READ_BUFFER_SIZE` input buffer once it has read.
+ * @ingroup IO
+ */
+#ifndef QB_IO_POOLED_INPUT
+#define QB_IO_POOLED_INPUT 0
+#endif
+
+/**
+ * @def QB_IO_INPUT_POOL_MAX_TAIL
+ * @brief Largest unconsumed tail a pooled-input stream copies into a pooled buffer
+ * @details Also the capacity of the largest buffer `input_pool` keeps. A longer tail (a message
+ *          still arriving) stays in the scratch buffer, which the stream then keeps until it drains.
+ * @ingroup IO
+ */
+#ifndef QB_IO_INPUT_POOL_MAX_TAIL
+#define QB_IO_INPUT_POOL_MAX_TAIL 16384
+#endif
+
+/**
+ * @def QB_IO_INPUT_POOL_DEPTH
+ * @brief Number of free buffers `input_pool` keeps per size class, per thread
+ * @ingroup IO
+ */
+#ifndef QB_IO_INPUT_POOL_DEPTH
+#define QB_IO_INPUT_POOL_DEPTH 256
+#endif
+
 /**
  * @def QB_DEFAULT_MAX_SESSIONS
  * @brief Default maximum number of sessions per io_handler instance.
@@ -235,6 +292,20 @@
 #define QB_DEFAULT_MAX_SESSIONS 0
 #endif
 
+/**
+ * @def QB_ACCEPT_BUDGET
+ * @brief Default number of connections an acceptor takes per readiness event.
+ * @details `transport::accept::read()` (and `saccept`) drain the listen queue up to this many
+ *          connections before returning to the event loop, which hands them to the acceptor
+ *          as one batch. Anything left queued fires the watcher again on the next loop pass,
+ *          so a bounded budget keeps a connection storm from starving established sessions.
+ *          Adjust per acceptor at runtime with `set_accept_budget()`.
+ * @ingroup IO
+ */
+#ifndef QB_ACCEPT_BUDGET
+#define QB_ACCEPT_BUDGET 64
+#endif
+
 /**
  * @def QB_MAX_READ_BUFFER_SIZE
  * @brief Maximum allowed size for input buffers (DoS protection)
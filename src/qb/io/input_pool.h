@@ -0,0 +1,207 @@
+/**
+ * @file qb/io/input_pool.h
+ * @brief Per-thread read scratch buffer and size-class pool for pooled stream input
+ *
+ * A stream in pooled-input mode (`istream::set_pooled_input()`) owns no input buffer while it has
+ * nothing to keep. `read()` borrows the thread's scratch buffer, the protocol dispatches complete
+ * messages straight from it, and `eof()` hands it back, after copying any unconsumed tail into a
+ * small buffer drawn from this pool. An idle connection then holds nothing, and one waiting on
+ * the rest of a message holds a buffer sized to what it has. In the default mode, each
+ * connection keeps a `QB_DEFAULT_READ_BUFFER_SIZE` buffer for its whole lifetime.
+ *
+ * Buffers are `qb::allocator::pipe<char>`s, whose capacity is always 4 KiB times a power of two.
+ * The pool keeps one free list per capacity from 4 KiB up to `QB_IO_INPUT_POOL_MAX_TAIL`, each
+ * capped at `QB_IO_INPUT_POOL_DEPTH` buffers; anything else is freed.
+ *
+ * One pool per thread, so per event loop and per VirtualCore: nothing here is synchronized.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#ifndef QB_IO_INPUT_POOL_H_
+#define QB_IO_INPUT_POOL_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <qb/io/config.h>
+#include <qb/system/allocator/pipe.h>
+
+namespace qb::io {
+
+/**
+ * @class input_pool
+ * @ingroup IO
+ * @brief The calling thread's read scratch buffer and its pool of small input buffers.
+ *
+ * Only one stream can borrow the scratch buffer at a time. A stream that finds it already lent,
+ * for example on a read nested inside another stream's dispatch, reads into a buffer of its own.
+ */
+class input_pool {
+public:
+    using buffer_type = qb::allocator::pipe<char>;
+
+    /** @brief Capacity of the smallest buffer (a default-constructed pipe's). */
+    static constexpr std::size_t min_capacity = 4096;
+    /** @brief Number of size classes: 4 KiB, 8 KiB, ... up to `QB_IO_INPUT_POOL_MAX_TAIL`. */
+    static constexpr std::size_t class_count =
+        std::bit_width(std::bit_floor(static_cast<std::size_t>(QB_IO_INPUT_POOL_MAX_TAIL)) / min_capacity);
+
+    static_assert(QB_IO_INPUT_POOL_MAX_TAIL >= min_capacity, "QB_IO_INPUT_POOL_MAX_TAIL must be at least 4096");
+
+private:
+    buffer_type                                       _scratch{empty()};
+    bool                                              _lent = false;
+    std::array<std::vector<buffer_type>, class_count> _free;
+
+    /// Size class holding a buffer of capacity @p capacity, or `class_count` if none does.
+    [[nodiscard]] static std::size_t
+    class_of(std::size_t const capacity) noexcept {
+        if (capacity < min_capacity || !std::has_single_bit(capacity / min_capacity) || capacity % min_capacity)
+            return class_count;
+        const auto index = static_cast<std::size_t>(std::countr_zero(capacity / min_capacity));
+        return index < class_count ? index : class_count;
+    }
+
+public:
+    /**
+     * @brief The calling thread's pool.
+     */
+    [[nodiscard]] static input_pool &
+    local() noexcept {
+        thread_local input_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief A buffer that owns no storage.
+     */
+    [[nodiscard]] static buffer_type
+    empty() {
+        // A moved-from pipe is the only one without storage; `storage` frees what `owner` had.
+        buffer_type                  owner;
+        [[maybe_unused]] buffer_type storage(std::move(owner));
+        return owner;
+    }
+
+    /**
+     * @brief Whether a stream is holding the scratch buffer.
+     */
+    [[nodiscard]] bool
+    lent() const noexcept {
+        return _lent;
+    }
+
+    /**
+     * @brief Borrow the scratch buffer (empty, at least `QB_DEFAULT_READ_BUFFER_SIZE` bytes).
+     * @pre `!lent()`
+     */
+    [[nodiscard]] buffer_type
+    lend() {
+        if (_scratch.capacity() < QB_DEFAULT_READ_BUFFER_SIZE)
+            _scratch.allocate_back(QB_DEFAULT_READ_BUFFER_SIZE);
+        _scratch.reset();
+        _lent = true;
+        return std::move(_scratch);
+    }
+
+    /**
+     * @brief Give the scratch buffer back.
+     */
+    void
+    give_back(buffer_type scratch) noexcept {
+        _scratch = std::move(scratch);
+        _scratch.reset();
+        _lent = false;
+    }
+
+    /**
+     * @brief The borrower keeps the scratch buffer (its tail did not fit a pooled buffer).
+     *
+     * The next `lend()` allocates a new one.
+     */
+    void
+    keep_lent() noexcept {
+        _lent = false;
+    }
+
+    /**
+     * @brief An empty buffer that can hold @p size bytes without growing.
+     * @pre `size <= QB_IO_INPUT_POOL_MAX_TAIL`
+     */
+    [[nodiscard]] buffer_type
+    acquire(std::size_t const size) {
+        auto index = class_of(std::bit_ceil((std::max) (size, min_capacity)));
+        if (index < class_count && !_free[index].empty()) {
+            auto buffer = std::move(_free[index].back());
+            _free[index].pop_back();
+            return buffer;
+        }
+        buffer_type buffer;
+        if (size > min_capacity) {
+            buffer.allocate_back(size);
+            buffer.reset();
+        }
+        return buffer;
+    }
+
+    /**
+     * @brief Keep @p buffer for a later `acquire()`, or free it if its class is full or it has
+     *        none.
+     * @details Taken by value: `release(std::move(b))` always leaves `b` without storage.
+     */
+    void
+    release(buffer_type buffer) noexcept {
+        const auto index = class_of(buffer.capacity());
+        if (index == class_count || _free[index].size() >= QB_IO_INPUT_POOL_DEPTH)
+            return; // freed with `buffer`
+        buffer.reset();
+        try {
+            _free[index].push_back(std::move(buffer));
+        } catch (...) {
+        }
+    }
+
+    /**
+     * @brief Number of buffers waiting in the pool.
+     */
+    [[nodiscard]] std::size_t
+    cached() const noexcept {
+        std::size_t count = 0;
+        for (auto const &list : _free)
+            count += list.size();
+        return count;
+    }
+
+    /**
+     * @brief Free every pooled buffer (the scratch buffer too, unless it is lent).
+     */
+    void
+    trim() noexcept {
+        for (auto &list : _free)
+            list = {};
+        if (!_lent) {
+            [[maybe_unused]] buffer_type freed(std::move(_scratch));
+        }
+    }
+};
+
+} // namespace qb::io
+
+#endif // QB_IO_INPUT_POOL_H_
@@ -24,6 +24,7 @@
 
 #ifndef QB_IO_ASYNC_PROTOCOL_ACCEPT_H
 #define QB_IO_ASYNC_PROTOCOL_ACCEPT_H
+#include <span>
 #include "../async/protocol.h"
 
 namespace qb::io::protocol {
@@ -40,7 +41,8 @@ namespace qb::io::protocol {
  * socket (as `_Socket` type) to the I/O component.
  *
  * @tparam _IO_ The I/O component type that uses this protocol (typically an acceptor class).
- *              It must provide a `getAccepted()` method returning a reference to the newly accepted socket.
+ *              It must provide a `getAcceptedBatch()` method returning the connections the last
+ *              read accepted, as a `std::span<_Socket>`.
  * @tparam _Socket The type of socket that represents the newly accepted connection (e.g., `qb::io::tcp::socket`).
  */
 template <typename _IO_, typename _Socket>
@@ -52,6 +54,12 @@ public:
      */
     using message = _Socket; /**< Type alias for the socket type */
 
+    /**
+     * @typedef batch
+     * @brief Every connection one readiness event accepted, handed to the I/O component at once.
+     */
+    using batch = std::span<_Socket>;
+
     /**
      * @brief Default constructor is deleted as an I/O component reference is required.
      */
@@ -65,33 +73,27 @@ public:
         : async::AProtocol<_IO_>(io) {}
 
     /**
-     * @brief Checks if a new connection is available to be processed.
-     *
-     * This method determines if a new connection has been accepted by checking
-     * if the socket obtained from `this->_io.getAccepted()` is currently open.
+     * @brief Counts the accepted connections waiting to be handed off.
      *
-     * @return `1` if a new, open connection is available, `0` otherwise.
-     *         The return type `std::size_t` is used to conform to the `AProtocol` interface,
-     *         but effectively it's a boolean check.
+     * @return The size of the I/O component's pending batch; `0` when the last read accepted
+     *         nothing. It is a count of connections, not of bytes.
      */
     std::size_t
     getMessageSize() noexcept final {
-        return static_cast<size_t>(this->_io.getAccepted().is_open());
+        return this->_io.getAcceptedBatch().size();
     }
 
     /**
-     * @brief Processes a newly accepted connection.
+     * @brief Hands the whole pending batch to the I/O component.
      *
-     * This method is called when `getMessageSize()` returns a non-zero value (i.e., an open socket was found).
-     * It then calls the I/O component's `on()` handler, passing the newly accepted socket
-     * (obtained via `this->_io.getAccepted()`) by moving it.
+     * Calls the component's `on(batch&&)` once per readiness event; the acceptor then either
+     * passes the batch on as is or moves each socket out through `on(message&&)`.
      *
-     * @param size Ignored parameter (required by `AProtocol` interface, but its value is not used here
-     *             as `getMessageSize()` for this protocol effectively returns a boolean status).
+     * @param size Ignored parameter (the batch carries its own size).
      */
     void
     onMessage(std::size_t /*size*/) noexcept final { // size is unused
-        this->_io.on(std::move(this->_io.getAccepted()));
+        this->_io.on(batch{this->_io.getAcceptedBatch()});
     }
 
     /**
@@ -0,0 +1,183 @@
+/**
+ * @file qb/io/shared_frame.h
+ * @brief Immutable, reference-counted byte ranges for zero-copy stream output
+ *
+ * A `shared_frame` is a read-only view of bytes plus the reference that keeps them alive. It is
+ * what `stream::enqueue()` queues instead of copying into the contiguous output buffer: the stream
+ * holds the reference until the transport has written the last byte, then drops it. Copying a
+ * frame only bumps the count, so the same frame can sit in any number of streams' queues at once.
+ *
+ * The owner can be:
+ * - a copy made once (`copy_of`), e.g. a message serialized for many recipients;
+ * - a container moved in (`adopt`), e.g. a response body built by the caller;
+ * - nothing at all (`borrow`): the bytes belong to the caller, who is called back once every
+ *   holder is done with them.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#ifndef QB_IO_SHARED_FRAME_H_
+#define QB_IO_SHARED_FRAME_H_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace qb::io {
+
+/**
+ * @class shared_frame
+ * @ingroup IO
+ * @brief Read-only bytes kept alive by a shared owner; cheap to copy, never copied by the stream.
+ *
+ * The default-constructed frame is empty and owns nothing. A frame never changes after it is
+ * made: every holder sees the same bytes, which is what makes sharing it between streams safe on
+ * one core. Frames may also be handed across cores (the count is atomic), but the bytes must not
+ * be written through any other path while a frame refers to them.
+ */
+class shared_frame {
+    std::shared_ptr<const void> _owner;
+    const char                 *_data = nullptr;
+    std::size_t                 _size = 0;
+
+    shared_frame(std::shared_ptr<const void> owner, const char *data, std::size_t size) noexcept
+        : _owner(std::move(owner))
+        , _data(data)
+        , _size(size) {}
+
+public:
+    shared_frame() noexcept = default;
+
+    /**
+     * @brief Copy @p size bytes from @p data into a new frame (one allocation).
+     */
+    [[nodiscard]] static shared_frame
+    copy_of(const char *data, std::size_t size) {
+        if (!size)
+            return {};
+        auto bytes = std::make_shared<char[]>(size);
+        std::memcpy(bytes.get(), data, size);
+        const char *begin = bytes.get();
+        return {std::move(bytes), begin, size};
+    }
+
+    /**
+     * @brief Copy @p bytes into a new frame.
+     */
+    [[nodiscard]] static shared_frame
+    copy_of(std::string_view bytes) {
+        return copy_of(bytes.data(), bytes.size());
+    }
+
+    /**
+     * @brief Take ownership of @p bytes without copying them.
+     * @details The string object moves into the frame's control block; its buffer stays where it
+     *          is. Short strings live inside the object itself, which the move copies — that is
+     *          at most a few bytes.
+     */
+    [[nodiscard]] static shared_frame
+    adopt(std::string &&bytes) {
+        if (bytes.empty())
+            return {};
+        auto        owner = std::make_shared<const std::string>(std::move(bytes));
+        const char *begin = owner->data();
+        const auto  size  = owner->size();
+        return {std::move(owner), begin, size};
+    }
+
+    /**
+     * @brief Take ownership of @p bytes without copying them.
+     */
+    [[nodiscard]] static shared_frame
+    adopt(std::vector<char> &&bytes) {
+        if (bytes.empty())
+            return {};
+        auto        owner = std::make_shared<const std::vector<char>>(std::move(bytes));
+        const char *begin = owner->data();
+        const auto  size  = owner->size();
+        return {std::move(owner), begin, size};
+    }
+
+    /**
+     * @brief Refer to @p size bytes the caller keeps alive, and learn when they are free again.
+     * @param release Invoked exactly once, when the last copy of the frame is gone — for a
+     *                queued frame, once the transport has written it or the stream was closed.
+     *                May be empty. It runs wherever that last copy dies, so it must not throw.
+     * @details An empty range yields an empty frame and @p release is invoked immediately.
+     */
+    [[nodiscard]] static shared_frame
+    borrow(const char *data, std::size_t size, std::function<void()> release = {}) {
+        if (!size) {
+            if (release)
+                release();
+            return {};
+        }
+        if (!release)
+            return {std::shared_ptr<const void>(), data, size};
+        // A null pointer with a deleter still owns a control block, and the deleter still runs.
+        std::shared_ptr<const void> owner(nullptr, [release = std::move(release)](const void *) { release(); });
+        return {std::move(owner), data, size};
+    }
+
+    /** @brief First byte of the frame (`nullptr` when empty). */
+    [[nodiscard]] const char *
+    data() const noexcept {
+        return _data;
+    }
+
+    /** @brief Number of bytes in the frame. */
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _size;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept {
+        return !_size;
+    }
+
+    /** @brief The bytes, as a view. */
+    [[nodiscard]] std::string_view
+    view() const noexcept {
+        return {_data, _size};
+    }
+
+    /**
+     * @brief Number of frames sharing this one's owner (0 for an empty or callback-less borrowed
+     *        frame).
+     */
+    [[nodiscard]] long
+    use_count() const noexcept {
+        return _owner.use_count();
+    }
+
+    /** @brief Drop this reference; the frame becomes empty. */
+    void
+    reset() noexcept {
+        _owner.reset();
+        _data = nullptr;
+        _size = 0;
+    }
+};
+
+} // namespace qb::io
+
+#endif // QB_IO_SHARED_FRAME_H_
@@ -30,7 +30,12 @@
 
 #ifndef QB_IO_STREAM_H_
 #define QB_IO_STREAM_H_
+#include <algorithm>
+#include <vector>
 #include <qb/io/config.h>
+#include <qb/io/input_pool.h>
+#include <qb/io/shared_frame.h>
+#include <qb/io/system/io_slice.h>
 #include <qb/system/allocator/pipe.h>
 #include <qb/utility/type_traits.h>
 
@@ -46,6 +51,10 @@ static constexpr int ErrBufferLimitExceeded = -2;
  * transport implementations. It manages an input buffer and provides
  * methods for reading data from the underlying IO object into the buffer.
  *
+ * In pooled-input mode (`set_pooled_input()`), the stream owns no input buffer between reads:
+ * `read()` borrows the thread's `input_pool` scratch buffer, and `eof()` gives it back after
+ * moving any unconsumed tail into a small pooled buffer.
+ *
  * @tparam _IO_ The IO type that implements the actual transport operations
  */
 template <typename _IO_>
@@ -58,10 +67,56 @@ public:
     using input_buffer_type = qb::allocator::pipe<char>;
 
 protected:
-    _IO_              _in;        /**< The underlying IO object */
-    input_buffer_type _in_buffer; /**< Buffer for incoming data */
+    _IO_              _in; /**< The underlying IO object */
+    input_buffer_type _in_buffer{QB_IO_POOLED_INPUT ? input_pool::empty() : input_buffer_type()}; /**< Buffer for incoming data */
     std::size_t       _max_read_buffer_size =
         QB_MAX_READ_BUFFER_SIZE; /**< Maximum allowed size for the input buffer (DoS protection). Configurable at runtime. */
+    bool _pooled_input = QB_IO_POOLED_INPUT; /**< Read through the thread's scratch buffer (see `set_pooled_input()`) */
+    bool _input_lent   = false;              /**< `_in_buffer` is the thread's scratch buffer */
+
+    /**
+     * @brief Pooled-input mode: swap the thread's scratch buffer in as `_in_buffer` for a read.
+     *
+     * The unconsumed tail moves in front of the scratch, and its pooled buffer goes back to the
+     * pool. Nothing changes if the scratch is already lent (a read nested in another stream's
+     * dispatch) or if the tail is too long to have come from the pool: the read then goes to
+     * the stream's own buffer.
+     */
+    void
+    borrow_input() {
+        auto &pool = input_pool::local();
+        if (_input_lent || pool.lent() || _in_buffer.size() > QB_IO_INPUT_POOL_MAX_TAIL)
+            return;
+        auto scratch = pool.lend();
+        if (const auto tail = _in_buffer.size())
+            scratch.put(_in_buffer.begin(), tail);
+        pool.release(std::move(_in_buffer));
+        _in_buffer  = std::move(scratch);
+        _input_lent = true;
+    }
+
+    /**
+     * @brief Give the scratch buffer back, keeping the unconsumed tail in a pooled buffer.
+     *
+     * A tail over `QB_IO_INPUT_POOL_MAX_TAIL` keeps the scratch buffer itself as the stream's
+     * own, and the pool makes a new scratch on its next `lend()`.
+     */
+    void
+    return_input() {
+        auto &pool  = input_pool::local();
+        _input_lent = false;
+        if (const auto tail = _in_buffer.size(); tail > QB_IO_INPUT_POOL_MAX_TAIL) {
+            _in_buffer.reorder();
+            pool.keep_lent();
+        } else {
+            auto scratch = std::move(_in_buffer);
+            if (tail) {
+                _in_buffer = pool.acquire(tail);
+                _in_buffer.put(scratch.begin(), tail);
+            }
+            pool.give_back(std::move(scratch));
+        }
+    }
 
 public:
     /**
@@ -131,6 +186,31 @@ public:
         _max_read_buffer_size = size;
     }
 
+    /**
+     * @brief Whether the stream reads through the thread's scratch buffer
+     * @return True in pooled-input mode
+     */
+    [[nodiscard]] bool
+    pooled_input() const noexcept {
+        return _pooled_input;
+    }
+
+    /**
+     * @brief Switch pooled-input mode on or off
+     * @param on True to read through the thread's `input_pool` scratch buffer
+     * @note Pooled input suits many mostly idle connections: between reads the stream holds no
+     *       input buffer, or only a pooled one sized to an unconsumed tail, instead of keeping a
+     *       `QB_DEFAULT_READ_BUFFER_SIZE` buffer. Complete messages are dispatched straight from
+     *       the scratch buffer, so `in()` is only valid until the next `eof()`. The default is
+     *       `QB_IO_POOLED_INPUT`. Call it from the thread that runs the stream.
+     */
+    void
+    set_pooled_input(bool const on) noexcept {
+        _pooled_input = on;
+        if (on && !_input_lent && !_in_buffer.size())
+            input_pool::local().release(std::move(_in_buffer));
+    }
+
     /**
      * @brief Read data from the transport into the input buffer
      * @return Number of bytes read on success, error code on failure
@@ -164,11 +244,16 @@ public:
         // Clamp to max I/O size to prevent integer overflow in platform APIs
         const std::size_t read_size = (bucket_read > QB_MAX_IO_SIZE) ? QB_MAX_IO_SIZE : bucket_read;
 
+        if (_pooled_input)
+            borrow_input();
         const auto ret = _in.read(_in_buffer.allocate_back(read_size), read_size);
         if (ret >= 0)
             _in_buffer.free_back(read_size - static_cast<std::size_t>(ret));
-        else
+        else {
             _in_buffer.free_back(read_size); // Release entire reservation on read failure (e.g. WSAEWOULDBLOCK)
+            if (_input_lent)
+                return_input(); // no eof() follows a failed read
+        }
         return ret;
     }
 
@@ -187,13 +272,19 @@ public:
     /**
      * @brief Handle end-of-file condition
      *
-     * Resets or reorders the input buffer based on whether it contains data.
+     * Resets or reorders the input buffer based on whether it contains data. In pooled-input
+     * mode, gives the scratch buffer back and keeps only the unconsumed tail, if any.
      */
     void
     eof() noexcept {
-        if (!_in_buffer.size())
-            _in_buffer.reset();
-        else
+        if (_input_lent)
+            return_input();
+        else if (!_in_buffer.size()) {
+            if (_pooled_input)
+                input_pool::local().release(std::move(_in_buffer));
+            else
+                _in_buffer.reset();
+        } else
             _in_buffer.reorder();
     }
 
@@ -212,7 +303,11 @@ public:
      */
     void
     close() noexcept {
-        _in_buffer.reset();
+        if (_input_lent) {
+            input_pool::local().give_back(std::move(_in_buffer));
+            _input_lent = false;
+        } else
+            _in_buffer.reset();
         // C++20: use concept directly
         if constexpr (qb::has_disconnect<_IO_>)
             _in.disconnect();
@@ -386,6 +481,14 @@ public:
  *       smallest footprint that preserves correct semantics; any change to
  *       either field must be mirrored in `ostream<_IO_>`.
  *
+ * @note **Output queue.** Besides the contiguous `_out_buffer`, a stream whose IO type offers
+ *       `writev(const io_slice *, std::size_t)` (TCP, TLS) keeps a queue of `shared_frame`s added
+ *       with `enqueue()`. Each queued frame remembers how many buffer bytes were published ahead
+ *       of it, so `write()` can hand the kernel the buffer runs and the frames interleaved in
+ *       publish order — one `sendmsg()` (one batched `SSL_write_ex()` run for TLS) instead of
+ *       copying large payloads into the buffer first. While the queue is empty, `write()` is the
+ *       plain single-buffer path it always was.
+ *
  * @tparam _IO_ The IO type that implements the actual transport operations
  */
 template <typename _IO_>
@@ -405,15 +508,30 @@ public:
      */
     static constexpr bool has_reset_on_pending_read = false;
 
+    /** @brief Whether `_IO_` can write a list of buffers in one call, enabling `enqueue()` */
+    static constexpr bool has_gather_write = qb::has_writev_r<_IO_, int, const io_slice *, std::size_t>;
+
 protected:
+    /** @brief A frame waiting in the output queue */
+    struct queued_frame {
+        shared_frame frame;  /**< The bytes; the reference is dropped once they are all written */
+        std::size_t  sent;   /**< Bytes of `frame` already written */
+        std::size_t  before; /**< `_out_buffer` bytes still to be written ahead of this frame */
+    };
+
     output_buffer_type _out_buffer; /**< Buffer for outgoing data */
     std::size_t        _max_write_buffer_size =
         QB_MAX_WRITE_BUFFER_SIZE; /**< Maximum allowed size for the output buffer (DoS protection). Configurable at runtime. */
+    std::vector<queued_frame> _out_frames;          /**< Output queue; entries before `_out_frames_head` are done */
+    std::size_t               _out_frames_head  = 0; /**< First frame still (partly) unwritten */
+    std::size_t               _out_frames_bytes = 0; /**< Unwritten frame bytes in the queue */
+    std::size_t               _out_claimed      = 0; /**< `_out_buffer` bytes that precede the last queued frame */
 
 public:
     /**
      * @brief Get the output buffer
      * @return Reference to the output buffer
+     * @note Bytes appended here go out after every frame already queued with `enqueue()`.
      */
     [[nodiscard]] output_buffer_type &
     out() noexcept {
@@ -422,11 +540,51 @@ public:
 
     /**
      * @brief Get the number of bytes pending for writing
-     * @return Number of bytes in the output buffer
+     * @return Number of bytes in the output buffer plus the unwritten bytes of queued frames
      */
     [[nodiscard]] std::size_t
     pendingWrite() const noexcept {
-        return _out_buffer.size();
+        return _out_buffer.size() + _out_frames_bytes;
+    }
+
+    /**
+     * @brief Number of frames in the output queue (partly written ones included)
+     */
+    [[nodiscard]] std::size_t
+    pendingFrames() const noexcept {
+        return _out_frames.size() - _out_frames_head;
+    }
+
+    /**
+     * @brief Queue @p frame for writing after everything published so far, without copying it
+     * @param frame The bytes to send; the stream keeps this reference until they are written
+     * @return false if the output limit would be exceeded (the frame is not queued)
+     *
+     * Frames shorter than `QB_IO_GATHER_MIN_SIZE` are copied into the output buffer instead,
+     * which is cheaper at that size; either way the bytes go out in publish order with whatever
+     * is written to `out()` before and after.
+     *
+     * @note The limit is `max_write_buffer_size()` against `pendingWrite()`, frames included: a
+     *       peer that stops reading must not pin an unbounded amount of shared memory either.
+     */
+    [[nodiscard]] bool
+    enqueue(shared_frame frame) noexcept
+    requires has_gather_write
+    {
+        const auto pending = pendingWrite();
+        if (_max_write_buffer_size < pending || frame.size() > _max_write_buffer_size - pending)
+            return false;
+        if (frame.empty())
+            return true;
+        if (frame.size() < QB_IO_GATHER_MIN_SIZE) {
+            std::memcpy(_out_buffer.allocate_back(frame.size()), frame.data(), frame.size());
+            return true;
+        }
+        const auto before = _out_buffer.size() - _out_claimed;
+        _out_claimed      = _out_buffer.size();
+        _out_frames_bytes += frame.size();
+        _out_frames.push_back({std::move(frame), 0, before});
+        return true;
     }
 
     /**
@@ -453,6 +611,10 @@ public:
     write() noexcept
     requires qb::has_write_r<_IO_, int, const char *, std::size_t>
     {
+        if constexpr (has_gather_write) {
+            if (_out_frames_head != _out_frames.size())
+                return write_queue();
+        }
         const auto ret = this->_in.write(_out_buffer.begin(), _out_buffer.size());
         if (ret > 0) {
             // Advance the cursor, never relocate the tail — see the identical comment on
@@ -465,6 +627,84 @@ public:
         return ret;
     }
 
+private:
+    /**
+     * @brief Gather-write the output queue: buffer runs and frames in publish order
+     *
+     * Hands `_IO_::writev()` at most `QB_IO_MAX_SLICES` slices and `QB_MAX_IO_SIZE` bytes, then
+     * retires what was written: buffer bytes through `free_front()` exactly as the contiguous
+     * path does, frames by dropping their reference.
+     */
+    [[nodiscard]] int
+    write_queue() noexcept
+    requires has_gather_write
+    {
+        io_slice    slices[QB_IO_MAX_SLICES];
+        std::size_t count = 0, total = 0;
+        const auto  add   = [&](const char *data, std::size_t size) noexcept {
+            size            = (std::min) (size, QB_MAX_IO_SIZE - total);
+            slices[count++] = {data, size};
+            total += size;
+            return count < QB_IO_MAX_SLICES && total < QB_MAX_IO_SIZE;
+        };
+
+        const char *buffered = _out_buffer.begin();
+        bool        room     = true;
+        for (auto i = _out_frames_head; room && i < _out_frames.size(); ++i) {
+            auto const &queued = _out_frames[i];
+            if (queued.before) {
+                room = add(buffered, queued.before);
+                buffered += queued.before;
+            }
+            if (room)
+                room = add(queued.frame.data() + queued.sent, queued.frame.size() - queued.sent);
+        }
+        if (room && _out_buffer.size() != _out_claimed)
+            add(buffered, _out_buffer.size() - _out_claimed);
+
+        const auto ret = this->_in.writev(slices, count);
+        if (ret > 0)
+            retire(static_cast<std::size_t>(ret));
+        return ret;
+    }
+
+    /**
+     * @brief Drop @p written bytes from the front of the queue
+     */
+    void
+    retire(std::size_t written) noexcept {
+        std::size_t from_buffer = 0;
+        while (written && _out_frames_head != _out_frames.size()) {
+            auto      &queued = _out_frames[_out_frames_head];
+            const auto ahead  = (std::min) (written, queued.before);
+            queued.before -= ahead;
+            _out_claimed -= ahead;
+            from_buffer += ahead;
+            written -= ahead;
+            if (!written)
+                break;
+            const auto sent = (std::min) (written, queued.frame.size() - queued.sent);
+            queued.sent += sent;
+            _out_frames_bytes -= sent;
+            written -= sent;
+            if (queued.sent == queued.frame.size()) {
+                queued.frame.reset();
+                ++_out_frames_head;
+            }
+        }
+        if (_out_frames_head == _out_frames.size()) {
+            _out_frames.clear(); // keeps the capacity for the next burst
+            _out_frames_head = 0;
+        }
+        from_buffer += written; // the tail published after the last frame
+        if (from_buffer == _out_buffer.size())
+            _out_buffer.reset();
+        else if (from_buffer)
+            _out_buffer.free_front(from_buffer);
+    }
+
+public:
+
     /**
      * @brief Get the maximum allowed size for the output buffer
      * @return Maximum buffer size in bytes, or SIZE_MAX (-1) if unlimited
@@ -502,7 +742,8 @@ public:
      */
     [[nodiscard]] char *
     publish(char const *data, std::size_t size) noexcept {
-        if (_max_write_buffer_size < _out_buffer.size() || size > _max_write_buffer_size - _out_buffer.size()) {
+        const auto pending = pendingWrite();
+        if (_max_write_buffer_size < pending || size > _max_write_buffer_size - pending) {
             return nullptr;
         }
 
@@ -517,6 +758,10 @@ public:
     void
     close() noexcept {
         _out_buffer.reset();
+        _out_frames.clear(); // drops every reference: borrowed frames' release callbacks run here
+        _out_frames_head  = 0;
+        _out_frames_bytes = 0;
+        _out_claimed      = 0;
         static_cast<istream<_IO_> &>(*this).close();
     }
 };
@@ -0,0 +1,43 @@
+/**
+ * @file qb/io/system/io_slice.h
+ * @brief Portable descriptor of one buffer in a gather write.
+ *
+ * Shared by the socket layer (`socket::sendv()`, `tcp::socket::writev()`) and by
+ * `qb::io::stream`, which builds the slice list from its output queue, without the latter having
+ * to pull in the platform socket headers.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup System
+ */
+
+#ifndef QB_IO_SYSTEM_IO_SLICE_H
+#define QB_IO_SYSTEM_IO_SLICE_H
+#include <cstddef>
+
+namespace qb::io {
+
+/**
+ * @brief One contiguous byte range of a gather write.
+ *
+ * Stand-in for `struct iovec` / `WSABUF`, whose layouts differ; `socket::sendv()` converts.
+ */
+struct io_slice {
+    const void *data;
+    std::size_t size;
+};
+
+} // namespace qb::io
+
+#endif // QB_IO_SYSTEM_IO_SLICE_H
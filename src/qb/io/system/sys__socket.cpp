@@ -43,6 +43,7 @@
 
 #if !defined(_WIN32)
 #include <qb/io/system/sys__ifaddrs.h>
+#include <sys/uio.h> // struct iovec for sendv()
 #endif
 
 // For apple bsd socket implemention
@@ -248,6 +249,16 @@ socket::pserve(const char *addr, u_short port) {
 }
 int
 socket::pserve(const endpoint &ep) {
+    return this->pserve(ep, false);
+}
+int
+socket::pserve(const endpoint &ep, bool share_port) {
+#if !defined(SO_REUSEPORT)
+    if (share_port) {
+        set_last_errno(ENOPROTOOPT);
+        return -1;
+    }
+#endif
     if (!this->reopen(ep.af()))
         return -1;
 
@@ -278,6 +289,13 @@ socket::pserve(const endpoint &ep) {
     if (ep.af() == AF_INET6)
         set_optval(IPPROTO_IPV6, IPV6_V6ONLY, 0);
 
+    // A shared port must be set before bind(); every member of the group needs it, and
+    // Linux also requires them all to belong to the same effective user.
+#if defined(SO_REUSEPORT)
+    if (share_port && set_optval(SOL_SOCKET, SO_REUSEPORT, 1) != 0)
+        return -1;
+#endif
+
     int n = this->bind(ep);
     if (n != 0)
         return n;
@@ -673,11 +691,18 @@ int
 socket::accept_n(socket_type &new_sock) const {
     for (;;) {
         // Accept the waiting connection.
+#if defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+        // One syscall instead of accept + two fcntl, and no fd leaks into a fork/exec.
+        new_sock = ::accept4(this->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
         new_sock = ::accept(this->fd, nullptr, nullptr);
+#endif
 
         // Check if operation succeeded.
         if (new_sock != invalid_socket) {
+#if !(defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC))
             socket::set_nonblocking(new_sock, true);
+#endif
             // Accepted sockets are created by ::accept, not open().
             suppress_sigpipe(new_sock);
             return 0;
@@ -889,6 +914,36 @@ socket::send(socket_type s, const void *buf, int len, int flags) {
     return static_cast<int>(::send(s, (const char *) buf, len, flags));
 }
 
+int
+socket::sendv(const io_slice *slices, std::size_t count, int flags) const {
+    return socket::sendv(this->fd, slices, count, flags);
+}
+int
+socket::sendv(socket_type s, const io_slice *slices, std::size_t count, int flags) {
+    count = (std::min) (count, static_cast<std::size_t>(QB_IO_MAX_SLICES));
+#if defined(_WIN32)
+    WSABUF bufs[QB_IO_MAX_SLICES];
+    for (std::size_t i = 0; i < count; ++i) {
+        bufs[i].buf = static_cast<CHAR *>(const_cast<void *>(slices[i].data));
+        bufs[i].len = static_cast<ULONG>(slices[i].size);
+    }
+    DWORD sent = 0;
+    if (::WSASend(s, bufs, static_cast<DWORD>(count), &sent, static_cast<DWORD>(flags), nullptr, nullptr) != 0)
+        return -1;
+    return static_cast<int>(sent);
+#else
+    struct iovec iov[QB_IO_MAX_SLICES];
+    for (std::size_t i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<void *>(slices[i].data);
+        iov[i].iov_len  = slices[i].size;
+    }
+    struct msghdr msg {};
+    msg.msg_iov    = iov;
+    msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(count);
+    return static_cast<int>(::sendmsg(s, &msg, flags));
+#endif
+}
+
 int
 socket::recv(void *buf, int len, int flags) const {
     return static_cast<int>(this->recv(this->fd, buf, len, flags));
@@ -41,6 +41,7 @@
 #include <vector>
 
 #include <qb/io/config.h>
+#include <qb/io/system/io_slice.h>
 #include <qb/system/time.h>
 
 #if !defined(_WS2IPDEF_)
@@ -824,6 +825,9 @@ public: /// portable connect APIs
     // easy to create a tcp ipv4 or ipv6 server socket.
     QB__DECL int pserve(const char *addr, u_short port);
     QB__DECL int pserve(const endpoint &ep);
+    // same, joining the port's SO_REUSEPORT group when share_port is set: every socket bound
+    // that way gets its own accept queue and the kernel spreads new connections across them.
+    QB__DECL int pserve(const endpoint &ep, bool share_port);
 
 public:
     /**
@@ -1023,6 +1027,8 @@ public:
      *        If no error occurs, return 0, and the new_sock will be the actual
      *connection is made.
      *        Otherwise, a EWOULDBLOCK,EAGAIN or other value is returned
+     * @note new_sock is non-blocking; where accept4() exists it is also
+     *       close-on-exec, both set by the accepting syscall itself.
      */
     QB__DECL int accept_n(socket_type &new_sock) const;
 
@@ -1121,6 +1127,20 @@ public:
     QB__DECL int        send(const void *buf, int len, int flags = MSG_NOSIGNAL) const;
     QB__DECL static int send(socket_type fd, const void *buf, int len, int flags = MSG_NOSIGNAL);
 
+    /**
+     * @brief Sends several buffers on this connected socket in one call (gather write)
+     * @params: at most QB_IO_MAX_SLICES slices are sent, the rest are ignored; the caller keeps
+     *          the total below INT_MAX.
+     *
+     * @returns:
+     *         Like send(): the total number of bytes sent, which can stop anywhere inside any
+     *slice, or SOCKET_ERROR.
+     * @remark: `sendmsg()` on POSIX, so `flags` (MSG_NOSIGNAL) applies exactly as it does to
+     *          send(); `WSASend()` on Windows.
+     */
+    QB__DECL int        sendv(const io_slice *slices, std::size_t count, int flags = MSG_NOSIGNAL) const;
+    QB__DECL static int sendv(socket_type fd, const io_slice *slices, std::size_t count, int flags = MSG_NOSIGNAL);
+
     /**
      * @brief Receives data from this connected socket or a bound connectionless socket.
      * @params: omit
@@ -23,6 +23,9 @@
  */
 
 #include <qb/io/tcp/listener.h>
+#if defined(__linux__)
+#include <linux/filter.h>
+#endif
 
 namespace qb::io::tcp {
 
@@ -47,6 +50,53 @@ listener::listen(io::uri const &u) noexcept {
     return -1;
 }
 
+int
+listener::listen_shared(io::endpoint const &ep) noexcept {
+    const auto ret = pserve(ep, true);
+    if (!ret)
+        set_optval<int>(IPPROTO_TCP, TCP_NODELAY, 1);
+    return ret;
+}
+
+int
+listener::listen_shared(io::uri const &u) noexcept {
+    switch (u.af()) {
+        case AF_INET:
+        case AF_INET6:
+            return listen_shared(io::endpoint().as_in(std::string(u.host()).c_str(), u.u_port()));
+    }
+    return -1;
+}
+
+int
+listener::steer_by_cpu(std::uint32_t shards) noexcept {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    if (!shards)
+        return -1;
+    // A = cpu; A %= shards; return A
+    sock_filter code[] = {{BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+                          {BPF_ALU | BPF_MOD | BPF_K, 0, 0, shards},
+                          {BPF_RET | BPF_A, 0, 0, 0}};
+    sock_fprog program{static_cast<unsigned short>(sizeof(code) / sizeof(code[0])), code};
+    return set_optval(SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, static_cast<socklen_t>(sizeof(program)));
+#else
+    (void) shards;
+    set_last_errno(EOPNOTSUPP);
+    return -1;
+#endif
+}
+
+int
+listener::steer(int program_fd) noexcept {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_EBPF)
+    return set_optval<int>(SOL_SOCKET, SO_ATTACH_REUSEPORT_EBPF, program_fd);
+#else
+    (void) program_fd;
+    set_last_errno(EOPNOTSUPP);
+    return -1;
+#endif
+}
+
 int
 listener::listen_v4(uint16_t port, std::string const &host) noexcept {
     return listen(io::endpoint().as_in(host.c_str(), port));
@@ -24,6 +24,7 @@
 
 #ifndef QB_IO_TCP_LISTENER_H_
 #define QB_IO_TCP_LISTENER_H_
+#include <cstdint>
 #include <filesystem>
 #include "socket.h"
 
@@ -96,6 +97,49 @@ public:
      */
     int listen_v6(uint16_t port, std::string const &host = "::") noexcept;
 
+    /**
+     * @brief Start listening on an endpoint other listeners in this process may bind as well.
+     * @param ep The `qb::io::endpoint` to listen on (IPv4 or IPv6).
+     * @return 0 on success, or a non-zero error code on failure.
+     * @details Sets `SO_REUSEPORT` before binding, so each listener that does the same on the
+     *          same address joins one group: every member keeps its own accept queue and the
+     *          kernel hashes each new connection to one of them. One listener per `VirtualCore`
+     *          therefore accepts, and serves, its share of the clients without any cross-core
+     *          handoff. Fails with `ENOPROTOOPT` where the platform has no `SO_REUSEPORT`
+     *          (Windows). On Linux a member can only join a group bound by the same user.
+     */
+    int listen_shared(io::endpoint const &ep) noexcept;
+
+    /**
+     * @brief `listen_shared()` on an endpoint given by a `tcp://` URI.
+     * @param uri The `qb::io::uri` to listen on. A Unix domain socket cannot be shared and fails.
+     * @return 0 on success, or a non-zero error code on failure.
+     */
+    int listen_shared(io::uri const &uri) noexcept;
+
+    /**
+     * @brief Steer the connections of this listener's `SO_REUSEPORT` group by receiving CPU.
+     * @param shards Number of listeners in the group.
+     * @return 0 on success, or a non-zero error code on failure (`EOPNOTSUPP` outside Linux).
+     * @details Attaches a classic BPF program (`SO_ATTACH_REUSEPORT_CBPF`) that picks member
+     *          `cpu % shards`, where `cpu` is the CPU the kernel handled the SYN on. Members are
+     *          numbered in the order they were bound, so to keep a connection on the CPU that
+     *          received it, bind member `i` from the core pinned to CPU `i` (or bind them all up
+     *          front, in that order, and hand each one to its core). The program is shared by
+     *          the whole group; attach it once, from any member, after binding.
+     */
+    int steer_by_cpu(std::uint32_t shards) noexcept;
+
+    /**
+     * @brief Steer the connections of this listener's `SO_REUSEPORT` group with an eBPF program.
+     * @param program_fd A loaded `BPF_PROG_TYPE_SOCKET_FILTER` program, as returned by `bpf(2)`.
+     *                   The program's return value is the index of the member to pick.
+     * @return 0 on success, or a non-zero error code on failure (`EOPNOTSUPP` outside Linux).
+     * @details Loading the program is left to the caller (libbpf or a raw `bpf(2)` call);
+     *          the group keeps its own reference, so the caller may close `program_fd` afterwards.
+     */
+    int steer(int program_fd) noexcept;
+
     /**
      * @brief Start listening on a Unix domain socket.
      * @param path The file system path for the Unix domain socket.
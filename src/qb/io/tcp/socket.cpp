@@ -256,6 +256,11 @@ socket::write(const void *data, std::size_t size) const noexcept {
     return send(data, static_cast<int>(size));
 }
 
+int
+socket::writev(const io_slice *slices, std::size_t count) const noexcept {
+    return sendv(slices, count);
+}
+
 int
 socket::disconnect() const noexcept {
     return shutdown();
@@ -262,6 +262,16 @@ public:
      */
     int write(const void *data, std::size_t size) const noexcept;
 
+    /**
+     * @brief Write several buffers to the connected TCP socket in one system call.
+     * @param slices The buffers, in order.
+     * @param count Number of entries in `slices`; at most `QB_IO_MAX_SLICES` are written.
+     * @return Total number of bytes written, which can stop inside any slice when the send
+     *         buffer fills. A negative value indicates an error.
+     * @see qb::io::socket::sendv(const io_slice*, std::size_t, int)
+     */
+    int writev(const io_slice *slices, std::size_t count) const noexcept;
+
     /**
      * @brief Disconnect the TCP socket.
      * @return 0 on success, or a non-zero error code on failure.
@@ -23,6 +23,8 @@
  * @ingroup IO
  */
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <qb/io/system/file.h> // qb::io::sys::resolve_resource (working-dir-independent paths)
 #include <qb/io/tcp/ssl/socket.h>
@@ -1034,6 +1036,69 @@ socket::write(const void *data, std::size_t size) noexcept {
     return ret;
 }
 
+int
+socket::writev(const io_slice *slices, std::size_t count) noexcept {
+    if (!_ssl_handle)
+        return -1;
+    auto ret = handCheck();
+    if (ret != 1)
+        return ret;
+
+    // Largest plaintext a single TLS record carries (RFC 8446 §5.1).
+    constexpr std::size_t record = 16384;
+    char                  stage[record];
+    std::size_t           total = 0;
+    std::size_t           index = 0, offset = 0; // next unsent byte: slices[index] + offset
+    const auto            advance = [&](std::size_t n) noexcept {
+        while (n) {
+            const auto take = (std::min) (n, slices[index].size - offset);
+            n -= take;
+            offset += take;
+            if (offset == slices[index].size) {
+                index += 1;
+                offset = 0;
+            }
+        }
+    };
+    while (index < count) {
+        if (offset == slices[index].size) { // empty slice
+            index += 1;
+            offset = 0;
+            continue;
+        }
+        const char *data = static_cast<const char *>(slices[index].data) + offset;
+        std::size_t size = slices[index].size - offset;
+        if (size < record) {
+            size = 0;
+            for (auto i = index, o = offset; i < count && size < record; ++i, o = 0) {
+                const auto take = (std::min) (slices[i].size - o, record - size);
+                std::memcpy(stage + size, static_cast<const char *>(slices[i].data) + o, take);
+                size += take;
+            }
+            data = stage;
+        }
+
+        std::size_t written = 0;
+        ERR_clear_error(); // see write()
+        if (SSL_write_ex(ssl_handle(), data, size, &written) != 1) {
+            switch (SSL_get_error(ssl_handle(), 0)) {
+                case SSL_ERROR_WANT_WRITE:
+                case SSL_ERROR_WANT_READ:
+                    break;
+                default:
+                    if (!total)
+                        return -1;
+            }
+            break;
+        }
+        // With SSL_MODE_ENABLE_PARTIAL_WRITE a short count only means one record went out:
+        // carry on from there until OpenSSL reports the socket full.
+        total += written;
+        advance(written);
+    }
+    return static_cast<int>(total);
+}
+
 [[nodiscard]] SSL *
 socket::ssl_handle() const noexcept {
     return _ssl_handle.get();
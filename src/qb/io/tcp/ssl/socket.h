@@ -684,6 +684,20 @@ public:
      */
     int write(const void *data, std::size_t size) noexcept;
 
+    /**
+     * @brief Encrypt and send several buffers, batching small ones into full TLS records.
+     * @param slices The plaintext buffers, in order.
+     * @param count Number of entries in `slices`.
+     * @return Total number of plaintext bytes accepted, which can stop inside any slice; `0` when
+     *         the SSL layer wants I/O first; a negative value on error.
+     * @details OpenSSL has no gather write, and one `SSL_write_ex()` per slice would seal every
+     *          small slice in its own record. Runs of slices shorter than a record are copied into
+     *          one record-sized staging block first; a slice of a record or more is encrypted in
+     *          place. The staging is a pure function of the queue, so a retry after
+     *          `SSL_ERROR_WANT_WRITE` hands OpenSSL the same leading bytes, as it requires.
+     */
+    int writev(const io_slice *slices, std::size_t count) noexcept;
+
     /**
      * @brief Get the underlying OpenSSL `SSL` handle.
      * @return Pointer to the `SSL` object, or `nullptr` if not initialized.
@@ -24,6 +24,8 @@
 
 #ifndef QB_IO_TRANSPORT_ACCEPT_H_
 #define QB_IO_TRANSPORT_ACCEPT_H_
+#include <span>
+#include <vector>
 #include "../tcp/listener.h"
 
 namespace qb::io::transport {
@@ -38,14 +40,21 @@ namespace qb::io::transport {
  * for stream classes (like `qb::io::istream`) when building acceptor components
  * (e.g., `qb::io::async::tcp::acceptor`).
  *
- * Its `read()` method attempts to accept a new connection via the listener, and
- * `getAccepted()` provides access to the newly accepted `qb::io::tcp::socket`.
+ * Its `read()` method accepts the pending connections via the listener, up to a
+ * per-wakeup budget; `getAcceptedBatch()` exposes them and `getAccepted()` the oldest.
  */
 class accept {
-    io::tcp::listener _io;          /**< TCP listener for accepting connections */
-    io::tcp::socket   _accepted_io; /**< Socket for the accepted connection */
+    io::tcp::listener            _io;                        /**< TCP listener for accepting connections */
+    io::tcp::socket              _accepted_io;               /**< Empty; what `getAccepted()` returns when nothing is pending. */
+    std::vector<io::tcp::socket> _batch;                     /**< Connections taken by the last `read()`, not yet handed off. */
+    std::size_t                  _budget = QB_ACCEPT_BUDGET; /**< Most connections one `read()` takes. */
 
 public:
+    /** @brief Reserve the batch for `accept_budget()` connections, so `read()` never allocates */
+    accept() {
+        _batch.reserve(_budget);
+    }
+
     /** @brief Indicates that this transport implementation is not secure */
     static constexpr bool
     is_secure() noexcept {
@@ -67,12 +76,13 @@ public:
     }
 
     /**
-     * @brief Accept a new connection
-     * @return Native handle of the accepted socket, or -1 on failure
+     * @brief Accept the pending connections, up to `accept_budget()`
+     * @return Native handle of the first socket accepted, or -1 on failure
      *
-     * Attempts to accept a new connection. If successful, returns the
-     * native handle of the accepted socket which can be used for
-     * further communication.
+     * Drains the listen queue into the batch that `getAcceptedBatch()`
+     * exposes, so one readiness event (one libev dispatch) accepts a whole
+     * burst of connections rather than one. Each socket arrives non-blocking
+     * and close-on-exec from `accept4()` where the platform has it.
      *
      * @note **Transient accept errors.** A connection aborted by the peer
      *       between the kernel queueing it and accept() picking it up surfaces
@@ -84,9 +94,16 @@ public:
      */
     std::size_t
     read() noexcept {
-        const auto ret = _io.accept(_accepted_io);
-        if (ret == io::SocketStatus::Done)
-            return static_cast<std::size_t>(_accepted_io.native_handle());
+        int ret = 0;
+        while (_batch.size() < _budget) {
+            io::tcp::socket accepted;
+            if ((ret = _io.accept(accepted)) != io::SocketStatus::Done)
+                break;
+            _batch.push_back(std::move(accepted));
+        }
+        // An error after some connections only ends the batch; the next wakeup retries it.
+        if (!_batch.empty())
+            return static_cast<std::size_t>(_batch.front().native_handle());
         if (ret == ECONNABORTED
 #ifdef EPROTO
             || ret == EPROTO
@@ -106,15 +123,16 @@ public:
     }
 
     /**
-     * @brief Release the accepted socket handle
+     * @brief Drop the batch once it has been handed off
      * @param Unused parameter
      *
-     * Releases the handle of the last accepted socket to prevent
-     * it from being closed when the socket object is destroyed.
+     * The handler has moved out every socket it keeps by now, so what is left
+     * is moved-from slots and connections nobody took: clearing the batch
+     * closes the latter instead of leaking their descriptors.
      */
     void
     flush(std::size_t) noexcept {
-        _accepted_io.release_handle();
+        _batch.clear();
     }
 
     /**
@@ -138,15 +156,42 @@ public:
     }
 
     /**
-     * @brief Get the accepted socket
-     * @return Reference to the last accepted socket
-     *
-     * Returns a reference to the socket object representing
-     * the last accepted connection.
+     * @brief Get the oldest accepted connection not yet handed off
+     * @return Reference to it, or to an empty socket when nothing is pending
      */
     io::tcp::socket &
     getAccepted() noexcept {
-        return _accepted_io;
+        return _batch.empty() ? _accepted_io : _batch.front();
+    }
+
+    /**
+     * @brief Get every connection the last `read()` accepted
+     * @return The pending batch, oldest first; empty once `flush()` has run
+     */
+    std::span<io::tcp::socket>
+    getAcceptedBatch() noexcept {
+        return _batch;
+    }
+
+    /**
+     * @brief Set how many connections one `read()` may take
+     * @param budget Connections per readiness event; 0 is treated as 1
+     *
+     * Defaults to `QB_ACCEPT_BUDGET`. A larger budget empties a connection
+     * storm in fewer loop passes; a smaller one returns to established
+     * sessions sooner. The batch is reserved for the new budget here, so
+     * `read()` stays allocation-free.
+     */
+    void
+    set_accept_budget(std::size_t budget) {
+        _budget = budget ? budget : 1;
+        _batch.reserve(_budget);
+    }
+
+    /** @brief Connections one `read()` may take */
+    [[nodiscard]] std::size_t
+    accept_budget() const noexcept {
+        return _budget;
     }
 };
 
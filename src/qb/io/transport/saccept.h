@@ -25,6 +25,8 @@
 
 #ifndef QB_IO_TRANSPORT_SACCEPT_H_
 #define QB_IO_TRANSPORT_SACCEPT_H_
+#include <span>
+#include <vector>
 #include "../tcp/ssl/listener.h"
 
 namespace qb::io::transport {
@@ -38,14 +40,21 @@ namespace qb::io::transport {
  * TCP connections. It wraps a `qb::io::tcp::ssl::listener` and is used similarly
  * to `qb::io::transport::accept`, but for encrypted connections.
  *
- * Its `read()` method attempts to accept a new secure connection, performing the SSL handshake,
- * and `getAccepted()` provides access to the newly established `qb::io::tcp::ssl::socket`.
+ * Its `read()` method accepts the pending secure connections, up to a per-wakeup budget;
+ * `getAcceptedBatch()` exposes them and `getAccepted()` the oldest `qb::io::tcp::ssl::socket`.
  */
 class saccept {
-    io::tcp::ssl::listener _io;          /**< SSL TCP listener for accepting secure connections. */
-    io::tcp::ssl::socket   _accepted_io; /**< SSL socket for the most recently accepted secure connection. */
+    io::tcp::ssl::listener            _io;                        /**< SSL TCP listener for accepting secure connections. */
+    io::tcp::ssl::socket              _accepted_io;               /**< Empty; what `getAccepted()` returns when nothing is pending. */
+    std::vector<io::tcp::ssl::socket> _batch;                     /**< Connections taken by the last `read()`, not yet handed off. */
+    std::size_t                       _budget = QB_ACCEPT_BUDGET; /**< Most connections one `read()` takes. */
 
 public:
+    /** @brief Reserve the batch for `accept_budget()` connections, so `read()` never allocates */
+    saccept() {
+        _batch.reserve(_budget);
+    }
+
     /** @brief Indicates that this transport implementation is secure */
     static constexpr bool
     is_secure() noexcept {
@@ -67,12 +76,11 @@ public:
     }
 
     /**
-     * @brief Accept a new secure connection
-     * @return Native handle of the accepted socket, or -1 on failure
+     * @brief Accept the pending secure connections, up to `accept_budget()`
+     * @return Native handle of the first socket accepted, or -1 on failure
      *
-     * Attempts to accept a new secure connection. If successful, returns the
-     * native handle of the accepted socket which can be used for
-     * further secure communication.
+     * Mirrors `transport::accept::read()`: one readiness event drains a burst
+     * of connections into the batch that `getAcceptedBatch()` exposes.
      *
      * @note **Transient accept errors.** Mirrors `transport::accept::read()`:
      *       a peer-aborted pending connection (`ECONNABORTED` / `EPROTO`) is
@@ -81,9 +89,16 @@ public:
      */
     std::size_t
     read() noexcept {
-        const auto ret = _io.accept(_accepted_io);
-        if (ret == io::SocketStatus::Done)
-            return static_cast<std::size_t>(_accepted_io.native_handle());
+        int ret = 0;
+        while (_batch.size() < _budget) {
+            io::tcp::ssl::socket accepted;
+            if ((ret = _io.accept(accepted)) != io::SocketStatus::Done)
+                break;
+            _batch.push_back(std::move(accepted));
+        }
+        // An error after some connections only ends the batch; the next wakeup retries it.
+        if (!_batch.empty())
+            return static_cast<std::size_t>(_batch.front().native_handle());
         if (ret == ECONNABORTED
 #ifdef EPROTO
             || ret == EPROTO
@@ -100,23 +115,17 @@ public:
     }
 
     /**
-     * @brief Release the native handle of the accepted SSL socket.
+     * @brief Drop the batch once it has been handed off.
      * @param Unused parameter (required by the stream/protocol contract).
      *
-     * This mirrors `transport::accept::flush()`: at this point
-     * `protocol::accept::onMessage()` has already `std::move()`d the
-     * accepted `ssl::socket` into the user session, so `_accepted_io` is in a
-     * moved-from (empty) state. We simply release the native handle to make
-     * that fact explicit rather than reassigning a fresh `ssl::socket()` — the
-     * previous approach destroyed a default-constructed temporary on the hot
-     * accept path and obscured the moved-from semantics.
-     *
-     * The `SSL*` owned by the previously accepted socket has already been
-     * transferred by the move; no additional work is required here.
+     * This mirrors `transport::accept::flush()`: every `ssl::socket` a
+     * handler keeps has been `std::move()`d out by now, its `SSL*` with it, so
+     * clearing the batch only destroys moved-from slots and closes the
+     * connections nobody took instead of leaking them.
      */
     void
     flush(std::size_t) noexcept {
-        _accepted_io.release_handle();
+        _batch.clear();
     }
 
     /**
@@ -140,15 +149,38 @@ public:
     }
 
     /**
-     * @brief Get the accepted secure socket
-     * @return Reference to the last accepted secure socket
-     *
-     * Returns a reference to the SSL socket object representing
-     * the last accepted secure connection.
+     * @brief Get the oldest accepted secure connection not yet handed off
+     * @return Reference to it, or to an empty socket when nothing is pending
      */
     io::tcp::ssl::socket &
     getAccepted() noexcept {
-        return _accepted_io;
+        return _batch.empty() ? _accepted_io : _batch.front();
+    }
+
+    /**
+     * @brief Get every secure connection the last `read()` accepted
+     * @return The pending batch, oldest first; empty once `flush()` has run
+     */
+    std::span<io::tcp::ssl::socket>
+    getAcceptedBatch() noexcept {
+        return _batch;
+    }
+
+    /**
+     * @brief Set how many connections one `read()` may take
+     * @param budget Connections per readiness event; 0 is treated as 1
+     * @see transport::accept::set_accept_budget()
+     */
+    void
+    set_accept_budget(std::size_t budget) {
+        _budget = budget ? budget : 1;
+        _batch.reserve(_budget);
+    }
+
+    /** @brief Connections one `read()` may take */
+    [[nodiscard]] std::size_t
+    accept_budget() const noexcept {
+        return _budget;
     }
 };
 
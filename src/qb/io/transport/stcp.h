@@ -65,6 +65,8 @@ public:
             return ErrBufferLimitExceeded;
         }
 
+        if (this->_pooled_input)
+            this->borrow_input();
         auto ret = _in.read(_in_buffer.allocate_back(bucket_read), bucket_read);
         if (ret >= 0) {
             _in_buffer.free_back(bucket_read - ret);
@@ -85,6 +87,8 @@ public:
             }
         } else {
             _in_buffer.free_back(bucket_read);
+            if (this->_input_lent)
+                this->return_input();
         }
         return ret;
     }
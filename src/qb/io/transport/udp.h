@@ -342,6 +342,8 @@ public:
 
         const auto remaining = this->_max_read_buffer_size - _in_buffer.size();
         if (remaining >= io::udp::socket::MaxDatagramSize) {
+            if (this->_pooled_input)
+                this->borrow_input();
             const auto ret =
                 transport().read(_in_buffer.allocate_back(io::udp::socket::MaxDatagramSize), io::udp::socket::MaxDatagramSize, _remote_source);
             if (qb::likely(ret > 0)) {
@@ -355,6 +357,8 @@ public:
                 setDestination(_remote_source);
             } else {
                 _in_buffer.free_back(io::udp::socket::MaxDatagramSize);
+                if (this->_input_lent)
+                    this->return_input();
             }
             return ret;
         }
@@ -0,0 +1,222 @@
+/**
+ * @file qb/system/allocator/huge_pages.h
+ * @brief Page-granular mappings that ask for 2 MiB pages, and fall back when there are none
+ *
+ * `map_pages()` returns anonymous memory aligned and sized for 2 MiB pages: from the
+ * reserved hugetlb pool (`MAP_HUGETLB`), from transparent huge pages (`madvise(MADV_HUGEPAGE)`
+ * on a 2 MiB-aligned mapping), or from ordinary pages. It asks for the best of those the
+ * caller allows and reports what it got; a missing pool or a kernel without THP is a fallback,
+ * not an error. Off Linux every request is served by ordinary pages.
+ *
+ * `page_region` owns one such mapping. The engine uses them for the rings and receive buffer
+ * of a core's mailbox and for large outbound pipes (`CoreInitializer::setHugePages()`).
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - C++ Actor Framework (cpp.actor)
+ * @ingroup Container
+ */
+
+#ifndef QB_SYSTEM_ALLOCATOR_HUGE_PAGES_H
+#define QB_SYSTEM_ALLOCATOR_HUGE_PAGES_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__linux__) || defined(__APPLE__) || defined(unix) || defined(__unix) || defined(__unix__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define QB_HUGE_PAGES_MMAP 1
+#endif
+
+namespace qb::allocator {
+
+/// The page size huge mappings are aligned and rounded to: x86-64 and arm64 (4 KiB granule) PMD size.
+constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+/**
+ * @enum page_kind
+ * @brief What backs a mapping, in increasing order of preference.
+ */
+enum class page_kind : std::uint8_t {
+    normal,      ///< Base pages (4 KiB on x86-64).
+    transparent, ///< Advised `MADV_HUGEPAGE`: the kernel backs it with 2 MiB pages when it can.
+    hugetlb      ///< Taken from the reserved pool (`vm.nr_hugepages`); never swapped or split.
+};
+
+/// Human-readable name of @p kind: "normal", "transparent" or "hugetlb".
+[[nodiscard]] inline char const *
+to_string(page_kind const kind) noexcept {
+    switch (kind) {
+        case page_kind::hugetlb:
+            return "hugetlb";
+        case page_kind::transparent:
+            return "transparent";
+        default:
+            return "normal";
+    }
+}
+
+/// Length of the mapping `map_pages(bytes, want)` makes: whole 2 MiB pages unless @p want is `normal`.
+[[nodiscard]] inline std::size_t
+mapping_size(std::size_t const bytes, page_kind const want) noexcept {
+    constexpr std::size_t base_page = 4096;
+    const std::size_t     unit      = want == page_kind::normal ? base_page : huge_page_size;
+    return (bytes + unit - 1) / unit * unit;
+}
+
+/**
+ * @brief Map @p bytes of zeroed, read-write anonymous memory, backed by @p want pages if possible
+ * @param bytes Size requested; the mapping is `mapping_size(bytes, want)` long
+ * @param want  Best kind to try: `hugetlb` falls back to `transparent`, which falls back to `normal`
+ * @param got   If not null, receives the kind actually obtained
+ * @return The mapping, or `nullptr` if not even base pages could be mapped. Release it with
+ *         `unmap_pages(addr, bytes, want)`, passing the same @p bytes and @p want.
+ */
+[[nodiscard]] inline void *
+map_pages(std::size_t const bytes, page_kind const want, page_kind *const got = nullptr) noexcept {
+    if (!bytes)
+        return nullptr;
+    const auto length = mapping_size(bytes, want);
+    auto       report = [got](void *addr, page_kind const kind) {
+        if (got)
+            *got = kind;
+        return addr;
+    };
+#if defined(QB_HUGE_PAGES_MMAP)
+    constexpr int prot  = PROT_READ | PROT_WRITE;
+    constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_HUGETLB)
+    if (want == page_kind::hugetlb) {
+        int hugetlb = flags | MAP_HUGETLB;
+#if defined(MAP_HUGE_2MB)
+        hugetlb |= MAP_HUGE_2MB; // not the pool's default size, which may be 1 GiB
+#endif
+        if (void *addr = ::mmap(nullptr, length, prot, hugetlb, -1, 0); addr != MAP_FAILED)
+            return report(addr, page_kind::hugetlb);
+    }
+#endif
+    if (want == page_kind::normal) {
+        void *addr = ::mmap(nullptr, length, prot, flags, -1, 0);
+        return addr == MAP_FAILED ? nullptr : report(addr, page_kind::normal);
+    }
+    // THP only backs 2 MiB-aligned ranges: over-map by one page, then trim both ends.
+    void *raw = ::mmap(nullptr, length + huge_page_size, prot, flags, -1, 0);
+    if (raw == MAP_FAILED)
+        return nullptr;
+    const auto base    = reinterpret_cast<std::uintptr_t>(raw);
+    const auto aligned = (base + huge_page_size - 1) & ~(std::uintptr_t{huge_page_size} - 1);
+    if (aligned != base)
+        ::munmap(raw, aligned - base);
+    if (const auto tail = base + length + huge_page_size - (aligned + length))
+        ::munmap(reinterpret_cast<void *>(aligned + length), tail);
+    auto *addr = reinterpret_cast<void *>(aligned);
+#if defined(MADV_HUGEPAGE)
+    if (::madvise(addr, length, MADV_HUGEPAGE) == 0)
+        return report(addr, page_kind::transparent);
+#endif
+    return report(addr, page_kind::normal);
+#else
+    void *addr = ::operator new(length, std::align_val_t{want == page_kind::normal ? 4096 : huge_page_size}, std::nothrow);
+    if (addr)
+        std::memset(addr, 0, length);
+    return addr ? report(addr, page_kind::normal) : nullptr;
+#endif
+}
+
+/// Release a mapping made by `map_pages(bytes, want)`. Null is a no-op.
+inline void
+unmap_pages(void *const addr, std::size_t const bytes, page_kind const want) noexcept {
+    if (!addr)
+        return;
+#if defined(QB_HUGE_PAGES_MMAP)
+    ::munmap(addr, mapping_size(bytes, want));
+#else
+    ::operator delete(addr, std::align_val_t{want == page_kind::normal ? 4096 : huge_page_size});
+#endif
+}
+
+/**
+ * @class page_region
+ * @brief Owns one `map_pages()` mapping. Move-only; an empty region owns nothing.
+ *
+ * @code
+ * qb::allocator::page_region region(rings * ring_bytes, qb::allocator::page_kind::hugetlb);
+ * if (region.kind() != qb::allocator::page_kind::hugetlb)
+ *     ; // the pool was empty: THP or base pages, still usable
+ * auto *buckets = region.as<EventBucket>();
+ * @endcode
+ */
+class page_region {
+    void       *_data  = nullptr;
+    std::size_t _bytes = 0;
+    page_kind   _want  = page_kind::normal;
+    page_kind   _kind  = page_kind::normal;
+
+public:
+    page_region() noexcept = default;
+
+    /// Map @p bytes as `map_pages(bytes, want)` does; empty if that fails.
+    page_region(std::size_t const bytes, page_kind const want) noexcept
+        : _want(want) {
+        _data  = map_pages(bytes, want, &_kind);
+        _bytes = _data ? bytes : 0;
+    }
+
+    page_region(page_region &&rhs) noexcept
+        : _data(std::exchange(rhs._data, nullptr))
+        , _bytes(std::exchange(rhs._bytes, 0))
+        , _want(rhs._want)
+        , _kind(rhs._kind) {}
+
+    page_region &
+    operator=(page_region &&rhs) noexcept {
+        if (this != &rhs) {
+            unmap_pages(_data, _bytes, _want);
+            _data  = std::exchange(rhs._data, nullptr);
+            _bytes = std::exchange(rhs._bytes, 0);
+            _want  = rhs._want;
+            _kind  = rhs._kind;
+        }
+        return *this;
+    }
+
+    ~page_region() noexcept {
+        unmap_pages(_data, _bytes, _want);
+    }
+
+    /// Start of the mapping, aligned to at least a base page.
+    [[nodiscard]] void *
+    data() const noexcept {
+        return _data;
+    }
+
+    /// The mapping as an array of @p T.
+    template <typename T>
+    [[nodiscard]] T *
+    as() const noexcept {
+        return static_cast<T *>(_data);
+    }
+
+    /// Bytes requested; the mapping itself is rounded up to whole pages.
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        return _bytes;
+    }
+
+    /// The pages actually backing the region (`normal` when empty).
+    [[nodiscard]] page_kind
+    kind() const noexcept {
+        return _kind;
+    }
+
+    explicit
+    operator bool() const noexcept {
+        return _data != nullptr;
+    }
+};
+
+} // namespace qb::allocator
+
+#endif // QB_SYSTEM_ALLOCATOR_HUGE_PAGES_H
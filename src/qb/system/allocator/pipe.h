@@ -19,6 +19,7 @@
 #include <memory>
 #include <new>
 #include <qb/string.h>
+#include <qb/system/allocator/huge_pages.h>
 #include <qb/utility/branch_hints.h>
 #include <qb/utility/nocopy.h>
 #include <qb/utility/prefix.h>
@@ -62,10 +63,34 @@ protected:
     std::size_t _begin;      /**< Index of first valid element */
     std::size_t _end;        /**< Index just after the last valid element */
     bool        _flag_front; /**< Indicates if the last allocation was at the beginning */
+    bool        _huge_pages; /**< Grow into transparent huge pages once past one (`huge_pages()`) */
+    bool        _huge_data;  /**< `_data` came from `map_pages()` rather than the allocator */
     std::size_t _capacity;   /**< Total buffer capacity */
     std::size_t _factor;     /**< Buffer expansion factor */
     T          *_data;       /**< Buffer data */
 
+    /// Storage for @p n elements: huge pages if enabled and @p n fills one, else the allocator.
+    T *
+    acquire(std::size_t const n) {
+        _huge_data = false;
+        if (unlikely(_huge_pages) && n * sizeof(T) >= huge_page_size) {
+            if (auto *const mapped = map_pages(n * sizeof(T), page_kind::transparent)) {
+                _huge_data = true;
+                return static_cast<T *>(mapped);
+            }
+        }
+        return base_type::allocate(n);
+    }
+
+    /// Give back storage of @p n elements obtained by `acquire()`; @p huge is `_huge_data` at the time.
+    void
+    release(T *const data, std::size_t const n, bool const huge) noexcept {
+        if (huge)
+            unmap_pages(data, n * sizeof(T), page_kind::transparent);
+        else
+            base_type::deallocate(data, n);
+    }
+
 public:
     /**
      * @brief Default constructor
@@ -76,6 +101,8 @@ public:
         : _begin(0)
         , _end(0)
         , _flag_front(false)
+        , _huge_pages(false)
+        , _huge_data(false)
         , _capacity(_SIZE)
         , _factor(1)
         , _data(base_type::allocate(_SIZE)) {}
@@ -92,6 +119,8 @@ public:
         , _begin(0)
         , _end(0)
         , _flag_front(false)
+        , _huge_pages(false)
+        , _huge_data(false)
         , _capacity(0)
         , _factor(1)
         , _data(nullptr) {
@@ -114,11 +143,14 @@ public:
         , _begin(rhs._begin)
         , _end(rhs._end)
         , _flag_front(rhs._flag_front)
+        , _huge_pages(rhs._huge_pages)
+        , _huge_data(rhs._huge_data)
         , _capacity(rhs._capacity)
         , _factor(rhs._factor)
         , _data(rhs._data) {
         rhs._begin = rhs._end = 0;
         rhs._flag_front       = false;
+        rhs._huge_data        = false;
         rhs._capacity         = 0;
         rhs._factor           = 1;
         rhs._data             = nullptr;
@@ -150,15 +182,18 @@ public:
         // _capacity == 0): std::allocator::deallocate requires a pointer that
         // came from allocate(). The destructor already guards the same way.
         if (_capacity)
-            base_type::deallocate(_data, _capacity);
+            release(_data, _capacity, _huge_data);
         _begin      = rhs._begin;
         _end        = rhs._end;
         _flag_front = rhs._flag_front;
+        _huge_pages = rhs._huge_pages;
+        _huge_data  = rhs._huge_data;
         _capacity   = rhs._capacity;
         _factor     = rhs._factor;
         _data       = rhs._data;
         rhs._begin = rhs._end = 0;
         rhs._flag_front       = false;
+        rhs._huge_data        = false;
         rhs._capacity         = 0;
         rhs._factor           = 1;
         rhs._data             = nullptr;
@@ -172,7 +207,29 @@ public:
      */
     ~base_pipe() {
         if (_capacity)
-            base_type::deallocate(_data, _capacity);
+            release(_data, _capacity, _huge_data);
+    }
+
+    /**
+     * @brief Back every later growth to at least one huge page with transparent huge pages
+     *
+     * A buffer of `huge_page_size` bytes or more is then mapped 2 MiB-aligned and advised
+     * `MADV_HUGEPAGE` (`qb::allocator::map_pages`); smaller ones stay on the allocator, where a
+     * huge page would mostly go unused. The current buffer is left where it is.
+     *
+     * @param enable Whether growth may use huge pages
+     */
+    inline void
+    huge_pages(bool const enable) noexcept {
+        _huge_pages = enable;
+    }
+
+    /**
+     * @brief Whether growth may use huge pages (see `huge_pages(bool)`)
+     */
+    [[nodiscard]] inline bool
+    huge_pages() const noexcept {
+        return _huge_pages;
     }
 
     /**
@@ -377,11 +434,12 @@ public:
             if (unlikely(new_capacity <= nb_item || nb_item + size > new_capacity))
                 throw std::bad_alloc();
 
-            const auto new_data = base_type::allocate(new_capacity);
+            const bool old_huge = _huge_data;
+            const auto new_data = acquire(new_capacity);
             if (nb_item > 0)
                 std::memcpy(new_data, _data + _begin, nb_item * sizeof(T));
             if (_capacity)
-                base_type::deallocate(_data, _capacity);
+                release(_data, _capacity, old_huge);
 
             _begin    = 0;
             _end      = nb_item + size;
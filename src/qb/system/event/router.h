@@ -9,6 +9,7 @@
  * - Single-Event Multiple-Handler (SEMH) for one-to-many distribution
  * - Multiple-Event Single-Handler (MESH) for many-to-one handling
  * - Multiple-Event Multiple-Handler (MEMH) for fully dynamic event routing
+ * - Dense MEMH (`dense_memh`), the MEMH contract over flat ordinal × slot tables
  *
  * @author qb - C++ Actor Framework
  * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
@@ -29,8 +30,10 @@
 #ifndef QB_EVENT_ROUTER_H
 #define QB_EVENT_ROUTER_H
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <vector>
 #include <qb/system/container/unordered_map.h>
 #include <qb/utility/abi.h> /* QB_ABI_ANCHOR */
@@ -1005,6 +1008,303 @@ ensure_disposer() noexcept {
     }
 }
 
+/**
+ * @brief Multiple-Event Multiple-Handler router over dense tables (drop-in for `memh<_RawEvent>`)
+ *
+ * Same contract as the heterogeneous `memh` — `route(event, onError)`, `dispose`, `subscribe<E>`,
+ * `unsubscribe<E>(h)`, `unsubscribe(h)`, `unsubscribe(id)` — with none of its per-event hashing.
+ *
+ * @tparam _RawEvent The raw event base type. Its `id_type` must be an unsigned integer that is
+ *         small and dense (qb's `EventId` comes from the `type_id_for<T>()` counter), and its
+ *         `id_handler_type` must expose `sid()`, the per-core dense slot of the handler.
+ * @tparam _CleanEvent Whether to clean up events after routing
+ *
+ * @details
+ * `memh::route` costs, per event: one hash lookup of the event id, one virtual
+ * `IEventResolver::resolve`, then a second hash lookup of the destination `ActorId` in the
+ * resolver's `semh` before the trampoline. On a core doing millions of events a second that
+ * double hash plus indirect call is the single largest item of the receive path.
+ *
+ * Both keys are already dense, so neither needs hashing:
+ *  - the event id is a process-wide counter value; `_ordinals[id]` maps it to a compact per-router
+ *    ordinal (`0` = not subscribed here), so the table only grows with the types this core
+ *    actually handles, not with every type the program ever registered;
+ *  - the destination's `sid()` is handed out by the core's `ServiceIdPool` bitset, lowest first.
+ *
+ * Routing is therefore `_rows[ordinal - 1].slots[sid]` → `{handler, trampoline}` → one direct
+ * call. Each row is a flat vector sized to the highest SID subscribed to that type, so memory is
+ * (types handled × highest SID) × 16 bytes; the default events every actor registers make a few
+ * rows as long as the actor population, which is the same order as the hash buckets they replace.
+ *
+ * The per-type release (`internal::EventPolicy::dispose` semantics: destroy a non-trivial payload
+ * once it is no longer `alive`) is a typed function pointer stored in the row — `nullptr` for a
+ * trivially destructible type, so the common case pays a predicted branch, not a call.
+ *
+ * **Slot identity.** A slot is keyed by `sid()` alone, so every handler subscribed to one router
+ * must live on the same core — which is the only way `VirtualCore` uses it. The destination's
+ * core index is not re-checked on the hot path: the engine only ever routes events addressed to
+ * its own core into its own router.
+ *
+ * **Re-entrancy.** A handler may subscribe (spawn an actor) or unsubscribe while being dispatched.
+ * Either can reallocate `_rows` or a row, so `route()` copies the entry and the release pointer
+ * into locals BEFORE the call and never touches the tables after it. Broadcast snapshots its
+ * targets first, exactly like `semh` (see the comment there).
+ *
+ * **Unknown types** take the `onError` branch and are freed through the same process-wide disposer
+ * registry as `memh` (`_fallback`, with its per-router memo), so `ensure_disposer<>()` keeps
+ * covering events that were enqueued but never subscribed on this core.
+ */
+template <typename _RawEvent, bool _CleanEvent = true>
+class dense_memh {
+public:
+    using _EventId   = typename _RawEvent::id_type;
+    using _HandlerId = typename _RawEvent::id_handler_type;
+
+    static_assert(std::is_integral_v<_EventId> && std::is_unsigned_v<_EventId>,
+                  "dense_memh indexes by event id: id_type must be a dense unsigned integer");
+
+private:
+    using Trampoline = void (*)(void *, _RawEvent &) noexcept;
+    using Release    = void (*)(_RawEvent &) noexcept;
+    using Ordinal    = std::uint16_t;
+
+    struct Entry {
+        void      *handler  = nullptr;
+        Trampoline dispatch = nullptr;
+    };
+
+    struct Row {
+        std::vector<Entry> slots;
+        Release            release = nullptr;
+    };
+
+    /**
+     * @brief Typed trampoline: recasts both the handler and the event, honouring `has_is_alive`.
+     */
+    template <typename _Event, typename _Handler>
+    static void
+    dispatch_trampoline(void *opaque_handler, _RawEvent &raw) noexcept {
+        auto &handler = *static_cast<_Handler *>(opaque_handler);
+        auto &event   = reinterpret_cast<_Event &>(raw);
+        if constexpr (qb::has_is_alive<_Event>) {
+            if (handler.is_alive())
+                handler.on(event);
+        } else {
+            handler.on(event);
+        }
+    }
+
+    /**
+     * @brief Typed post-route release, the `internal::EventPolicy::dispose` rule for one type.
+     */
+    template <typename _Event>
+    static void
+    release_trampoline(_RawEvent &raw) noexcept {
+        using _Clean = std::remove_const_t<_Event>;
+        auto &event  = reinterpret_cast<_Clean &>(raw);
+        if constexpr (qb::has_is_alive<_Clean>) {
+            if (!event.is_alive())
+                event.~_Clean();
+        } else
+            event.~_Clean();
+    }
+
+    template <typename _Handler>
+    [[nodiscard]] static std::size_t
+    slot_of(_Handler const &handler) noexcept {
+        return static_cast<std::size_t>(handler.id().sid());
+    }
+
+    /**
+     * @brief Row for @p id, or `nullptr` when this router has no subscription of that type.
+     */
+    [[nodiscard]] Row *
+    find_row(_EventId const id) const noexcept {
+        const auto index = static_cast<std::size_t>(id);
+        if (unlikely(index >= _ordinals.size()))
+            return nullptr;
+        const Ordinal ordinal = _ordinals[index];
+        return likely(ordinal != 0) ? &_rows[ordinal - 1] : nullptr;
+    }
+
+    template <typename _Event>
+    Row &
+    acquire_row() {
+        const auto index = static_cast<std::size_t>(_RawEvent::template type_to_id<_Event>());
+        if (index >= _ordinals.size())
+            _ordinals.resize(index + 1, Ordinal{0});
+        if (_ordinals[index] == 0) {
+            auto &row = _rows.emplace_back();
+            if constexpr (_CleanEvent && !std::is_trivially_destructible_v<std::remove_const_t<_Event>>)
+                row.release = &release_trampoline<_Event>;
+            _ordinals[index] = static_cast<Ordinal>(_rows.size());
+        }
+        return _rows[_ordinals[index] - 1];
+    }
+
+    std::vector<Ordinal> _ordinals;
+    /// `mutable` for the same reason `memh`'s resolvers are reached through pointers: the
+    /// `unsubscribe` family is `const` in the MEMH contract (`VirtualCore::unregisterEvents`).
+    mutable std::vector<Row>           _rows;
+    memh<_RawEvent, _CleanEvent, void> _fallback;
+
+public:
+    dense_memh()           = default;
+    ~dense_memh() noexcept = default;
+
+    /**
+     * @brief Routes an event to the appropriate handlers with error handling
+     *
+     * @tparam _Func Type of the error handling function
+     * @param event The event to route
+     * @param onError Function to call if the event type is not registered
+     */
+    template <typename _Func>
+    void
+    route(_RawEvent &event, _Func const &onError) const {
+        Row *const row = find_row(event.getID());
+        if (unlikely(!row)) {
+            // Same tolerant path as memh: no throw, and free the payload through the shared
+            // disposer registry (memoised per router).
+            _fallback.route(event, onError);
+            return;
+        }
+        const Release release = row->release;
+
+        const auto dest = event.getDestination();
+        if constexpr (qb::has_is_broadcast<_HandlerId>) {
+            if (dest.is_broadcast()) {
+                // See semh::route — handlers may (un)subscribe during a broadcast.
+                static thread_local std::vector<Entry> bcast_snapshot;
+                const std::size_t                      base = bcast_snapshot.size();
+                for (const auto &entry : row->slots) {
+                    if (entry.dispatch)
+                        bcast_snapshot.push_back(entry);
+                }
+                const std::size_t end = bcast_snapshot.size();
+                for (std::size_t i = base; i < end; ++i) {
+                    const auto  dispatch = bcast_snapshot[i].dispatch;
+                    auto *const target   = bcast_snapshot[i].handler;
+                    QB_ASSUME(dispatch != nullptr);
+                    dispatch(target, event);
+                }
+                bcast_snapshot.resize(base);
+
+                if constexpr (_CleanEvent) {
+                    if (release)
+                        release(event);
+                }
+                return;
+            }
+        }
+
+        const auto slot = static_cast<std::size_t>(dest.sid());
+        if (likely(slot < row->slots.size())) {
+            const Entry entry = row->slots[slot];
+            if (likely(entry.dispatch != nullptr))
+                entry.dispatch(entry.handler, event);
+        }
+
+        if constexpr (_CleanEvent) {
+            if (release)
+                release(event);
+        }
+    }
+
+    /**
+     * @brief Hand @p event to the handler its (unicast) destination names, and keep it.
+     * @param event The event to deliver; neither released nor passed to an error hook.
+     * @details For a caller that delivers one payload to several destinations in turn — a
+     *          multicast copy — and disposes it once when done. An unsubscribed type or
+     *          destination is simply skipped.
+     */
+    void
+    deliver(_RawEvent &event) const noexcept {
+        Row *const row = find_row(event.getID());
+        if (unlikely(!row))
+            return;
+        const auto slot = static_cast<std::size_t>(event.getDestination().sid());
+        if (likely(slot < row->slots.size())) {
+            const Entry entry = row->slots[slot];
+            if (likely(entry.dispatch != nullptr))
+                entry.dispatch(entry.handler, event);
+        }
+    }
+
+    /**
+     * @brief Destroy the payload of an event that will NOT be routed.
+     * @param event The event whose (possibly non-trivial) members must be destroyed.
+     * @details Unconditional destruction, same as `memh::dispose` — see there for the callers.
+     */
+    void
+    dispose(_RawEvent &event) const {
+        _fallback.dispose(event);
+    }
+
+    /**
+     * @brief Subscribe a handler to events of a specific type
+     *
+     * @tparam _Event The event type to subscribe to
+     * @tparam _Handler The handler type
+     * @param handler The handler to subscribe
+     */
+    template <typename _Event, typename _Handler>
+    QB_ABI_ANCHOR void
+    subscribe(_Handler &handler) {
+        static const typename memh<_RawEvent, _CleanEvent, void>::template SafeDispose<_Event> o{};
+        (void) o;
+
+        auto             &row  = acquire_row<_Event>();
+        const std::size_t slot = slot_of(handler);
+        if (slot >= row.slots.size())
+            row.slots.resize(slot + 1);
+        row.slots[slot] = Entry{static_cast<void *>(&handler), &dispatch_trampoline<_Event, _Handler>};
+    }
+
+    /**
+     * @brief Unsubscribe a handler from events of a specific type
+     *
+     * @tparam _Event The event type to unsubscribe from
+     * @tparam _Handler The handler type
+     * @param handler The handler to unsubscribe
+     */
+    template <typename _Event, typename _Handler>
+    void
+    unsubscribe(_Handler const &handler) const {
+        if (Row *const row = find_row(_RawEvent::template type_to_id<_Event>())) {
+            const std::size_t slot = slot_of(handler);
+            if (slot < row->slots.size())
+                row->slots[slot] = Entry{};
+        }
+    }
+
+    /**
+     * @brief Unsubscribe a handler from all event types
+     *
+     * @tparam _Handler The handler type
+     * @param handler The handler to unsubscribe
+     */
+    template <typename _Handler>
+    void
+    unsubscribe(_Handler const &handler) const {
+        unsubscribe(handler.id());
+    }
+
+    /**
+     * @brief Unsubscribe a handler by ID from all event types
+     *
+     * @param id The ID of the handler to unsubscribe
+     */
+    void
+    unsubscribe(_HandlerId const &id) const {
+        const auto slot = static_cast<std::size_t>(id.sid());
+        for (auto &row : _rows) {
+            if (slot < row.slots.size())
+                row.slots[slot] = Entry{};
+        }
+    }
+};
+
 } // namespace qb::router
 
 #endif // QB_EVENT_ROUTER_H
@@ -467,6 +467,7 @@ class ringbuffer<T, 0> : public internal::ringbuffer<T> {
     // so it must be released with delete[]. A scalar unique_ptr<T> would call
     // scalar delete on an array allocation (alloc/dealloc-size mismatch, UB).
     std::unique_ptr<T[]> array_;
+    T *const             storage_;
 
 public:
     /**
@@ -476,7 +477,38 @@ public:
      */
     explicit ringbuffer(size_t const max_size)
         : max_size_(max_size + 1)
-        , array_(new T[max_size + 1]) {}
+        , array_(new T[max_size + 1])
+        , storage_(array_.get()) {}
+
+    /**
+     * @brief Constructs a ringbuffer on storage it does not own, e.g. a slice of a huge-page region
+     *
+     * @param max_size Maximum number of elements that can be stored
+     * @param storage  At least `max_size + 1` elements, outliving the ring; if null the ring
+     *                 allocates its own
+     */
+    ringbuffer(size_t const max_size, T *const storage)
+        : max_size_(max_size + 1)
+        , array_(storage ? nullptr : new T[max_size + 1])
+        , storage_(storage ? storage : array_.get()) {}
+
+    /**
+     * @brief The ring's storage, e.g. to place its pages (`qb::CpuTopology::bindMemory`)
+     *
+     * @return Pointer to `storage_size()` elements
+     */
+    [[nodiscard]] T *
+    data() noexcept {
+        return storage_;
+    }
+
+    /**
+     * @brief Number of elements of storage: the capacity plus the slot that tells full from empty
+     */
+    [[nodiscard]] size_t
+    storage_size() const noexcept {
+        return max_size_;
+    }
 
     /**
      * @brief Enqueue a single element into the buffer
@@ -486,7 +518,7 @@ public:
      */
     inline bool
     enqueue(T const &t) noexcept {
-        return internal::ringbuffer<T>::enqueue(t, array_.get(), max_size_);
+        return internal::ringbuffer<T>::enqueue(t, storage_, max_size_);
     }
 
     /**
@@ -497,7 +529,7 @@ public:
      */
     inline bool
     dequeue(T *ret) noexcept {
-        return internal::ringbuffer<T>::dequeue(ret, 1, array_.get(), max_size_);
+        return internal::ringbuffer<T>::dequeue(ret, 1, storage_, max_size_);
     }
 
     /**
@@ -511,7 +543,7 @@ public:
     template <bool _All = true>
     inline size_t
     enqueue(T const *t, size_t size) noexcept {
-        return internal::ringbuffer<T>::template enqueue<_All>(t, size, array_.get(), max_size_);
+        return internal::ringbuffer<T>::template enqueue<_All>(t, size, storage_, max_size_);
     }
 
     /**
@@ -523,7 +555,7 @@ public:
      */
     inline size_t
     dequeue(T *ret, size_t size) noexcept {
-        return internal::ringbuffer<T>::dequeue(ret, size, array_.get(), max_size_);
+        return internal::ringbuffer<T>::dequeue(ret, size, storage_, max_size_);
     }
 
     /**
@@ -538,7 +570,7 @@ public:
     template <typename Func>
     inline size_t
     dequeue(Func const &func, T *ret, size_t size) noexcept {
-        const size_t nb_consume = internal::ringbuffer<T>::dequeue(ret, size, array_.get(), max_size_);
+        const size_t nb_consume = internal::ringbuffer<T>::dequeue(ret, size, storage_, max_size_);
         if (nb_consume)
             func(ret, nb_consume);
         return nb_consume;
@@ -554,7 +586,7 @@ public:
     template <typename Func>
     inline size_t
     consume_all(Func const &func) noexcept {
-        return internal::ringbuffer<T>::consume_all(func, array_.get(), max_size_);
+        return internal::ringbuffer<T>::consume_all(func, storage_, max_size_);
     }
 };
 
@@ -0,0 +1,199 @@
+/**
+ * @file qb/system/lockfree/work_stealing_deque.h
+ * @brief Chase-Lev work-stealing deque: one owner at the bottom, any number of thieves at the top.
+ *
+ * The owner thread pushes and pops at the bottom (LIFO, no atomic read-modify-write unless it
+ * races a thief for the last item); other threads steal from the top (FIFO, one CAS). The ring
+ * grows by doubling when the owner finds it full; the arrays it outgrew are kept until the deque
+ * is destroyed, since a thief may still be reading one. Memory orders follow Lê, Pop, Cohen and
+ * Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup LockFree
+ */
+
+#ifndef QB_LOCKFREE_WORK_STEALING_DEQUE_H
+#define QB_LOCKFREE_WORK_STEALING_DEQUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <qb/utility/nocopy.h>
+#include <qb/utility/prefix.h>
+
+namespace qb::lockfree {
+
+/**
+ * @brief Growable Chase-Lev work-stealing deque.
+ *
+ * - push() / pop() / reserve(): the owner thread only.
+ * - steal(): any thread, including the owner.
+ * - empty() / size(): approximate from any thread; exact for the owner while no thief runs.
+ *
+ * @tparam T Trivially copyable element, typically a pointer: a slot may be read by a thief
+ *           that then loses the race for it, so elements are copied, never moved out.
+ */
+template <typename T>
+class work_stealing_deque : public nocopy {
+    static_assert(std::is_trivially_copyable_v<T>, "work_stealing_deque stores trivially copyable elements");
+
+    struct ring {
+        const std::int64_t                mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit ring(std::int64_t const capacity)
+            : mask(capacity - 1)
+            , slots(new std::atomic<T>[static_cast<std::size_t>(capacity)]) {}
+
+        [[nodiscard]] std::int64_t
+        capacity() const noexcept {
+            return mask + 1;
+        }
+        [[nodiscard]] T
+        get(std::int64_t const index) const noexcept {
+            return slots[static_cast<std::size_t>(index & mask)].load(std::memory_order_relaxed);
+        }
+        void
+        put(std::int64_t const index, T const value) noexcept {
+            slots[static_cast<std::size_t>(index & mask)].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    // Thieves hammer `_top`, the owner `_bottom`: one line each.
+    alignas(QB_LOCKFREE_CACHELINE_BYTES) std::atomic<std::int64_t> _top{0};
+    alignas(QB_LOCKFREE_CACHELINE_BYTES) std::atomic<std::int64_t> _bottom{0};
+    std::atomic<ring *>                                            _ring;
+    // Owner only: every ring ever installed, the live one last.
+    std::vector<std::unique_ptr<ring>> _rings;
+
+    ring *
+    grow(ring *const from, std::int64_t const bottom, std::int64_t const top) {
+        auto next = std::make_unique<ring>(from->capacity() * 2);
+        for (auto i = top; i < bottom; ++i)
+            next->put(i, from->get(i));
+        auto *const installed = next.get();
+        _rings.push_back(std::move(next));
+        _ring.store(installed, std::memory_order_release);
+        return installed;
+    }
+
+public:
+    /// @param capacity Initial slot count, rounded up to a power of two (at least 2).
+    explicit work_stealing_deque(std::size_t const capacity = 256) {
+        _rings.push_back(std::make_unique<ring>(static_cast<std::int64_t>(std::bit_ceil((std::max)(capacity, std::size_t{2})))));
+        _ring.store(_rings.back().get(), std::memory_order_relaxed);
+    }
+
+    /** @brief Owner: append @p value at the bottom, growing the ring if it is full. */
+    void
+    push(T const value) {
+        const auto b = _bottom.load(std::memory_order_relaxed);
+        const auto t = _top.load(std::memory_order_acquire);
+        auto      *a = _ring.load(std::memory_order_relaxed);
+        if (b - t > a->capacity() - 1)
+            a = grow(a, b, t);
+        a->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Owner: grow now so the next @p count push() calls do not allocate.
+     * @details Throws what push() would (`std::bad_alloc`), before anything is queued.
+     */
+    void
+    reserve(std::size_t const count) {
+        const auto b = _bottom.load(std::memory_order_relaxed);
+        const auto t = _top.load(std::memory_order_acquire);
+        auto      *a = _ring.load(std::memory_order_relaxed);
+        while (b - t + static_cast<std::int64_t>(count) > a->capacity())
+            a = grow(a, b, t);
+    }
+
+    /**
+     * @brief Owner: take the most recently pushed element.
+     * @return false if the deque was empty, or a thief took its last element first.
+     */
+    bool
+    pop(T &out) noexcept {
+        const auto  b = _bottom.load(std::memory_order_relaxed) - 1;
+        auto *const a = _ring.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = _top.load(std::memory_order_relaxed);
+        if (t > b) {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        const T value = a->get(b);
+        if (t == b) {
+            // Last element: settle the race with the thieves on `_top`.
+            const bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won)
+                return false;
+        }
+        out = value;
+        return true;
+    }
+
+    /**
+     * @brief Any thread: take the oldest element.
+     * @return false if the deque was empty or another thread won the element; the caller may retry.
+     */
+    bool
+    steal(T &out) noexcept {
+        auto t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto b = _bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return false;
+        // Acquire pairs with the release store in grow(): the slots of a newer ring are visible.
+        const T value = _ring.load(std::memory_order_acquire)->get(t);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return false;
+        out = value;
+        return true;
+    }
+
+    /** @brief Approximate element count; never negative. */
+    [[nodiscard]] std::size_t
+    size() const noexcept {
+        const auto b = _bottom.load(std::memory_order_relaxed);
+        const auto t = _top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0u;
+    }
+
+    /** @brief Approximate: two relaxed loads, cheap enough to gate every pop or steal attempt. */
+    [[nodiscard]] bool
+    empty() const noexcept {
+        return size() == 0;
+    }
+
+    /** @brief Current slot count of the ring. */
+    [[nodiscard]] std::size_t
+    capacity() const noexcept {
+        return static_cast<std::size_t>(_ring.load(std::memory_order_relaxed)->capacity());
+    }
+};
+
+} // namespace qb::lockfree
+
+#endif // QB_LOCKFREE_WORK_STEALING_DEQUE_H
@@ -803,6 +803,8 @@ QB_DEFINE_METHOD_TRAIT(on);
 QB_DEFINE_METHOD_TRAIT(read);
 QB_DEFINE_METHOD_TRAIT(write);
 QB_DEFINE_METHOD_TRAIT(flush);
+QB_DEFINE_METHOD_TRAIT(writev);
+QB_DEFINE_METHOD_TRAIT(enqueue);
 
 // Bool property traits (function-or-variable)
 QB_DEFINE_PROPERTY_TRAIT(is_alive);
@@ -9,11 +9,14 @@
 
 /**
  * @file benchmark/messaging/broadcast-vs-explicit-fanout.cpp
- * @brief `BroadcastId(core)` vs explicit per-actor `push` at matched total deliveries.
+ * @brief `BroadcastId(core)` vs explicit per-actor `push` vs `EventBatch` vs `multicast` at matched
+ *        total deliveries.
  *
  * All `sinks` sit on `consumer_core`. The producer issues either `waves` broadcast waves (each
- * wave delivers to every sink on that core) or `waves * sinks` explicit `push` calls — tuned so
- * both modes drive the SAME total deliveries (`sinks * waves`). The broadcast case requires
+ * wave delivers to every sink on that core), `waves * sinks` explicit `push` calls, `waves`
+ * `batch<FanoutMsg>(consumer_core, sinks)` batches of one push per sink, or `waves`
+ * `multicast<FanoutMsg>(sinks)` calls (one event per wave) — tuned so every mode drives the SAME
+ * total deliveries (`sinks * waves`). The broadcast case requires
  * `producer_core != consumer_core` so the producer is not itself a recipient of its own broadcast.
  *
  * Delivery-latch design: the original bench coordinated shutdown through two FILE-SCOPE atomics
@@ -72,17 +75,17 @@ public:
     }
 };
 
-enum class FanoutMode : std::uint8_t { Broadcast, Explicit };
+enum class FanoutMode : std::uint8_t { Broadcast, Explicit, Batched, Multicast };
 
 template <FanoutMode Mode>
 class FanoutProducerActor final : public qb::Actor {
-    const qb::CoreId      _broadcast_core;
+    const qb::CoreId      _consumer_core;
     const qb::ActorIdList _ids;
     const std::uint64_t   _waves;
 
 public:
-    FanoutProducerActor(qb::CoreId const broadcast_core, qb::ActorIdList ids, std::uint64_t const waves)
-        : _broadcast_core(broadcast_core)
+    FanoutProducerActor(qb::CoreId const consumer_core, qb::ActorIdList ids, std::uint64_t const waves)
+        : _consumer_core(consumer_core)
         , _ids(std::move(ids))
         , _waves(waves) {}
 
@@ -90,11 +93,20 @@ public:
     onInit() final {
         if constexpr (Mode == FanoutMode::Broadcast) {
             for (std::uint64_t w = 0; w < _waves; ++w)
-                push<FanoutMsg>(qb::BroadcastId(static_cast<std::uint32_t>(_broadcast_core)));
-        } else {
+                push<FanoutMsg>(qb::BroadcastId(static_cast<std::uint32_t>(_consumer_core)));
+        } else if constexpr (Mode == FanoutMode::Explicit) {
             for (std::uint64_t w = 0; w < _waves; ++w)
                 for (auto const &id : _ids)
                     push<FanoutMsg>(id);
+        } else if constexpr (Mode == FanoutMode::Multicast) {
+            for (std::uint64_t w = 0; w < _waves; ++w)
+                multicast<FanoutMsg>(_ids);
+        } else {
+            for (std::uint64_t w = 0; w < _waves; ++w) {
+                auto out = batch<FanoutMsg>(_consumer_core, _ids.size());
+                for (auto const &id : _ids)
+                    out.push(id);
+            }
         }
         kill();
         co_return true;
@@ -117,7 +129,7 @@ build_fanout(qb::Main &main, std::uint32_t const n, std::uint64_t const waves, s
     if constexpr (Mode == FanoutMode::Broadcast)
         main.addActor<FanoutProducerActor<FanoutMode::Broadcast>>(producer_c, bcore, qb::ActorIdList{}, waves);
     else
-        main.addActor<FanoutProducerActor<FanoutMode::Explicit>>(producer_c, bcore, ids, waves);
+        main.addActor<FanoutProducerActor<Mode>>(producer_c, bcore, ids, waves);
 }
 
 template <FanoutMode Mode>
@@ -208,5 +220,15 @@ BENCHMARK_TEMPLATE(BM_Fanout_Deliveries, FanoutMode::Explicit)
     ->ArgNames({"sinks", "waves", "producer_core", "consumer_core"})
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Fanout_Deliveries, FanoutMode::Batched)
+    ->Apply(ApplyFanoutExplicitArgs)
+    ->ArgNames({"sinks", "waves", "producer_core", "consumer_core"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Fanout_Deliveries, FanoutMode::Multicast)
+    ->Apply(ApplyFanoutExplicitArgs)
+    ->ArgNames({"sinks", "waves", "producer_core", "consumer_core"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
 
 BENCHMARK_MAIN();
@@ -0,0 +1,225 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/messaging/idle-policy-sweep.cpp
+ * @brief Latency against CPU for each `qb::IdlePolicy`, on sparse ping-pong and on bursts.
+ *
+ * Both cores run with a 10 ms latency and `IdleWait::EventLoop`, so every policy may park and a
+ * parked core is woken by its doorbell or its own timers. Traffic is paced by timers so the cores
+ * are idle between messages, which is where the policies differ:
+ *   - `WORK=0` ping-pong — core 0 sends one ping every `kPingGap`, the far core replies; each
+ *     sample is one round trip;
+ *   - `WORK=1` bursts — core 0 sends `kBurst` events back to back every `kBurstGap`; each sample
+ *     is one event's send-to-handler delay on the far core.
+ * `POLICY` is 0 credit, 1 dedicated, 2 adaptive, 3 power saver.
+ *
+ * Counters: `p50_us`, `p99_us` of the samples (last iteration) and `cpu_cores`, the process CPU
+ * time over the wall time of the run (2.0 = both cores fully busy).
+ *
+ * Benchmark methodology: placement is hoisted out of the timed region (`PauseTiming()`);
+ * `start(true)` + `join()` is timed under `UseRealTime()`; counters are assigned once.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/io/async.h>
+#include <qb/main.h>
+
+#include "../../shared/BenchmarkCores.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::uint32_t kPings    = 2000;
+constexpr auto          kPingGap  = 200us;
+constexpr std::uint32_t kBursts   = 200;
+constexpr std::uint32_t kBurst    = 64;
+constexpr auto          kBurstGap = 2ms;
+constexpr auto          kLatency  = 10ms;
+
+std::vector<std::uint64_t> g_samples_ns;
+
+struct Stamped : qb::Event {
+    std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+};
+
+std::uint64_t
+since(std::chrono::steady_clock::time_point const sent) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sent).count());
+}
+
+class Ponger final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Stamped>(*this);
+        co_return true;
+    }
+    void
+    on(Stamped &event) {
+        reply(event);
+    }
+};
+
+class Pinger final : public qb::Actor {
+    const qb::ActorId _ponger;
+    std::uint32_t     _pongs = 0;
+
+public:
+    explicit Pinger(qb::ActorId ponger)
+        : _ponger(ponger) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Stamped>(*this);
+        push<Stamped>(_ponger);
+        co_return true;
+    }
+    void
+    on(Stamped const &event) {
+        g_samples_ns.push_back(since(event.sent));
+        if (++_pongs < kPings) {
+            qb::io::async::callback([this] { push<Stamped>(_ponger); }, kPingGap);
+            return;
+        }
+        push<qb::KillEvent>(_ponger);
+        kill();
+    }
+};
+
+class Sink final : public qb::Actor {
+    std::uint32_t _received = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Stamped>(*this);
+        co_return true;
+    }
+    void
+    on(Stamped const &event) {
+        g_samples_ns.push_back(since(event.sent)); // single writer: the far core
+        if (++_received == kBursts * kBurst)
+            kill();
+    }
+};
+
+class Burster final : public qb::Actor {
+    const qb::ActorId _sink;
+    std::uint32_t     _bursts = 0;
+
+    void
+    burst() {
+        for (std::uint32_t i = 0; i < kBurst; ++i)
+            push<Stamped>(_sink);
+        if (++_bursts < kBursts)
+            qb::io::async::callback([this] { burst(); }, kBurstGap);
+        else
+            kill();
+    }
+
+public:
+    explicit Burster(qb::ActorId sink)
+        : _sink(sink) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        burst();
+        co_return true;
+    }
+};
+
+qb::IdlePolicy
+policy_of(std::int64_t const index) {
+    switch (index) {
+        case 1:
+            return qb::IdlePolicy::dedicated();
+        case 2:
+            return qb::IdlePolicy::adaptive();
+        case 3:
+            return qb::IdlePolicy::power_saver();
+        default:
+            return qb::IdlePolicy::credit();
+    }
+}
+
+double
+process_cpu_seconds() {
+    timespec ts{};
+    ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+double
+percentile_us(std::vector<std::uint64_t> samples, double const q) {
+    const auto nth = static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(nth), samples.end());
+    return static_cast<double>(samples[nth]) / 1000.0;
+}
+
+void
+BM_IdlePolicySweep(benchmark::State &state) {
+    const auto cap = qb::bench::cappedBenchmarkCores();
+    if (cap < 2u) {
+        state.SkipWithError("requires-multicore: the sweep needs an idle far core");
+        return;
+    }
+    const auto policy   = policy_of(state.range(0));
+    const bool bursty   = state.range(1) != 0;
+    const auto far      = static_cast<qb::CoreId>(cap - 1u);
+    const auto expected = bursty ? kBursts * kBurst : kPings;
+
+    double cpu_s  = 0.;
+    double wall_s = 0.;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g_samples_ns.clear();
+        g_samples_ns.reserve(expected);
+        qb::Main main;
+        for (const auto core : {qb::CoreId{0}, far})
+            main.core(core).setLatency(kLatency).setIdleWait(qb::IdleWait::EventLoop).setIdlePolicy(policy);
+        if (bursty)
+            main.addActor<Burster>(0, main.addActor<Sink>(far));
+        else
+            main.addActor<Pinger>(0, main.addActor<Ponger>(far));
+        state.ResumeTiming();
+
+        const auto cpu_start  = process_cpu_seconds();
+        const auto wall_start = std::chrono::steady_clock::now();
+        main.start(true);
+        main.join();
+        wall_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+        cpu_s += process_cpu_seconds() - cpu_start;
+
+        if (g_samples_ns.size() != expected) {
+            state.SkipWithError("a sample was lost");
+            return;
+        }
+    }
+
+    state.counters["p50_us"]    = percentile_us(g_samples_ns, 0.50);
+    state.counters["p99_us"]    = percentile_us(g_samples_ns, 0.99);
+    state.counters["cpu_cores"] = wall_s > 0. ? cpu_s / wall_s : 0.;
+}
+
+} // namespace
+
+BENCHMARK(BM_IdlePolicySweep)
+    ->ArgsProduct({{0, 1, 2, 3}, {0, 1}})
+    ->ArgNames({"POLICY", "WORK"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,187 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/messaging/large-event-transfer.cpp
+ * @brief One-way cross-core stream of multi-KB frames: slab-carried `push` vs by-value `send`.
+ *
+ * A producer on core 0 streams `kFrames` frames of `Bytes` payload to a consumer on the far core
+ * (`cappedBenchmarkCores() - 1`). The consumer reads every payload word (a market-data handler
+ * touches the whole frame) and returns one credit per `kWindow` frames; the producer keeps at
+ * most two windows in flight, so neither pipe nor ring grows without bound and both variants
+ * move the same frames through the same flow control.
+ *
+ *   - `PATH=0` — `push`: a frame of at least `kSharedEventMinBuckets` buckets is built in core 0's
+ *     `SharedSlab`, only its descriptor crosses the mailbox ring, the consumer reads it in place
+ *     and releases the block back to core 0.
+ *   - `PATH=1` — `send`: the frame travels by value, pipe → ring → receive buffer, as every event
+ *     did before the slab path. 256 B frames take this path under `push` too (below threshold).
+ *
+ * Counters: `frames_per_s`, and `bytes_per_s` (payload only) via `SetBytesProcessed`. Guard: the
+ * consumer's checksum must match the producer's, else SkipWithError.
+ *
+ * Benchmark methodology: placement is hoisted out of the timed region (`PauseTiming()`);
+ * `start(true)` + `join()` is timed under `UseRealTime()`; counters are assigned once.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+#include "../../shared/BenchmarkCores.h"
+
+namespace {
+
+constexpr std::uint64_t kFrames = 20480;
+constexpr std::uint64_t kWindow = 64;
+static_assert(kFrames % kWindow == 0, "the producer counts whole windows of credit");
+
+std::atomic<std::uint64_t> g_consumer_sum{0};
+
+template <std::size_t Bytes>
+struct FrameEvent : qb::Event {
+    std::uint64_t seq = 0;
+    std::uint64_t words[Bytes / sizeof(std::uint64_t)];
+
+    explicit FrameEvent(std::uint64_t s) noexcept
+        : seq(s) {
+        for (std::size_t i = 0; i < std::size(words); ++i)
+            words[i] = s + i;
+    }
+};
+
+struct CreditEvent : qb::Event {};
+
+template <std::size_t Bytes>
+class Consumer final : public qb::Actor {
+    std::uint64_t _sum      = 0;
+    std::uint64_t _received = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<FrameEvent<Bytes>>(*this);
+        co_return true;
+    }
+    ~Consumer() override {
+        g_consumer_sum.store(_sum, std::memory_order_relaxed);
+    }
+
+    void
+    on(FrameEvent<Bytes> const &event) {
+        std::uint64_t sum = 0;
+        for (auto const w : event.words)
+            sum += w;
+        _sum += sum;
+        if (++_received % kWindow == 0)
+            push<CreditEvent>(event.getSource());
+        if (_received == kFrames)
+            kill();
+    }
+};
+
+template <std::size_t Bytes, bool ByValue>
+class Producer final : public qb::Actor {
+    const qb::ActorId _to;
+    std::uint64_t     _sent    = 0;
+    std::uint64_t     _credits = 0;
+
+    void
+    burst() {
+        for (std::uint64_t i = 0; i < kWindow && _sent < kFrames; ++i, ++_sent) {
+            if constexpr (ByValue)
+                send<FrameEvent<Bytes>>(_to, _sent);
+            else
+                push<FrameEvent<Bytes>>(_to, _sent);
+        }
+    }
+
+public:
+    explicit Producer(qb::ActorId to)
+        : _to(to) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<CreditEvent>(*this);
+        burst();
+        burst();
+        co_return true;
+    }
+
+    void
+    on(CreditEvent const &) {
+        if (++_credits == kFrames / kWindow)
+            kill();
+        else
+            burst();
+    }
+};
+
+template <std::size_t Bytes>
+std::uint64_t
+expected_sum() {
+    constexpr std::uint64_t n = Bytes / sizeof(std::uint64_t);
+    // sum over s of (n * s + n(n-1)/2)
+    return n * (kFrames * (kFrames - 1) / 2) + kFrames * (n * (n - 1) / 2);
+}
+
+template <std::size_t Bytes>
+void
+BM_LargeEventTransfer(benchmark::State &state) {
+    const auto cap = qb::bench::cappedBenchmarkCores();
+    if (cap < 2u) {
+        state.SkipWithError("requires-multicore: a cross-core stream needs >= 2 benchmark cores");
+        return;
+    }
+    const bool by_value = state.range(0) != 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        g_consumer_sum.store(0, std::memory_order_relaxed);
+        qb::Main   main;
+        const auto consumer = main.addActor<Consumer<Bytes>>(cap - 1u);
+        if (by_value)
+            main.addActor<Producer<Bytes, true>>(0, consumer);
+        else
+            main.addActor<Producer<Bytes, false>>(0, consumer);
+        state.ResumeTiming();
+
+        main.start(true);
+        main.join();
+
+        if (g_consumer_sum.load(std::memory_order_relaxed) != expected_sum<Bytes>()) {
+            state.SkipWithError("checksum mismatch: a frame was lost, duplicated or torn");
+            return;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kFrames * Bytes));
+    state.counters["frames_per_s"] = benchmark::Counter(static_cast<double>(kFrames), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+} // namespace
+
+#define REGISTER_LARGE_EVENT(BYTES)                  \
+    BENCHMARK_TEMPLATE(BM_LargeEventTransfer, BYTES) \
+        ->ArgsProduct({{0, 1}})                      \
+        ->ArgNames({"PATH"})                         \
+        ->UseRealTime()                              \
+        ->Unit(benchmark::kMillisecond)
+
+REGISTER_LARGE_EVENT(256);
+REGISTER_LARGE_EVENT(1024);
+REGISTER_LARGE_EVENT(4096);
+REGISTER_LARGE_EVENT(16384);
+REGISTER_LARGE_EVENT(49152);
+
+BENCHMARK_MAIN();
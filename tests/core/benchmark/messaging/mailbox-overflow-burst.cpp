@@ -0,0 +1,154 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/messaging/mailbox-overflow-burst.cpp
+ * @brief Bursty cross-core stream into a small mailbox: `Backpressure` vs `Overflow` mode.
+ *
+ * A producer on core 0 pushes `kBursts` bursts of `kBurst` events to a consumer on the far core
+ * (`cappedBenchmarkCores() - 1`); each burst is one handler invocation, so it leaves in one flush,
+ * several times wider than the consumer's ring. The consumer acknowledges each complete burst
+ * and the producer fires the next one on the ack, so at most one burst is ever in flight.
+ *
+ *   - `MODE=0` — `MailboxMode::Backpressure`: the flush spins, yields and bails whenever the ring
+ *     is full; the rest of the burst waits in the producer's pipe for the next loop pass.
+ *   - `MODE=1` — `MailboxMode::Overflow`: the flush chains what the ring refuses into one
+ *     segment and returns; the consumer drains ring then segment.
+ *
+ * `CAP` is the consumer's per-sender ring capacity in buckets (`setMailboxCapacity`). Counters:
+ * `events_per_s`, and per run `backoffs` / `stalled_flushes` / `spilled_segments` from
+ * `Main::getMailboxStats()`. Guard: the consumer must see every event in order, else SkipWithError.
+ *
+ * Benchmark methodology: placement is hoisted out of the timed region (`PauseTiming()`);
+ * `start(true)` + `join()` is timed under `UseRealTime()`; counters are assigned once.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+#include "../../shared/BenchmarkCores.h"
+
+namespace {
+
+constexpr std::uint32_t kBurst  = 4096;
+constexpr std::uint32_t kBursts = 32;
+
+std::atomic<bool> g_in_order{true};
+
+struct TickEvent : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+struct AckEvent : qb::Event {};
+
+class Consumer final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<TickEvent>(*this);
+        co_return true;
+    }
+
+    void
+    on(TickEvent const &event) {
+        if (event.seq != _next++)
+            g_in_order.store(false, std::memory_order_relaxed);
+        if (_next % kBurst == 0) {
+            push<AckEvent>(event.getSource());
+            if (_next == kBurst * kBursts)
+                kill();
+        }
+    }
+};
+
+class Producer final : public qb::Actor {
+    const qb::ActorId _to;
+    std::uint32_t     _sent = 0;
+
+    void
+    burst() {
+        for (std::uint32_t i = 0; i < kBurst; ++i)
+            push<TickEvent>(_to).seq = _sent++;
+    }
+
+public:
+    explicit Producer(qb::ActorId to)
+        : _to(to) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<AckEvent>(*this);
+        burst();
+        co_return true;
+    }
+
+    void
+    on(AckEvent const &) {
+        if (_sent == kBurst * kBursts)
+            kill();
+        else
+            burst();
+    }
+};
+
+void
+BM_MailboxOverflowBurst(benchmark::State &state) {
+    const auto cap = qb::bench::cappedBenchmarkCores();
+    if (cap < 2u) {
+        state.SkipWithError("requires-multicore: a cross-core stream needs >= 2 benchmark cores");
+        return;
+    }
+    const auto mode     = state.range(0) ? qb::MailboxMode::Overflow : qb::MailboxMode::Backpressure;
+    const auto capacity = static_cast<std::size_t>(state.range(1));
+
+    qb::MailboxStats stats;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g_in_order.store(true, std::memory_order_relaxed);
+        qb::Main   main;
+        const auto far = static_cast<qb::CoreId>(cap - 1u);
+        main.core(far).setMailboxCapacity(capacity).setMailboxMode(mode);
+        const auto consumer = main.addActor<Consumer>(far);
+        main.addActor<Producer>(0, consumer);
+        state.ResumeTiming();
+
+        main.start(true);
+        main.join();
+
+        if (!g_in_order.load(std::memory_order_relaxed)) {
+            state.SkipWithError("events lost or reordered");
+            return;
+        }
+        const auto run = main.getMailboxStats(far);
+        stats.backoffs += run.backoffs;
+        stats.stalled_flushes += run.stalled_flushes;
+        stats.spilled_segments += run.spilled_segments;
+    }
+
+    const auto runs                    = static_cast<double>(state.iterations());
+    state.counters["events_per_s"]     = benchmark::Counter(static_cast<double>(kBurst) * kBursts, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["backoffs"]         = static_cast<double>(stats.backoffs) / runs;
+    state.counters["stalled_flushes"]  = static_cast<double>(stats.stalled_flushes) / runs;
+    state.counters["spilled_segments"] = static_cast<double>(stats.spilled_segments) / runs;
+}
+
+} // namespace
+
+BENCHMARK(BM_MailboxOverflowBurst)
+    ->ArgsProduct({{0, 1}, {16, 256, 1023}})
+    ->ArgNames({"MODE", "CAP"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
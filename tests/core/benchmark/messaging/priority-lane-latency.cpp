@@ -0,0 +1,229 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/messaging/priority-lane-latency.cpp
+ * @brief Control-event round-trip latency under a saturated data stream: normal vs priority lane.
+ *
+ * Core 0 hosts a data producer and a pinger; the far core (`cappedBenchmarkCores() - 1`) hosts
+ * the data consumer and a ponger. The producer keeps `kWindow` data events in flight at all times
+ * (credit per `kCredit`), and the consumer burns `kWorkPerEvent` spin iterations per event, so
+ * the far core is the bottleneck and its inbound queues never drain. Meanwhile the pinger bounces
+ * `kPings` control events off the ponger, one at a time, and records every round trip.
+ *
+ *   - `LANE=0` — the control event is a plain `qb::Event`: it queues behind the data in the
+ *     producer core's pipe and in the far core's ring.
+ *   - `LANE=1` — the control event is a `qb::is_priority_event`: its own pipe, its own ring,
+ *     drained first; `reply()` keeps the lane on the way back.
+ *
+ * Counters: `p50_us`, `p99_us`, `max_us` of the control round trip (last iteration), and
+ * `data_events_per_s` delivered meanwhile. Guard: every ping must come back, else SkipWithError.
+ *
+ * Benchmark methodology: placement is hoisted out of the timed region (`PauseTiming()`);
+ * `start(true)` + `join()` is timed under `UseRealTime()`; counters are assigned once.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+#include "../../shared/BenchmarkCores.h"
+
+namespace {
+
+constexpr std::uint32_t kPings        = 200;
+constexpr std::uint32_t kWindow       = 16384;
+constexpr std::uint32_t kCredit       = 1024;
+constexpr std::uint32_t kWorkPerEvent = 200;
+static_assert(kWindow % kCredit == 0, "the producer refills whole credits");
+
+std::vector<std::uint64_t> g_rtt_ns;
+std::atomic<std::uint64_t> g_data_events{0};
+
+struct DataEvent : qb::Event {
+    std::uint64_t payload = 0;
+};
+
+struct CreditEvent : qb::Event {};
+
+template <bool Priority>
+struct ControlEvent : qb::Event {
+    std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+};
+
+} // namespace
+
+template <>
+struct qb::is_priority_event<ControlEvent<true>> : std::true_type {};
+
+namespace {
+
+class Consumer final : public qb::Actor {
+    std::uint64_t _received = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<DataEvent>(*this);
+        co_return true;
+    }
+    ~Consumer() override {
+        g_data_events.store(_received, std::memory_order_relaxed);
+    }
+
+    void
+    on(DataEvent const &event) {
+        auto acc = event.payload;
+        for (std::uint32_t i = 0; i < kWorkPerEvent; ++i)
+            benchmark::DoNotOptimize(acc += i);
+        if (++_received % kCredit == 0)
+            push<CreditEvent>(event.getSource());
+    }
+};
+
+class Producer final : public qb::Actor {
+    const qb::ActorId _to;
+    std::uint64_t     _sent = 0;
+
+    void
+    burst() {
+        for (std::uint32_t i = 0; i < kCredit; ++i)
+            push<DataEvent>(_to).payload = _sent++;
+    }
+
+public:
+    explicit Producer(qb::ActorId to)
+        : _to(to) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<CreditEvent>(*this);
+        for (std::uint32_t i = 0; i < kWindow / kCredit; ++i)
+            burst();
+        co_return true;
+    }
+
+    void
+    on(CreditEvent const &) {
+        burst();
+    }
+};
+
+template <bool Priority>
+class Ponger final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<ControlEvent<Priority>>(*this);
+        co_return true;
+    }
+
+    void
+    on(ControlEvent<Priority> &event) {
+        reply(event);
+    }
+};
+
+template <bool Priority>
+class Pinger final : public qb::Actor {
+    const qb::ActorId _ponger;
+    const qb::CoreId  _far;
+    std::uint32_t     _pongs = 0;
+
+public:
+    Pinger(qb::ActorId ponger, qb::CoreId far)
+        : _ponger(ponger)
+        , _far(far) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<ControlEvent<Priority>>(*this);
+        push<ControlEvent<Priority>>(_ponger);
+        co_return true;
+    }
+
+    void
+    on(ControlEvent<Priority> const &event) {
+        g_rtt_ns.push_back(
+            static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - event.sent).count()));
+        if (++_pongs < kPings) {
+            push<ControlEvent<Priority>>(_ponger);
+            return;
+        }
+        // Tear down behind the control traffic: the data actors on both cores go with us.
+        push<qb::KillEvent>(qb::BroadcastId(_far));
+        push<qb::KillEvent>(qb::BroadcastId(0));
+    }
+};
+
+template <bool Priority>
+void
+place(qb::Main &main, qb::CoreId const far) {
+    const auto consumer = main.addActor<Consumer>(far);
+    const auto ponger   = main.addActor<Ponger<Priority>>(far);
+    main.addActor<Producer>(0, consumer);
+    main.addActor<Pinger<Priority>>(0, ponger, far);
+}
+
+double
+percentile_us(std::vector<std::uint64_t> samples, double const q) {
+    const auto nth = static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(nth), samples.end());
+    return static_cast<double>(samples[nth]) / 1000.0;
+}
+
+void
+BM_PriorityLaneLatency(benchmark::State &state) {
+    const auto cap = qb::bench::cappedBenchmarkCores();
+    if (cap < 2u) {
+        state.SkipWithError("requires-multicore: a saturated cross-core stream needs >= 2 benchmark cores");
+        return;
+    }
+    const bool priority = state.range(0) != 0;
+    const auto far      = static_cast<qb::CoreId>(cap - 1u);
+
+    std::uint64_t data_events = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g_rtt_ns.clear();
+        g_rtt_ns.reserve(kPings);
+        g_data_events.store(0, std::memory_order_relaxed);
+        qb::Main main;
+        if (priority)
+            place<true>(main, far);
+        else
+            place<false>(main, far);
+        state.ResumeTiming();
+
+        main.start(true);
+        main.join();
+
+        if (g_rtt_ns.size() != kPings) {
+            state.SkipWithError("a control event was lost");
+            return;
+        }
+        data_events += g_data_events.load(std::memory_order_relaxed);
+    }
+
+    state.counters["p50_us"]            = percentile_us(g_rtt_ns, 0.50);
+    state.counters["p99_us"]            = percentile_us(g_rtt_ns, 0.99);
+    state.counters["max_us"]            = percentile_us(g_rtt_ns, 1.0);
+    state.counters["data_events_per_s"] = benchmark::Counter(static_cast<double>(data_events), benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK(BM_PriorityLaneLatency)->ArgsProduct({{0, 1}})->ArgNames({"LANE"})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
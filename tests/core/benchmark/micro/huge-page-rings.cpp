@@ -0,0 +1,248 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/micro/huge-page-rings.cpp
+ * @brief Mailbox-ring traffic of an N-core engine on base pages, THP and hugetlb (no `qb::Main`).
+ *
+ * Builds `CORES` mailboxes laid out as `SharedCoreCommunication::Mailbox` lays them out: per
+ * mailbox, `CORES` normal rings of `DefaultMailboxCapacity` buckets, `CORES` priority rings and a
+ * receive buffer. `PAGES=0` allocates each ring from the heap (`HugePages::Off`); `PAGES=1` and
+ * `PAGES=2` carve them all from one `page_region` per mailbox, asking for transparent huge pages
+ * (`HugePages::Transparent`) or the hugetlb pool (`HugePages::Explicit`).
+ *
+ * One iteration is the whole engine's ring traffic serialised onto this thread: `kSends` one-bucket
+ * events, each into a random sender's lane of a random mailbox, then every mailbox drained lane by
+ * lane into its receive buffer. The ring cursors are all over the mapping, so the cost is TLB
+ * reach more than bandwidth; it grows with `CORES` on base pages and should stay nearly flat on
+ * huge pages.
+ *
+ * Counters: `dtlb_misses` per event, from `perf_event_open(PERF_COUNT_HW_CACHE_DTLB)`, when the
+ * host lets this process count its own loads and stores (absent otherwise, e.g. in most VMs);
+ * `huge` is 1 when every mailbox got the pages it asked for (a `PAGES=2` row on a host without a
+ * hugetlb pool falls back to THP and reports `huge=0`); `thp_mib`, the process's `AnonHugePages`
+ * once the mailboxes are faulted in, shows whether the kernel actually backed the THP advice.
+ *
+ * Benchmark methodology: the mailboxes are built and pre-faulted before the timed loop; counters
+ * are assigned once after it.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <qb/main.h>
+#include <qb/system/allocator/huge_pages.h>
+#include <qb/system/lockfree/spsc.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using qb::allocator::page_kind;
+using Ring = qb::lockfree::spsc::ringbuffer<EventBucket, 0>;
+
+constexpr std::size_t kCapacity = qb::CoreInitializer::DefaultMailboxCapacity;
+constexpr std::size_t kPriority = qb::CoreInitializer::PriorityMailboxCapacity;
+constexpr std::size_t kSends    = 1u << 16;
+
+struct Mailbox {
+    qb::allocator::page_region         pages;
+    std::vector<std::unique_ptr<Ring>> lanes;
+    std::vector<std::unique_ptr<Ring>> priority_lanes;
+    std::unique_ptr<EventBucket[]>     receive_heap;
+    EventBucket                       *receive = nullptr;
+
+    Mailbox(std::size_t const producers, page_kind const want, bool const huge) {
+        EventBucket *next = nullptr;
+        if (huge) {
+            pages = qb::allocator::page_region(
+                (producers * (kCapacity + 1 + kPriority + 1) + kCapacity) * sizeof(EventBucket), want);
+            next  = pages.as<EventBucket>();
+        }
+        const auto carve = [&next](std::size_t const buckets) {
+            auto *const slice = next;
+            if (next)
+                next += buckets;
+            return slice;
+        };
+        for (std::size_t i = 0; i < producers; ++i)
+            lanes.push_back(std::make_unique<Ring>(kCapacity, carve(kCapacity + 1)));
+        for (std::size_t i = 0; i < producers; ++i)
+            priority_lanes.push_back(std::make_unique<Ring>(kPriority, carve(kPriority + 1)));
+        if (!(receive = carve(kCapacity))) {
+            receive_heap = std::make_unique<EventBucket[]>(kCapacity);
+            receive      = receive_heap.get();
+        }
+    }
+
+    // Touch every page once, as a running engine would have, so the loop measures the TLB.
+    void
+    prefault() {
+        for (auto *const set : {&lanes, &priority_lanes})
+            for (auto &ring : *set)
+                std::memset(ring->data(), 0, ring->storage_size() * sizeof(EventBucket));
+        std::memset(receive, 0, kCapacity * sizeof(EventBucket));
+    }
+
+    std::uint64_t
+    drain() {
+        std::uint64_t sum = 0;
+        for (auto &ring : lanes)
+            ring->dequeue(
+                [&sum](EventBucket const *batch, std::size_t const n) {
+                    for (std::size_t i = 0; i < n; ++i)
+                        sum += batch[i].__raw__[0];
+                },
+                receive, kCapacity);
+        return sum;
+    }
+};
+
+// AnonHugePages of this process, in MiB (0 where /proc is not Linux's).
+double
+anon_huge_mib() {
+    std::ifstream rollup("/proc/self/smaps_rollup");
+    for (std::string key; rollup >> key;) {
+        if (key == "AnonHugePages:") {
+            double kib = 0;
+            rollup >> kib;
+            return kib / 1024.;
+        }
+        rollup.ignore(256, '\n');
+    }
+    return 0.;
+}
+
+#if defined(__linux__)
+// Data-TLB misses of this thread (loads + stores where the PMU has both), or -1 if not countable.
+class DtlbCounter {
+    int _fds[2] = {-1, -1};
+
+public:
+    DtlbCounter() {
+        int slot = 0;
+        for (const auto op : {PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_OP_WRITE}) {
+            perf_event_attr attr{};
+            attr.type           = PERF_TYPE_HW_CACHE;
+            attr.size           = sizeof(attr);
+            attr.config         = PERF_COUNT_HW_CACHE_DTLB | (op << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            _fds[slot] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (_fds[slot] >= 0)
+                ++slot;
+        }
+    }
+    ~DtlbCounter() {
+        for (const int fd : _fds)
+            if (fd >= 0)
+                ::close(fd);
+    }
+    [[nodiscard]] bool
+    available() const noexcept {
+        return _fds[0] >= 0;
+    }
+    void
+    start() noexcept {
+        for (const int fd : _fds)
+            if (fd >= 0) {
+                ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+    }
+    [[nodiscard]] std::int64_t
+    stop() noexcept {
+        std::int64_t total = 0;
+        for (const int fd : _fds) {
+            if (fd < 0)
+                continue;
+            ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            std::int64_t count = 0;
+            if (::read(fd, &count, sizeof(count)) == sizeof(count))
+                total += count;
+        }
+        return total;
+    }
+};
+#else
+class DtlbCounter {
+public:
+    [[nodiscard]] bool
+    available() const noexcept {
+        return false;
+    }
+    void
+    start() noexcept {}
+    [[nodiscard]] std::int64_t
+    stop() noexcept {
+        return 0;
+    }
+};
+#endif
+
+void
+BM_HugePageRings(benchmark::State &state) {
+    const auto cores = static_cast<std::size_t>(state.range(0));
+    const auto mode  = state.range(1);
+    const auto want  = mode == 2 ? page_kind::hugetlb : page_kind::transparent;
+
+    std::vector<std::unique_ptr<Mailbox>> boxes;
+    bool                                  huge = mode != 0;
+    for (std::size_t i = 0; i < cores; ++i) {
+        boxes.push_back(std::make_unique<Mailbox>(cores, want, mode != 0));
+        boxes.back()->prefault();
+        huge = huge && boxes.back()->pages.kind() == want;
+    }
+
+    const auto    thp  = anon_huge_mib();
+    std::uint64_t rng  = 0x9e3779b97f4a7c15ull;
+    EventBucket   event{};
+    DtlbCounter   dtlb;
+    std::int64_t  misses = 0;
+    for (auto _ : state) {
+        dtlb.start();
+        for (std::size_t i = 0; i < kSends; ++i) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            auto &box          = *boxes[(rng >> 8) % cores];
+            event.__raw__[0]   = static_cast<std::uint32_t>(i);
+            auto &lane         = *box.lanes[(rng >> 32) % cores];
+            if (!lane.enqueue(event))
+                box.drain(); // a full ring: the consumer catches up, as backpressure would make it
+        }
+        std::uint64_t sum = 0;
+        for (auto &box : boxes)
+            sum += box->drain();
+        misses += dtlb.stop();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kSends));
+    if (dtlb.available())
+        state.counters["dtlb_misses"] = static_cast<double>(misses) / static_cast<double>(state.iterations() * kSends);
+    state.counters["huge"]    = huge ? 1. : 0.;
+    state.counters["thp_mib"] = thp;
+}
+
+} // namespace
+
+BENCHMARK(BM_HugePageRings)->ArgsProduct({{8, 32, 64}, {0, 1, 2}})->ArgNames({"CORES", "PAGES"});
+
+BENCHMARK_MAIN();
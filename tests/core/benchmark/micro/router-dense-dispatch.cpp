@@ -0,0 +1,240 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/micro/router-dense-dispatch.cpp
+ * @brief `qb::router::dense_memh` vs `qb::router::memh` — the per-event dispatch cost, isolated.
+ *
+ * `mpsc-router-dispatch` measures ingress + routing together, with three actors and three types:
+ * the ring dominates and both routers' tables stay in L1. This bench takes the ring out and sweeps
+ * the two dimensions a router actually scales with — event types handled on the core, and actors
+ * living on it — so the double hash + virtual resolve of `memh` and the ordinal × slot load of
+ * `dense_memh` are compared on the same pre-built stream of events.
+ *
+ * Setup (outside the timed region): `actors` handlers with SIDs 1..N on core 0 each subscribe all
+ * `types` message types (`Msg<0>`..`Msg<types-1>`, trivially copyable, one bucket each); a fixed-
+ * seed LCG draws `kStream` (type, destination) pairs into an `EventBucket` array. The timed loop
+ * routes the whole array once per iteration. Every handler folds into one consumer-local checksum,
+ * exactly like `mpsc-router-dispatch`.
+ *
+ * Benchmark methodology (perf harness, never a ctest gate):
+ *   - a one-shot probe routes the stream through BOTH routers and requires identical, non-zero
+ *     checksums — a router that mis-routes is caught before timing, as a SkipWithError;
+ *   - counters are assigned once, after the loop.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <qb/core/ActorId.h>
+#include <qb/core/Event.h>
+#include <qb/system/event/router.h>
+#include <qb/utility/prefix.h>
+
+namespace {
+
+using ::EventBucket;
+
+// Same minimal routable header as mpsc-router-dispatch.cpp: `qb::EventId` ids, `qb::ActorId`
+// destinations (which carry the `sid()` slot `dense_memh` indexes by). Ids are built from the packed
+// `(core << 16) | sid` form with core 0, so the packed value IS the SID.
+struct BenchEvt {
+    using id_type         = qb::EventId;
+    using id_handler_type = qb::ActorId;
+
+    std::uint16_t bucket_size = 1;
+    id_type       evt_id{};
+    qb::ActorId   dest{};
+    qb::ActorId   source{};
+
+    template <typename T>
+    [[nodiscard]] static id_type
+    type_to_id() noexcept {
+        return qb::detail::type_id_for<T>();
+    }
+
+    [[nodiscard]] id_type
+    getID() const noexcept {
+        return evt_id;
+    }
+    [[nodiscard]] qb::ActorId
+    getDestination() const noexcept {
+        return dest;
+    }
+    [[nodiscard]] bool
+    is_alive() const noexcept {
+        return true;
+    }
+};
+
+template <std::size_t N>
+struct Msg final : BenchEvt {
+    std::uint32_t value = 0;
+};
+
+constexpr std::size_t kMaxTypes = 32;
+constexpr std::size_t kStream   = 1u << 16;
+
+static_assert(std::is_trivially_copyable_v<Msg<0>>);
+static_assert(sizeof(Msg<0>) <= sizeof(EventBucket));
+
+struct LocalChecksum {
+    std::uint64_t value = 0;
+    void
+    mix(std::uint64_t const x) noexcept {
+        value ^= x + 0x9E3779B97F4A7C15ULL + (value << 6) + (value >> 2);
+    }
+};
+
+class Handler final {
+    const qb::ActorId _id;
+    LocalChecksum    *_checksum;
+
+public:
+    Handler(qb::ActorId const id, LocalChecksum &checksum) noexcept
+        : _id(id)
+        , _checksum(&checksum) {}
+    [[nodiscard]] qb::ActorId
+    id() const noexcept {
+        return _id;
+    }
+    [[nodiscard]] bool
+    is_alive() const noexcept {
+        return true;
+    }
+    template <std::size_t N>
+    void
+    on(Msg<N> &m) noexcept {
+        _checksum->mix((static_cast<std::uint64_t>(m.value) << 5) ^ N);
+    }
+};
+
+// Subscribes `handler` to Msg<0>..Msg<types-1>; the index sequence keeps the type list static.
+template <typename Router, std::size_t... I>
+void
+subscribe_types(Router &router, Handler &handler, std::size_t const types, std::index_sequence<I...>) {
+    ((I < types ? router.template subscribe<Msg<I>>(handler) : void()), ...);
+}
+
+template <std::size_t... I>
+[[nodiscard]] qb::EventId
+type_id_at(std::size_t const index, std::index_sequence<I...>) noexcept {
+    qb::EventId out{};
+    ((I == index ? (out = BenchEvt::type_to_id<Msg<I>>(), void()) : void()), ...);
+    return out;
+}
+
+[[nodiscard]] std::unique_ptr<EventBucket[]>
+make_stream(std::size_t const types, std::size_t const actors) {
+    auto          stream = std::make_unique<EventBucket[]>(kStream);
+    std::uint64_t lcg    = 0x2545F4914F6CDD1DULL;
+    for (std::size_t i = 0; i < kStream; ++i) {
+        lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+        Msg<0> m{};
+        m.evt_id = type_id_at((lcg >> 33) % types, std::make_index_sequence<kMaxTypes>{});
+        m.dest   = qb::ActorId{static_cast<std::uint32_t>(1 + (lcg >> 17) % actors)};
+        m.value  = static_cast<std::uint32_t>(lcg >> 40);
+        // All Msg<N> share one layout, so writing the header through Msg<0> is exact.
+        std::memcpy(static_cast<void *>(stream.get() + i), static_cast<const void *>(&m), sizeof(m));
+    }
+    return stream;
+}
+
+template <typename Router>
+struct Fixture {
+    LocalChecksum        checksum;
+    std::vector<Handler> handlers;
+    Router               router;
+
+    Fixture(std::size_t const types, std::size_t const actors) {
+        handlers.reserve(actors);
+        for (std::size_t a = 0; a < actors; ++a)
+            handlers.emplace_back(qb::ActorId{static_cast<std::uint32_t>(1 + a)}, checksum);
+        for (auto &h : handlers)
+            subscribe_types(router, h, types, std::make_index_sequence<kMaxTypes>{});
+    }
+
+    void
+    route_all(EventBucket *stream) noexcept {
+        for (std::size_t i = 0; i < kStream; ++i) {
+            auto *evt = std::launder(reinterpret_cast<BenchEvt *>(stream + i));
+            router.route(*evt, [](BenchEvt &) noexcept {
+                // Every drawn (type, dest) is subscribed: never reached.
+            });
+        }
+    }
+};
+
+using MemhRouter  = qb::router::memh<BenchEvt>;
+using DenseRouter = qb::router::dense_memh<BenchEvt>;
+
+template <typename Router>
+void
+BM_RouterDispatch(benchmark::State &state) {
+    const auto types  = static_cast<std::size_t>(state.range(0));
+    const auto actors = static_cast<std::size_t>(state.range(1));
+    if (types == 0u || types > kMaxTypes || actors == 0u) {
+        state.SkipWithError("invalid range: types must be in [1, 32] and actors non-zero");
+        return;
+    }
+
+    auto stream = make_stream(types, actors);
+
+    // One-shot probe: both routers must fold the stream into the same non-zero checksum.
+    {
+        Fixture<MemhRouter>  reference(types, actors);
+        Fixture<DenseRouter> dense(types, actors);
+        reference.route_all(stream.get());
+        dense.route_all(stream.get());
+        benchmark::DoNotOptimize(dense.checksum.value);
+        if (reference.checksum.value == 0ull) {
+            state.SkipWithError("memh dispatched zero messages (no handler fired)");
+            return;
+        }
+        if (reference.checksum.value != dense.checksum.value) {
+            state.SkipWithError("dense_memh and memh disagree on the routed stream");
+            return;
+        }
+    }
+
+    Fixture<Router> fixture(types, actors);
+    for (auto _ : state) {
+        fixture.route_all(stream.get());
+        benchmark::DoNotOptimize(fixture.checksum.value);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kStream));
+    state.counters["items_per_s"] = benchmark::Counter(static_cast<double>(kStream), benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["types"]  = static_cast<double>(types);
+    state.counters["actors"] = static_cast<double>(actors);
+}
+
+void
+apply_router_args(::benchmark::internal::Benchmark *b) {
+    for (std::int64_t types : {4, 16, 32})
+        for (std::int64_t actors : {8, 256, 4096})
+            b->Args({types, actors});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_RouterDispatch, MemhRouter)->Name("BM_RouterDispatch/memh")->Apply(apply_router_args)->ArgNames({"types", "actors"});
+BENCHMARK_TEMPLATE(BM_RouterDispatch, DenseRouter)
+    ->Name("BM_RouterDispatch/dense_memh")
+    ->Apply(apply_router_args)
+    ->ArgNames({"types", "actors"});
+
+BENCHMARK_MAIN();
@@ -20,6 +20,11 @@
  *     that, in `onInit()`, broadcasts a single `KillEvent` to `BroadcastId(1)` (the `actor-add`
  *     1024-kill shape). This isolates the cost of fanning ONE broadcast kill across N live actors and
  *     reaping them, vs. the per-actor self-kill of the first bench.
+ *   - `BM_ActorSpawn_Churn` — the session-per-actor shape: one spawner on core 0 creates `actors`
+ *     short-lived actors with `addRefActor<>()` in waves of `kWave`, each of which kills itself from
+ *     `onInit()`, so every wave is reaped before the next one is created. Steady-state churn on the
+ *     running core: actor storage is recycled wave after wave, through the core's `ActorSlab`.
+ *     Runs at WARN log level, so the per-actor INFO lines do not dominate it.
  *
  * Both keep the system suites' load-bearing oracle as a benchmark-time invariant via a live-instance
  * counter: every target actor `++`s on construction and `--`s on destruction, so after `join()` the
@@ -103,6 +108,36 @@ public:
     }
 };
 
+// Churn spawner: creates `total` self-killing actors in waves, one wave per loop pass.
+class ChurnSpawner final : public qb::Actor {
+    static constexpr std::uint32_t kWave = 256;
+
+    struct Wave : qb::Event {};
+
+    const std::uint32_t _total;
+    std::uint32_t       _spawned = 0;
+
+public:
+    explicit ChurnSpawner(std::uint32_t total)
+        : _total(total) {}
+
+    qb::io::async::task<bool>
+    onInit() final {
+        registerEvent<Wave>(*this);
+        push<Wave>(id());
+        co_return true;
+    }
+    void
+    on(Wave const &) {
+        for (std::uint32_t i = 0; i < kWave && _spawned < _total; ++i, ++_spawned)
+            (void) addRefActor<SelfKillTarget>();
+        if (_spawned < _total)
+            push<Wave>(id());
+        else
+            kill();
+    }
+};
+
 // ---------------------------------------------------------------------------
 // Bench 1: registration + first-frame init + self-kill teardown.
 // ---------------------------------------------------------------------------
@@ -188,6 +223,37 @@ BM_ActorSpawn_BroadcastKill(benchmark::State &state) {
     state.counters["actors"] = static_cast<double>(actors);
 }
 
+// ---------------------------------------------------------------------------
+// Bench 3: spawn/kill churn on a running core.
+// ---------------------------------------------------------------------------
+void
+BM_ActorSpawn_Churn(benchmark::State &state) {
+    const auto actors = static_cast<std::uint32_t>(state.range(0));
+    // Each actor logs its creation, subscriptions and deletion at INFO: that formatting, not the
+    // spawn, would be the measurement. Restored below.
+    qb::io::log::setLevel(qb::io::log::Level::WARN);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        reset_counters();
+        qb::Main main;
+        main.addActor<ChurnSpawner>(0, actors);
+        state.ResumeTiming();
+
+        main.start(true);
+        main.join();
+    }
+
+    qb::io::log::setLevel(qb::io::log::Level::INFO);
+    // Out of the timed region: every churned actor was built and reaped.
+    if (g_built.load(std::memory_order_relaxed) != static_cast<std::int64_t>(actors) || g_alive.load(std::memory_order_relaxed) != 0) {
+        state.SkipWithError("churn did not build/reap every actor");
+        return;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * actors));
+    state.counters["actors"] = static_cast<double>(actors);
+}
+
 void
 ArgsActors(benchmark::internal::Benchmark *b) {
     // Shapes from the system suites: 1024 (actor-add kill) and 2048 (actor-dependency spawn),
@@ -201,4 +267,6 @@ ArgsActors(benchmark::internal::Benchmark *b) {
 BENCHMARK(BM_ActorSpawn_FirstFrame)->Apply(ArgsActors)->ArgNames({"actors"})->Unit(benchmark::kMillisecond)->UseRealTime();
 BENCHMARK(BM_ActorSpawn_BroadcastKill)->Apply(ArgsActors)->ArgNames({"actors"})->Unit(benchmark::kMillisecond)->UseRealTime();
 
+BENCHMARK(BM_ActorSpawn_Churn)->Arg(1 << 16)->Arg(1 << 18)->ArgNames({"actors"})->Unit(benchmark::kMillisecond)->UseRealTime();
+
 BENCHMARK_MAIN();
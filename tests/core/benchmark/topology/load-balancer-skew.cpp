@@ -0,0 +1,186 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file benchmark/topology/load-balancer-skew.cpp
+ * @brief Skewed placement with and without `qb::LoadBalancer`: the throughput the balancer recovers.
+ *
+ * `NB_CORE` cores, `2 * NB_CORE` CPU-bound workers, ALL placed on core 0 — the other cores host only
+ * a parked actor. Each worker is a closed loop: it handles one `Tick`, burns `WORK_ITERS` rounds of
+ * integer mixing, and pushes the next `Tick` to itself, `kTicksPerWorker` times. Without the balancer
+ * core 0 runs every tick while its peers sleep; with it (`BALANCED=1`, one `LoadBalancer` per core,
+ * 10 ms period) the coordinator migrates workers off core 0 until the busy ratios even out.
+ *
+ * Workers opt in through `onMigrate()` and carry their remaining tick budget and mixing state, so the total
+ * work is identical in both rows and wall time compares directly. Migration is transparent to the
+ * loop: the `Tick` in flight to the old id is forwarded by core 0's redirection table.
+ *
+ * Counters: `ticks_per_s` (whole run), `migrations` (settled moves, counted as re-created workers),
+ * `cores_used` (cores that ran at least 1 % of the ticks) and `core0_share` (fraction of ticks run
+ * on core 0 — 1.0 means the skew was never corrected).
+ *
+ * Delivery guard (NOT a ctest gate — this is a perf harness): the run ends only once every worker has
+ * consumed its budget, and the per-core tick tally must sum to exactly `2 * NB_CORE * kTicksPerWorker`;
+ * a lost or duplicated tick is a SkipWithError. On a host with fewer hardware threads than `NB_CORE`
+ * the cores time-share and the balanced row cannot win — read it together with the machine.
+ *
+ * Benchmark methodology: placement is hoisted out of the timed region (`PauseTiming()`);
+ * `start(true)` + `join()` is timed under `UseRealTime()`; counters are assigned once per iteration.
+ */
+
+#include <array>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <qb/core/LoadBalancer.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint64_t kTicksPerWorker = 20000;
+constexpr std::size_t   kMaxCores       = 16;
+
+struct alignas(64) PaddedCounter {
+    std::atomic<std::uint64_t> value{0};
+};
+
+std::array<PaddedCounter, kMaxCores> g_core_ticks;
+std::atomic<std::uint64_t>           g_workers_built{0};
+std::atomic<std::uint32_t>           g_workers_left{0};
+
+struct Tick : qb::Event {};
+
+class Worker final : public qb::Actor {
+    std::uint64_t _remaining;
+    std::uint64_t _work_iters;
+    std::uint64_t _mix;
+    bool          _resumed;
+
+public:
+    Worker(std::uint64_t remaining, std::uint64_t work_iters, std::uint64_t mix = 0, bool resumed = false)
+        : _remaining(remaining)
+        , _work_iters(work_iters)
+        , _mix(mix)
+        , _resumed(resumed) {
+        g_workers_built.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        // A fresh worker starts its loop; a migrated one already has its Tick in flight
+        // (forwarded from the old id), so it must not start a second one.
+        if (!_resumed) {
+            _mix = 0x9E3779B97F4A7C15ULL ^ id().sid();
+            push<Tick>(id());
+        }
+        co_return true;
+    }
+
+    std::unique_ptr<qb::IActorFactory>
+    onMigrate() override {
+        return qb::make_migration<Worker>(_remaining, _work_iters, _mix, true);
+    }
+
+    void
+    on(Tick const &) {
+        for (std::uint64_t i = 0; i < _work_iters; ++i)
+            _mix = (_mix ^ (_mix >> 31)) * 0xBF58476D1CE4E5B9ULL + i;
+        benchmark::DoNotOptimize(_mix);
+        g_core_ticks[getIndex()].value.fetch_add(1, std::memory_order_relaxed);
+        if (--_remaining == 0) {
+            if (g_workers_left.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                qb::Main::stop();
+            kill();
+            return;
+        }
+        push<Tick>(id());
+    }
+};
+
+/// Keeps an otherwise empty core alive until Main::stop() (default SignalEvent handling).
+class Parked final : public qb::Actor {};
+
+void
+reset_tallies() {
+    for (auto &c : g_core_ticks)
+        c.value.store(0, std::memory_order_relaxed);
+    g_workers_built.store(0, std::memory_order_relaxed);
+}
+
+void
+build_skewed(qb::Main &main, std::uint32_t const nb_core, std::uint64_t const work_iters, bool const balanced) {
+    const std::uint32_t nb_workers = 2u * nb_core;
+    g_workers_left.store(nb_workers, std::memory_order_relaxed);
+    for (std::uint32_t w = 0; w < nb_workers; ++w)
+        main.addActor<Worker>(0, kTicksPerWorker, work_iters);
+    for (qb::CoreId core = 1; core < nb_core; ++core)
+        main.addActor<Parked>(core);
+    if (balanced) {
+        qb::LoadBalancerPolicy policy;
+        policy.interval   = std::chrono::milliseconds{10};
+        policy.hot_ratio  = 0.80;
+        policy.cold_ratio = 0.50;
+        policy.cooldown   = 1;
+        for (qb::CoreId core = 0; core < nb_core; ++core)
+            main.addActor<qb::LoadBalancer>(core, policy);
+    }
+}
+
+void
+BM_SkewedLoad(benchmark::State &state) {
+    const auto balanced   = state.range(0) != 0;
+    const auto nb_core    = static_cast<std::uint32_t>(state.range(1));
+    const auto work_iters = static_cast<std::uint64_t>(state.range(2));
+    if (nb_core < 2u || nb_core > kMaxCores) {
+        state.SkipWithError("NB_CORE must be in [2, 16]");
+        return;
+    }
+    const std::uint64_t total_ticks = 2ull * nb_core * kTicksPerWorker;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        reset_tallies();
+        qb::Main main;
+        build_skewed(main, nb_core, work_iters, balanced);
+        state.ResumeTiming();
+
+        main.start(true);
+        main.join();
+
+        std::uint64_t ran = 0;
+        std::uint32_t used = 0;
+        for (std::uint32_t c = 0; c < nb_core; ++c) {
+            const auto n = g_core_ticks[c].value.load(std::memory_order_relaxed);
+            ran += n;
+            used += (n * 100u >= total_ticks) ? 1u : 0u;
+        }
+        if (ran != total_ticks) {
+            state.SkipWithError("tick tally mismatch: a Tick was lost or duplicated across a migration");
+            return;
+        }
+        state.counters["ticks_per_s"] = benchmark::Counter(static_cast<double>(total_ticks), benchmark::Counter::kIsIterationInvariantRate);
+        state.counters["migrations"]  = static_cast<double>(g_workers_built.load(std::memory_order_relaxed) - 2ull * nb_core);
+        state.counters["cores_used"]  = static_cast<double>(used);
+        state.counters["core0_share"] =
+            static_cast<double>(g_core_ticks[0].value.load(std::memory_order_relaxed)) / static_cast<double>(total_ticks);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_SkewedLoad)
+    ->ArgsProduct({{0, 1}, {2, 4}, {2000}})
+    ->ArgNames({"BALANCED", "NB_CORE", "WORK_ITERS"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+BENCHMARK_MAIN();
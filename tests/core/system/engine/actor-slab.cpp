@@ -0,0 +1,139 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/actor-slab.cpp
+ * @brief Actor storage from the core's `ActorSlab` on a live engine.
+ *
+ *   - Waves of short-lived `addRefActor` children, each reaped before the next wave is created,
+ *     run on the same blocks: the second wave onwards reuses exactly the first wave's storage.
+ *   - Actors the slab does not pool — bigger than its largest class, or over-aligned — are still
+ *     built where their type requires and destroyed cleanly, on two cores.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kWave  = 64;
+constexpr std::uint32_t kWaves = 8;
+
+std::set<void const *>     g_storage; // core 0 only
+std::atomic<std::uint32_t> g_alive{0};
+std::atomic<std::uint32_t> g_aligned{0};
+
+class Session final : public qb::Actor {
+public:
+    Session() {
+        g_storage.insert(this);
+        g_alive.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~Session() override {
+        g_alive.fetch_sub(1, std::memory_order_relaxed);
+    }
+    qb::io::async::task<bool>
+    onInit() override {
+        kill();
+        co_return true;
+    }
+};
+
+struct Wave : qb::Event {};
+
+class Spawner final : public qb::Actor {
+    std::uint32_t _waves = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Wave>(*this);
+        push<Wave>(id());
+        co_return true;
+    }
+    void
+    on(Wave const &) {
+        for (std::uint32_t i = 0; i < kWave; ++i)
+            (void) addRefActor<Session>();
+        if (++_waves < kWaves)
+            push<Wave>(id()); // next loop pass: this wave is reaped by then
+        else
+            kill();
+    }
+};
+
+class Large final : public qb::Actor {
+    std::array<std::uint64_t, 1024> _state{}; // 8 KiB: above ActorSlab::kMaxBlockBytes
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        _state.back() = 1;
+        kill();
+        co_return true;
+    }
+};
+
+class alignas(128) OverAligned final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        if (reinterpret_cast<std::uintptr_t>(this) % 128 == 0)
+            g_aligned.fetch_add(1, std::memory_order_relaxed);
+        kill();
+        co_return true;
+    }
+};
+
+template <typename Setup>
+void
+run_engine(Setup setup) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    ASSERT_EQ(future.wait_for(60s), std::future_status::ready) << "engine did not terminate";
+}
+
+} // namespace
+
+TEST(ActorSlab, ChurnedActorsReuseTheirStorage) {
+    g_storage.clear();
+    g_alive = 0;
+    run_engine([](qb::Main &main) { main.addActor<Spawner>(0); });
+    EXPECT_EQ(g_alive.load(), 0u) << "every session was destroyed";
+    EXPECT_EQ(g_storage.size(), kWave) << kWaves << " waves of " << kWave << " sessions on the same blocks";
+}
+
+TEST(ActorSlab, UnpooledActorsOnTwoCores) {
+    g_aligned = 0;
+    run_engine([](qb::Main &main) {
+        for (qb::CoreId core = 0; core < 2; ++core) {
+            main.addActor<Large>(core);
+            main.addActor<OverAligned>(core);
+        }
+    });
+    EXPECT_EQ(g_aligned.load(), 2u);
+}
@@ -0,0 +1,163 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/actor-table.cpp
+ * @brief The core's SID-indexed actor table on a live engine.
+ *
+ *   - A handle to a reaped actor stays empty once its recycled id names the next actor, while
+ *     a fresh handle to that actor resolves it.
+ *   - An actor killed several times in one pass is reaped once.
+ *   - Far more actors than the table's first allocation, each with a callback, are all ticked
+ *     and all reaped.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::atomic<std::uint32_t> g_destroyed{0};
+std::atomic<std::uint32_t> g_ticked{0};
+std::atomic<bool>          g_same_id{false};
+std::atomic<bool>          g_stale_resolved{true};
+std::atomic<bool>          g_fresh_resolved{false};
+
+class Child final : public qb::Actor {
+    const bool _die;
+
+public:
+    explicit Child(bool die)
+        : _die(die) {}
+    ~Child() override {
+        g_destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+    qb::io::async::task<bool>
+    onInit() override {
+        if (_die)
+            kill();
+        co_return true;
+    }
+};
+
+struct Next : qb::Event {};
+
+class Parent final : public qb::Actor {
+    qb::ActorHandle<Child> _first;
+    qb::ActorHandle<Child> _second;
+    int                    _step = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Next>(*this);
+        _first = addRefActor<Child>(true);
+        push<Next>(id());
+        co_return true;
+    }
+    void
+    on(Next const &) {
+        switch (_step++) {
+            case 0: // same pass as the kill: the first child is reaped at its end
+                push<Next>(id());
+                break;
+            case 1:
+                _second = addRefActor<Child>(false);
+                g_same_id.store(_second.id() == _first.id());
+                g_stale_resolved.store(_first.get() != nullptr);
+                g_fresh_resolved.store(_second.get() != nullptr);
+                push<Next>(id());
+                break;
+            default:
+                push<qb::KillEvent>(_second.id());
+                kill();
+        }
+    }
+};
+
+class Repeated final : public qb::Actor {
+public:
+    ~Repeated() override {
+        g_destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+    qb::io::async::task<bool>
+    onInit() override {
+        kill();
+        kill();
+        co_return true;
+    }
+};
+
+class Ticker final
+    : public qb::Actor
+    , public qb::ICallback {
+public:
+    ~Ticker() override {
+        g_destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+    qb::io::async::task<bool>
+    onInit() override {
+        registerCallback(*this);
+        co_return true;
+    }
+    void
+    on(qb::LoopEvent const &) override {
+        g_ticked.fetch_add(1, std::memory_order_relaxed);
+        kill();
+        kill();
+    }
+};
+
+template <typename Setup>
+void
+run_engine(Setup setup) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    ASSERT_EQ(future.wait_for(60s), std::future_status::ready) << "engine did not terminate";
+}
+
+} // namespace
+
+TEST(ActorTable, StaleHandleDoesNotResolveARecycledId) {
+    g_destroyed = 0;
+    run_engine([](qb::Main &main) { main.addActor<Parent>(0); });
+    ASSERT_TRUE(g_same_id.load()) << "the second child took the first one's service id";
+    EXPECT_FALSE(g_stale_resolved.load()) << "the first child's handle resolved the second child";
+    EXPECT_TRUE(g_fresh_resolved.load());
+    EXPECT_EQ(g_destroyed.load(), 2u);
+}
+
+TEST(ActorTable, RepeatedKillsReapOnce) {
+    constexpr std::uint32_t kActors = 1000; // well past the table's first 64 slots
+    g_destroyed = 0;
+    g_ticked    = 0;
+    run_engine([](qb::Main &main) {
+        main.addActor<Repeated>(0);
+        for (std::uint32_t i = 0; i < kActors; ++i)
+            main.addActor<Ticker>(0);
+    });
+    EXPECT_EQ(g_ticked.load(), kActors) << "each ticker ticked once before its reap";
+    EXPECT_EQ(g_destroyed.load(), kActors + 1);
+}
@@ -0,0 +1,117 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/huge-pages.cpp
+ * @brief `CoreInitializer::setHugePages()`: every mode delivers, whatever the host can back it with.
+ *
+ *   - `setHugePages()` defaults to off and `Main::setHugePages()` reaches every initializer.
+ *   - Under each mode, three cores push bursts at a sink on the fourth: one burst wider than a
+ *     huge page's worth of buckets so the senders' pipes grow onto one, and sequenced events
+ *     that must arrive complete and in order per sender. An empty hugetlb pool (`Explicit`) or a
+ *     kernel without THP falls back, which must not change delivery.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr qb::CoreId    kSenders = 3;
+constexpr std::uint32_t kEvents  = 40000; // per sender, more buckets than one 2 MiB page holds
+
+std::atomic<std::uint32_t> g_in_order{0};
+
+struct Seq : qb::Event {
+    std::uint32_t sender;
+    std::uint32_t seq;
+    Seq(std::uint32_t const from, std::uint32_t const n)
+        : sender(from)
+        , seq(n) {}
+};
+
+class Sink final : public qb::Actor {
+    std::uint32_t _next[kSenders] = {};
+    std::uint32_t _done           = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Seq>(*this);
+        co_return true;
+    }
+    void
+    on(Seq const &event) {
+        if (event.seq != _next[event.sender]++)
+            return;
+        if (event.seq + 1 == kEvents) {
+            g_in_order.fetch_add(1, std::memory_order_relaxed);
+            if (++_done == kSenders)
+                kill();
+        }
+    }
+};
+
+class Sender final : public qb::Actor {
+    const qb::ActorId   _sink;
+    const std::uint32_t _id;
+
+public:
+    Sender(qb::ActorId sink, std::uint32_t id)
+        : _sink(sink)
+        , _id(id) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t i = 0; i < kEvents; ++i)
+            push<Seq>(_sink, _id, i); // one loop pass: the whole burst sits in the pipe
+        kill();
+        co_return true;
+    }
+};
+
+} // namespace
+
+TEST(HugePages, DefaultsOffAndReachesEveryCore) {
+    qb::Main main;
+    EXPECT_EQ(main.core(0).getHugePages(), qb::HugePages::Off);
+    (void) main.core(1); // registers core 1
+    main.setHugePages(qb::HugePages::Explicit);
+    EXPECT_EQ(main.core(0).getHugePages(), qb::HugePages::Explicit);
+    EXPECT_EQ(main.core(1).getHugePages(), qb::HugePages::Explicit);
+}
+
+TEST(HugePages, EveryModeDeliversCompleteAndInOrder) {
+    for (const auto mode : {qb::HugePages::Off, qb::HugePages::Transparent, qb::HugePages::Explicit}) {
+        SCOPED_TRACE(static_cast<int>(mode));
+        g_in_order = 0;
+        auto done   = std::make_shared<std::promise<void>>();
+        auto future = done->get_future();
+        std::thread([done, mode] {
+            qb::Main main;
+            const auto sink = main.addActor<Sink>(0);
+            for (qb::CoreId core = 1; core <= kSenders; ++core)
+                main.addActor<Sender>(core, sink, static_cast<std::uint32_t>(core - 1));
+            main.setHugePages(mode);
+            main.start(false);
+            main.join();
+            done->set_value();
+        }).detach();
+        ASSERT_EQ(future.wait_for(60s), std::future_status::ready) << "engine did not terminate";
+        EXPECT_EQ(g_in_order.load(), kSenders);
+    }
+}
@@ -0,0 +1,197 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/idle-policy.cpp
+ * @brief `CoreInitializer::setIdlePolicy()`: every policy keeps delivering, and each backs off as documented.
+ *
+ *   - Each policy, on two cores with a 5 s latency and the event-loop wait, carries a paced
+ *     cross-core ping-pong well under one latency; adaptive does it too with latency 0, where it
+ *     may not park.
+ *   - `dedicated()` never parks: a chain of short timers on a core whose condition-variable wait
+ *     would hold each one for the latency completes at once.
+ *   - `power_saver()` parks through an idle stretch: the core thread burns a fraction of it.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/io/async.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kRoundTrips = 100;
+constexpr std::uint32_t kTimers     = 20;
+constexpr auto          kLatency    = 5s;
+constexpr auto          kBound      = 4s; // below one latency: no wakeup may wait it out
+
+struct Ping : qb::Event {};
+struct Pong : qb::Event {};
+
+class Ponger final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Ping>(*this);
+        co_return true;
+    }
+    void
+    on(Ping const &event) {
+        push<Pong>(event.getSource());
+    }
+};
+
+class Pinger final : public qb::Actor {
+    const qb::ActorId _peer;
+    std::uint32_t     _count = 0;
+
+public:
+    explicit Pinger(qb::ActorId peer)
+        : _peer(peer) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Pong>(*this);
+        push<Ping>(_peer);
+        co_return true;
+    }
+    void
+    on(Pong const &) {
+        std::this_thread::sleep_for(1ms); // let the peer go idle between hops
+        if (++_count < kRoundTrips)
+            push<Ping>(_peer);
+        else {
+            push<qb::KillEvent>(_peer);
+            kill();
+        }
+    }
+};
+
+class TimerChain final : public qb::Actor {
+    std::uint32_t _fired = 0;
+
+    void
+    arm() {
+        qb::io::async::callback([this] {
+            if (++_fired < kTimers)
+                arm();
+            else
+                kill();
+        }, 5ms);
+    }
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        arm();
+        co_return true;
+    }
+};
+
+class Idler final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        qb::io::async::callback([this] { kill(); }, 300ms);
+        co_return true;
+    }
+};
+
+struct Run {
+    std::chrono::steady_clock::duration wall = std::chrono::steady_clock::duration::max();
+    std::chrono::nanoseconds            cpu{0}; ///< of the thread that ran core 0
+};
+
+std::chrono::nanoseconds
+thread_cpu() {
+    timespec ts{};
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+// start(false) runs core 0 on the calling thread, so its CPU time is this thread's.
+template <typename Setup>
+Run
+timed_run(Setup setup) {
+    auto done   = std::make_shared<std::promise<Run>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        Run        run;
+        const auto cpu_start = thread_cpu();
+        const auto start     = std::chrono::steady_clock::now();
+        main.start(false);
+        main.join();
+        run.wall = std::chrono::steady_clock::now() - start;
+        run.cpu  = thread_cpu() - cpu_start;
+        done->set_value(run);
+    }).detach();
+    if (future.wait_for(60s) != std::future_status::ready)
+        return {};
+    return future.get();
+}
+
+} // namespace
+
+TEST(IdlePolicy, DefaultsToCredit) {
+    qb::Main main;
+    EXPECT_EQ(main.core(0).getIdlePolicy().mode, qb::IdlePolicy::Mode::Credit);
+}
+
+TEST(IdlePolicy, EveryPolicyCarriesAPacedPingPong) {
+    struct Case {
+        char const    *name;
+        qb::IdlePolicy policy;
+        qb::duration   latency;
+    };
+    for (auto const &c : {Case{"credit", qb::IdlePolicy::credit(), kLatency},
+                          Case{"dedicated", qb::IdlePolicy::dedicated(), kLatency},
+                          Case{"adaptive", qb::IdlePolicy::adaptive(), kLatency},
+                          Case{"adaptive, latency 0", qb::IdlePolicy::adaptive(), qb::duration::zero()},
+                          Case{"power_saver", qb::IdlePolicy::power_saver(), kLatency}}) {
+        SCOPED_TRACE(c.name);
+        const auto run = timed_run([&c](qb::Main &main) {
+            for (qb::CoreId core : {0, 1})
+                main.core(core).setLatency(c.latency).setIdleWait(qb::IdleWait::EventLoop).setIdlePolicy(c.policy);
+            const auto ponger = main.addActor<Ponger>(1);
+            main.addActor<Pinger>(0, ponger);
+        });
+        ASSERT_NE(run.wall, std::chrono::steady_clock::duration::max()) << "engine did not terminate";
+        EXPECT_LT(run.wall, kBound);
+    }
+}
+
+TEST(IdlePolicy, DedicatedNeverParks) {
+    const auto run = timed_run([](qb::Main &main) {
+        // The condition-variable wait cannot see timers: a parking policy would hold each for 5 s.
+        main.core(0).setLatency(kLatency).setIdlePolicy(qb::IdlePolicy::dedicated());
+        main.addActor<TimerChain>(0);
+    });
+    ASSERT_NE(run.wall, std::chrono::steady_clock::duration::max()) << "engine did not terminate";
+    EXPECT_LT(run.wall, kBound) << kTimers << " chained 5 ms timers";
+}
+
+TEST(IdlePolicy, PowerSaverParksThroughIdleTime) {
+    const auto run = timed_run([](qb::Main &main) {
+        main.core(0).setLatency(kLatency).setIdleWait(qb::IdleWait::EventLoop).setIdlePolicy(qb::IdlePolicy::power_saver());
+        main.addActor<Idler>(0);
+    });
+    ASSERT_NE(run.wall, std::chrono::steady_clock::duration::max()) << "engine did not terminate";
+    EXPECT_GE(run.wall, 300ms);
+    EXPECT_LT(run.wall, kBound);
+    EXPECT_LT(run.cpu, 100ms) << "the core thread should sleep through its 300 ms idle stretch";
+}
@@ -0,0 +1,152 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/idle-wait.cpp
+ * @brief `IdleWait::EventLoop`: an idle core blocks in its I/O loop and every wake source ends it.
+ *
+ * Every core runs with a 5 s latency, so a single missed wakeup costs seconds and fails the
+ * time bound:
+ *   - cross-core ping-pong, each side pausing before it answers: every hop lands on a parked
+ *     core and must ring its doorbell;
+ *   - a chain of short `async::callback` timers on an otherwise idle core: the loop wakes on
+ *     its own I/O, which a core parked on the condition variable would only see at the latency.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/io/async.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kRoundTrips = 200;
+constexpr std::uint32_t kTimers     = 20;
+constexpr auto          kLatency    = 5s;
+constexpr auto          kBound      = 4s; // below one latency: no wakeup may be missed
+
+struct Ping : qb::Event {};
+struct Pong : qb::Event {};
+
+class Ponger final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Ping>(*this);
+        co_return true;
+    }
+    void
+    on(Ping const &event) {
+        push<Pong>(event.getSource());
+    }
+};
+
+class Pinger final : public qb::Actor {
+    const qb::ActorId _peer;
+    std::uint32_t     _count = 0;
+
+public:
+    explicit Pinger(qb::ActorId peer)
+        : _peer(peer) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Pong>(*this);
+        push<Ping>(_peer);
+        co_return true;
+    }
+    void
+    on(Pong const &) {
+        // Long enough for the peer to spend its spin credit and park before the next hop.
+        std::this_thread::sleep_for(1ms);
+        if (++_count < kRoundTrips)
+            push<Ping>(_peer);
+        else {
+            push<qb::KillEvent>(_peer);
+            kill();
+        }
+    }
+};
+
+class TimerChain final : public qb::Actor {
+    std::uint32_t _fired = 0;
+
+    void
+    arm() {
+        qb::io::async::callback([this] {
+            if (++_fired < kTimers)
+                arm();
+            else
+                kill();
+        }, 5ms);
+    }
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        arm();
+        co_return true;
+    }
+};
+
+template <typename Setup>
+std::chrono::steady_clock::duration
+timed_run(Setup setup) {
+    auto done   = std::make_shared<std::promise<std::chrono::steady_clock::duration>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        const auto start = std::chrono::steady_clock::now();
+        main.start(false);
+        main.join();
+        done->set_value(std::chrono::steady_clock::now() - start);
+    }).detach();
+    if (future.wait_for(60s) != std::future_status::ready)
+        return std::chrono::steady_clock::duration::max();
+    return future.get();
+}
+
+void
+park_in_event_loop(qb::Main &main, qb::CoreId const core) {
+    main.core(core).setLatency(kLatency).setIdleWait(qb::IdleWait::EventLoop);
+}
+
+} // namespace
+
+TEST(IdleWait, DefaultsToCondition) {
+    qb::Main main;
+    EXPECT_EQ(main.core(0).getIdleWait(), qb::IdleWait::Condition);
+}
+
+TEST(IdleWait, DoorbellWakesAParkedCoreOnEveryHop) {
+    const auto elapsed = timed_run([](qb::Main &main) {
+        park_in_event_loop(main, 0);
+        park_in_event_loop(main, 1);
+        const auto ponger = main.addActor<Ponger>(1);
+        main.addActor<Pinger>(0, ponger);
+    });
+    ASSERT_NE(elapsed, std::chrono::steady_clock::duration::max()) << "engine did not terminate";
+    EXPECT_LT(elapsed, kBound) << kRoundTrips << " round trips between two parked cores";
+}
+
+TEST(IdleWait, OwnTimersWakeAParkedCore) {
+    const auto elapsed = timed_run([](qb::Main &main) {
+        park_in_event_loop(main, 0);
+        main.addActor<TimerChain>(0);
+    });
+    ASSERT_NE(elapsed, std::chrono::steady_clock::duration::max()) << "engine did not terminate";
+    EXPECT_LT(elapsed, kBound) << kTimers << " chained 5 ms timers on a parked core";
+}
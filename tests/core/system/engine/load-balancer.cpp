@@ -0,0 +1,214 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/load-balancer.cpp
+ * @brief `qb::LoadBalancer` moves a busy movable actor off a saturated core, and only movable ones.
+ *
+ * Core 0 hosts four closed-loop workers (each handles a `Tick`, burns a little CPU, pushes the next
+ * `Tick` to itself) and one equally busy actor that does NOT override `onMigrate()`. Core 1 hosts
+ * nothing but its `LoadBalancer`. Core 0's busy ratio is ~1 and core 1's ~0, so the coordinator must
+ * migrate a worker to core 1; the first `Tick` a worker handles there stops the engine. The pinned
+ * actor is a candidate too — the balancer must take its refusal and never get it moved.
+ *
+ * A second case makes every core both hot and cold (`hot_ratio = 0`, `cold_ratio = 1`) and runs
+ * four actors that each work a fifth of the time, so every decision moves one from the busier
+ * core to the other and they would keep changing core. With a `min_residence` longer than the
+ * run, each moves at most once.
+ *
+ * The engine runs on a detached thread; a balancer that never acts is stopped by the watchdog and
+ * fails the test instead of hanging the suite.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/core/LoadBalancer.h>
+#include <qb/main.h>
+
+namespace {
+
+std::atomic<bool> g_worker_ran_on_1{false};
+std::atomic<bool> g_pinned_ran_on_1{false};
+std::atomic<int>  g_moves{0};
+
+struct Tick : qb::Event {};
+
+std::uint64_t
+burn(std::uint64_t mix) {
+    for (std::uint64_t i = 0; i < 500; ++i)
+        mix = (mix ^ (mix >> 31)) * 0xBF58476D1CE4E5B9ULL + i;
+    return mix;
+}
+
+class Worker final : public qb::Actor {
+    std::uint64_t _mix;
+    bool          _resumed;
+
+public:
+    explicit Worker(std::uint64_t mix = 1, bool resumed = false)
+        : _mix(mix)
+        , _resumed(resumed) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        if (!_resumed)
+            push<Tick>(id());
+        co_return true;
+    }
+
+    std::unique_ptr<qb::IActorFactory>
+    onMigrate() override {
+        return qb::make_migration<Worker>(_mix, true);
+    }
+
+    void
+    on(Tick const &) {
+        _mix = burn(_mix);
+        if (getIndex() == 1 && !g_worker_ran_on_1.exchange(true))
+            qb::Main::stop();
+        push<Tick>(id());
+    }
+};
+
+class Pinned final : public qb::Actor {
+    std::uint64_t _mix = 7;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        push<Tick>(id());
+        co_return true;
+    }
+
+    void
+    on(Tick const &) {
+        _mix = burn(_mix);
+        if (getIndex() != 0)
+            g_pinned_ran_on_1 = true;
+        push<Tick>(id());
+    }
+};
+
+/// Works 200 us of every millisecond, so a core's busy ratio follows how many roamers it hosts
+/// instead of sitting at 1 like a core running a closed-loop `Worker`. Counts its moves.
+class Roamer final
+    : public qb::Actor
+    , public qb::ICallback {
+    std::uint64_t _mix;
+    bool          _resumed;
+    std::uint64_t _next_ns = 0;
+
+public:
+    explicit Roamer(std::uint64_t mix = 3, bool resumed = false)
+        : _mix(mix)
+        , _resumed(resumed) {
+        if (resumed)
+            g_moves.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        registerCallback(*this);
+        co_return true;
+    }
+
+    std::unique_ptr<qb::IActorFactory>
+    onMigrate() override {
+        return qb::make_migration<Roamer>(_mix, true);
+    }
+
+    void
+    on(qb::LoopEvent const &loop) final {
+        if (loop.now < _next_ns)
+            return;
+        _next_ns = loop.now + 1'000'000u;
+        push<Tick>(id());
+    }
+
+    void
+    on(Tick const &) {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+        while (std::chrono::steady_clock::now() < until)
+            _mix = burn(_mix);
+    }
+};
+
+} // namespace
+
+TEST(LoadBalancer, MigratesABusyMovableActorToTheIdleCore) {
+    g_worker_ran_on_1 = false;
+    g_pinned_ran_on_1 = false;
+
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::Main main;
+        // The pinned actor is added first so it has the lowest SID and gets proposed first
+        // whenever it ties with a worker.
+        main.addActor<Pinned>(0);
+        for (int i = 0; i < 4; ++i)
+            main.addActor<Worker>(0);
+        qb::LoadBalancerPolicy policy;
+        policy.interval  = std::chrono::milliseconds{5};
+        policy.max_moves = 2;
+        policy.cooldown  = 0;
+        main.addActor<qb::LoadBalancer>(0, policy);
+        main.addActor<qb::LoadBalancer>(1, policy);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+
+    const bool finished = future.wait_for(std::chrono::seconds(20)) == std::future_status::ready;
+    if (!finished) {
+        qb::Main::stop();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready) << "engine did not stop";
+    }
+    EXPECT_TRUE(g_worker_ran_on_1.load()) << "no worker was migrated off the saturated core";
+    EXPECT_FALSE(g_pinned_ran_on_1.load()) << "an actor without onMigrate() must never move";
+}
+
+TEST(LoadBalancer, AMovedActorStaysForItsMinimumResidence) {
+    g_moves = 0;
+
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::Main main;
+        for (int i = 0; i < 4; ++i)
+            main.addActor<Roamer>(0);
+        qb::LoadBalancerPolicy policy;
+        policy.interval      = std::chrono::milliseconds{5};
+        policy.hot_ratio     = 0.0;
+        policy.cold_ratio    = 1.0;
+        policy.max_moves     = 2;
+        policy.cooldown      = 0;
+        policy.min_residence = std::chrono::minutes{10};
+        main.addActor<qb::LoadBalancer>(0, policy);
+        main.addActor<qb::LoadBalancer>(1, policy);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+
+    // About a hundred decisions: without the residence, the roamers would keep changing core.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    qb::Main::stop();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready) << "engine did not stop";
+    EXPECT_GE(g_moves.load(), 1) << "the balancer never moved anything";
+    EXPECT_LE(g_moves.load(), 4) << "a worker was moved again within its minimum residence";
+}
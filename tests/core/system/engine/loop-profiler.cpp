@@ -0,0 +1,212 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/loop-profiler.cpp
+ * @brief `Main::getCoreProfile()`: histogram arithmetic, and attribution when the profiler is in.
+ *
+ *   - `LatencyHistogram` buckets, mean and percentiles on known samples (always runs).
+ *   - Built without `QB_WITH_LOOP_PROFILER`: a profile is reported disabled and empty.
+ *   - Built with it: a handler that spins ~50 µs per event is charged to its event type and to
+ *     its actor, a cheap handler is not, and a callback actor's ticks land in its callback
+ *     histogram and in the pass-level one.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/icallback.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kEvents = 200;
+constexpr auto          kSpin   = std::chrono::microseconds(50);
+
+struct SlowEvent : qb::Event {};
+struct FastEvent : qb::Event {};
+
+class Worker final : public qb::Actor {
+    std::uint32_t _seen = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SlowEvent>(*this);
+        registerEvent<FastEvent>(*this);
+        co_return true;
+    }
+    void
+    on(SlowEvent const &) {
+        const auto until = std::chrono::steady_clock::now() + kSpin;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        if (++_seen == 2 * kEvents)
+            kill();
+    }
+    void
+    on(FastEvent const &) {
+        if (++_seen == 2 * kEvents)
+            kill();
+    }
+};
+
+class Ticker final
+    : public qb::Actor
+    , public qb::ICallback {
+    std::uint32_t _ticks = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerCallback(*this);
+        co_return true;
+    }
+    void
+    on(qb::LoopEvent const &) final {
+        if (++_ticks == 10)
+            kill();
+    }
+};
+
+class Driver final : public qb::Actor {
+    const qb::ActorId _slow;
+    const qb::ActorId _fast;
+
+public:
+    Driver(qb::ActorId slow, qb::ActorId fast)
+        : _slow(slow)
+        , _fast(fast) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t i = 0; i < kEvents; ++i) {
+            push<SlowEvent>(_slow);
+            push<FastEvent>(_fast);
+        }
+        for (std::uint32_t i = 0; i < kEvents; ++i) { // both workers stop at 2 * kEvents
+            push<FastEvent>(_slow);
+            push<FastEvent>(_fast);
+        }
+        kill();
+        co_return true;
+    }
+};
+
+struct Profiled {
+    qb::CoreProfile profile;
+    qb::ActorId     slow;
+    qb::ActorId     fast;
+    qb::ActorId     ticker;
+};
+
+bool
+run_engine(Profiled &run) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, &run] {
+        qb::Main main;
+        run.slow   = main.addActor<Worker>(0);
+        run.fast   = main.addActor<Worker>(0);
+        run.ticker = main.addActor<Ticker>(0);
+        main.addActor<Driver>(0, run.slow, run.fast);
+        main.start(false);
+        main.join();
+        run.profile = main.getCoreProfile(0);
+        done->set_value();
+    }).detach();
+    return future.wait_for(std::chrono::seconds(30)) == std::future_status::ready;
+}
+
+qb::CoreProfile::EventType const *
+find_type(qb::CoreProfile const &profile, qb::Event::id_type const id) {
+    for (auto const &entry : profile.event_types)
+        if (entry.id == id)
+            return &entry;
+    return nullptr;
+}
+
+qb::CoreProfile::ActorEntry const *
+find_actor(qb::CoreProfile const &profile, qb::ActorId const id) {
+    for (auto const &entry : profile.actors)
+        if (entry.id == id)
+            return &entry;
+    return nullptr;
+}
+
+} // namespace
+
+TEST(LoopProfiler, HistogramBucketsAndPercentiles) {
+    qb::LatencyHistogram h;
+    EXPECT_EQ(h.percentile(0.5), 0u);
+    EXPECT_EQ(qb::LatencyHistogram::bucket_of(0), 0u);
+    EXPECT_EQ(qb::LatencyHistogram::bucket_of(1), 1u);
+    EXPECT_EQ(qb::LatencyHistogram::bucket_of(1023), 10u);
+    EXPECT_EQ(qb::LatencyHistogram::bucket_of(1024), 11u);
+    EXPECT_EQ(qb::LatencyHistogram::bucket_of(~std::uint64_t{0}), qb::LatencyHistogram::Buckets - 1);
+
+    for (int i = 0; i < 90; ++i)
+        h.add(100); // bucket 7: [64, 128)
+    for (int i = 0; i < 10; ++i)
+        h.add(5000); // bucket 13: [4096, 8192)
+    EXPECT_EQ(h.count, 100u);
+    EXPECT_EQ(h.max_ns, 5000u);
+    EXPECT_DOUBLE_EQ(h.mean_ns(), 590.);
+    EXPECT_EQ(h.percentile(0.5), 127u);
+    EXPECT_EQ(h.percentile(0.9), 5000u) << "capped at the maximum";
+    EXPECT_EQ(h.percentile(1.0), 5000u);
+}
+
+TEST(LoopProfiler, DisabledBuildReportsAnEmptyProfile) {
+    if constexpr (qb::kLoopProfiler)
+        GTEST_SKIP() << "qb-core built with QB_WITH_LOOP_PROFILER";
+    Profiled run;
+    ASSERT_TRUE(run_engine(run)) << "engine did not terminate";
+    EXPECT_FALSE(run.profile.enabled);
+    EXPECT_TRUE(run.profile.event_types.empty());
+    EXPECT_TRUE(run.profile.actors.empty());
+    EXPECT_EQ(run.profile.callbacks.count, 0u);
+}
+
+TEST(LoopProfiler, ChargesHandlersAndCallbacksToTheirTypeAndActor) {
+    if constexpr (!qb::kLoopProfiler)
+        GTEST_SKIP() << "qb-core built without QB_WITH_LOOP_PROFILER";
+    Profiled run;
+    ASSERT_TRUE(run_engine(run)) << "engine did not terminate";
+    auto const &profile = run.profile;
+    ASSERT_TRUE(profile.enabled);
+
+    auto const *slow_type = find_type(profile, qb::Event::type_to_id<SlowEvent>());
+    auto const *fast_type = find_type(profile, qb::Event::type_to_id<FastEvent>());
+    ASSERT_NE(slow_type, nullptr);
+    ASSERT_NE(fast_type, nullptr);
+    EXPECT_EQ(slow_type->handler.count, kEvents);
+    EXPECT_EQ(fast_type->handler.count, 3 * kEvents);
+    EXPECT_GE(slow_type->handler.mean_ns(), 50'000.);
+    EXPECT_LT(fast_type->handler.percentile(0.5), 50'000u);
+
+    auto const *slow = find_actor(profile, run.slow);
+    auto const *fast = find_actor(profile, run.fast);
+    ASSERT_NE(slow, nullptr);
+    ASSERT_NE(fast, nullptr);
+    EXPECT_EQ(slow->events.count, 2 * kEvents);
+    EXPECT_EQ(fast->events.count, 2 * kEvents);
+    EXPECT_GE(slow->events.total_ns, kEvents * 50'000u);
+    EXPECT_LT(fast->events.total_ns, slow->events.total_ns);
+
+    auto const *ticker = find_actor(profile, run.ticker);
+    ASSERT_NE(ticker, nullptr);
+    EXPECT_EQ(ticker->callbacks.count, 10u);
+    EXPECT_EQ(ticker->events.count, 0u);
+    EXPECT_GE(profile.callbacks.count, 10u);
+    EXPECT_EQ(profile.untracked, 0u);
+}
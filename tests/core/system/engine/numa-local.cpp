@@ -0,0 +1,122 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/numa-local.cpp
+ * @brief `Main::setNumaLocal()` and `Main::spreadActors()` on a live engine.
+ *
+ *   - `setNumaLocal()` reaches every initializer and defaults to off.
+ *   - Actors placed by `spreadActors()` over the configured cores land where `CpuTopology::spread()`
+ *     says, and with every core NUMA-local each of them exchanges events with a collector on
+ *     core 0: binding the mailbox rings, event buffer and pipes must not lose or corrupt an event.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kWorkers = 4;
+constexpr std::uint32_t kRounds  = 1000;
+
+std::atomic<std::uint32_t> g_done{0};
+
+struct Tick : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+class Collector final : public qb::Actor {
+    std::uint32_t _finished = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        co_return true;
+    }
+    void
+    on(Tick &event) {
+        if (event.seq + 1 < kRounds) {
+            ++event.seq;
+            reply(event);
+        } else if (++_finished == kWorkers)
+            kill();
+    }
+};
+
+class Worker final : public qb::Actor {
+    const qb::ActorId _collector;
+    std::uint32_t     _expected = 0;
+
+public:
+    explicit Worker(qb::ActorId collector)
+        : _collector(collector) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        push<Tick>(_collector);
+        co_return true;
+    }
+    void
+    on(Tick &event) {
+        const bool in_order = event.seq == ++_expected;
+        if (!in_order)
+            event.seq = kRounds - 1; // let the collector finish; this worker is not counted
+        reply(event);
+        if (event.seq + 1 == kRounds) {
+            if (in_order)
+                g_done.fetch_add(1, std::memory_order_relaxed);
+            kill();
+        }
+    }
+};
+
+} // namespace
+
+TEST(NumaLocal, DefaultsOffAndReachesEveryCore) {
+    qb::Main main;
+    EXPECT_FALSE(main.core(0).isNumaLocal());
+    (void) main.core(1); // registers core 1
+    main.setNumaLocal();
+    EXPECT_TRUE(main.core(0).isNumaLocal());
+    EXPECT_TRUE(main.core(1).isNumaLocal());
+}
+
+TEST(NumaLocal, SpreadActorsExchangeOnBoundCores) {
+    g_done = 0;
+    auto done   = std::make_shared<std::promise<std::vector<qb::CoreId>>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::Main main;
+        const qb::CoreIdSet cores{0, 1};
+        const auto          collector = main.addActor<Collector>(0);
+        const auto          workers   = main.spreadActors<Worker>(cores, kWorkers, collector);
+        main.setNumaLocal();
+        main.start(false);
+        main.join();
+        std::vector<qb::CoreId> placed;
+        for (auto const &id : workers)
+            placed.push_back(id.index());
+        done->set_value(placed);
+    }).detach();
+    ASSERT_EQ(future.wait_for(60s), std::future_status::ready) << "engine did not terminate";
+
+    EXPECT_EQ(future.get(), qb::CoreSet::topology().spread({0, 1}, kWorkers));
+    EXPECT_EQ(g_done.load(), kWorkers) << "every worker saw its " << kRounds << " ticks in order";
+}
@@ -0,0 +1,247 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/recording.cpp
+ * @brief `CoreInitializer::setRecording()` and `qb::Replay`.
+ *
+ *   - Two cores record: core 1 sends small, multi-bucket, slab-resident (`SharedEventRef`) and
+ *     heap-owning events to a consumer on core 0. Core 0's file holds every one of them as
+ *     inbound, with payload bytes intact, and core 1's holds the same as outbound.
+ *   - A one-core engine replays core 0's file as fast as it can into the same consumer: it sees
+ *     the recorded sequence again, except the heap-owning events, which `Replay` skips.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/core/Recording.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kRounds = 500;
+
+struct Small : qb::Event {
+    std::uint32_t seq;
+    explicit Small(std::uint32_t s)
+        : seq(s) {}
+};
+struct Wide : qb::Event {
+    std::uint32_t seq;
+    std::uint8_t  bytes[200];
+    explicit Wide(std::uint32_t s)
+        : seq(s) {
+        for (std::size_t i = 0; i < sizeof(bytes); ++i)
+            bytes[i] = static_cast<std::uint8_t>(s + i);
+    }
+};
+/// Wide enough for the shared slab: crosses cores as a `SharedEventRef`.
+struct Large : qb::Event {
+    std::uint32_t seq;
+    std::uint8_t  bytes[1100];
+    explicit Large(std::uint32_t s)
+        : seq(s) {
+        std::memset(bytes, static_cast<int>(s & 0xFF), sizeof(bytes));
+    }
+};
+struct Owning : qb::Event {
+    std::vector<std::uint32_t> values;
+    std::uint32_t              seq;
+    explicit Owning(std::uint32_t s)
+        : values(4, s)
+        , seq(s) {}
+};
+struct Done : qb::Event {};
+
+struct Seen {
+    std::atomic<std::uint32_t> small{0}, wide{0}, large{0}, owning{0}, corrupt{0};
+    std::atomic<bool>          done{false};
+    void
+    reset() {
+        small = wide = large = owning = corrupt = 0;
+        done                                    = false;
+    }
+};
+Seen g_seen;
+
+std::atomic<std::uint64_t> g_injected{0};
+std::atomic<std::uint64_t> g_skipped{0};
+
+class Consumer final : public qb::Actor {
+    void
+    check(std::atomic<std::uint32_t> &counter, std::uint32_t const seq, bool const intact) {
+        if (counter.load(std::memory_order_relaxed) != seq || !intact)
+            g_seen.corrupt.fetch_add(1, std::memory_order_relaxed);
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Small>(*this);
+        registerEvent<Wide>(*this);
+        registerEvent<Large>(*this);
+        registerEvent<Owning>(*this);
+        registerEvent<Done>(*this);
+        co_return true;
+    }
+    void
+    on(Small const &event) {
+        check(g_seen.small, event.seq, true);
+    }
+    void
+    on(Wide const &event) {
+        bool intact = true;
+        for (std::size_t i = 0; i < sizeof(event.bytes); ++i)
+            intact = intact && event.bytes[i] == static_cast<std::uint8_t>(event.seq + i);
+        check(g_seen.wide, event.seq, intact);
+    }
+    void
+    on(Large const &event) {
+        check(g_seen.large, event.seq, event.bytes[0] == (event.seq & 0xFF) && event.bytes[sizeof(event.bytes) - 1] == (event.seq & 0xFF));
+    }
+    void
+    on(Owning const &event) {
+        check(g_seen.owning, event.seq, event.values.size() == 4 && event.values.back() == event.seq);
+    }
+    void
+    on(Done const &) {
+        g_seen.done = true;
+        kill();
+    }
+};
+
+class Producer final : public qb::Actor {
+    const qb::ActorId _to;
+
+public:
+    explicit Producer(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t seq = 0; seq < kRounds; ++seq) {
+            push<Small>(_to, seq);
+            push<Wide>(_to, seq);
+            push<Large>(_to, seq);
+            push<Owning>(_to, seq);
+        }
+        push<Done>(_to);
+        kill();
+        co_return true;
+    }
+};
+
+class Watcher final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<qb::ReplayDone>(*this);
+        co_return true;
+    }
+    void
+    on(qb::ReplayDone const &event) {
+        g_injected = event.injected;
+        g_skipped  = event.skipped;
+        kill();
+    }
+};
+
+/// Event records of @p file by kind, then by type name.
+std::map<qb::RecordKind, std::map<std::string, std::uint32_t>>
+census(std::string const &file, std::uint32_t &owning_flags, std::uint32_t &bad_payloads) {
+    std::map<qb::RecordKind, std::map<std::string, std::uint32_t>> out;
+    qb::Recording                                                  recording;
+    if (!recording.open(file))
+        return out;
+    qb::RecordView record;
+    while (recording.next(record)) {
+        auto const &entry = *record.entry;
+        char const *name  = recording.type_name(entry.type);
+        ++out[entry.kind][name ? name : "?"];
+        if (entry.flags & qb::RecordEntry::Owning)
+            ++owning_flags;
+        // The payload is the event itself: its own header repeats the entry's.
+        std::uint32_t dest = 0;
+        std::memcpy(&dest, record.payload + 8, sizeof(dest));
+        if (dest != entry.dest)
+            ++bad_payloads;
+    }
+    return out;
+}
+
+TEST(Recording, RecordsBothSidesAndReplaysIntoOneCore) {
+    const auto dir = std::filesystem::temp_directory_path() / ("qb-recording-" + std::to_string(::getpid()));
+    std::filesystem::remove_all(dir);
+
+    qb::ServiceId recorded_sid = 0;
+    {
+        qb::Main main;
+        const auto consumer = main.addActor<Consumer>(0);
+        main.addActor<Producer>(1, consumer);
+        main.setRecording(dir.string());
+        recorded_sid = consumer.sid();
+        main.start();
+        main.join();
+        EXPECT_FALSE(main.hasError());
+    }
+    ASSERT_TRUE(g_seen.done.load());
+    ASSERT_EQ(g_seen.corrupt.load(), 0u);
+
+    const auto core0 = (dir / "core-0.qbrec").string();
+    const auto core1 = (dir / "core-1.qbrec").string();
+    std::uint32_t owning0 = 0, owning1 = 0, bad = 0;
+    auto          in  = census(core0, owning0, bad);
+    auto          out = census(core1, owning1, bad);
+    EXPECT_EQ(bad, 0u);
+    auto const &received = in[qb::RecordKind::Inbound];
+    auto const &sent     = out[qb::RecordKind::Outbound];
+    for (char const *name : {qb::Event::type_to_name<Small>(), qb::Event::type_to_name<Wide>(), qb::Event::type_to_name<Large>(),
+                             qb::Event::type_to_name<Owning>()}) {
+        EXPECT_EQ(received.count(name) ? received.at(name) : 0u, kRounds) << name;
+        EXPECT_EQ(sent.count(name) ? sent.at(name) : 0u, kRounds) << name;
+    }
+    EXPECT_EQ(owning0, kRounds);
+    EXPECT_EQ(owning1, kRounds);
+
+    g_seen.reset();
+    {
+        qb::Main   main;
+        const auto consumer = main.addActor<Consumer>(0);
+        const auto watcher  = main.addActor<Watcher>(0);
+        ASSERT_EQ(consumer.sid(), recorded_sid) << "the default route keeps the recorded sid";
+        qb::ReplayPolicy policy;
+        policy.file   = core0;
+        policy.speed  = 0;
+        policy.notify = watcher;
+        main.addActor<qb::Replay>(0, policy);
+        main.start();
+        main.join();
+        EXPECT_FALSE(main.hasError());
+    }
+    EXPECT_TRUE(g_seen.done.load());
+    EXPECT_EQ(g_seen.corrupt.load(), 0u);
+    EXPECT_EQ(g_seen.small.load(), kRounds);
+    EXPECT_EQ(g_seen.wide.load(), kRounds);
+    EXPECT_EQ(g_seen.large.load(), kRounds);
+    EXPECT_EQ(g_seen.owning.load(), 0u) << "heap-owning records are not replayable";
+    EXPECT_EQ(g_injected.load(), 3u * kRounds + 1u);
+    EXPECT_EQ(g_skipped.load(), kRounds);
+
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace
@@ -0,0 +1,332 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/task-pool.cpp
+ * @brief The per-core work-stealing task queues, through `qb::offload` / `parallel_for` / `map_reduce`.
+ *
+ * What is pinned:
+ *   - an offloaded closure's value, `void` completion and exception all come back to the awaiting
+ *     coroutine, which resumes on its own core's thread;
+ *   - an idle core **steals**: core 0 holds its first chunk until another thread has run one, which
+ *     only a steal by core 1 can satisfy, and every index still runs exactly once;
+ *   - `map_reduce` folds chunk results in index order, whichever core ran them;
+ *   - the event form pushes the caller's own event type built from the result;
+ *   - a task awaited inside an async `onInit()` is delivered through the activation gate;
+ *   - a task whose awaiter was cancelled (its actor killed) is freed, run or not.
+ *
+ * Effects are mirrored to file-scope atomics and asserted after `join()`.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <qb/actor.h>
+#include <qb/core/patterns.h>
+#include <qb/io/async.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct Done : qb::Event {};
+
+// Lives on core 1 with nothing to do, so that core is idle and steals.
+class Idler final : public qb::Actor {};
+
+// ---------------------------------------------------------------------------
+// 1. offload: value, void and exception, resumed on the calling core.
+// ---------------------------------------------------------------------------
+std::atomic<int>  g_value{0};
+std::atomic<bool> g_void_ran{false};
+std::atomic<bool> g_rethrown{false};
+std::atomic<bool> g_same_thread{false};
+
+class Offloader final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Done>(*this);
+        spawn([](qb::ScopedCoroContext ctx) -> qb::io::async::task<void> {
+            const auto home = std::this_thread::get_id();
+            g_value         = co_await qb::offload(ctx, [] { return 6 * 7; });
+            co_await qb::offload(ctx, [] { g_void_ran = true; });
+            try {
+                (void) co_await qb::offload(ctx, []() -> int { throw std::runtime_error("boom"); });
+            } catch (std::runtime_error const &e) {
+                g_rethrown = std::string(e.what()) == "boom";
+            }
+            g_same_thread = std::this_thread::get_id() == home;
+            ctx.push<Done>();
+        });
+        co_return true;
+    }
+    void
+    on(Done const &) {
+        kill();
+    }
+};
+
+TEST(TaskPool, OffloadResolvesOnTheCallingCore) {
+    qb::Main main;
+    main.addActor<Offloader>(0);
+    main.start(false);
+    main.join();
+    EXPECT_FALSE(main.hasError());
+    EXPECT_EQ(g_value.load(), 42);
+    EXPECT_TRUE(g_void_ran.load());
+    EXPECT_TRUE(g_rethrown.load()) << "the closure's exception must be rethrown at the co_await";
+    EXPECT_TRUE(g_same_thread.load());
+}
+
+// ---------------------------------------------------------------------------
+// 2. parallel_for: an idle core steals, every index runs once.
+// ---------------------------------------------------------------------------
+constexpr std::size_t                  kIndices = 4096;
+std::array<std::atomic<int>, kIndices> g_hits{};
+std::atomic<std::thread::id>           g_owner_thread{};
+std::atomic<bool>                      g_foreign_ran{false};
+std::atomic<bool>                      g_every_index_once{false};
+
+class Splitter final : public qb::Actor {
+    const qb::ActorId _idler;
+
+public:
+    explicit Splitter(qb::ActorId idler)
+        : _idler(idler) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Done>(*this);
+        g_owner_thread = std::this_thread::get_id();
+        spawn([](qb::ScopedCoroContext ctx) -> qb::io::async::task<void> {
+            co_await qb::parallel_for(
+                ctx, 0, kIndices,
+                [](std::size_t const i) {
+                    if (std::this_thread::get_id() != g_owner_thread.load())
+                        g_foreign_ran = true;
+                    else {
+                        // Hold core 0 until core 1 ran a chunk: only a steal gets one there.
+                        const auto until = std::chrono::steady_clock::now() + 10s;
+                        while (!g_foreign_ran.load() && std::chrono::steady_clock::now() < until)
+                            std::this_thread::yield();
+                    }
+                    g_hits[i].fetch_add(1);
+                },
+                64);
+            bool once = true;
+            for (auto const &hit : g_hits)
+                once = once && hit.load() == 1;
+            g_every_index_once = once;
+            ctx.push<Done>();
+        });
+        co_return true;
+    }
+    void
+    on(Done const &) {
+        push<qb::KillEvent>(_idler);
+        kill();
+    }
+};
+
+TEST(TaskPool, IdleCoreStealsChunksAndEveryIndexRunsOnce) {
+    qb::Main main;
+    const auto idler = main.addActor<Idler>(1);
+    main.addActor<Splitter>(0, idler);
+    main.start(false);
+    main.join();
+    EXPECT_FALSE(main.hasError());
+    EXPECT_TRUE(g_foreign_ran.load()) << "core 1 never stole a chunk";
+    EXPECT_TRUE(g_every_index_once.load());
+}
+
+// ---------------------------------------------------------------------------
+// 3. map_reduce: folded in index order.
+// ---------------------------------------------------------------------------
+std::string g_folded;
+std::string g_expected;
+
+class Reducer final : public qb::Actor {
+    const qb::ActorId _idler;
+
+public:
+    explicit Reducer(qb::ActorId idler)
+        : _idler(idler) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Done>(*this);
+        for (std::size_t i = 0; i < 500; ++i)
+            g_expected += static_cast<char>('a' + i % 26);
+        spawn([](qb::ScopedCoroContext ctx) -> qb::io::async::task<void> {
+            // Concatenation is associative but not commutative: any out-of-order fold shows.
+            g_folded = co_await qb::map_reduce(
+                ctx, 0, 500, std::string{}, [](std::size_t const i) { return std::string(1, static_cast<char>('a' + i % 26)); },
+                [](std::string a, std::string const &b) { return a + b; }, 7);
+            ctx.push<Done>();
+        });
+        co_return true;
+    }
+    void
+    on(Done const &) {
+        push<qb::KillEvent>(_idler);
+        kill();
+    }
+};
+
+TEST(TaskPool, MapReduceFoldsInIndexOrder) {
+    qb::Main main;
+    const auto idler = main.addActor<Idler>(1);
+    main.addActor<Reducer>(0, idler);
+    main.start(false);
+    main.join();
+    EXPECT_FALSE(main.hasError());
+    EXPECT_EQ(g_folded, g_expected);
+}
+
+// ---------------------------------------------------------------------------
+// 4. Event form: the result arrives as the caller's own event.
+// ---------------------------------------------------------------------------
+std::atomic<int> g_event_value{0};
+
+struct Computed : qb::Event {
+    int value;
+    explicit Computed(int v)
+        : value(v) {}
+};
+
+class EventOffloader final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Computed>(*this);
+        co_return qb::offload<Computed>(*this, [] { return 1234; });
+    }
+    void
+    on(Computed const &event) {
+        g_event_value = event.value;
+        kill();
+    }
+};
+
+TEST(TaskPool, EventFormPushesTheCallersEvent) {
+    qb::Main main;
+    main.addActor<EventOffloader>(0);
+    main.start(false);
+    main.join();
+    EXPECT_FALSE(main.hasError());
+    EXPECT_EQ(g_event_value.load(), 1234);
+}
+
+// ---------------------------------------------------------------------------
+// 5. Awaited from inside an async onInit(): passes the activation gate.
+// ---------------------------------------------------------------------------
+std::atomic<int> g_init_value{0};
+
+class InitOffloader final : public qb::Actor {
+    int _value = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Done>(*this);
+        _value = co_await qb::offload(context(), [] { return 99; });
+        push<Done>(id());
+        co_return true;
+    }
+    void
+    on(Done const &) {
+        g_init_value = _value;
+        kill();
+    }
+};
+
+TEST(TaskPool, AwaitedInsideOnInit) {
+    qb::Main main;
+    main.addActor<InitOffloader>(0);
+    main.start(false);
+    main.join();
+    EXPECT_FALSE(main.hasError());
+    EXPECT_EQ(g_init_value.load(), 99);
+}
+
+// ---------------------------------------------------------------------------
+// 6. A cancelled wait: the awaiter throws, and the group and its closure are freed.
+// ---------------------------------------------------------------------------
+std::atomic<int>  g_live_closures{0};
+std::atomic<bool> g_cancelled{false};
+
+struct Tracked {
+    Tracked() { ++g_live_closures; }
+    Tracked(Tracked const &) { ++g_live_closures; }
+    Tracked(Tracked &&) noexcept { ++g_live_closures; }
+    ~Tracked() { --g_live_closures; }
+};
+
+struct TrackedJob {
+    Tracked tracked;
+    int
+    operator()() const {
+        return 1;
+    }
+};
+
+// Keeps core 0 running until the cancelled coroutine has resumed.
+class Witness final : public qb::Actor {};
+
+class Abandoner final : public qb::Actor {
+    const qb::ActorId _witness;
+
+public:
+    explicit Abandoner(qb::ActorId witness)
+        : _witness(witness) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Done>(*this);
+        // The TaskDoneEvent is pushed only once the chunk ran, a pass after Done is: the actor is
+        // always dead by the time it lands.
+        spawn([witness = _witness](qb::ScopedCoroContext ctx) -> qb::io::async::task<void> {
+            TrackedJob job; // named: a temporary in the co_await operand trips GCC 12's frame copy
+            try {
+                (void) co_await qb::offload(ctx, std::move(job));
+            } catch (qb::io::async::cancelled_error const &) {
+                g_cancelled = true;
+            }
+            ctx.push_to<qb::KillEvent>(witness);
+        });
+        push<Done>(id());
+        co_return true;
+    }
+    void
+    on(Done const &) {
+        kill();
+    }
+};
+
+TEST(TaskPool, CancelledWaitFreesTheTask) {
+    {
+        qb::Main main;
+        const auto witness = main.addActor<Witness>(0);
+        main.addActor<Abandoner>(0, witness);
+        main.start(false);
+        main.join();
+        EXPECT_FALSE(main.hasError());
+        EXPECT_TRUE(g_cancelled.load());
+    }
+    EXPECT_EQ(g_live_closures.load(), 0) << "the task group leaked with its closure";
+}
+
+} // namespace
@@ -0,0 +1,228 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/engine/telemetry.cpp
+ * @brief `qb::Telemetry` publishes every core's counters, over its Unix socket and to its file.
+ *
+ *   - `Telemetry::render()` lays a sample out as documented.
+ *   - Two cores, one `Telemetry` each. Core 1 blasts QoS-0 events at a sink on core 0, whose
+ *     mailbox ring is the minimum size, so most are dropped; it also parks events for an actor
+ *     whose `onInit()` is still sleeping. The test scrapes the socket until core 1's report
+ *     shows the drops and the stash, then stops the engine: the file then holds the final
+ *     document, and the drops it reports plus the events the sink saw add up to the blast.
+ *
+ * The engine runs on a detached thread and is stopped with `Main::stop()` (process-wide).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <qb/core/Telemetry.h>
+#include <qb/json.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kBlast   = 10000;
+constexpr std::uint32_t kStashed = 5;
+
+std::atomic<std::uint32_t> g_sunk{0};
+
+struct Burst : qb::EventQOS0 {};
+struct Parked : qb::Event {};
+
+class Sink final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Burst>(*this);
+        co_return true;
+    }
+    void
+    on(Burst const &) {
+        g_sunk.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+class Sleeper final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Parked>(*this);
+        co_await context().sleep(3s); // Activating for the whole test: its events are stashed
+        co_return true;
+    }
+    void
+    on(Parked const &) {}
+};
+
+class Blaster final : public qb::Actor {
+    const qb::ActorId _sink;
+    const qb::ActorId _sleeper;
+
+public:
+    Blaster(qb::ActorId sink, qb::ActorId sleeper)
+        : _sink(sink)
+        , _sleeper(sleeper) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t i = 0; i < kBlast; ++i)
+            push<Burst>(_sink);
+        for (std::uint32_t i = 0; i < kStashed; ++i)
+            push<Parked>(_sleeper);
+        kill();
+        co_return true;
+    }
+};
+
+std::string
+scrape(std::string const &path) {
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return {};
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    path.copy(addr.sun_path, sizeof(addr.sun_path) - 1);
+    std::string out;
+    if (::connect(fd, reinterpret_cast<sockaddr const *>(&addr), sizeof(addr)) == 0) {
+        char    buffer[4096];
+        ssize_t n;
+        while ((n = ::read(fd, buffer, sizeof(buffer))) > 0)
+            out.append(buffer, static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+    return out;
+}
+
+qb::json const *
+core_of(qb::json const &doc, qb::CoreId const core) {
+    for (auto const &entry : doc.at("cores"))
+        if (entry.at("core").get<qb::CoreId>() == core)
+            return &entry;
+    return nullptr;
+}
+
+} // namespace
+
+TEST(Telemetry, RendersTheDocumentedShape) {
+    qb::CoreTelemetry sample;
+    sample.core                    = 3;
+    sample.loop_passes             = 42;
+    sample.qos0_drops              = 7;
+    sample.mailbox_capacity        = 16;
+    sample.inbound.stalled_flushes = 2;
+    sample.activating              = 1;
+    sample.activation_stashed      = 9;
+    sample.watchers                = 4;
+    sample.tasks_stolen            = 5;
+    sample.packed_events           = 11;
+    sample.free_ids                = 65000;
+    sample.redirects               = 2;
+
+    const auto doc = qb::json::parse(qb::Telemetry::render({sample}, 1234));
+    EXPECT_EQ(doc.at("timestamp_ns").get<std::uint64_t>(), 1234u);
+    ASSERT_EQ(doc.at("cores").size(), 1u);
+    auto const &core = doc.at("cores").at(0);
+    EXPECT_EQ(core.at("core").get<int>(), 3);
+    EXPECT_EQ(core.at("loop_passes").get<std::uint64_t>(), 42u);
+    EXPECT_EQ(core.at("flush").at("qos0_drops").get<std::uint64_t>(), 7u);
+    EXPECT_EQ(core.at("flush").at("packed").get<std::uint64_t>(), 11u);
+    EXPECT_EQ(core.at("mailbox").at("capacity").get<std::uint64_t>(), 16u);
+    EXPECT_EQ(core.at("mailbox").at("stalled_flushes").get<std::uint64_t>(), 2u);
+    EXPECT_EQ(core.at("activating").at("actors").get<std::uint64_t>(), 1u);
+    EXPECT_EQ(core.at("activating").at("stashed_events").get<std::uint64_t>(), 9u);
+    EXPECT_EQ(core.at("io").at("watchers").get<std::uint64_t>(), 4u);
+    EXPECT_EQ(core.at("tasks").at("stolen").get<std::uint64_t>(), 5u);
+    EXPECT_EQ(core.at("free_ids").get<std::uint64_t>(), 65000u);
+    EXPECT_EQ(core.at("migration").at("redirects").get<std::uint64_t>(), 2u);
+}
+
+TEST(Telemetry, ExportsDropsAndStashesOverSocketAndFile) {
+    const auto tag    = std::to_string(::getpid());
+    const auto file   = (std::filesystem::temp_directory_path() / ("qb-telemetry-" + tag + ".json")).string();
+    const auto socket = "/tmp/qb-telemetry-" + tag + ".sock"; // sun_path is ~100 bytes
+    std::filesystem::remove(file);
+    g_sunk = 0;
+
+    qb::TelemetryPolicy policy;
+    policy.interval    = 20ms;
+    policy.file        = file;
+    policy.unix_socket = socket;
+
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, policy] {
+        qb::Main main;
+        main.core(0).setMailboxCapacity(qb::CoreInitializer::MinMailboxCapacity);
+        const auto sink    = main.addActor<Sink>(0);
+        const auto sleeper = main.addActor<Sleeper>(1);
+        main.addActor<Blaster>(1, sink, sleeper);
+        main.addActor<qb::Telemetry>(0, policy);
+        main.addActor<qb::Telemetry>(1, policy);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+
+    // Scrape until core 1 has reported the blast and the parked events.
+    std::optional<qb::json> live;
+    for (const auto deadline = std::chrono::steady_clock::now() + 10s; std::chrono::steady_clock::now() < deadline;
+         std::this_thread::sleep_for(10ms)) {
+        const auto text = scrape(socket);
+        if (text.empty())
+            continue;
+        auto        doc   = qb::json::parse(text);
+        auto const *core1 = core_of(doc, 1);
+        if (core1 && core1->at("flush").at("qos0_drops").get<std::uint64_t>() > 0
+            && core1->at("activating").at("stashed_events").get<std::uint64_t>() == kStashed) {
+            live = std::move(doc);
+            break;
+        }
+    }
+    qb::Main::stop();
+    ASSERT_EQ(future.wait_for(30s), std::future_status::ready) << "engine did not terminate";
+    ASSERT_TRUE(live.has_value()) << "no scrape showed core 1's drops and stash";
+
+    auto const &core1 = *core_of(*live, 1);
+    EXPECT_EQ(core1.at("activating").at("actors").get<std::uint64_t>(), 1u);
+    EXPECT_GE(core1.at("io").at("coro_active").get<std::uint64_t>(), 1u) << "the sleeping onInit";
+    EXPECT_GE(core1.at("events").at("sent").get<std::uint64_t>(), kBlast);
+    auto const *core0 = core_of(*live, 0);
+    ASSERT_NE(core0, nullptr);
+    EXPECT_EQ(core0->at("mailbox").at("capacity").get<std::uint64_t>(), qb::CoreInitializer::MinMailboxCapacity);
+
+    std::ifstream in(file);
+    ASSERT_TRUE(in) << "no document at " << file;
+    std::stringstream text;
+    text << in.rdbuf();
+    const auto final_doc = qb::json::parse(text.str());
+    ASSERT_EQ(final_doc.at("cores").size(), 2u);
+    const auto drops = core_of(final_doc, 1)->at("flush").at("qos0_drops").get<std::uint64_t>();
+    EXPECT_EQ(g_sunk.load() + drops, kBlast) << "every QoS-0 event is either delivered or counted as dropped";
+    const auto high_water = core_of(final_doc, 0)->at("mailbox").at("high_water").get<std::uint64_t>();
+    EXPECT_GT(high_water, 0u);
+    EXPECT_LE(high_water, qb::CoreInitializer::MinMailboxCapacity);
+    EXPECT_FALSE(std::filesystem::exists(socket)) << "the collector removes its socket";
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,416 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/lifecycle/actor-migration.cpp
+ * @brief `Actor::migrate()` moves a live actor to another VirtualCore without losing a message.
+ *
+ * The driver (core 0) sends `kBefore` hits to a counter on core 0, asks the engine to move it to
+ * core 1, then keeps sending `kDuring` hits to the OLD id before the outcome is known. When the
+ * `MigratedEvent` arrives it sends `kAfter` hits to the NEW id and asks for a report. Every hit
+ * must be accounted for exactly once, on core 1, with the counter's move-only state intact:
+ *
+ *  - hits sent before the request are handled by the original instance and carried over by its
+ *    `onMigrate()` factory;
+ *  - hits sent to the old id while the transfer is in flight are parked in core 0's redirection
+ *    table and forwarded once the new id is known;
+ *  - the report, sent to the new id, queues behind the forwarded hits (same core-0 → core-1 pipe).
+ *
+ * A second case pins the refusal path: an actor that does not override `onMigrate()` stays where
+ * it is, keeps serving its id, and the requester is told `migrated == NotFound` without `busy`;
+ * an actor with a coroutine in flight is refused with `busy` set, since a later retry may
+ * succeed.
+ *
+ * A third case bounces one actor between two cores many times with no redirect grace period and
+ * reads each core's `Telemetry`: once the last migration has settled, no redirection entry is
+ * left and every old id is back in its core's pool, so repeated migrations neither grow the
+ * table nor use up ids.
+ *
+ * The engine runs on a detached thread behind a watchdog so a lost settlement fails the test
+ * instead of hanging the suite.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/core/Telemetry.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint64_t kBefore = 100;
+constexpr std::uint64_t kDuring = 100;
+constexpr std::uint64_t kAfter  = 100;
+
+std::atomic<std::uint64_t> g_reported_hits{0};
+std::atomic<int>           g_reported_core{-1};
+std::atomic<int>           g_reported_token{0};
+std::atomic<bool>          g_migrated_valid{false};
+std::atomic<int>           g_migrated_core{-1};
+std::atomic<bool>          g_refused{false};
+std::atomic<bool>          g_pinned_served{false};
+std::atomic<bool>          g_pinned_busy{true};
+std::atomic<bool>          g_drowsy_busy{false};
+std::atomic<int>           g_counters_built{0};
+
+void
+reset() {
+    g_reported_hits  = 0;
+    g_reported_core  = -1;
+    g_reported_token = 0;
+    g_migrated_valid = false;
+    g_migrated_core  = -1;
+    g_refused        = false;
+    g_pinned_served  = false;
+    g_pinned_busy    = true;
+    g_drowsy_busy    = false;
+    g_counters_built = 0;
+}
+
+struct HitEvent : qb::Event {};
+struct ReportEvent : qb::Event {
+    std::uint64_t hits  = 0;
+    int           core  = -1;
+    int           token = 0;
+};
+
+/// Movable: its state is a plain counter plus a move-only member, both handed to the factory.
+class Counter final : public qb::Actor {
+    std::uint64_t        _hits;
+    std::unique_ptr<int> _token;
+
+public:
+    explicit Counter(std::uint64_t hits = 0, std::unique_ptr<int> token = std::make_unique<int>(42))
+        : _hits(hits)
+        , _token(std::move(token)) {
+        g_counters_built.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<HitEvent>(*this);
+        registerEvent<ReportEvent>(*this);
+        co_return true;
+    }
+
+    std::unique_ptr<qb::IActorFactory>
+    onMigrate() override {
+        return qb::make_migration<Counter>(_hits, std::move(_token));
+    }
+
+    void
+    on(HitEvent const &) {
+        ++_hits;
+    }
+    void
+    on(ReportEvent &event) {
+        event.hits  = _hits;
+        event.core  = static_cast<int>(getIndex());
+        event.token = _token ? *_token : 0;
+        reply(event);
+    }
+};
+
+/// Not movable: keeps the default `onMigrate()`.
+class Pinned final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<HitEvent>(*this);
+        co_return true;
+    }
+    void
+    on(HitEvent const &event) {
+        g_pinned_served.store(true, std::memory_order_relaxed);
+        push<HitEvent>(event.getSource());
+    }
+};
+
+/// Movable, but busy when the driver asks to move it: a coroutine it spawned is still asleep.
+class Drowsy final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        spawn([](qb::ScopedCoroContext ctx) -> qb::io::async::task<void> { co_await ctx.sleep(std::chrono::milliseconds(300)); });
+        co_return true;
+    }
+    std::unique_ptr<qb::IActorFactory>
+    onMigrate() override {
+        return qb::make_migration<Drowsy>();
+    }
+};
+
+/// Keeps core 1 alive until the driver is done.
+class Idle final : public qb::Actor {};
+
+class Driver final : public qb::Actor {
+    const qb::ActorId _counter;
+    const qb::ActorId _pinned;
+    const qb::ActorId _drowsy;
+    const qb::ActorId _idle;
+    qb::ActorId       _moved;
+
+public:
+    Driver(qb::ActorId counter, qb::ActorId pinned, qb::ActorId drowsy, qb::ActorId idle)
+        : _counter(counter)
+        , _pinned(pinned)
+        , _drowsy(drowsy)
+        , _idle(idle) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<qb::MigratedEvent>(*this);
+        registerEvent<ReportEvent>(*this);
+        registerEvent<HitEvent>(*this);
+        for (std::uint64_t i = 0; i < kBefore; ++i)
+            push<HitEvent>(_counter);
+        migrate(_counter, 1);
+        for (std::uint64_t i = 0; i < kDuring; ++i)
+            push<HitEvent>(_counter);
+        migrate(_pinned, 1);
+        migrate(_drowsy, 1);
+        co_return true;
+    }
+
+    void
+    on(qb::MigratedEvent const &event) {
+        if (event.origin == _pinned) {
+            g_refused.store(!event.migrated.is_valid(), std::memory_order_relaxed);
+            g_pinned_busy.store(event.busy, std::memory_order_relaxed);
+            push<HitEvent>(_pinned); // the refused actor must still answer on its id
+            return;
+        }
+        if (event.origin == _drowsy) {
+            g_drowsy_busy.store(!event.migrated.is_valid() && event.busy, std::memory_order_relaxed);
+            return;
+        }
+        g_migrated_valid.store(event.migrated.is_valid(), std::memory_order_relaxed);
+        g_migrated_core.store(event.migrated.index(), std::memory_order_relaxed);
+        _moved = event.migrated;
+        if (!_moved.is_valid()) {
+            finish();
+            return;
+        }
+        for (std::uint64_t i = 0; i < kAfter; ++i)
+            push<HitEvent>(_moved);
+        push<ReportEvent>(_moved);
+    }
+
+    void
+    on(ReportEvent const &event) {
+        g_reported_hits.store(event.hits, std::memory_order_relaxed);
+        g_reported_core.store(event.core, std::memory_order_relaxed);
+        g_reported_token.store(event.token, std::memory_order_relaxed);
+        finish();
+    }
+
+    void
+    on(HitEvent const &) {
+        // Pinned's echo: nothing to do, the flag is set on its side.
+    }
+
+private:
+    void
+    finish() {
+        if (_moved.is_valid())
+            push<qb::KillEvent>(_moved);
+        push<qb::KillEvent>(_pinned);
+        push<qb::KillEvent>(_drowsy);
+        push<qb::KillEvent>(_idle);
+        kill();
+    }
+};
+
+constexpr int           kBounces        = 200;
+constexpr std::uint64_t kSettleBudgetNs = 10'000'000'000; // 10 s
+
+std::atomic<int>           g_bounces{0};
+std::atomic<std::uint32_t> g_max_sid{0};
+std::atomic<std::uint64_t> g_free_ids_before{0};
+std::atomic<std::uint64_t> g_free_ids_after{0};
+std::atomic<std::uint64_t> g_redirects_after{~std::uint64_t{0}};
+
+/// Moves a counter back and forth between cores 0 and 1, reading telemetry before and after.
+class Bouncer final
+    : public qb::Actor
+    , public qb::ICallback {
+    qb::ActorId   _counter;
+    qb::ActorId   _idle;
+    std::uint64_t _since_ns    = 0;
+    std::uint64_t _deadline_ns = 0;
+    bool          _bouncing    = false;
+
+    // The sum over both cores, or nothing until both have been sampled after `_since_ns`.
+    // Each core stamps its sample with its own loop time, so "after" is only approximate
+    // across cores: the end of the test waits for the counts, not for a fresh sample.
+    [[nodiscard]] bool
+    sampled(std::uint64_t &free_ids, std::uint64_t &redirects) const {
+        free_ids = redirects = 0;
+        const auto cores     = getService<qb::Telemetry>()->snapshot();
+        if (cores.size() != 2)
+            return false;
+        for (auto const &core : cores) {
+            if (core.sampled_ns <= _since_ns)
+                return false;
+            free_ids += core.free_ids;
+            redirects += core.redirects;
+        }
+        return true;
+    }
+
+public:
+    Bouncer(qb::ActorId counter, qb::ActorId idle)
+        : _counter(counter)
+        , _idle(idle) {}
+
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<qb::MigratedEvent>(*this);
+        registerCallback(*this);
+        _since_ns = time();
+        co_return true;
+    }
+
+    void
+    on(qb::LoopEvent const &) final {
+        if (_bouncing)
+            return;
+        std::uint64_t free_ids = 0, redirects = 0;
+        if (!sampled(free_ids, redirects))
+            return;
+        if (!g_free_ids_before.load(std::memory_order_relaxed)) {
+            g_free_ids_before.store(free_ids, std::memory_order_relaxed);
+            _bouncing = true;
+            migrate(_counter, 1);
+            return;
+        }
+        // Keep sampling until the last redirects are gone and their ids are back, or the
+        // deadline passes, in which case the counts are reported as they stand.
+        const bool settled = !redirects && free_ids == g_free_ids_before.load(std::memory_order_relaxed);
+        if (!settled && time() < _deadline_ns)
+            return;
+        g_free_ids_after.store(free_ids, std::memory_order_relaxed);
+        g_redirects_after.store(redirects, std::memory_order_relaxed);
+        unregisterCallback(*this);
+        push<qb::KillEvent>(_counter);
+        push<qb::KillEvent>(_idle);
+        for (qb::CoreId core : {0, 1})
+            push<qb::KillEvent>(getServiceId<qb::TelemetryTag>(core));
+        kill();
+    }
+
+    void
+    on(qb::MigratedEvent const &event) {
+        if (!event.migrated.is_valid()) {
+            _bouncing    = false; // reported as is: the counts below will not match
+            _since_ns    = time();
+            _deadline_ns = _since_ns + kSettleBudgetNs;
+            return;
+        }
+        _counter = event.migrated;
+        if (_counter.sid() > g_max_sid.load(std::memory_order_relaxed))
+            g_max_sid.store(_counter.sid(), std::memory_order_relaxed);
+        if (g_bounces.fetch_add(1, std::memory_order_relaxed) + 1 < kBounces) {
+            migrate(_counter, _counter.index() == 0 ? 1 : 0);
+            return;
+        }
+        // Done: wait for both cores to report the redirects reclaimed.
+        _bouncing    = false;
+        _since_ns    = time();
+        _deadline_ns = _since_ns + kSettleBudgetNs;
+    }
+};
+
+[[nodiscard]] bool
+run_bouncer(std::chrono::seconds budget) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::TelemetryPolicy policy;
+        policy.interval = std::chrono::milliseconds(1);
+        qb::Main   main;
+        const auto counter = main.addActor<Counter>(0);
+        const auto idle    = main.addActor<Idle>(1);
+        main.addActor<qb::Telemetry>(0, policy);
+        main.addActor<qb::Telemetry>(1, policy);
+        main.addActor<Bouncer>(0, counter, idle);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    return future.wait_for(budget) == std::future_status::ready;
+}
+
+[[nodiscard]] bool
+run_engine(std::chrono::seconds budget) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::Main   main;
+        const auto counter = main.addActor<Counter>(0);
+        const auto pinned  = main.addActor<Pinned>(0);
+        const auto drowsy  = main.addActor<Drowsy>(0);
+        const auto idle    = main.addActor<Idle>(1);
+        main.addActor<Driver>(0, counter, pinned, drowsy, idle);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    return future.wait_for(budget) == std::future_status::ready;
+}
+
+} // namespace
+
+TEST(ActorMigration, MovesStateAndForwardsEventsSentToTheOldId) {
+    reset();
+    ASSERT_TRUE(run_engine(std::chrono::seconds(30))) << "engine did not terminate: a migration never settled";
+
+    EXPECT_TRUE(g_migrated_valid.load());
+    EXPECT_EQ(g_migrated_core.load(), 1);
+    EXPECT_EQ(g_counters_built.load(), 2) << "the factory must re-create the actor exactly once";
+    EXPECT_EQ(g_reported_core.load(), 1) << "the report must come from the destination core";
+    EXPECT_EQ(g_reported_token.load(), 42) << "move-only state must survive the move";
+    EXPECT_EQ(g_reported_hits.load(), kBefore + kDuring + kAfter)
+        << "hits sent to the old id during the transfer must be forwarded, each exactly once";
+}
+
+TEST(ActorMigration, ActorWithoutOnMigrateIsRefusedAndKeepsServing) {
+    reset();
+    ASSERT_TRUE(run_engine(std::chrono::seconds(30))) << "engine did not terminate";
+
+    EXPECT_TRUE(g_refused.load()) << "a non-opted-in actor must be reported as not migrated";
+    EXPECT_TRUE(g_pinned_served.load()) << "a refused actor must keep serving its original id";
+    EXPECT_FALSE(g_pinned_busy.load()) << "not opting in is a refusal for good, not a busy one";
+}
+
+TEST(ActorMigration, ActorWithCoroutinesInFlightIsRefusedAsBusy) {
+    reset();
+    ASSERT_TRUE(run_engine(std::chrono::seconds(30))) << "engine did not terminate";
+
+    EXPECT_TRUE(g_drowsy_busy.load()) << "an actor awaiting a coroutine must be refused with busy set";
+}
+
+TEST(ActorMigration, RepeatedMigrationsReclaimRedirectsAndIds) {
+    reset();
+    const auto grace                               = qb::VirtualCore::migration_redirect_grace_ns;
+    qb::VirtualCore::migration_redirect_grace_ns = 0;
+    const bool finished                            = run_bouncer(std::chrono::seconds(60));
+    qb::VirtualCore::migration_redirect_grace_ns = grace;
+    ASSERT_TRUE(finished) << "engine did not terminate";
+
+    EXPECT_EQ(g_bounces.load(), kBounces);
+    EXPECT_EQ(g_redirects_after.load(), 0u) << "every settled redirect must be erased once its grace is over";
+    EXPECT_EQ(g_free_ids_after.load(), g_free_ids_before.load()) << "every old id must return to its core's pool";
+    EXPECT_LT(g_max_sid.load(), 64u) << "old ids must be reused, not drawn fresh on every move";
+}
@@ -0,0 +1,242 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/event-batch.cpp
+ * @brief `Actor::batch<E>()` delivers what `push<E>()` delivers, in the same order.
+ *
+ *   - Fan-out, same core and cross core: every round is one batch to all receivers. Reservations
+ *     are deliberately wrong both ways — too small (the batch must grow) and far too large (the
+ *     tail must be handed back). A plain `push` queued after each batch must arrive after it, and
+ *     nothing else may arrive: an untrimmed tail would reach the receiver as garbage events.
+ *   - A non-trivially-destructible payload arrives intact and is destroyed exactly once.
+ *   - A destination on another core than the batch's, and an event big enough for the shared
+ *     slab, take the plain `push()` path and still arrive.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kReceivers = 5;
+constexpr std::uint32_t kRounds    = 2000;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_out_of_order{0};
+std::atomic<std::uint32_t> g_done{0};
+std::atomic<std::uint32_t> g_large{0};
+std::atomic<std::int32_t>  g_live{0};
+
+struct SeqEvent : qb::Event {
+    std::uint32_t seq = 0;
+    explicit SeqEvent(std::uint32_t s)
+        : seq(s) {}
+};
+
+struct DoneEvent : qb::Event {
+    std::uint32_t rounds = 0;
+};
+
+/// Heap-owning, so it needs its disposer — and relocatable, as any cross-core payload must be.
+struct VectorEvent : qb::Event {
+    std::vector<std::uint32_t> values;
+    explicit VectorEvent(std::uint32_t const round)
+        : values(16, round) {
+        g_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~VectorEvent() {
+        g_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+struct LargeEvent : qb::Event {
+    std::uint8_t bytes[2048]{};
+};
+static_assert(sizeof(LargeEvent) >= qb::kSharedEventMinBuckets * QB_LOCKFREE_EVENT_BUCKET_BYTES);
+
+class Receiver final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SeqEvent>(*this);
+        registerEvent<DoneEvent>(*this);
+        registerEvent<VectorEvent>(*this);
+        registerEvent<LargeEvent>(*this);
+        co_return true;
+    }
+    void
+    on(SeqEvent const &event) {
+        if (event.seq != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_received.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(VectorEvent const &event) {
+        if (event.values.size() != 16 || event.values.back() != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_received.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(LargeEvent const &event) {
+        if (event.bytes[0] == 0x5a && event.bytes[sizeof(event.bytes) - 1] == 0xa5)
+            g_large.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(DoneEvent const &event) {
+        if (_next != event.rounds)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_done.fetch_add(1, std::memory_order_relaxed);
+        kill();
+    }
+};
+
+enum class Payload { Seq, Vector };
+
+class Sender final : public qb::Actor {
+    const qb::ActorIdList _to;
+    const Payload         _payload;
+
+public:
+    Sender(qb::ActorIdList to, Payload payload)
+        : _to(std::move(to))
+        , _payload(payload) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        const auto core = _to.front().index();
+        for (std::uint32_t round = 0; round < kRounds; ++round) {
+            // Alternate a reservation too small to hold the round with one far too large.
+            const std::size_t reserve = round % 2 ? 2 : 64;
+            if (_payload == Payload::Seq) {
+                auto out = batch<SeqEvent>(core, reserve);
+                for (auto const id : _to)
+                    out.push(id, round);
+                EXPECT_EQ(out.size(), _to.size());
+            } else {
+                auto out = batch<VectorEvent>(core, reserve);
+                for (auto const id : _to)
+                    out.push(id, round);
+            }
+        }
+        for (auto const id : _to)
+            push<DoneEvent>(id).rounds = kRounds;
+        kill();
+        co_return true;
+    }
+};
+
+class StraySender final : public qb::Actor {
+    const qb::ActorId _near;
+    const qb::ActorId _far;
+
+public:
+    StraySender(qb::ActorId near, qb::ActorId far)
+        : _near(near)
+        , _far(far) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        {
+            auto out = batch<SeqEvent>(_far.index(), 4);
+            out.push(_far, 0u);
+            out.push(_near, 0u); // another core: plain push()
+            out.push(_far, 1u);
+            EXPECT_EQ(out.size(), 3u);
+        }
+        {
+            auto out = batch<LargeEvent>(_far.index(), 2); // shared-slab sized: plain push()
+            for (auto const id : {_far, _far}) {
+                auto &event                           = out.push(id);
+                event.bytes[0]                        = 0x5a;
+                event.bytes[sizeof(event.bytes) - 1] = 0xa5;
+            }
+        }
+        push<DoneEvent>(_near).rounds = 1;
+        push<DoneEvent>(_far).rounds  = 2;
+        kill();
+        co_return true;
+    }
+};
+
+void
+reset() {
+    g_received     = 0;
+    g_out_of_order = 0;
+    g_done         = 0;
+    g_large        = 0;
+    g_live         = 0;
+}
+
+template <typename Setup>
+bool
+run_engine(Setup setup) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    return future.wait_for(std::chrono::seconds(30)) == std::future_status::ready;
+}
+
+void
+run_fanout(qb::CoreId const receivers_core, Payload const payload) {
+    reset();
+    ASSERT_TRUE(run_engine([=](qb::Main &main) {
+        qb::ActorIdList ids;
+        for (std::uint32_t i = 0; i < kReceivers; ++i)
+            ids.push_back(main.addActor<Receiver>(receivers_core));
+        main.addActor<Sender>(0, ids, payload);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), kReceivers * kRounds);
+    EXPECT_EQ(g_done.load(), kReceivers);
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "a batch must deliver in push order, and only what was pushed";
+}
+
+} // namespace
+
+TEST(EventBatch, SameCoreFanOutArrivesInOrder) {
+    run_fanout(0, Payload::Seq);
+}
+
+TEST(EventBatch, CrossCoreFanOutArrivesInOrder) {
+    run_fanout(1, Payload::Seq);
+}
+
+TEST(EventBatch, NonTrivialPayloadIsDeliveredAndDisposedOnce) {
+    run_fanout(1, Payload::Vector);
+    EXPECT_EQ(g_live.load(), 0) << "every batched event must be destroyed exactly once";
+}
+
+TEST(EventBatch, StrayDestinationAndLargeEventFallBackToPush) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        const auto near = main.addActor<Receiver>(0);
+        const auto far  = main.addActor<Receiver>(1);
+        main.addActor<StraySender>(0, near, far);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), 3u);
+    EXPECT_EQ(g_large.load(), 2u);
+    EXPECT_EQ(g_done.load(), 2u);
+    EXPECT_EQ(g_out_of_order.load(), 0u);
+}
@@ -0,0 +1,147 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/mailbox-overflow.cpp
+ * @brief A burst far wider than the destination's mailbox ring arrives complete and in order.
+ *
+ * Core 1's mailbox is shrunk to `MinMailboxCapacity` buckets, and a sender on core 0 pushes
+ * `kBurst` sequenced events to it from `onInit()` — one flush hundreds of rings wide.
+ *
+ *   - `MailboxMode::Overflow`: the flush spills what the ring refuses into segments instead of
+ *     stalling. Every event must arrive exactly once, in push order (the receiver drains the ring
+ *     before the segments behind it), the counters must show the spill, and a QoS-0 event wider
+ *     than the ring — undeliverable under backpressure — must ride a segment.
+ *   - `MailboxMode::Backpressure`: the same burst arrives through bounded retries alone; nothing
+ *     is ever spilled.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kBurst  = 20000;
+constexpr std::uint32_t kWideAt = kBurst / 2;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_out_of_order{0};
+std::atomic<std::uint32_t> g_wide{0};
+
+struct SeqEvent : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+/// Best-effort and wider than a `MinMailboxCapacity` ring: only an overflow segment can carry it.
+struct WideEvent : qb::EventQOS0 {
+    std::uint32_t seq = 0;
+    std::uint8_t  bytes[1536]{};
+};
+static_assert(sizeof(WideEvent) > qb::CoreInitializer::MinMailboxCapacity * QB_LOCKFREE_EVENT_BUCKET_BYTES);
+
+class Receiver final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SeqEvent>(*this);
+        registerEvent<WideEvent>(*this);
+        co_return true;
+    }
+    void
+    on(SeqEvent const &event) {
+        if (event.seq != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        if (g_received.fetch_add(1, std::memory_order_relaxed) + 1 == kBurst) {
+            push<qb::KillEvent>(event.getSource());
+            kill();
+        }
+    }
+    void
+    on(WideEvent const &event) {
+        if (event.seq == kWideAt && _next == kWideAt)
+            g_wide.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+class Sender final : public qb::Actor {
+    const qb::ActorId _to;
+    const bool        _wide;
+
+public:
+    Sender(qb::ActorId to, bool wide)
+        : _to(to)
+        , _wide(wide) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t i = 0; i < kBurst; ++i) {
+            if (_wide && i == kWideAt)
+                push<WideEvent>(_to).seq = i;
+            push<SeqEvent>(_to).seq = i;
+        }
+        co_return true;
+    }
+};
+
+qb::MailboxStats
+run_burst(qb::MailboxMode const mode, bool const wide) {
+    g_received     = 0;
+    g_out_of_order = 0;
+    g_wide         = 0;
+
+    auto stats  = std::make_shared<std::promise<qb::MailboxStats>>();
+    auto future = stats->get_future();
+    std::thread([stats, mode, wide] {
+        qb::Main main;
+        main.core(1).setMailboxCapacity(qb::CoreInitializer::MinMailboxCapacity).setMailboxMode(mode);
+        const auto receiver = main.addActor<Receiver>(1);
+        main.addActor<Sender>(0, receiver, wide);
+        main.start(false);
+        main.join();
+        stats->set_value(main.getMailboxStats(1));
+    }).detach();
+    if (future.wait_for(std::chrono::seconds(30)) != std::future_status::ready) {
+        ADD_FAILURE() << "engine did not terminate";
+        return {};
+    }
+    return future.get();
+}
+
+} // namespace
+
+TEST(MailboxOverflow, BurstWiderThanTheRingSpillsAndArrivesInOrder) {
+    const auto stats = run_burst(qb::MailboxMode::Overflow, true);
+
+    EXPECT_EQ(g_received.load(), kBurst);
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "the ring must be drained before the segments chained behind it";
+    EXPECT_EQ(g_wide.load(), 1u) << "an event wider than the ring must ride a segment, in its place";
+    EXPECT_GT(stats.spilled_segments, 0u);
+    EXPECT_GE(stats.spilled_events, stats.spilled_segments);
+    EXPECT_GE(stats.spilled_buckets, stats.spilled_events);
+    EXPECT_EQ(stats.backoffs, 0u) << "an overflow mailbox never backpressures its senders";
+    EXPECT_EQ(stats.stalled_flushes, 0u);
+}
+
+TEST(MailboxOverflow, BackpressureModeDeliversTheSameBurstWithoutSpilling) {
+    const auto stats = run_burst(qb::MailboxMode::Backpressure, false);
+
+    EXPECT_EQ(g_received.load(), kBurst);
+    EXPECT_EQ(g_out_of_order.load(), 0u);
+    EXPECT_GT(stats.backoffs, 0u) << "a burst hundreds of rings wide must have met a full ring";
+    EXPECT_EQ(stats.spilled_segments, 0u);
+    EXPECT_EQ(stats.spilled_events, 0u);
+}
@@ -0,0 +1,270 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/multicast.cpp
+ * @brief `Actor::multicast<E>()` reaches every listed actor once per listing, one copy per core.
+ *
+ *   - Receivers on two cores, interleaved in the list: every round is one multicast followed by
+ *     a plain `push` to each receiver, which must arrive after it.
+ *   - A non-trivially-destructible payload is constructed once per destination core, not per
+ *     receiver, and every object — copies handed out by `reply()` included — is destroyed once.
+ *   - A target that `reply()`s gets its own copy; the targets after it still see the original.
+ *   - A payload big enough for the shared slab (cross core) and for a same-core copy, with a list
+ *     that names one actor twice.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kPerCore = 4;
+constexpr std::uint32_t kRounds  = 1000;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_out_of_order{0};
+std::atomic<std::uint32_t> g_done{0};
+std::atomic<std::uint32_t> g_replies{0};
+std::atomic<std::uint32_t> g_large{0};
+std::atomic<std::uint32_t> g_built{0};
+std::atomic<std::int32_t>  g_live{0};
+
+struct SeqEvent : qb::Event {
+    std::uint32_t seq = 0;
+    explicit SeqEvent(std::uint32_t s)
+        : seq(s) {}
+};
+
+struct DoneEvent : qb::Event {
+    std::uint32_t rounds = 0;
+};
+
+/// Heap-owning and relocatable; counts the objects built from arguments and the live ones.
+struct VectorEvent : qb::Event {
+    std::vector<std::uint32_t> values;
+    explicit VectorEvent(std::uint32_t const seq)
+        : values(16, seq) {
+        g_built.fetch_add(1, std::memory_order_relaxed);
+        g_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    VectorEvent(VectorEvent const &other)
+        : qb::Event(other)
+        , values(other.values) {
+        g_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~VectorEvent() {
+        g_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+struct LargeEvent : qb::Event {
+    std::uint8_t bytes[2048]{};
+    LargeEvent() {
+        bytes[0]                 = 0x5a;
+        bytes[sizeof(bytes) - 1] = 0xa5;
+    }
+};
+static_assert(sizeof(LargeEvent) >= qb::kSharedEventMinBuckets * QB_LOCKFREE_EVENT_BUCKET_BYTES);
+
+class Receiver final : public qb::Actor {
+    const bool    _replies;
+    std::uint32_t _next = 0;
+
+public:
+    explicit Receiver(bool replies = false)
+        : _replies(replies) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SeqEvent>(*this);
+        registerEvent<VectorEvent>(*this);
+        registerEvent<LargeEvent>(*this);
+        registerEvent<DoneEvent>(*this);
+        co_return true;
+    }
+    void
+    on(SeqEvent const &event) {
+        if (event.getDestination() != id() || event.seq != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_received.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(VectorEvent &event) {
+        if (event.getDestination() != id() || event.values.size() != 16 || event.values.back() != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_received.fetch_add(1, std::memory_order_relaxed);
+        if (_replies)
+            reply(event);
+    }
+    void
+    on(LargeEvent const &event) {
+        if (event.bytes[0] == 0x5a && event.bytes[sizeof(event.bytes) - 1] == 0xa5)
+            g_large.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(DoneEvent const &event) {
+        if (_next != event.rounds)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_done.fetch_add(1, std::memory_order_relaxed);
+        kill();
+    }
+};
+
+enum class Payload { Seq, Vector };
+
+class Sender final : public qb::Actor {
+    const qb::ActorIdList _to;
+    const Payload         _payload;
+    std::uint32_t         _expected_replies;
+
+public:
+    Sender(qb::ActorIdList to, Payload payload, std::uint32_t expected_replies)
+        : _to(std::move(to))
+        , _payload(payload)
+        , _expected_replies(expected_replies) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<VectorEvent>(*this);
+        for (std::uint32_t round = 0; round < kRounds; ++round) {
+            if (_payload == Payload::Seq) {
+                multicast<SeqEvent>(_to, 2 * round);
+                for (auto const id : _to)
+                    push<SeqEvent>(id, 2 * round + 1); // behind the multicast copy
+            } else
+                multicast<VectorEvent>(_to, round);
+        }
+        for (auto const id : _to)
+            push<DoneEvent>(id).rounds = _payload == Payload::Seq ? 2 * kRounds : kRounds;
+        if (!_expected_replies)
+            kill();
+        co_return true;
+    }
+    void
+    on(VectorEvent const &event) {
+        if (event.values.size() != 16)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        g_replies.fetch_add(1, std::memory_order_relaxed);
+        if (!--_expected_replies)
+            kill();
+    }
+};
+
+class LargeSender final : public qb::Actor {
+    const qb::ActorIdList _to;
+    const qb::ActorIdList _receivers;
+
+public:
+    LargeSender(qb::ActorIdList to, qb::ActorIdList receivers)
+        : _to(std::move(to))
+        , _receivers(std::move(receivers)) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        multicast<LargeEvent>(_to);
+        for (auto const id : _receivers)
+            push<DoneEvent>(id).rounds = 0;
+        kill();
+        co_return true;
+    }
+};
+
+void
+reset() {
+    g_received     = 0;
+    g_out_of_order = 0;
+    g_done         = 0;
+    g_replies      = 0;
+    g_large        = 0;
+    g_built        = 0;
+    g_live         = 0;
+}
+
+template <typename Setup>
+bool
+run_engine(Setup setup) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    return future.wait_for(std::chrono::seconds(30)) == std::future_status::ready;
+}
+
+/// `kPerCore` receivers on each of cores 0 and 1, interleaved in the list.
+qb::ActorIdList
+add_receivers(qb::Main &main, std::uint32_t const replying = 0) {
+    qb::ActorIdList ids;
+    for (std::uint32_t i = 0; i < kPerCore; ++i) {
+        ids.push_back(main.addActor<Receiver>(0, i < replying));
+        ids.push_back(main.addActor<Receiver>(1, i < replying));
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(Multicast, DeliversToEveryTargetAheadOfLaterPushes) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        main.addActor<Sender>(0, add_receivers(main), Payload::Seq, 0u);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), 2 * kPerCore * 2 * kRounds);
+    EXPECT_EQ(g_done.load(), 2 * kPerCore);
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "a multicast is ordered like push(), to its own destination";
+}
+
+TEST(Multicast, BuildsOneCopyPerCoreAndDisposesItOnce) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) { main.addActor<Sender>(0, add_receivers(main), Payload::Vector, 0u); }))
+        << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), 2 * kPerCore * kRounds);
+    EXPECT_EQ(g_built.load(), 2 * kRounds) << "one payload per destination core";
+    EXPECT_EQ(g_out_of_order.load(), 0u);
+    EXPECT_EQ(g_live.load(), 0) << "every multicast copy must be destroyed exactly once";
+}
+
+TEST(Multicast, ReplyingTargetGetsACopyOfItsOwn) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        // The first target of each core replies: the others are dispatched after it.
+        main.addActor<Sender>(0, add_receivers(main, 1), Payload::Vector, 2 * kRounds);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), 2 * kPerCore * kRounds);
+    EXPECT_EQ(g_replies.load(), 2 * kRounds);
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "a reply must not alter what the remaining targets see";
+    EXPECT_EQ(g_live.load(), 0);
+}
+
+TEST(Multicast, LargePayloadAndRepeatedTarget) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        const auto a = main.addActor<Receiver>(1);
+        const auto b = main.addActor<Receiver>(1);
+        const auto c = main.addActor<Receiver>(0);
+        const auto d = main.addActor<Receiver>(0);
+        main.addActor<LargeSender>(0, qb::ActorIdList{a, c, b, a, d}, qb::ActorIdList{a, b, c, d});
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_large.load(), 5u) << "one delivery per listing";
+    EXPECT_EQ(g_done.load(), 4u);
+}
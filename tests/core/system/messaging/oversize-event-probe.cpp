@@ -30,6 +30,11 @@
  * Pinned here at the exact boundary: `kMaxBuckets` buckets must deliver, `kMaxBuckets + 1`
  * must NOT wedge the engine. The oversize case is run on a detached thread with a watchdog
  * so a regression fails this test instead of hanging the whole suite.
+ *
+ * Since large pushed events cross cores through the sender's `SharedSlab` (only a one-bucket
+ * descriptor enters the ring), the ring bound only applies to events that travel by value.
+ * The wedge case therefore uses an `EventQOS0` event, which always does; the same width pushed
+ * as a regular event must now be delivered, and its payload destroyed exactly once.
  */
 
 #include <atomic>
@@ -71,6 +76,8 @@ struct TrackedPayload {
 struct BigEvent : public qb::Event {
     TrackedPayload payload;
 };
+/// Always travels by value (QoS 0 never takes the slab path), so the ring bound applies.
+struct BigQos0Event : public qb::EventQOS0 {};
 /// Queued into the SAME pipe right after BigEvent: proves ordered traffic still flows.
 struct TailEvent : public qb::Event {};
 
@@ -79,6 +86,7 @@ public:
     qb::io::async::task<bool>
     onInit() override {
         registerEvent<BigEvent>(*this);
+        registerEvent<BigQos0Event>(*this);
         registerEvent<TailEvent>(*this);
         co_return true;
     }
@@ -87,6 +95,10 @@ public:
         g_big.fetch_add(1, std::memory_order_relaxed);
     }
     void
+    on(BigQos0Event const &) {
+        g_big.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
     on(TailEvent const &) {
         g_tail.fetch_add(1, std::memory_order_relaxed);
         kill();
@@ -96,15 +108,20 @@ public:
 class OvSend final : public qb::Actor {
     const qb::ActorId _to;
     const std::size_t _extra;
+    const bool        _qos0;
 
 public:
-    OvSend(qb::ActorId to, std::size_t extra)
+    OvSend(qb::ActorId to, std::size_t extra, bool qos0)
         : _to(to)
-        , _extra(extra) {}
+        , _extra(extra)
+        , _qos0(qos0) {}
     qb::io::async::task<bool>
     onInit() override {
         auto pipe = getPipe(_to);
-        static_cast<void>(pipe.allocated_push<BigEvent>(_extra));
+        if (_qos0)
+            static_cast<void>(pipe.allocated_push<BigQos0Event>(_extra));
+        else
+            static_cast<void>(pipe.allocated_push<BigEvent>(_extra));
         pipe.push<TailEvent>(); // FIFO behind BigEvent — must still get through
         kill();
         co_return true;
@@ -119,7 +136,7 @@ extra_for_buckets(std::size_t buckets) noexcept {
 
 /// Run one cross-core case; returns false if the engine failed to terminate in `budget`.
 [[nodiscard]] bool
-run_case(std::size_t extra, std::chrono::seconds budget) {
+run_case(std::size_t extra, std::chrono::seconds budget, bool qos0 = false) {
     g_big           = 0;
     g_tail          = 0;
     g_payload_alive = 0;
@@ -128,10 +145,10 @@ run_case(std::size_t extra, std::chrono::seconds budget) {
     // plus a promise.
     auto done   = std::make_shared<std::promise<void>>();
     auto future = done->get_future();
-    std::thread([extra, done] {
+    std::thread([extra, qos0, done] {
         qb::Main main;
         auto     rcv = main.addActor<OvRecv>(1);
-        main.addActor<OvSend>(0, rcv, extra);
+        main.addActor<OvSend>(0, rcv, extra, qos0);
         main.start();
         main.join();
         done->set_value();
@@ -151,20 +168,28 @@ TEST(OversizeEvent, MaxSizedEventIsDeliveredCrossCore) {
     EXPECT_EQ(g_tail.load(), 1);
 }
 
-// One bucket more can never be enqueued — the engine must still terminate, and the
+// One bucket more can never be enqueued by value — the engine must still terminate, and the
 // ordered traffic queued behind it must not be held hostage.
 TEST(OversizeEvent, OversizedEventDoesNotWedgeTheEngine) {
     if (std::thread::hardware_concurrency() < 2u)
         GTEST_SKIP() << "requires-multicore: needs a second core to exercise cross-core delivery";
 
-    ASSERT_TRUE(run_case(extra_for_buckets(kMaxBuckets + 1), std::chrono::seconds(30)))
+    ASSERT_TRUE(run_case(extra_for_buckets(kMaxBuckets + 1), std::chrono::seconds(30), true))
         << "engine wedged: an event of " << (kMaxBuckets + 1) << " buckets can never be enqueued into the " << kMaxBuckets
         << "-bucket mailbox ring, so __flush_all__ retries it forever and join() never returns";
-    EXPECT_EQ(g_big.load(), 0) << "an oversized event cannot be delivered cross-core";
+    EXPECT_EQ(g_big.load(), 0) << "an oversized by-value event cannot be delivered cross-core";
     EXPECT_EQ(g_tail.load(), 1) << "traffic queued behind the undeliverable event must still be delivered "
                                    "(no head-of-line block)";
-    // The dropped event owns heap through TrackedPayload. Dropping it must run its destructor
-    // exactly once (via the router's type-erased disposer), not leak it and not double-free it.
-    EXPECT_EQ(g_payload_alive.load(), 0) << "the undeliverable event's payload was not disposed — dropping it must free "
-                                            "its heap exactly like every other terminal path";
+}
+
+// The same width pushed as a regular event crosses through the shared slab: delivered, in
+// order, and its payload destroyed exactly once by the receiver — not leaked, not double-freed.
+TEST(OversizeEvent, OversizedEventIsDeliveredThroughTheSharedSlab) {
+    if (std::thread::hardware_concurrency() < 2u)
+        GTEST_SKIP() << "requires-multicore: needs a second core to exercise cross-core delivery";
+
+    ASSERT_TRUE(run_case(extra_for_buckets(kMaxBuckets + 1), std::chrono::seconds(30))) << "engine did not terminate";
+    EXPECT_EQ(g_big.load(), 1) << "a slab-carried event is not bounded by the mailbox ring";
+    EXPECT_EQ(g_tail.load(), 1);
+    EXPECT_EQ(g_payload_alive.load(), 0) << "the slab-resident event's payload must be destroyed exactly once";
 }
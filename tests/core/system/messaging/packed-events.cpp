@@ -0,0 +1,231 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/packed-events.cpp
+ * @brief Small cross-core events sharing a mailbox-ring bucket (`detail::packed_bucket`).
+ *
+ *   - Core 1 pushes a repeating run of events one, two, three slots wide, a full-bucket one that
+ *     is never packed, and a heap-owning one, to a receiver on core 0. Every event arrives, in
+ *     push order, with its payload intact, and the heap-owning one is destroyed exactly once.
+ *   - Core 1's `Telemetry` reports the events that travelled packed: the test polls the
+ *     collector's file until it does, then stops the engine.
+ *
+ * The engine runs on a detached thread and is stopped with `Main::stop()` (process-wide).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <qb/actor.h>
+#include <qb/core/Telemetry.h>
+#include <qb/json.h>
+#include <qb/main.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::uint32_t kRounds = 4000;
+constexpr std::uint32_t kKinds  = 5;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_corrupt{0};
+std::atomic<bool>          g_done{false};
+std::atomic<std::int32_t>  g_live{0};
+
+struct Tick : qb::Event {};
+struct Small : qb::Event {
+    std::uint32_t seq;
+    explicit Small(std::uint32_t s)
+        : seq(s) {}
+};
+struct Mid : qb::Event {
+    std::uint64_t a, b;
+    std::uint32_t seq;
+    explicit Mid(std::uint32_t s)
+        : a(s * 0x9e3779b97f4a7c15ull)
+        , b(~a)
+        , seq(s) {}
+};
+struct Full : qb::Event {
+    std::uint32_t seq;
+    std::uint8_t  bytes[44];
+    explicit Full(std::uint32_t s)
+        : seq(s) {
+        for (std::size_t i = 0; i < sizeof(bytes); ++i)
+            bytes[i] = static_cast<std::uint8_t>(s + i);
+    }
+};
+/// Heap-owning: it needs its disposer, and the packed copy must be the one destroyed.
+struct Owning : qb::Event {
+    std::vector<std::uint32_t> values;
+    std::uint32_t              seq;
+    explicit Owning(std::uint32_t s)
+        : values(8, s)
+        , seq(s) {
+        g_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~Owning() {
+        g_live.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+struct Done : qb::Event {};
+
+using qb::detail::packed_bucket;
+static_assert(packed_bucket::width<Tick>() == 1 && packed_bucket::width<Small>() == 2 && packed_bucket::width<Mid>() == 3,
+              "the run must cover every packed width");
+static_assert(packed_bucket::width<Full>() == 0, "Full must take the unpacked path");
+static_assert(packed_bucket::width<Owning>() == 3);
+
+class Receiver final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+    void
+    step(std::uint32_t const kind, std::uint32_t const seq, bool const intact) {
+        if (_next % kKinds != kind || _next / kKinds != seq || !intact)
+            g_corrupt.fetch_add(1, std::memory_order_relaxed);
+        ++_next;
+        g_received.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<Tick>(*this);
+        registerEvent<Small>(*this);
+        registerEvent<Mid>(*this);
+        registerEvent<Full>(*this);
+        registerEvent<Owning>(*this);
+        registerEvent<Done>(*this);
+        co_return true;
+    }
+    void
+    on(Tick const &) {
+        step(0, _next / kKinds, true);
+    }
+    void
+    on(Small const &event) {
+        step(1, event.seq, true);
+    }
+    void
+    on(Mid const &event) {
+        step(2, event.seq, event.a == event.seq * 0x9e3779b97f4a7c15ull && event.b == ~event.a);
+    }
+    void
+    on(Full const &event) {
+        bool intact = true;
+        for (std::size_t i = 0; i < sizeof(event.bytes); ++i)
+            intact = intact && event.bytes[i] == static_cast<std::uint8_t>(event.seq + i);
+        step(3, event.seq, intact);
+    }
+    void
+    on(Owning const &event) {
+        step(4, event.seq, event.values.size() == 8 && event.values.front() == event.seq && event.values.back() == event.seq);
+    }
+    void
+    on(Done const &) {
+        g_done = true;
+    }
+};
+
+class Sender final : public qb::Actor {
+    const qb::ActorId _to;
+
+public:
+    explicit Sender(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t seq = 0; seq < kRounds; ++seq) {
+            push<Tick>(_to);
+            push<Small>(_to, seq);
+            push<Mid>(_to, seq);
+            push<Full>(_to, seq);
+            push<Owning>(_to, seq);
+        }
+        push<Done>(_to);
+        kill();
+        co_return true;
+    }
+};
+
+qb::json const *
+core_of(qb::json const &doc, qb::CoreId const core) {
+    for (auto const &entry : doc.at("cores"))
+        if (entry.at("core").get<qb::CoreId>() == core)
+            return &entry;
+    return nullptr;
+}
+
+std::uint64_t
+packed_by(std::string const &file, qb::CoreId const core) {
+    std::ifstream in(file);
+    if (!in)
+        return 0;
+    std::stringstream text;
+    text << in.rdbuf();
+    const auto doc = qb::json::parse(text.str(), nullptr, false);
+    if (doc.is_discarded())
+        return 0;
+    auto const *entry = core_of(doc, core);
+    return entry ? entry->at("flush").at("packed").get<std::uint64_t>() : 0;
+}
+
+TEST(PackedEvents, SmallEventsArriveInOrderAndIntact) {
+    const auto file = (std::filesystem::temp_directory_path() / ("qb-packed-events-" + std::to_string(::getpid()) + ".json")).string();
+    std::filesystem::remove(file);
+
+    qb::TelemetryPolicy policy;
+    policy.interval = 10ms;
+    policy.file     = file;
+
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, policy] {
+        qb::Main main;
+        const auto receiver = main.addActor<Receiver>(0);
+        main.addActor<Sender>(1, receiver);
+        main.addActor<qb::Telemetry>(0, policy);
+        main.addActor<qb::Telemetry>(1, policy);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+
+    std::uint64_t packed = 0;
+    for (const auto deadline = std::chrono::steady_clock::now() + 20s; std::chrono::steady_clock::now() < deadline;
+         std::this_thread::sleep_for(10ms)) {
+        packed = packed_by(file, 1);
+        if (g_done.load() && packed > 0)
+            break;
+    }
+    qb::Main::stop();
+    ASSERT_EQ(future.wait_for(30s), std::future_status::ready) << "engine did not terminate";
+    std::filesystem::remove(file);
+
+    EXPECT_TRUE(g_done.load());
+    EXPECT_EQ(g_received.load(), kRounds * kKinds);
+    EXPECT_EQ(g_corrupt.load(), 0u) << "an event arrived out of order or with a damaged payload";
+    EXPECT_EQ(g_live.load(), 0) << "a heap-owning event was destroyed more or less than once";
+    EXPECT_GT(packed, 0u) << "core 1 never sent a packed bucket";
+    EXPECT_LE(packed, static_cast<std::uint64_t>(kRounds) * (kKinds - 1));
+}
+
+} // namespace
@@ -0,0 +1,254 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/priority-lanes.cpp
+ * @brief `qb::is_priority_event` types overtake a data burst, keep their own order, and cannot
+ *        starve the normal lane.
+ *
+ *   - Cross-core: core 1's mailbox is shrunk to `MinMailboxCapacity` and a sender on core 0
+ *     pushes a burst hundreds of rings wide with `Urgent` events spread through it, all from one
+ *     `onInit()`. The urgent events must arrive in order, after at most one ring's worth of data.
+ *     The receiver `reply()`s the last one behind a burst of its own: the reply must come back
+ *     ahead of that burst too, which only holds if the re-push kept the lane.
+ *   - Same core: an urgent event pushed after a burst is delivered before any of it.
+ *   - Starvation guard: a sender that floods the priority lane on every loop pass must not stop
+ *     a normal stream to the same core from completing.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kBurst   = 20000;
+constexpr std::uint32_t kUrgent  = 10;
+constexpr std::uint32_t kUrgentN = kBurst / kUrgent;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_urgent{0};
+std::atomic<std::uint32_t> g_out_of_order{0};
+std::atomic<std::uint32_t> g_data_before_urgent{0}; // max over every urgent event
+std::atomic<std::uint32_t> g_echo_before_reply{kBurst};
+
+struct SeqEvent : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+struct Urgent : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+struct EchoEvent : qb::Event {};
+
+} // namespace
+
+template <>
+struct qb::is_priority_event<Urgent> : std::true_type {};
+
+namespace {
+
+void
+reset() {
+    g_received           = 0;
+    g_urgent             = 0;
+    g_out_of_order       = 0;
+    g_data_before_urgent = 0;
+    g_echo_before_reply  = kBurst;
+}
+
+void
+record_urgent(std::uint32_t const seq, std::uint32_t const data_before) {
+    if (seq != g_urgent.fetch_add(1, std::memory_order_relaxed))
+        g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+    if (data_before > g_data_before_urgent.load(std::memory_order_relaxed))
+        g_data_before_urgent.store(data_before, std::memory_order_relaxed);
+}
+
+class Receiver final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SeqEvent>(*this);
+        registerEvent<Urgent>(*this);
+        co_return true;
+    }
+    void
+    on(SeqEvent const &event) {
+        if (event.seq != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        if (g_received.fetch_add(1, std::memory_order_relaxed) + 1 == kBurst) {
+            push<qb::KillEvent>(event.getSource()); // normal lane: behind the echoes, if any
+            kill();
+        }
+    }
+    void
+    on(Urgent &event) {
+        record_urgent(event.seq, _next);
+        if (event.seq + 1 == kUrgent && event.getSource().index() != id().index()) {
+            for (std::uint32_t i = 0; i < kBurst; ++i)
+                push<EchoEvent>(event.getSource());
+            reply(event);
+        }
+    }
+};
+
+class Sender final : public qb::Actor {
+    const qb::ActorId _to;
+    std::uint32_t     _echoes = 0;
+
+public:
+    explicit Sender(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<EchoEvent>(*this);
+        registerEvent<Urgent>(*this);
+        for (std::uint32_t i = 0; i < kBurst; ++i) {
+            push<SeqEvent>(_to).seq = i;
+            if (i % kUrgentN == kUrgentN - 1)
+                push<Urgent>(_to).seq = i / kUrgentN;
+        }
+        co_return true;
+    }
+    void
+    on(EchoEvent const &) {
+        ++_echoes;
+    }
+    void
+    on(Urgent const &) {
+        g_echo_before_reply = _echoes;
+    }
+};
+
+class Flooder final
+    : public qb::Actor
+    , public qb::ICallback {
+    const qb::ActorId _to;
+
+public:
+    explicit Flooder(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerCallback(*this);
+        co_return true;
+    }
+    void
+    on(qb::LoopEvent const &) final {
+        for (std::uint32_t i = 0; i < 64; ++i)
+            push<Urgent>(_to).seq = i;
+    }
+};
+
+class FloodedReceiver final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SeqEvent>(*this);
+        registerEvent<Urgent>(*this);
+        co_return true;
+    }
+    void
+    on(SeqEvent const &) {
+        if (g_received.fetch_add(1, std::memory_order_relaxed) + 1 == kBurst) {
+            push<qb::KillEvent>(qb::BroadcastId(0)); // the flooder
+            kill();
+        }
+    }
+    void
+    on(Urgent const &) {
+        g_urgent.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+class Streamer final : public qb::Actor {
+    const qb::ActorId _to;
+
+public:
+    explicit Streamer(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        for (std::uint32_t i = 0; i < kBurst; ++i)
+            push<SeqEvent>(_to).seq = i;
+        kill();
+        co_return true;
+    }
+};
+
+template <typename Setup>
+bool
+run_engine(Setup setup) {
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done, setup] {
+        qb::Main main;
+        setup(main);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    return future.wait_for(std::chrono::seconds(30)) == std::future_status::ready;
+}
+
+} // namespace
+
+TEST(PriorityLanes, UrgentEventsOvertakeACrossCoreBurstInOrder) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        main.core(0).setMailboxCapacity(qb::CoreInitializer::MinMailboxCapacity);
+        main.core(1).setMailboxCapacity(qb::CoreInitializer::MinMailboxCapacity);
+        const auto receiver = main.addActor<Receiver>(1);
+        main.addActor<Sender>(0, receiver);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), kBurst);
+    EXPECT_EQ(g_urgent.load(), kUrgent);
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "each lane stays FIFO";
+    EXPECT_LE(g_data_before_urgent.load(), qb::CoreInitializer::MinMailboxCapacity)
+        << "an urgent event may only wait for the normal batch already being delivered";
+    EXPECT_LE(g_echo_before_reply.load(), qb::CoreInitializer::MinMailboxCapacity)
+        << "reply() must keep the priority lane of the event it re-pushes";
+}
+
+TEST(PriorityLanes, SameCoreUrgentEventIsDeliveredBeforeTheBurst) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        const auto receiver = main.addActor<Receiver>(0);
+        main.addActor<Sender>(0, receiver);
+    })) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), kBurst);
+    EXPECT_EQ(g_urgent.load(), kUrgent);
+    EXPECT_EQ(g_out_of_order.load(), 0u);
+    EXPECT_EQ(g_data_before_urgent.load(), 0u) << "the same-core priority pipe is drained first";
+}
+
+TEST(PriorityLanes, PriorityFloodDoesNotStarveTheNormalLane) {
+    reset();
+    ASSERT_TRUE(run_engine([](qb::Main &main) {
+        main.core(1).setMailboxCapacity(qb::CoreInitializer::MinMailboxCapacity);
+        const auto receiver = main.addActor<FloodedReceiver>(1);
+        main.addActor<Flooder>(0, receiver);
+        main.addActor<Streamer>(0, receiver);
+    })) << "a priority flood starved the normal stream";
+
+    EXPECT_EQ(g_received.load(), kBurst);
+    EXPECT_GT(g_urgent.load(), 0u);
+}
@@ -51,6 +51,9 @@
  *     nothing to reject, and `ShortStdStringEventCrossesCoresWithoutTrippingTheGuard` asserts the
  *     complement instead — that the guard does not false-positive on it.
  *
+ *   - the PACKED path: `PackedSelfReferentialEventIsRejectedCrossCoreInDebug` sends two small
+ *     self-referential events back to back, which leave as one packed bucket of copies.
+ *
  * All of that is Debug-only: the guard is `#ifndef NDEBUG`, so a Release build runs the five
  * relocation tests and none of the guard tests.
  */
@@ -416,6 +419,67 @@ TEST(RelocatablePayload, ShortStdStringEventCrossesCoresWithoutTrippingTheGuard)
         << "the engine never finished: a short std::string event did not complete its cross-core hop";
 }
 
+// A run of small events leaves the sender packed into one bucket (`detail::packed_bucket`), so what
+// reaches `send` is a copy of their bytes at new offsets, in which an interior pointer no longer
+// addresses its own range. The guard must therefore also run on each event as it is packed.
+namespace {
+
+struct CompactSelfRefEvent : public qb::Event {
+    char  buf[8]{};
+    char *cursor; ///< points INTO this object, like SelfRefEvent, in half a bucket
+    CompactSelfRefEvent()
+        : cursor(buf) {}
+};
+static_assert(qb::detail::packed_bucket::width<CompactSelfRefEvent>() == 2, "CompactSelfRefEvent must take the packed path");
+
+class CompactSelfRefRecv final : public qb::Actor {
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<CompactSelfRefEvent>(*this);
+        co_return true;
+    }
+    void
+    on(CompactSelfRefEvent const &) {
+        kill();
+    }
+};
+
+class CompactSelfRefSend final : public qb::Actor {
+    const qb::ActorId _to;
+
+public:
+    explicit CompactSelfRefSend(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        push<CompactSelfRefEvent>(_to); // two in a row: flushed as one packed bucket
+        push<CompactSelfRefEvent>(_to);
+        kill();
+        co_return true;
+    }
+};
+
+void
+push_packed_self_referential_cross_core() {
+    qb::Main main;
+    auto     rcv = main.addActor<CompactSelfRefRecv>(1);
+    main.addActor<CompactSelfRefSend>(0, rcv);
+    main.start();
+    main.join();
+}
+
+} // namespace
+
+TEST(RelocatablePayloadDeathTest, PackedSelfReferentialEventIsRejectedCrossCoreInDebug) {
+    if (std::thread::hardware_concurrency() < 2u)
+        GTEST_SKIP() << "requires-multicore: the guard sits on the cross-core relocation path";
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_DEATH(push_packed_self_referential_cross_core(), kGuardDiagnostic)
+        << "a self-referential event crossed cores inside a packed bucket: the guard must check each "
+           "event as it is packed, not the bucket it is packed into";
+}
+
 // --- The guard's OTHER precondition: deterministic bucket bytes ---------------------------------
 //
 // The guard scans the whole bucket range, because that is what gets memcpy'd. But a payload does
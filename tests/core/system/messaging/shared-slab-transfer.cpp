@@ -0,0 +1,162 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file system/messaging/shared-slab-transfer.cpp
+ * @brief Large cross-core events travel through the sender's `SharedSlab` intact and in order.
+ *
+ * The sender (core 0) pushes `kRounds` pairs to a receiver on core 1: a small event that travels
+ * by value, then a 2 KiB frame that is built in core 0's slab and crosses the ring as a
+ * descriptor. Both carry one sequence number, so any reordering between the two paths shows up
+ * as a gap. The receiver checks every frame byte, then `reply()`s the frame — the engine's
+ * re-push of a received event, which copies it into core 1's slab — and the sender checks it
+ * again on the way back.
+ *
+ * Each frame owns a heap buffer whose live count must return to zero: a frame destroyed twice
+ * (double dispose) or never (lost in a release) shows up there. `kRounds` exceeds the slab's
+ * per-class cache, so blocks are both recycled through the owner's return stack and freed.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <qb/actor.h>
+#include <qb/main.h>
+
+namespace {
+
+constexpr std::uint32_t kRounds    = 2000;
+constexpr std::size_t   kFrameSize = 2048;
+
+std::atomic<std::uint32_t> g_received{0};
+std::atomic<std::uint32_t> g_returned{0};
+std::atomic<std::uint32_t> g_out_of_order{0};
+std::atomic<std::uint32_t> g_corrupt{0};
+std::atomic<int>           g_heap_alive{0};
+
+struct SmallEvent : qb::Event {
+    std::uint32_t seq = 0;
+};
+
+/// Non-trivial and large enough for the slab path (>= kSharedEventMinBuckets).
+struct FrameEvent : qb::Event {
+    std::uint32_t                  seq = 0;
+    std::unique_ptr<std::uint32_t> heap;
+    std::uint8_t                   bytes[kFrameSize]{};
+
+    FrameEvent() = default;
+    explicit FrameEvent(std::uint32_t s)
+        : seq(s)
+        , heap(std::make_unique<std::uint32_t>(s)) {
+        g_heap_alive.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kFrameSize; ++i)
+            bytes[i] = static_cast<std::uint8_t>(s + i);
+    }
+    ~FrameEvent() {
+        if (heap)
+            g_heap_alive.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool
+    intact() const noexcept {
+        if (!heap || *heap != seq)
+            return false;
+        for (std::size_t i = 0; i < kFrameSize; ++i)
+            if (bytes[i] != static_cast<std::uint8_t>(seq + i))
+                return false;
+        return true;
+    }
+};
+static_assert(sizeof(FrameEvent) >= qb::kSharedEventMinBuckets * QB_LOCKFREE_EVENT_BUCKET_BYTES);
+
+class Receiver final : public qb::Actor {
+    std::uint32_t _next = 0;
+
+public:
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<SmallEvent>(*this);
+        registerEvent<FrameEvent>(*this);
+        co_return true;
+    }
+    void
+    on(SmallEvent const &event) {
+        if (event.seq != _next)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+    }
+    void
+    on(FrameEvent &event) {
+        if (event.seq != _next++)
+            g_out_of_order.fetch_add(1, std::memory_order_relaxed);
+        if (!event.intact())
+            g_corrupt.fetch_add(1, std::memory_order_relaxed);
+        g_received.fetch_add(1, std::memory_order_relaxed);
+        reply(event);
+    }
+};
+
+class Sender final : public qb::Actor {
+    const qb::ActorId _to;
+    std::uint32_t     _returned = 0;
+
+public:
+    explicit Sender(qb::ActorId to)
+        : _to(to) {}
+    qb::io::async::task<bool>
+    onInit() override {
+        registerEvent<FrameEvent>(*this);
+        for (std::uint32_t i = 0; i < kRounds; ++i) {
+            push<SmallEvent>(_to).seq = i;
+            push<FrameEvent>(_to, i);
+        }
+        co_return true;
+    }
+    void
+    on(FrameEvent const &event) {
+        if (!event.intact())
+            g_corrupt.fetch_add(1, std::memory_order_relaxed);
+        g_returned.fetch_add(1, std::memory_order_relaxed);
+        if (++_returned == kRounds) {
+            push<qb::KillEvent>(_to);
+            kill();
+        }
+    }
+};
+
+} // namespace
+
+TEST(SharedSlab, LargeEventsCrossCoresInOrderAndAreDestroyedOnce) {
+    g_received     = 0;
+    g_returned     = 0;
+    g_out_of_order = 0;
+    g_corrupt      = 0;
+    g_heap_alive   = 0;
+
+    auto done   = std::make_shared<std::promise<void>>();
+    auto future = done->get_future();
+    std::thread([done] {
+        qb::Main   main;
+        const auto receiver = main.addActor<Receiver>(1);
+        main.addActor<Sender>(0, receiver);
+        main.start(false);
+        main.join();
+        done->set_value();
+    }).detach();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(30)), std::future_status::ready) << "engine did not terminate";
+
+    EXPECT_EQ(g_received.load(), kRounds);
+    EXPECT_EQ(g_returned.load(), kRounds) << "replied frames must come back through the receiver's slab";
+    EXPECT_EQ(g_out_of_order.load(), 0u) << "the descriptor must keep the frame's place in the FIFO pipe";
+    EXPECT_EQ(g_corrupt.load(), 0u);
+    EXPECT_EQ(g_heap_alive.load(), 0) << "every frame must be destroyed exactly once";
+}
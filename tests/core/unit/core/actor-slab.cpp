@@ -0,0 +1,96 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/core/actor-slab.cpp
+ * @brief `qb::ActorSlab` block management, without an engine.
+ *
+ *   - a freed block is handed out again to the next actor of its class, and blocks of one class
+ *     are carved next to each other from one chunk;
+ *   - every block is 16-byte aligned and big enough for its request, across all classes;
+ *   - a block freed on another thread goes back to its owner and is reused there;
+ *   - no slab, or a request above the largest class, is served by the heap.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <qb/main.h>
+
+using qb::ActorSlab;
+
+TEST(ActorSlab, ReusesFreedBlocksOfTheSameClass) {
+    ActorSlab slab;
+    void     *first  = ActorSlab::allocate(&slab, 200);
+    void     *second = ActorSlab::allocate(&slab, 200);
+    EXPECT_EQ(slab.live(), 2u);
+    EXPECT_EQ(slab.reserved(), ActorSlab::kChunkBytes);
+    EXPECT_EQ(static_cast<std::byte *>(second) - static_cast<std::byte *>(first), 256) << "200 + header: the 256-byte class";
+
+    ActorSlab::deallocate(first, &slab);
+    EXPECT_EQ(slab.live(), 1u);
+    EXPECT_EQ(ActorSlab::allocate(&slab, 190), first) << "same class, LIFO";
+    void *other = ActorSlab::allocate(&slab, 400);
+    EXPECT_NE(other, first);
+    for (void *p : {first, second, other})
+        ActorSlab::deallocate(p, &slab);
+    EXPECT_EQ(slab.live(), 0u);
+}
+
+TEST(ActorSlab, EveryClassIsAlignedAndWritable) {
+    ActorSlab           slab;
+    std::vector<void *> blocks;
+    for (std::size_t bytes = 8; bytes + ActorSlab::kHeaderBytes <= ActorSlab::kMaxBlockBytes; bytes += 24) {
+        auto *block = ActorSlab::allocate(&slab, bytes);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), 0u);
+        std::memset(block, 0x5a, bytes);
+        blocks.push_back(block);
+    }
+    EXPECT_GT(slab.reserved(), ActorSlab::kChunkBytes) << "the classes spilled over several chunks";
+    for (void *p : blocks)
+        ActorSlab::deallocate(p, &slab);
+    EXPECT_EQ(slab.live(), 0u);
+}
+
+TEST(ActorSlab, ForeignFreeReturnsToTheOwner) {
+    ActorSlab           slab;
+    ActorSlab           other;
+    std::vector<void *> blocks;
+    for (int i = 0; i < 64; ++i)
+        blocks.push_back(ActorSlab::allocate(&slab, 100));
+
+    std::thread([&blocks, &other] {
+        for (void *p : blocks)
+            ActorSlab::deallocate(p, &other); // not `other`'s blocks: back to `slab`
+    }).join();
+    EXPECT_EQ(other.live(), 0u);
+    EXPECT_EQ(slab.live(), 64u) << "not reclaimed before the owner's next miss";
+
+    // The free list of the class is empty, so this allocation takes the whole return stack.
+    void *reused = ActorSlab::allocate(&slab, 100);
+    EXPECT_EQ(slab.live(), 1u);
+    EXPECT_NE(std::find(blocks.begin(), blocks.end(), reused), blocks.end());
+    EXPECT_EQ(slab.reserved(), ActorSlab::kChunkBytes);
+    ActorSlab::deallocate(reused, &slab);
+}
+
+TEST(ActorSlab, HeapWithoutASlabOrAboveTheLargestClass) {
+    ActorSlab slab;
+    void     *loose = ActorSlab::allocate(nullptr, 128);
+    void     *large = ActorSlab::allocate(&slab, ActorSlab::kMaxBlockBytes);
+    EXPECT_EQ(slab.live(), 0u);
+    EXPECT_EQ(slab.reserved(), 0u);
+    std::memset(large, 0, ActorSlab::kMaxBlockBytes);
+    ActorSlab::deallocate(loose, &slab);
+    ActorSlab::deallocate(large, nullptr);
+    ActorSlab::deallocate(nullptr, &slab);
+}
@@ -0,0 +1,149 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/core/cpu-topology.cpp
+ * @brief `qb::CpuTopology` — sysfs discovery and the placement it derives. NO `qb::Main`.
+ *
+ * `discover()` is pointed at a fake `devices/system` tree written to a temp directory: two
+ * sockets, one NUMA node and one L3 each, two physical cores per socket with two SMT threads
+ * each (Linux numbering: siblings are `n` and `n + 4`), and an offline CPU 8. Against it:
+ *
+ *   - nodes, packages, L3 domains, siblings and SLIT distances read back as written;
+ *   - `spread()` fills every physical core, alternating sockets, before any SMT sibling, wraps
+ *     past the set, and places CPUs it does not know last;
+ *   - a missing tree falls back to one node of `hardware_concurrency()` independent CPUs;
+ *   - `bindMemory()` rejects what it cannot bind, and on Linux binds a buffer to the node of CPU 0.
+ */
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <gtest/gtest.h>
+#include <qb/core/CoreSet.h>
+
+namespace fs = std::filesystem;
+using qb::CoreId;
+using qb::CoreIdSet;
+using qb::CpuTopology;
+
+namespace {
+
+void
+put(fs::path const &file, std::string const &text) {
+    fs::create_directories(file.parent_path());
+    std::ofstream(file) << text << '\n';
+}
+
+class FakeSysfs : public ::testing::Test {
+protected:
+    fs::path root;
+
+    void
+    SetUp() override {
+        root = fs::temp_directory_path() / ("qb-sysfs-" + std::to_string(::getpid()));
+        fs::remove_all(root);
+        put(root / "cpu/online", "0-7");
+        for (int cpu = 0; cpu <= 8; ++cpu) {
+            const auto dir     = root / "cpu" / ("cpu" + std::to_string(cpu));
+            const int  package = (cpu % 4) / 2;
+            put(dir / "topology/physical_package_id", std::to_string(package));
+            put(dir / "topology/core_id", std::to_string(cpu % 2));
+            put(dir / "cache/index0/level", "1");
+            put(dir / "cache/index0/id", "99");
+            put(dir / "cache/index3/level", "3");
+            put(dir / "cache/index3/id", std::to_string(package));
+        }
+        put(root / "node/node0/cpulist", "0-1,4-5");
+        put(root / "node/node0/distance", "10 21");
+        put(root / "node/node1/cpulist", "2-3,6-7");
+        put(root / "node/node1/distance", "21 10");
+    }
+    void
+    TearDown() override {
+        fs::remove_all(root);
+    }
+};
+
+CoreIdSet
+set_of(std::initializer_list<CoreId> ids) {
+    CoreIdSet set;
+    for (const auto id : ids)
+        set.insert(id);
+    return set;
+}
+
+} // namespace
+
+TEST_F(FakeSysfs, ReadsNodesSocketsCachesAndSiblings) {
+    const auto topo = CpuTopology::discover(root.string());
+    ASSERT_EQ(topo.cpus().size(), 8u) << "CPU 8 is not online";
+    EXPECT_EQ(topo.getNbNodes(), 2u);
+    EXPECT_EQ(topo.nodeOf(5), 0);
+    EXPECT_EQ(topo.nodeOf(6), 1);
+    EXPECT_EQ(topo.nodeOf(8), -1);
+    EXPECT_EQ(topo.find(8), nullptr);
+    EXPECT_EQ(topo.find(3)->package, 1);
+    EXPECT_EQ(topo.find(3)->l3, 1);
+
+    EXPECT_EQ(topo.nodeCores(1).to_vector(), (std::vector<CoreId>{2, 3, 6, 7}));
+    EXPECT_EQ(topo.packageCores(0).to_vector(), (std::vector<CoreId>{0, 1, 4, 5}));
+    EXPECT_EQ(topo.siblings(0).to_vector(), (std::vector<CoreId>{0, 4}));
+    EXPECT_EQ(topo.l3Cores(1).to_vector(), (std::vector<CoreId>{0, 1, 4, 5}));
+    EXPECT_TRUE(topo.siblings(8).empty());
+
+    EXPECT_EQ(topo.nodeDistance(0, 0), 10);
+    EXPECT_EQ(topo.nodeDistance(0, 1), 21);
+    EXPECT_EQ(topo.nodeDistance(1, 0), 21);
+    EXPECT_EQ(topo.nodeDistance(0, 5), 0) << "unknown node";
+}
+
+TEST_F(FakeSysfs, SpreadsOverPhysicalCoresBeforeSiblings) {
+    const auto topo = CpuTopology::discover(root.string());
+    CoreIdSet  all;
+    for (auto const &info : topo.cpus())
+        all.insert(info.cpu);
+    EXPECT_EQ(topo.spread(all, 8), (std::vector<CoreId>{0, 2, 1, 3, 4, 6, 5, 7})) << "alternating sockets, then SMT";
+    EXPECT_EQ(topo.spread(topo.nodeCores(0), 3), (std::vector<CoreId>{0, 1, 4}));
+    EXPECT_EQ(topo.spread(topo.nodeCores(0), 5), (std::vector<CoreId>{0, 1, 4, 5, 0})) << "wraps";
+    EXPECT_EQ(topo.spread(set_of({0, 200}), 2), (std::vector<CoreId>{0, 200})) << "unknown CPUs last";
+    EXPECT_TRUE(topo.spread({}, 4).empty());
+}
+
+TEST(CpuTopology, FallsBackWithoutSysfs) {
+    const auto topo = CpuTopology::discover("/nonexistent/qb-sysfs");
+    EXPECT_EQ(topo.cpus().size(), std::max(1u, std::thread::hardware_concurrency()));
+    EXPECT_EQ(topo.getNbNodes(), 1u);
+    EXPECT_EQ(topo.nodeOf(0), 0);
+    EXPECT_EQ(topo.siblings(0).to_vector(), (std::vector<CoreId>{0}));
+}
+
+TEST(CpuTopology, HostAndCoreSetAgree) {
+    auto const &host = qb::CoreSet::topology();
+    ASSERT_FALSE(host.cpus().empty());
+    const auto      cpu  = host.cpus().front().cpu;
+    const qb::CoreSet set{set_of({cpu})};
+    EXPECT_EQ(set.nodeOf(cpu), host.nodeOf(cpu));
+    EXPECT_TRUE(set.onNode(host.nodeOf(cpu)).contains(cpu));
+}
+
+TEST(CpuTopology, BindMemory) {
+    auto buffer = std::make_unique<char[]>(1 << 16);
+    EXPECT_FALSE(CpuTopology::bindMemory(nullptr, 4096, 0));
+    EXPECT_FALSE(CpuTopology::bindMemory(buffer.get(), 1 << 16, -1));
+#if defined(__linux__)
+    auto const &host = CpuTopology::host();
+    EXPECT_TRUE(CpuTopology::bindMemory(buffer.get(), 1 << 16, host.nodeOf(host.cpus().front().cpu)));
+#endif
+}
@@ -216,6 +216,47 @@ TEST(EventHeader, GetItemSizeRoundsUpNoOffByOne) {
     EXPECT_EQ(ceil_buckets(129), 3u);
 }
 
+// ---------------------------------------------------------------------------
+// detail::packed_bucket::width<T>() — the slots (quarters of a bucket) a small event occupies
+// when several share one bucket of a mailbox ring. A derived event's members start at offset 16,
+// in Event's tail padding, so the width follows the members' extent, not sizeof(T) (64 for all of
+// these). Oracle: 16-byte header + member bytes, rounded up to 16.
+// ---------------------------------------------------------------------------
+
+namespace {
+struct Empty final : Event {};
+struct Int : Event {
+    std::int32_t value;
+};
+struct Sixteen : Event {
+    std::uint64_t a, b;
+};
+struct Seventeen : Event {
+    std::uint64_t a, b;
+    char          c;
+};
+struct FortyEight : Event {
+    char pad[48];
+};
+} // namespace
+
+using qb::detail::packed_bucket;
+
+static_assert(packed_bucket::slots * packed_bucket::slot_bytes == QB_LOCKFREE_EVENT_BUCKET_BYTES);
+
+TEST(PackedBucket, WidthFollowsTheMembersNotSizeof) {
+    static_assert(sizeof(Int) == 64 && sizeof(Seventeen) == 64 && sizeof(FortyEight) == 64);
+    EXPECT_EQ(packed_bucket::width<Event>(), 1u);
+    EXPECT_EQ(packed_bucket::width<Empty>(), 1u);
+    EXPECT_EQ(packed_bucket::width<Int>(), 2u) << "16 + 4 bytes round up to two slots";
+    EXPECT_EQ(packed_bucket::width<Sixteen>(), 2u) << "16 + 16 bytes fill two slots exactly";
+    EXPECT_EQ(packed_bucket::width<Seventeen>(), 3u) << "one byte over tips into a third slot";
+    EXPECT_EQ(packed_bucket::width<FortyEight>(), 0u) << "a full bucket gains nothing from packing";
+    EXPECT_EQ(packed_bucket::width<E1>(), 2u);
+    EXPECT_EQ(packed_bucket::width<Eover>(), 0u) << "wider than one bucket: never packed";
+    EXPECT_EQ(packed_bucket::width<qb::KillEvent>(), 1u);
+}
+
 // ---------------------------------------------------------------------------
 // Pipe::allocated_push bucket rounding + the documented uint16 truncation cap.
 // allocated_push computes:  n = (hint + sizeof(T)); buckets = n/bucketBytes + (n%bucketBytes!=0);
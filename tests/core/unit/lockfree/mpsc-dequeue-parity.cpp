@@ -232,8 +232,8 @@ TEST(MpscDequeueParity, TheTwoDrainsAgreeOnContentAndDisagreeOnBudget) {
 }
 
 // ---------------------------------------------------------------------------
-// Same two properties on the runtime-producer specialisation, which the engine
-// actually instantiates (`Mailbox` is <EventBucket, MaxRingEvents, 0>).
+// Same two properties on the runtime-producer specialisation. The engine's own
+// `Mailbox` (runtime-sized lanes) keeps the per-producer form of the second.
 // ---------------------------------------------------------------------------
 
 TEST(MpscDequeueParity, RuntimeSpecialisationHasTheSameTwoContracts) {
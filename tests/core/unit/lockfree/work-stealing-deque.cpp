@@ -0,0 +1,152 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/lockfree/work-stealing-deque.cpp
+ * @brief `qb::lockfree::work_stealing_deque` — the Chase-Lev deque behind the engine's task queues.
+ *
+ * What is pinned:
+ *   - the owner end is LIFO and the thief end FIFO, on one deque;
+ *   - growth keeps every element in place, including across a wrapped `top`;
+ *   - **no loss, no duplication** when the owner pushes and pops while thieves steal: every
+ *     pushed value is taken exactly once, by whichever side won it. The race that matters is on
+ *     the last element, so the owner keeps the deque near-empty for most of the run.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qb/system/lockfree/work_stealing_deque.h>
+
+using qb::lockfree::work_stealing_deque;
+
+namespace {
+
+TEST(WorkStealingDeque, EmptyDequeYieldsNothing) {
+    work_stealing_deque<int *> q;
+    int                       *out = nullptr;
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.pop(out));
+    EXPECT_FALSE(q.steal(out));
+    EXPECT_EQ(out, nullptr) << "a failed take must not touch the out parameter";
+    EXPECT_TRUE(q.empty()) << "a failed pop must restore the bottom index";
+}
+
+TEST(WorkStealingDeque, OwnerPopsNewestThiefStealsOldest) {
+    work_stealing_deque<std::uintptr_t> q(4);
+    for (std::uintptr_t i = 1; i <= 4; ++i)
+        q.push(i);
+    std::uintptr_t out = 0;
+    ASSERT_TRUE(q.pop(out));
+    EXPECT_EQ(out, 4u);
+    ASSERT_TRUE(q.steal(out));
+    EXPECT_EQ(out, 1u);
+    ASSERT_TRUE(q.steal(out));
+    EXPECT_EQ(out, 2u);
+    ASSERT_TRUE(q.pop(out));
+    EXPECT_EQ(out, 3u);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(WorkStealingDeque, GrowthKeepsEveryElementAcrossAWrappedTop) {
+    work_stealing_deque<std::uintptr_t> q(4);
+    std::uintptr_t                      out = 0;
+    // Move `top` off zero so the live range wraps the small ring before it grows.
+    for (std::uintptr_t i = 0; i < 3; ++i) {
+        q.push(100 + i);
+        ASSERT_TRUE(q.steal(out));
+    }
+    for (std::uintptr_t i = 0; i < 100; ++i)
+        q.push(i);
+    EXPECT_GE(q.capacity(), 100u);
+    EXPECT_EQ(q.size(), 100u);
+    for (std::uintptr_t i = 0; i < 50; ++i) {
+        ASSERT_TRUE(q.steal(out));
+        EXPECT_EQ(out, i);
+    }
+    for (std::uintptr_t i = 100; i-- > 50;) {
+        ASSERT_TRUE(q.pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(WorkStealingDeque, ReserveGrowsAheadOfThePushes) {
+    work_stealing_deque<std::uintptr_t> q(4);
+    q.push(1);
+    q.reserve(20);
+    const auto capacity = q.capacity();
+    EXPECT_GE(capacity, 21u);
+    for (std::uintptr_t i = 2; i <= 21; ++i)
+        q.push(i);
+    EXPECT_EQ(q.capacity(), capacity) << "reserved pushes must not grow the ring again";
+    std::uintptr_t out = 0;
+    for (std::uintptr_t i = 1; i <= 21; ++i) {
+        ASSERT_TRUE(q.steal(out));
+        EXPECT_EQ(out, i);
+    }
+    q.reserve(3);
+    EXPECT_EQ(q.capacity(), capacity) << "room already there: no growth";
+}
+
+TEST(WorkStealingDeque, OwnerAndThievesTakeEveryValueExactlyOnce) {
+    constexpr std::size_t kValues  = 200000;
+    constexpr int         kThieves = 3;
+    work_stealing_deque<std::uintptr_t> q(8);
+    std::vector<std::atomic<int>>       taken(kValues + 1);
+    std::atomic<bool>                   done{false};
+    std::atomic<std::size_t>            stolen{0};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < kThieves; ++t)
+        thieves.emplace_back([&] {
+            std::uintptr_t out = 0;
+            for (;;) {
+                if (q.steal(out)) {
+                    taken[out].fetch_add(1, std::memory_order_relaxed);
+                    stolen.fetch_add(1, std::memory_order_relaxed);
+                } else if (done.load(std::memory_order_acquire) && q.empty())
+                    return;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    std::uintptr_t out = 0;
+    for (std::uintptr_t v = 1; v <= kValues; ++v) {
+        q.push(v);
+        // Pop about half back: the deque hovers around one element, where pop and steal race.
+        if ((v & 1u) && q.pop(out))
+            taken[out].fetch_add(1, std::memory_order_relaxed);
+    }
+    while (q.pop(out))
+        taken[out].fetch_add(1, std::memory_order_relaxed);
+    done.store(true, std::memory_order_release);
+    for (auto &t : thieves)
+        t.join();
+
+    std::size_t missing = 0, doubled = 0;
+    for (std::size_t v = 1; v <= kValues; ++v) {
+        const int n = taken[v].load();
+        missing += n == 0;
+        doubled += n > 1;
+    }
+    EXPECT_EQ(missing, 0u);
+    EXPECT_EQ(doubled, 0u);
+    EXPECT_TRUE(q.empty());
+    EXPECT_LE(stolen.load(), kValues);
+}
+
+} // namespace
@@ -19,6 +19,7 @@
  *   semh — single-event / multi-handler            (subscribe/unsubscribe + broadcast fan-out)
  *   mesh — multi-event / single-handler            (type-id keyed resolver)
  *   memh — multi-event / multi-handler + onError   (per-route error callback on an unknown id)
+ *   dense_memh — memh's contract over ordinal × slot tables (same topology, same oracles)
  *
  * Every expected count is *derived from the routing topology* (subscriptions × iterations),
  * not echoed from a value the test set, so each is a real invariant. Two orthogonal oracles
@@ -474,3 +475,255 @@ TEST(EventRouting, MemhDisposerMemoStaysCorrectAcrossRepeatedRoutes) {
 
     EXPECT_EQ(TestDestroyEvent::_count, kRoutes) << "each unrouted event must have its payload disposed exactly once";
 }
+
+// =============================================================================
+// dense_memh — the MEMH contract over ordinal × slot tables.
+//
+// Needs an integral, dense event id and a handler id exposing `sid()`, which the `RawEvent` /
+// `ActorId` mocks above (typeid-name ids, no slot) do not have — so it gets its own pair, shaped
+// like `qb::Event` / `qb::ActorId`: low 16 bits are the slot, high 16 bits the core.
+// =============================================================================
+
+namespace {
+
+struct DenseId {
+    uint32_t _id = 0;
+
+    DenseId() = default;
+    explicit DenseId(uint32_t id) noexcept
+        : _id(id) {}
+
+    [[nodiscard]] uint16_t
+    sid() const noexcept {
+        return static_cast<uint16_t>(_id & 0xFFFFu);
+    }
+    [[nodiscard]] bool
+    is_broadcast() const noexcept {
+        return sid() == std::numeric_limits<uint16_t>::max();
+    }
+    bool
+    operator==(DenseId const &rhs) const noexcept {
+        return _id == rhs._id;
+    }
+};
+
+const DenseId kDenseBroadcast{0xFFFFu};
+
+// Stands in for `type_id_for<T>()`: a dense counter, deliberately offset so the ordinal table is
+// exercised with ids that are neither 0 nor contiguous with the router's ordinals.
+inline uint16_t dense_type_counter = 40;
+template <typename T>
+uint16_t
+dense_type_id() noexcept {
+    static const uint16_t id = ++dense_type_counter;
+    return id;
+}
+
+struct DenseRaw {
+    using id_type         = uint16_t;
+    using id_handler_type = DenseId;
+
+    template <typename T>
+    static id_type
+    type_to_id() noexcept {
+        return dense_type_id<T>();
+    }
+
+    id_type id{};
+    DenseId dest{};
+    bool    alive = true;
+
+    [[nodiscard]] id_type
+    getID() const noexcept {
+        return id;
+    }
+    [[nodiscard]] bool
+    is_alive() const noexcept {
+        return alive;
+    }
+    [[nodiscard]] DenseId
+    getDestination() const noexcept {
+        return dest;
+    }
+};
+
+struct DenseHit : DenseRaw {
+    static std::size_t _count;
+    DenseHit() {
+        id = type_to_id<DenseHit>();
+    }
+};
+std::size_t DenseHit::_count = 0;
+
+struct DenseDestroy : DenseRaw {
+    static std::size_t _count;
+    DenseDestroy() {
+        alive = false;
+        id    = type_to_id<DenseDestroy>();
+    }
+    ~DenseDestroy() {
+        ++_count;
+    }
+};
+std::size_t DenseDestroy::_count = 0;
+
+struct DenseUnknown : DenseRaw {
+    DenseUnknown() {
+        id = type_to_id<DenseUnknown>();
+    }
+};
+
+struct DenseActor {
+    DenseId     _id;
+    std::size_t hits = 0;
+
+    explicit DenseActor(uint32_t id)
+        : _id(id) {}
+
+    [[nodiscard]] DenseId
+    id() const noexcept {
+        return _id;
+    }
+    [[nodiscard]] bool
+    is_alive() const noexcept {
+        return true;
+    }
+    void
+    on(DenseHit &) {
+        ++hits;
+        ++DenseHit::_count;
+    }
+    void
+    on(DenseDestroy const &) {
+        ++hits;
+    }
+};
+
+} // namespace
+
+TEST(EventRouting, DenseMEMHMatchesMemhTopology) {
+    // Same topology as Test_MEMH: 5 subscribers, 1/2/3 removed by the three unsubscribe forms,
+    // 5 targeted routes + 1 broadcast per iteration → 4 handler hits per iteration.
+    DenseActor                       a1(1), a2(2), a3(3), a4(4), a5(5);
+    qb::router::dense_memh<DenseRaw> router;
+    for (auto *a : {&a1, &a2, &a3, &a4, &a5})
+        router.subscribe<DenseHit>(*a);
+    router.unsubscribe(a1.id());
+    router.unsubscribe(a2);
+    router.unsubscribe<DenseHit>(a3);
+
+    std::size_t on_error = 0;
+    const auto  onError  = [&](DenseRaw &) {
+        ++on_error;
+    };
+    DenseHit event;
+    DenseHit::_count = 0;
+    for (std::size_t i = 0; i < 1024u; ++i) {
+        for (uint32_t j = 1; j < 6u; ++j) {
+            event.dest = DenseId(j);
+            router.route(event, onError);
+        }
+        event.dest = kDenseBroadcast;
+        router.route(event, onError);
+    }
+    EXPECT_EQ(DenseHit::_count, 4096u);
+    EXPECT_EQ(a4.hits, 2048u);
+    EXPECT_EQ(a5.hits, 2048u);
+    EXPECT_EQ(a1.hits + a2.hits + a3.hits, 0u);
+    EXPECT_EQ(on_error, 0u) << "a subscribed type must never take the error path";
+
+    // A destination whose slot lies beyond every row is a miss, not an out-of-bounds read.
+    event.dest = DenseId(60000);
+    router.route(event, onError);
+    EXPECT_EQ(DenseHit::_count, 4096u);
+}
+
+TEST(EventRouting, DenseMEMHReleasesPerCleanEventPolicy) {
+    DenseActor actor(7);
+
+    // _CleanEvent=true: every route releases the not-alive payload, hit or miss, unicast or
+    // broadcast — 3 routes, 3 destructor runs attributable to the router.
+    {
+        qb::router::dense_memh<DenseRaw, true> router;
+        router.subscribe<DenseDestroy>(actor);
+        const auto noop = [](auto &) {
+        };
+        alignas(DenseDestroy) unsigned char storage[sizeof(DenseDestroy)];
+        DenseDestroy::_count = 0;
+        for (const uint32_t dest : {7u, 8u, 0xFFFFu}) {
+            auto *ev = new (storage) DenseDestroy{};
+            ev->dest = DenseId(dest);
+            router.route(*ev, noop);
+        }
+        EXPECT_EQ(DenseDestroy::_count, 3u);
+    }
+
+    // _CleanEvent=false: the router never destroys.
+    {
+        qb::router::dense_memh<DenseRaw, false> router;
+        router.subscribe<DenseDestroy>(actor);
+        const auto noop = [](auto &) {
+        };
+        alignas(DenseDestroy) unsigned char storage[sizeof(DenseDestroy)];
+        auto *ev             = new (storage) DenseDestroy{};
+        ev->dest             = DenseId(7);
+        DenseDestroy::_count = 0;
+        router.route(*ev, noop);
+        EXPECT_EQ(DenseDestroy::_count, 0u);
+        ev->~DenseDestroy();
+    }
+}
+
+TEST(EventRouting, DenseMEMHUnknownTypeTakesErrorPath) {
+    DenseActor                       actor(1);
+    qb::router::dense_memh<DenseRaw> router;
+    router.subscribe<DenseHit>(actor);
+
+    std::size_t  on_error = 0;
+    DenseUnknown unknown;
+    unknown.dest = DenseId(1);
+    router.route(unknown, [&](DenseRaw &e) {
+        ++on_error;
+        EXPECT_EQ(&e, static_cast<DenseRaw *>(&unknown));
+    });
+    EXPECT_EQ(on_error, 1u);
+    EXPECT_EQ(actor.hits, 0u);
+}
+
+TEST(EventRouting, DenseMEMHSubscribeDuringBroadcast) {
+    // A handler that subscribes a new handler mid-broadcast (an actor spawning another) grows the
+    // row under the router's feet; the snapshot must keep the in-flight broadcast on the targets it
+    // started with, and the newcomer must be reachable from the next route on.
+    struct Spawner : DenseActor {
+        qb::router::dense_memh<DenseRaw> *router = nullptr;
+        DenseActor                        child{900};
+        bool                              spawned = false;
+
+        using DenseActor::DenseActor;
+        void
+        on(DenseHit &) {
+            ++hits;
+            if (!spawned) {
+                spawned = true;
+                router->subscribe<DenseHit>(child);
+            }
+        }
+    };
+
+    qb::router::dense_memh<DenseRaw> router;
+    Spawner                          parent(1);
+    parent.router = &router;
+    router.subscribe<DenseHit>(parent);
+
+    const auto noop = [](auto &) {
+    };
+    DenseHit event;
+    event.dest = kDenseBroadcast;
+    router.route(event, noop);
+    EXPECT_EQ(parent.hits, 1u);
+    EXPECT_EQ(parent.child.hits, 0u) << "a handler subscribed during a broadcast must not receive that broadcast";
+
+    router.route(event, noop);
+    EXPECT_EQ(parent.hits, 2u);
+    EXPECT_EQ(parent.child.hits, 1u);
+}
@@ -0,0 +1,146 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/system/huge-pages.cpp
+ * @brief `qb::allocator::map_pages` / `page_region`, and the two containers that can sit on them.
+ *
+ *   - every `page_kind` maps zeroed, writable memory; anything but `normal` is 2 MiB-aligned and
+ *     whole pages long, and an empty hugetlb pool falls back instead of failing;
+ *   - `page_region` releases its mapping once, across moves;
+ *   - `spsc::ringbuffer<T, 0>` runs on storage it is handed, wrapping through it;
+ *   - a `pipe` with `huge_pages(true)` moves onto an aligned mapping once it outgrows a huge page,
+ *     keeps its contents across growth and moves, and stays on the heap below that.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+#include <qb/system/allocator/huge_pages.h>
+#include <qb/system/allocator/pipe.h>
+#include <qb/system/lockfree/spsc.h>
+
+using qb::allocator::huge_page_size;
+using qb::allocator::page_kind;
+using qb::allocator::page_region;
+
+namespace {
+
+bool
+huge_aligned(void const *addr) {
+    return reinterpret_cast<std::uintptr_t>(addr) % huge_page_size == 0;
+}
+
+struct Bucket {
+    std::uint64_t words[8];
+};
+
+} // namespace
+
+TEST(HugePages, MapsEveryKindWithFallback) {
+    for (const auto want : {page_kind::normal, page_kind::transparent, page_kind::hugetlb}) {
+        SCOPED_TRACE(qb::allocator::to_string(want));
+        auto       got   = page_kind::hugetlb;
+        const auto bytes = huge_page_size + 100;
+        auto      *addr  = static_cast<unsigned char *>(qb::allocator::map_pages(bytes, want, &got));
+        ASSERT_NE(addr, nullptr);
+        EXPECT_LE(got, want) << "never better than asked";
+        EXPECT_EQ(addr[0], 0);
+        EXPECT_EQ(addr[bytes - 1], 0);
+        std::memset(addr, 0xab, bytes);
+        if (want != page_kind::normal) {
+#if defined(__linux__)
+            EXPECT_TRUE(huge_aligned(addr));
+            EXPECT_NE(got, page_kind::normal) << "madvise(MADV_HUGEPAGE) exists on every supported kernel";
+#endif
+            EXPECT_EQ(qb::allocator::mapping_size(bytes, want), 2 * huge_page_size);
+        }
+        qb::allocator::unmap_pages(addr, bytes, want);
+    }
+    EXPECT_EQ(qb::allocator::map_pages(0, page_kind::transparent), nullptr);
+}
+
+TEST(HugePages, RegionOwnsItsMappingAcrossMoves) {
+    page_region empty;
+    EXPECT_FALSE(empty);
+    EXPECT_EQ(empty.kind(), page_kind::normal);
+
+    page_region region(4096 * 3, page_kind::transparent);
+    ASSERT_TRUE(region);
+    EXPECT_EQ(region.size(), 4096u * 3);
+    region.as<Bucket>()[10].words[0] = 42;
+
+    page_region moved(std::move(region));
+    EXPECT_FALSE(region);
+    ASSERT_TRUE(moved);
+    EXPECT_EQ(moved.as<Bucket>()[10].words[0], 42u);
+
+    page_region other(64, page_kind::normal);
+    other = std::move(moved);
+    EXPECT_EQ(other.as<Bucket>()[10].words[0], 42u);
+    EXPECT_FALSE(moved);
+}
+
+TEST(HugePages, RingRunsOnAdoptedStorage) {
+    constexpr std::size_t kCapacity = 15;
+    page_region           region((kCapacity + 1) * sizeof(Bucket), page_kind::transparent);
+    ASSERT_TRUE(region);
+    qb::lockfree::spsc::ringbuffer<Bucket, 0> ring(kCapacity, region.as<Bucket>());
+    EXPECT_EQ(ring.data(), region.as<Bucket>());
+    EXPECT_EQ(ring.storage_size(), kCapacity + 1);
+
+    std::uint64_t sent = 0, received = 0;
+    for (int round = 0; round < 10; ++round) { // wraps the ring several times
+        std::vector<Bucket> batch(11);
+        for (auto &bucket : batch)
+            bucket.words[0] = sent++;
+        ASSERT_EQ(ring.enqueue(batch.data(), batch.size()), batch.size());
+        Bucket out[kCapacity];
+        const auto n = ring.dequeue(out, kCapacity);
+        ASSERT_EQ(n, batch.size());
+        for (std::size_t i = 0; i < n; ++i)
+            EXPECT_EQ(out[i].words[0], received++);
+    }
+
+    qb::lockfree::spsc::ringbuffer<Bucket, 0> own(kCapacity, nullptr);
+    EXPECT_NE(own.data(), nullptr) << "null storage: the ring allocates";
+}
+
+TEST(HugePages, PipeGrowsOntoHugePages) {
+    constexpr std::size_t kPerPage = huge_page_size / sizeof(Bucket);
+    qb::allocator::pipe<Bucket> pipe;
+    pipe.huge_pages(true);
+    EXPECT_TRUE(pipe.huge_pages());
+    for (std::size_t i = 0; i < kPerPage / 2; ++i)
+        pipe.allocate_back(1)->words[0] = i;
+    EXPECT_LT(pipe.capacity() * sizeof(Bucket), huge_page_size) << "below one huge page: still the heap";
+
+    for (std::size_t i = kPerPage / 2; i < 2 * kPerPage; ++i)
+        pipe.allocate_back(1)->words[0] = i;
+#if defined(__linux__)
+    EXPECT_TRUE(huge_aligned(pipe.data()));
+#endif
+    for (std::size_t i = 0; i < pipe.size(); ++i)
+        ASSERT_EQ(pipe.begin()[i].words[0], i);
+
+    qb::allocator::pipe<Bucket> moved(std::move(pipe));
+    EXPECT_EQ(moved.size(), 2 * kPerPage);
+    EXPECT_EQ(moved.begin()[kPerPage].words[0], kPerPage);
+    qb::allocator::pipe<Bucket> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 2 * kPerPage);
+    EXPECT_TRUE(assigned.huge_pages());
+
+    qb::allocator::pipe<Bucket> plain;
+    for (std::size_t i = 0; i < 2 * kPerPage; ++i)
+        plain.allocate_back(1);
+    EXPECT_FALSE(plain.huge_pages());
+}
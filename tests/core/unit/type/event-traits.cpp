@@ -125,4 +125,31 @@ TEST(EventTraits, ServiceEventSize) {
     EXPECT_EQ(sizeof(qb::ServiceEvent), 64u);
 }
 
+// ---------------------------------------------------------------------------
+// Dispatch priority is opt-in per type and independent of QoS: no event rides the priority
+// lane unless `qb::is_priority_event` is specialised for it, and the `_v` form strips
+// cv/ref qualifiers so a deduced `T const &` gets the same answer as `T`.
+// ---------------------------------------------------------------------------
+
+struct ControlEvent : public qb::Event {};
+
+} // namespace
+
+template <>
+struct qb::is_priority_event<ControlEvent> : std::true_type {};
+
+namespace {
+
+static_assert(!qb::is_priority_event_v<qb::Event>);
+static_assert(!qb::is_priority_event_v<qb::EventQOS0>);
+static_assert(!qb::is_priority_event_v<qb::KillEvent>, "kill keeps its FIFO place unless a program opts it in");
+static_assert(qb::is_priority_event_v<ControlEvent>);
+static_assert(qb::is_priority_event_v<ControlEvent const &>);
+
+TEST(EventTraits, PriorityLaneIsOptIn) {
+    EXPECT_FALSE(qb::is_priority_event_v<TriviallyDestructibleEvent>);
+    EXPECT_TRUE(qb::is_priority_event_v<ControlEvent>);
+    EXPECT_EQ(sizeof(ControlEvent), sizeof(qb::Event)) << "the lane is a header bit, not a member";
+}
+
 } // namespace
@@ -8,6 +8,8 @@
  * deadline, retry watchdog, and deferred dispatch in the framework. These
  * benchmarks isolate the create→fire round-trip and the rearm cost from any
  * socket I/O, driving a real (socket-free) libev loop via `listener::current`.
+ * The setTimeout churn case compares a dedicated `ev_timer` per handler with
+ * the same handlers moved onto the listener's `TimerWheel`.
  *
  * Seeded from the demoted perf smoke tests in the former test-async-io
  * (IntensiveAsyncOperations / ManyConcurrentTimers, ~4000 timers) — now
@@ -177,11 +179,56 @@ BM_WithTimeout_Rearm(benchmark::State &state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// ---------------------------------------------------------------------------
+// Deadline churn over a live population: `count` with_timeout handlers, each
+// iteration pushes one of them to a fresh deadline with setTimeout() — the
+// real re-arm (not the lazy updateTimeout() stamp). On its own ev_timer that
+// is a libev heap remove + insert, O(log count); with useTimerWheel() it is an
+// O(1) unlink/relink on the listener's TimerWheel. range(1) selects the wheel.
+// ---------------------------------------------------------------------------
+void
+BM_WithTimeout_SetTimeoutChurn(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const bool wheel = state.range(1) != 0;
+    qb::io::async::init();
+
+    std::vector<std::unique_ptr<RearmTimer>> timers;
+    timers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        timers.push_back(std::make_unique<RearmTimer>(60s + std::chrono::milliseconds(i)));
+        if (wheel)
+            timers.back()->useTimerWheel();
+    }
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        timers[next]->setTimeout(60s + std::chrono::milliseconds(next * 7 % 1000));
+        if (++next == count)
+            next = 0;
+    }
+
+    std::size_t fires = 0;
+    for (auto const &t : timers)
+        fires += t->fires;
+    timers.clear();
+    qb::io::async::listener::current.clear();
+
+    if (fires != 0)
+        state.SkipWithError("setTimeout churn should not let a handler fire");
+
+    state.SetItemsProcessed(state.iterations());
+}
+
 } // namespace
 
 BENCHMARK(BM_Callback_ImmediateDispatch)->Unit(benchmark::kNanosecond)->UseRealTime();
 BENCHMARK(BM_Callback_BulkDispatch)->Arg(64)->Arg(1024)->Arg(4096)->ArgName("timers")->Unit(benchmark::kMicrosecond)->UseRealTime();
 BENCHMARK(BM_ScopedCallback_ConstructFireDestroy)->Unit(benchmark::kNanosecond)->UseRealTime();
 BENCHMARK(BM_WithTimeout_Rearm)->Unit(benchmark::kNanosecond)->UseRealTime();
+BENCHMARK(BM_WithTimeout_SetTimeoutChurn)
+    ->ArgsProduct({{1024, 65536, 262144}, {0, 1}})
+    ->ArgNames({"timers", "wheel"})
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
 
 BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/**
+ * @file qb/io/tests/benchmark/session/broadcast-fanout.cpp
+ * @brief Cost of one `io_handler::stream()` broadcast against the number of sessions.
+ *
+ * A server pushes the same 4 KiB update to every connected session. `shared=0` is what
+ * `stream()` did before broadcast frames: `*session << payload` per session, which serializes and
+ * copies the payload into every session's output buffer. `shared=1` is `stream()` as it is now:
+ * the payload is serialized once into a `shared_frame` and every session queues a reference.
+ * `sessions` is the fan-out width.
+ *
+ * Only the fan-out itself is timed — the loop that reaches every session. The loopback delivery
+ * that follows (the sessions' writes, the clients' reads) is the same in both modes and runs with
+ * the timer paused. The `copied` counter is the number of payload bytes the fan-out put into the
+ * sessions' own buffers.
+ *
+ * Single-loop model, as in transport/tcp-accept-rate: the benchmark thread owns the plain
+ * loopback client sockets and the one `listener::current` loop the server runs on. Setup and
+ * teardown are outside the timed region; a pass cap turns a stall into `SkipWithError`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <qb/io/async.h>
+#include <qb/io/protocol/text.h>
+
+namespace {
+
+using namespace qb::io;
+
+constexpr std::size_t kPayload = 4096;
+
+class FanoutServer;
+
+// Server-side session: only ever written to.
+class FanoutSession : public use<FanoutSession>::tcp::client<FanoutServer> {
+public:
+    using Protocol = qb::protocol::text::command<FanoutSession>;
+
+    explicit FanoutSession(IOServer &server)
+        : client(server) {}
+
+    void
+    on(Protocol::message &&) {}
+};
+
+class FanoutServer : public use<FanoutServer>::tcp::server<FanoutSession> {};
+
+template <typename Predicate>
+bool
+pump_until(Predicate &&pred, std::size_t const max_passes = 5'000'000u) {
+    auto &loop = qb::io::async::listener::current;
+    for (std::size_t i = 0; i < max_passes; ++i) {
+        if (pred())
+            return true;
+        loop.run(EVRUN_NOWAIT);
+    }
+    return pred();
+}
+
+void
+BM_Session_BroadcastFanout(benchmark::State &state) {
+    const bool shared   = state.range(0) != 0;
+    const auto sessions = static_cast<std::size_t>(state.range(1));
+    qb::io::async::init();
+
+    const std::string payload(kPayload, 'u');
+
+    FanoutServer server;
+    if (server.transport().listen_v4(0, "127.0.0.1") != 0) {
+        state.SkipWithError("listen_v4 on loopback failed");
+        return;
+    }
+    const auto port = server.transport().local_endpoint().port();
+    server.set_max_sessions(0);
+    server.start();
+
+    std::vector<tcp::socket> clients(sessions);
+    for (auto &client : clients) {
+        if (client.connect_v4("127.0.0.1", port) != SocketStatus::Done) {
+            state.SkipWithError("loopback connect failed");
+            return;
+        }
+        client.set_nonblocking(true);
+    }
+    if (!pump_until([&] { return server.session_count() == sessions; })) {
+        state.SkipWithError("not every connection was registered");
+        return;
+    }
+
+    std::vector<char>        sink(64 * 1024);
+    std::vector<std::size_t> received(sessions);
+    std::size_t              copied = 0;
+    for (auto _ : state) {
+        if (shared) {
+            server.stream(std::string_view(payload));
+        } else {
+            for (auto &[id, session] : server.sessions())
+                *session << std::string_view(payload);
+        }
+
+        state.PauseTiming();
+        for (auto &[id, session] : server.sessions())
+            copied += session->out().size();
+        std::fill(received.begin(), received.end(), 0);
+        std::size_t done = 0;
+        const bool  ok   = pump_until([&] {
+            for (std::size_t i = 0; i < sessions; ++i) {
+                if (received[i] == kPayload)
+                    continue;
+                const int ret = clients[i].read(sink.data(), sink.size());
+                if (ret > 0 && (received[i] += static_cast<std::size_t>(ret)) == kPayload)
+                    ++done;
+            }
+            return done == sessions;
+        });
+        state.ResumeTiming();
+        if (!ok) {
+            state.SkipWithError("the broadcast never reached every client");
+            break;
+        }
+    }
+
+    clients.clear();
+    qb::io::async::listener::current.clear();
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * sessions));
+    state.counters["copied"] =
+        benchmark::Counter(static_cast<double>(copied), benchmark::Counter::kAvgIterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_Session_BroadcastFanout)
+    ->ArgsProduct({{0, 1}, {16, 256, 1024}})
+    ->ArgNames({"shared", "sessions"})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
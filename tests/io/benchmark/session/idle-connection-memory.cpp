@@ -0,0 +1,177 @@
+/**
+ * @file qb/io/tests/benchmark/session/idle-connection-memory.cpp
+ * @brief Input-buffer memory per idle connection, with and without pooled input.
+ *
+ * A server holds `connections` loopback sessions. Each client sends one line and then goes quiet.
+ * With `tail=1` it also sends the first bytes of a second line, so the session is left waiting
+ * on a partial message. `pooled=0` is the default stream mode: the first read grows the
+ * session's input buffer to `QB_DEFAULT_READ_BUFFER_SIZE`, and the session keeps it.
+ * `pooled=1` sets `set_pooled_input(true)` in the session constructor: reads land in the
+ * thread's scratch buffer, and only an unconsumed tail is kept, in a pooled 4 KiB buffer.
+ *
+ * Counters, per connection once every session has dispatched its line:
+ *   - `in_bytes`: the capacity of the session's input buffer.
+ *   - `heap_bytes` (glibc only): the growth of the bytes in use on the heap, from before the
+ *     clients connect to after (`mallinfo2`). This includes the session objects and their
+ *     output buffers, which both modes share. Unlike the resident set, it does not depend on
+ *     what an earlier run freed but the allocator kept.
+ * The time is that of setting up the connections and dispatching the first bytes.
+ *
+ * Single-loop model, as in transport/tcp-accept-rate. One iteration per run, since the
+ * measurement is the steady state the run sets up; a pass cap turns a stall into
+ * `SkipWithError`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <qb/io/async.h>
+#include <qb/io/input_pool.h>
+#include <qb/io/protocol/text.h>
+
+namespace {
+
+using namespace qb::io;
+
+constexpr std::size_t kConnectBatch = 256;
+
+bool g_pooled = false;
+
+class IdleServer;
+
+class IdleSession : public use<IdleSession>::tcp::client<IdleServer> {
+public:
+    using Protocol = qb::protocol::text::command<IdleSession>;
+
+    std::size_t lines = 0;
+
+    explicit IdleSession(IOServer &server)
+        : client(server) {
+        set_pooled_input(g_pooled);
+    }
+
+    void
+    on(Protocol::message &&) {
+        ++lines;
+    }
+};
+
+class IdleServer : public use<IdleServer>::tcp::server<IdleSession> {};
+
+template <typename Predicate>
+bool
+pump_until(Predicate &&pred, std::size_t const max_passes = 5'000'000u) {
+    auto &loop = qb::io::async::listener::current;
+    for (std::size_t i = 0; i < max_passes; ++i) {
+        if (pred())
+            return true;
+        loop.run(EVRUN_NOWAIT);
+    }
+    return pred();
+}
+
+// Bytes allocated on the heap and not yet freed, or 0 where the allocator cannot tell.
+std::size_t
+heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return ::mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void
+BM_Session_IdleConnectionMemory(benchmark::State &state) {
+    g_pooled                = state.range(0) != 0;
+    const bool tail         = state.range(1) != 0;
+    const auto connections  = static_cast<std::size_t>(state.range(2));
+    const char request[]    = "hello\nwor";
+    const auto request_size = tail ? sizeof(request) - 1 : 6;
+    qb::io::async::init();
+    input_pool::local().trim();
+
+    IdleServer server;
+    if (server.transport().listen_v4(0, "127.0.0.1") != 0) {
+        state.SkipWithError("listen_v4 on loopback failed");
+        return;
+    }
+    const auto port = server.transport().local_endpoint().port();
+    server.set_max_sessions(0);
+    server.start();
+
+    std::size_t in_bytes = 0, heap_bytes = 0;
+    for (auto _ : state) {
+        const auto heap_before = heap_in_use();
+        std::vector<tcp::socket> clients(connections);
+        for (std::size_t i = 0; i < connections; ++i) {
+            if (clients[i].connect_v4("127.0.0.1", port) != SocketStatus::Done ||
+                clients[i].write(request, request_size) != static_cast<int>(request_size)) {
+                state.SkipWithError("loopback connect or send failed");
+                return;
+            }
+            // Accept as we go, so the listen backlog never fills.
+            if ((i + 1) % kConnectBatch == 0 && !pump_until([&] { return server.session_count() == i + 1; })) {
+                state.SkipWithError("the server stopped accepting");
+                return;
+            }
+        }
+        const bool dispatched = pump_until([&] {
+            if (server.session_count() != connections)
+                return false;
+            for (auto &[id, session] : server.sessions())
+                if (session->lines != 1 || session->in().size() != request_size - 6)
+                    return false;
+            return true;
+        });
+        if (!dispatched) {
+            state.SkipWithError("not every session dispatched its line");
+            return;
+        }
+
+        const auto heap_after = heap_in_use();
+        for (auto &[id, session] : server.sessions())
+            in_bytes += session->in().capacity();
+        heap_bytes = heap_after > heap_before ? heap_after - heap_before : 0;
+
+        state.PauseTiming();
+        clients.clear();
+        pump_until([&] { return server.session_count() == 0; });
+        state.ResumeTiming();
+    }
+
+    qb::io::async::listener::current.clear();
+    state.counters["in_bytes"]   = static_cast<double>(in_bytes) / static_cast<double>(connections);
+    state.counters["heap_bytes"] = static_cast<double>(heap_bytes) / static_cast<double>(connections);
+}
+
+} // namespace
+
+BENCHMARK(BM_Session_IdleConnectionMemory)
+    ->ArgsProduct({{0, 1}, {0, 1}, {1000, 5000}})
+    ->ArgNames({"pooled", "tail", "connections"})
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
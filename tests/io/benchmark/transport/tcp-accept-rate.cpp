@@ -0,0 +1,139 @@
+/**
+ * @file qb/io/tests/benchmark/transport/tcp-accept-rate.cpp
+ * @brief Loopback connection rate through `use<>::tcp::server` (connects/s; no TLS, daemon-free).
+ *
+ * Prices the accept path a connection storm takes: the listener's readiness event, the accept
+ * syscalls, the batch handoff and `registerSessions()`, then the session teardown when the client
+ * hangs up. `budget` is the acceptor's per-wakeup accept budget (`set_accept_budget`): `1` takes
+ * one connection per libev dispatch, the default `QB_ACCEPT_BUDGET` drains the whole queued burst
+ * in one. `burst` is how many clients connect before the loop gets to run.
+ *
+ * Single-loop model, as in tcp-loopback-echo: blocking loopback connects complete in the kernel
+ * (they only need room in the listen backlog), so the benchmark thread opens `burst` clients,
+ * then pumps its one `listener::current` loop until the server has registered them all; closing
+ * the clients lets the same loop dispose the sessions before the next iteration.
+ *
+ * Methodology (perf harness, never a ctest gate): listener bring-up happens before the timed
+ * region; the connects, accepts and disconnect drain are all timed, since they are the cost of a
+ * connection. A pass cap turns a stall into `SkipWithError`, and a final check requires the
+ * server to have registered exactly every client.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <qb/io/async.h>
+#include <qb/io/protocol/text.h>
+
+namespace {
+
+using namespace qb::io;
+
+class AcceptServer;
+
+// Server-side session: nothing to say, only there to be registered and torn down.
+class AcceptSession : public use<AcceptSession>::tcp::client<AcceptServer> {
+public:
+    using Protocol = qb::protocol::text::command<AcceptSession>;
+
+    explicit AcceptSession(IOServer &server)
+        : client(server) {}
+
+    void
+    on(Protocol::message &&) {}
+};
+
+class AcceptServer : public use<AcceptServer>::tcp::server<AcceptSession> {
+public:
+    std::size_t registered = 0;
+
+    void
+    on(IOSession &) {
+        ++registered;
+    }
+};
+
+// Pump the single thread-local loop until `pred()` holds or the pass cap is hit.
+template <typename Predicate>
+bool
+pump_until(Predicate &&pred, std::size_t const max_passes = 5'000'000u) {
+    auto &loop = qb::io::async::listener::current;
+    for (std::size_t i = 0; i < max_passes; ++i) {
+        if (pred())
+            return true;
+        loop.run(EVRUN_NOWAIT);
+    }
+    return pred();
+}
+
+void
+BM_Tcp_AcceptRate(benchmark::State &state) {
+    const auto budget = static_cast<std::size_t>(state.range(0));
+    const auto burst  = static_cast<std::size_t>(state.range(1));
+    qb::io::async::init();
+
+    AcceptServer server;
+    if (server.transport().listen_v4(0, "127.0.0.1") != 0) {
+        state.SkipWithError("listen_v4 on loopback failed");
+        return;
+    }
+    const auto port = server.transport().local_endpoint().port();
+    server.set_accept_budget(budget);
+    server.start();
+
+    std::size_t              connected = 0;
+    std::vector<tcp::socket> clients;
+    clients.reserve(burst);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < burst; ++i) {
+            if (clients.emplace_back().connect_v4("127.0.0.1", port) != SocketStatus::Done) {
+                state.SkipWithError("loopback connect failed");
+                break;
+            }
+        }
+        connected += clients.size();
+        if (!pump_until([&] { return server.registered == connected; })) {
+            state.SkipWithError("accept stalled (a connection was never registered)");
+            break;
+        }
+        clients.clear(); // hang up: the sessions see EOF and leave the registry
+        if (!pump_until([&] { return server.session_count() == 0; })) {
+            state.SkipWithError("sessions were never disposed");
+            break;
+        }
+    }
+
+    qb::io::async::listener::current.clear();
+    if (server.registered != connected) {
+        state.SkipWithError("registered != connected");
+        return;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(connected));
+}
+
+} // namespace
+
+BENCHMARK(BM_Tcp_AcceptRate)
+    ->ArgsProduct({{1, QB_ACCEPT_BUDGET}, {16, 256}})
+    ->ArgNames({"budget", "burst"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
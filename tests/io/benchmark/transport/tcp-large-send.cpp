@@ -0,0 +1,149 @@
+/**
+ * @file qb/io/tests/benchmark/transport/tcp-large-send.cpp
+ * @brief Large response bodies out of a `use<>::tcp::server` session: copied vs queued by reference.
+ *
+ * A session answers with a body that already exists in memory — a cached file, a serialized
+ * snapshot. `frame=0` streams it into the session's output buffer (`*session << view`), so every
+ * response is one more copy of the body before the kernel's own; `frame=1` publishes a
+ * `shared_frame` made once (`*session << frame`), which the stream queues by reference and hands
+ * to `writev()` in place. `size` is the body size.
+ *
+ * Single-loop model, as in tcp-accept-rate: one `listener::current` loop runs the server, and the
+ * benchmark thread drains the plain loopback client socket between loop passes, until it has read
+ * the whole body.
+ *
+ * Methodology (perf harness, never a ctest gate): the connection is set up before the timed
+ * region; each iteration publishes one body and pumps until the client has read all of it. A pass
+ * cap turns a stall into `SkipWithError`.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <qb/io/async.h>
+#include <qb/io/protocol/text.h>
+#include <qb/io/shared_frame.h>
+
+namespace {
+
+using namespace qb::io;
+
+class SendServer;
+
+// Server-side session: never reads a request, only answers when the benchmark tells it to.
+class SendSession : public use<SendSession>::tcp::client<SendServer> {
+public:
+    using Protocol = qb::protocol::text::command<SendSession>;
+
+    explicit SendSession(IOServer &server)
+        : client(server) {}
+
+    void
+    on(Protocol::message &&) {}
+};
+
+class SendServer : public use<SendServer>::tcp::server<SendSession> {
+public:
+    SendSession *peer = nullptr;
+
+    void
+    on(IOSession &s) {
+        peer = &s;
+    }
+};
+
+template <typename Predicate>
+bool
+pump_until(Predicate &&pred, std::size_t const max_passes = 5'000'000u) {
+    auto &loop = qb::io::async::listener::current;
+    for (std::size_t i = 0; i < max_passes; ++i) {
+        if (pred())
+            return true;
+        loop.run(EVRUN_NOWAIT);
+    }
+    return pred();
+}
+
+void
+BM_Tcp_LargeSend(benchmark::State &state) {
+    const bool by_frame = state.range(0) != 0;
+    const auto size     = static_cast<std::size_t>(state.range(1));
+    qb::io::async::init();
+
+    std::string body(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+        body[i] = static_cast<char>('a' + i % 26);
+    const auto frame = shared_frame::copy_of(body);
+
+    SendServer server;
+    if (server.transport().listen_v4(0, "127.0.0.1") != 0) {
+        state.SkipWithError("listen_v4 on loopback failed");
+        return;
+    }
+    const auto port = server.transport().local_endpoint().port();
+    server.start();
+
+    tcp::socket client;
+    if (client.connect_v4("127.0.0.1", port) != SocketStatus::Done) {
+        state.SkipWithError("loopback connect failed");
+        return;
+    }
+    if (!pump_until([&] { return server.peer != nullptr; })) {
+        state.SkipWithError("the connection was never registered");
+        return;
+    }
+    client.set_nonblocking(true);
+
+    std::vector<char> sink(256 * 1024);
+    std::size_t       total = 0;
+    for (auto _ : state) {
+        if (by_frame)
+            *server.peer << frame;
+        else
+            *server.peer << std::string_view(body);
+        std::size_t received = 0;
+        if (!pump_until([&] {
+                const int ret = client.read(sink.data(), sink.size());
+                if (ret > 0)
+                    received += static_cast<std::size_t>(ret);
+                return received >= size;
+            })) {
+            state.SkipWithError("the body never arrived");
+            break;
+        }
+        total += received;
+    }
+
+    client.disconnect();
+    qb::io::async::listener::current.clear();
+    state.SetBytesProcessed(static_cast<std::int64_t>(total));
+}
+
+} // namespace
+
+BENCHMARK(BM_Tcp_LargeSend)
+    ->ArgsProduct({{0, 1}, {64 << 10, 1 << 20, 8 << 20}})
+    ->ArgNames({"frame", "size"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
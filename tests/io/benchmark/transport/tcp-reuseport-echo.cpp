@@ -0,0 +1,244 @@
+/**
+ * @file qb/io/tests/benchmark/transport/tcp-reuseport-echo.cpp
+ * @brief Multi-core TCP loopback echo: one `SO_REUSEPORT` server per thread (no TLS, daemon-free).
+ *
+ * The sharded counterpart of tcp-loopback-echo. Each of `shards` worker threads owns its own
+ * `listener::current` loop — exactly what a `VirtualCore` owns — with one
+ * `use<>::tcp::server` listening on a port shared with the other workers
+ * (`tcp::listener::listen_shared()`), plus `kClients` standalone echo clients. The kernel spreads
+ * the connections over the members' accept queues, so every worker accepts and echoes its share
+ * and no socket is ever handed to another loop. `shards=1` is the single-acceptor baseline; the
+ * messages/s column should scale with `shards` up to the number of CPUs.
+ *
+ * `steer=1` attaches `tcp::listener::steer_by_cpu()` and pins worker `i` to CPU `i`: the members
+ * are bound up front in worker order, so a client's SYN, handled on its own CPU, lands on its own
+ * worker's server and every round-trip stays on one core. `steer=0` leaves the kernel's 4-tuple
+ * hash in charge: sessions land on any worker, which still serves them from its own loop. Pinning
+ * is skipped for workers beyond the machine's CPU count.
+ *
+ * Methodology (perf harness, never a ctest gate): bring-up, connects and one warm-up round-trip
+ * per client happen before the timed region. Each timed iteration releases every worker at once;
+ * each fires `kBatch` messages on each of its clients and pumps its loop until they all return,
+ * then keeps pumping (serving sessions other workers' clients landed on) until the next release.
+ * A worker that stalls past the pass cap fails the run via `SkipWithError`; a final check
+ * requires every reply to have arrived.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup IO
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <qb/io/async.h>
+#include <qb/io/protocol/text.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace {
+
+using namespace qb::io;
+
+const std::string     kPayload = "round-trip-payload-0123456789";
+constexpr std::size_t kClients = 8;  // per worker
+constexpr std::size_t kBatch   = 64; // messages per client per iteration
+
+class EchoServer;
+
+class EchoServerSession : public use<EchoServerSession>::tcp::client<EchoServer> {
+public:
+    using Protocol = qb::protocol::text::command<EchoServerSession>;
+
+    explicit EchoServerSession(IOServer &server)
+        : client(server) {}
+
+    void
+    on(Protocol::message &&msg) {
+        *this << msg.text << Protocol::end;
+    }
+};
+
+class EchoServer : public use<EchoServer>::tcp::server<EchoServerSession> {
+public:
+    void
+    on(IOSession &) {}
+};
+
+class EchoClient : public use<EchoClient>::tcp::client<> {
+public:
+    using Protocol = qb::protocol::text::command<EchoClient>;
+
+    std::size_t received = 0;
+
+    void
+    on(Protocol::message &&) {
+        ++received;
+    }
+};
+
+// Pump this thread's loop until @p clients hold `target` replies between them, or the pass cap is hit.
+bool
+pump_until(std::vector<std::unique_ptr<EchoClient>> const &clients, std::size_t const target) {
+    auto &loop = async::listener::current;
+    for (std::size_t pass = 0; pass < 5'000'000u; ++pass) {
+        std::size_t received = 0;
+        for (auto const &client : clients)
+            received += client->received;
+        if (received >= target)
+            return true;
+        loop.run(EVRUN_NOWAIT);
+    }
+    return false;
+}
+
+void
+pin_to_cpu([[maybe_unused]] std::size_t const cpu) {
+#if defined(__linux__)
+    if (cpu >= std::thread::hardware_concurrency())
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+struct Shared {
+    uri                      at;
+    std::atomic<std::size_t> ready{0};
+    std::atomic<std::size_t> done{0};
+    std::atomic<std::size_t> round{0};
+    std::atomic<bool>        stop{false};
+    std::atomic<bool>        failed{false};
+};
+
+// One worker = one loop, one shared-port server, `kClients` clients; see the file comment.
+void
+worker(Shared &shared, tcp::listener listener, std::size_t const index, bool const pin) {
+    if (pin)
+        pin_to_cpu(index);
+    async::init();
+    auto &loop = async::listener::current;
+    {
+        EchoServer server;
+        server.transport() = std::move(listener);
+        server.start();
+
+        std::vector<std::unique_ptr<EchoClient>> clients;
+        for (std::size_t i = 0; i < kClients; ++i) {
+            auto &client = *clients.emplace_back(std::make_unique<EchoClient>());
+            if (client.transport().connect(shared.at) != SocketStatus::Done) {
+                shared.failed = true;
+                break;
+            }
+            client.start();
+            client << kPayload << EchoClient::Protocol::end;
+        }
+        std::size_t expected = clients.size();
+        if (!pump_until(clients, expected))
+            shared.failed = true;
+        shared.ready.fetch_add(1);
+
+        std::size_t seen = 0;
+        while (!shared.stop.load(std::memory_order_acquire)) {
+            if (shared.round.load(std::memory_order_acquire) == seen) {
+                loop.run(EVRUN_NOWAIT);
+                std::this_thread::yield();
+                continue;
+            }
+            ++seen;
+            for (auto &client : clients)
+                for (std::size_t i = 0; i < kBatch; ++i)
+                    *client << kPayload << EchoClient::Protocol::end;
+            expected += clients.size() * kBatch;
+            if (!pump_until(clients, expected))
+                shared.failed = true;
+            shared.done.fetch_add(1, std::memory_order_release);
+        }
+        clients.clear();
+        loop.clear();
+    }
+}
+
+void
+BM_Tcp_ReusePortEcho(benchmark::State &state) {
+    const auto shards = static_cast<std::size_t>(state.range(0));
+    const bool steer  = state.range(1) != 0;
+
+    // Bind every member here, in worker order, so member `i` is worker `i` for the steering program.
+    std::vector<tcp::listener> listeners(shards);
+    if (listeners[0].listen_shared(endpoint().as_in("127.0.0.1", 0)) != 0) {
+        state.SkipWithError("listen_shared on loopback failed");
+        return;
+    }
+    const auto port = listeners[0].local_endpoint().port();
+    for (std::size_t i = 1; i < shards; ++i)
+        if (listeners[i].listen_shared(endpoint().as_in("127.0.0.1", port)) != 0) {
+            state.SkipWithError("a second member could not join the SO_REUSEPORT group");
+            return;
+        }
+    if (steer && listeners[0].steer_by_cpu(static_cast<std::uint32_t>(shards)) != 0) {
+        state.SkipWithError("steer_by_cpu is not supported here");
+        return;
+    }
+
+    Shared shared;
+    shared.at = uri("tcp://127.0.0.1:" + std::to_string(port));
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < shards; ++i)
+        workers.emplace_back(worker, std::ref(shared), std::move(listeners[i]), i, steer);
+    while (shared.ready.load() < shards)
+        std::this_thread::yield();
+
+    std::size_t rounds = 0;
+    for (auto _ : state) {
+        if (shared.failed.load())
+            break;
+        ++rounds;
+        shared.round.store(rounds, std::memory_order_release);
+        while (shared.done.load(std::memory_order_acquire) < rounds * shards && !shared.failed.load())
+            std::this_thread::yield();
+    }
+
+    shared.stop.store(true, std::memory_order_release);
+    for (auto &thread : workers)
+        thread.join();
+
+    if (shared.failed.load()) {
+        state.SkipWithError("a worker stalled (connect failed or a reply never came back)");
+        return;
+    }
+    const auto messages = rounds * shards * kClients * kBatch;
+    state.SetItemsProcessed(static_cast<std::int64_t>(messages));
+    state.SetBytesProcessed(static_cast<std::int64_t>(messages * 2u * kPayload.size())); // send + echo
+}
+
+} // namespace
+
+BENCHMARK(BM_Tcp_ReusePortEcho)
+    ->ArgsProduct({{1, 2, 4}, {0, 1}})
+    ->ArgNames({"shards", "steer"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 
 #include <qb/io/async/io.h>
+#include <qb/io/shared_frame.h>
 #include <qb/io/system/sys__socket.h>
 #include <qb/io/tcp/listener.h>
 #include <qb/io/tcp/socket.h>
@@ -302,6 +303,7 @@ public:
     std::size_t disconnected_events    = 0u;
     std::size_t dispose_events         = 0u;
     int         last_disconnect_reason = 0;
+    bool        refuse_frames          = false;
 
     explicit PipeOutputProbe(qb::io::tcp::socket &sock) noexcept
         : _transport(sock) {}
@@ -351,6 +353,15 @@ public:
         _write_mode = write_mode::hard_error;
     }
 
+    // Frame queue stand-in: copies, or refuses like a stream whose output limit is reached.
+    bool
+    enqueue(qb::io::shared_frame const &frame) noexcept {
+        if (refuse_frames)
+            return false;
+        _out.put(frame.data(), frame.size());
+        return true;
+    }
+
     int
     write() noexcept {
         if (_write_mode == write_mode::would_block) {
@@ -847,6 +858,23 @@ TEST_F(AsyncIoBaseTest, OutputPublishOverflowRollsBackAndDisconnects) {
     EXPECT_EQ(std::string_view(output.out().begin(), output.out().size()), "abcd");
 }
 
+TEST_F(AsyncIoBaseTest, OutputPublishOfARefusedFrameDisconnects) {
+    auto            pair = make_stream_pair();
+    PipeOutputProbe output{pair.probe};
+
+    output.base().start();
+    output.base().publish(qb::io::shared_frame::copy_of(std::string_view{"ab"}));
+    ASSERT_EQ(output.pendingWrite(), 2u);
+    ASSERT_TRUE(output.base().is_connected());
+
+    output.refuse_frames = true;
+    output.base().publish(std::string_view{"cd"}, qb::io::shared_frame::copy_of(std::string_view{"ef"}));
+
+    EXPECT_EQ(std::string_view(output.out().begin(), output.out().size()), "abcd");
+    EXPECT_EQ(output.base().disconnection_reason(), static_cast<int>(qb::io::async::event::disconnect_reason::buffer_overflow));
+    EXPECT_FALSE(output.base().is_connected());
+}
+
 TEST_F(AsyncIoBaseTest, OutputWriteErrorsDistinguishWouldBlockFromHardFailure) {
     {
         auto            pair = make_stream_pair();
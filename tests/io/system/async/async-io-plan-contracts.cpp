@@ -494,7 +494,7 @@ TEST_F(IoPlanContractsTest, SacceptFlushIsIdempotentOnEmptyAcceptor) {
     transport::saccept sa;
 
     EXPECT_NO_THROW(sa.flush(0));
-    EXPECT_NO_THROW(sa.flush(0)); // idempotent — release_handle on an empty FD is fine
+    EXPECT_NO_THROW(sa.flush(0)); // idempotent — clearing an empty batch is fine
     EXPECT_EQ(sa.getAccepted().native_handle(), -1) << "after flush() the accepted socket must report no native handle";
 
     EXPECT_NO_THROW(sa.close());
@@ -0,0 +1,319 @@
+/**
+ * @file system/async/timer-wheel.cpp
+ * @brief `qb::io::async::TimerWheel` and its two opt-ins: `with_timeout::useTimerWheel()` and
+ *        `async::coarse_sleep()`.
+ *
+ * The wheel is driven by one libev timer on the listener's loop, so these are SYSTEM tests: they
+ * pump a real (socket-free) loop. What is proven:
+ *
+ *   - a node never fires before its deadline and fires once, within a tick of it;
+ *   - re-arming moves the deadline, cancelling (or destroying the node) suppresses the fire;
+ *   - deadlines spanning level 0 and level 1 (so crossing a cascade) fire in deadline order, and a
+ *     callback may cancel or arm other nodes while a slot is being expired;
+ *   - a `with_timeout` moved onto the wheel reaches the derived `on(event::timer&)` the same way,
+ *     `updateTimeout()` still defers it, and `listener::clear()` still silences it;
+ *   - `coarse_sleep()` resumes its coroutine, and a dropped frame's deadline never fires.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Tests
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <qb/io/async.h>
+
+#include "../../shared/coroutine_test_support.h"
+
+using namespace qb::io;
+using namespace std::chrono_literals;
+using qb::io::test::pump_until;
+using qb::io::test::reset_async_context;
+
+namespace {
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    void
+    SetUp() override {
+        reset_async_context();
+    }
+    void
+    TearDown() override {
+        async::listener::current.reset_coro_scheduler();
+        async::listener::current.clear();
+        // The wheel outlives the test (it belongs to the thread's listener): leave it empty and at
+        // its default resolution for the next one.
+        auto &wheel = async::listener::current.timer_wheel();
+        wheel.clear();
+        EXPECT_TRUE(wheel.set_resolution(async::TimerWheel::kDefaultResolution));
+    }
+};
+
+/// One wheel deadline that records when (and how often) it fired.
+struct Probe {
+    async::TimerWheel::node               node;
+    std::chrono::steady_clock::time_point fired_at{};
+    int                                   fires = 0;
+    int                                   id    = 0;
+    std::vector<int>                     *order = nullptr;
+
+    Probe() noexcept {
+        node.set<Probe, &Probe::on_expired>(this);
+    }
+
+    void
+    on_expired() noexcept {
+        fired_at = std::chrono::steady_clock::now();
+        ++fires;
+        if (order)
+            order->push_back(id);
+    }
+};
+
+class WheelTimer : public async::with_timeout<WheelTimer> {
+public:
+    std::atomic<int> count{0};
+
+    explicit WheelTimer(qb::duration timeout)
+        : with_timeout(timeout) {
+        useTimerWheel();
+    }
+
+    void
+    on(async::event::timer const &) {
+        count.fetch_add(1);
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// TimerWheel
+// =============================================================================
+
+TEST_F(TimerWheelTest, FiresOnceAndNeverBeforeTheDeadline) {
+    auto &wheel = async::listener::current.timer_wheel();
+    Probe probe;
+
+    ev_now_update(static_cast<struct ev_loop *>(wheel.loop()));
+    const auto armed_at = std::chrono::steady_clock::now();
+    wheel.arm(probe.node, 40ms);
+    EXPECT_TRUE(probe.node.armed());
+    EXPECT_EQ(wheel.size(), 1u);
+
+    EXPECT_TRUE(pump_until([&] { return probe.fires > 0; })) << "wheel deadline never fired";
+    // 1 ms of slack: the loop clock and steady_clock are read at slightly different instants.
+    EXPECT_GE(probe.fired_at - armed_at, 39ms) << "wheel deadline fired early";
+    EXPECT_FALSE(probe.node.armed());
+    EXPECT_EQ(wheel.size(), 0u);
+
+    EXPECT_FALSE(pump_until([&] { return probe.fires > 1; }, 60ms));
+    EXPECT_EQ(probe.fires, 1);
+}
+
+TEST_F(TimerWheelTest, RearmMovesTheDeadline) {
+    auto &wheel = async::listener::current.timer_wheel();
+    Probe probe;
+
+    wheel.arm(probe.node, 30ms);
+    wheel.arm(probe.node, 200ms);
+    EXPECT_EQ(wheel.size(), 1u) << "re-arming must move the node, not add a second deadline";
+
+    EXPECT_FALSE(pump_until([&] { return probe.fires > 0; }, 100ms)) << "the superseded 30ms deadline fired";
+    EXPECT_TRUE(pump_until([&] { return probe.fires > 0; })) << "the moved deadline never fired";
+    EXPECT_EQ(probe.fires, 1);
+}
+
+TEST_F(TimerWheelTest, CancelAndDestructionSuppressTheFire) {
+    auto &wheel = async::listener::current.timer_wheel();
+    Probe kept;
+    Probe cancelled;
+    auto  dropped = std::make_unique<Probe>();
+
+    wheel.arm(kept.node, 40ms);
+    wheel.arm(cancelled.node, 20ms);
+    wheel.arm(dropped->node, 20ms);
+    EXPECT_EQ(wheel.size(), 3u);
+
+    cancelled.node.cancel();
+    cancelled.node.cancel(); // idempotent
+    dropped.reset();
+    EXPECT_EQ(wheel.size(), 1u);
+
+    EXPECT_TRUE(pump_until([&] { return kept.fires > 0; })) << "the surviving deadline never fired";
+    EXPECT_EQ(cancelled.fires, 0);
+}
+
+TEST_F(TimerWheelTest, DeadlinesAcrossACascadeFireInOrder) {
+    auto &wheel = async::listener::current.timer_wheel();
+    ASSERT_TRUE(wheel.set_resolution(1ms));
+
+    // 2..240 ms at 1 ms ticks: the later half sits in level 1 and only reaches level 0 through a
+    // cascade. Deadlines are 2 ticks apart so rounding cannot merge two into one slot.
+    constexpr int                       count = 120;
+    std::vector<std::unique_ptr<Probe>> probes;
+    std::vector<int>                    order;
+    std::vector<int>                    ids(count);
+    for (int i = 0; i < count; ++i) {
+        ids[i] = i;
+        probes.push_back(std::make_unique<Probe>());
+        probes.back()->id    = i;
+        probes.back()->order = &order;
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937{7});
+
+    ev_now_update(static_cast<struct ev_loop *>(wheel.loop()));
+    for (int id : ids)
+        wheel.arm(probes[id]->node, std::chrono::milliseconds(2 * (id + 1)));
+    EXPECT_EQ(wheel.size(), static_cast<std::size_t>(count));
+
+    EXPECT_TRUE(pump_until([&] { return order.size() == static_cast<std::size_t>(count); })) << "not every deadline fired";
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end())) << "deadlines fired out of order";
+    for (auto const &p : probes)
+        EXPECT_EQ(p->fires, 1);
+}
+
+TEST_F(TimerWheelTest, CallbackMayCancelAndArmOtherNodes) {
+    auto &wheel = async::listener::current.timer_wheel();
+
+    // Two nodes due in the same tick: whichever fires first cancels the other and arms a third.
+    struct Juggler {
+        async::TimerWheel::node node;
+        Juggler                *peer = nullptr;
+        Probe                  *next = nullptr;
+        int                     fires = 0;
+
+        Juggler() noexcept {
+            node.set<Juggler, &Juggler::on_expired>(this);
+        }
+
+        void
+        on_expired() noexcept {
+            ++fires;
+            peer->node.cancel();
+            async::listener::current.timer_wheel().arm(next->node, 20ms);
+        }
+    };
+
+    Juggler a;
+    Juggler b;
+    Probe   next;
+    a.peer = &b;
+    b.peer = &a;
+    a.next = b.next = &next;
+
+    wheel.arm(a.node, 20ms);
+    wheel.arm(b.node, 20ms);
+
+    EXPECT_TRUE(pump_until([&] { return next.fires > 0; })) << "the node armed from a callback never fired";
+    EXPECT_EQ(a.fires + b.fires, 1) << "a node cancelled from a sibling's callback still fired";
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+// =============================================================================
+// with_timeout on the wheel
+// =============================================================================
+
+TEST_F(TimerWheelTest, WithTimeoutOnTheWheelFires) {
+    WheelTimer timer(40ms);
+    EXPECT_TRUE(timer.usesTimerWheel());
+    EXPECT_EQ(async::listener::current.timer_wheel().size(), 1u);
+
+    EXPECT_TRUE(pump_until([&] { return timer.count.load() > 0; })) << "wheel-backed with_timeout never fired";
+    EXPECT_EQ(timer.count.load(), 1);
+}
+
+TEST_F(TimerWheelTest, WithTimeoutUpdateTimeoutDefersTheDeadline) {
+    WheelTimer timer(120ms);
+
+    const auto keep_alive_until = std::chrono::steady_clock::now() + 250ms;
+    while (std::chrono::steady_clock::now() < keep_alive_until) {
+        timer.updateTimeout();
+        async::run(EVRUN_NOWAIT);
+        std::this_thread::sleep_for(20ms);
+    }
+    EXPECT_EQ(timer.count.load(), 0) << "updateTimeout() failed to defer a wheel-backed deadline";
+
+    EXPECT_TRUE(pump_until([&] { return timer.count.load() > 0; })) << "timer never fired after refresh stopped";
+}
+
+TEST_F(TimerWheelTest, WithTimeoutSetTimeoutZeroAndSwitchBack) {
+    WheelTimer timer(40ms);
+    timer.setTimeout(qb::duration::zero());
+    EXPECT_EQ(async::listener::current.timer_wheel().size(), 0u);
+    EXPECT_FALSE(pump_until([&] { return timer.count.load() > 0; }, 100ms)) << "a disabled wheel deadline fired";
+
+    // Re-enable on the wheel, then move it back to its own ev_timer: it still fires exactly once.
+    timer.setTimeout(40ms);
+    timer.useTimerWheel(false);
+    EXPECT_FALSE(timer.usesTimerWheel());
+    EXPECT_EQ(async::listener::current.timer_wheel().size(), 0u);
+    EXPECT_TRUE(pump_until([&] { return timer.count.load() > 0; })) << "deadline lost switching off the wheel";
+    EXPECT_FALSE(pump_until([&] { return timer.count.load() > 1; }, 60ms));
+}
+
+TEST_F(TimerWheelTest, ListenerClearSilencesAWheelBackedTimeout) {
+    WheelTimer timer(30ms);
+    async::listener::current.clear();
+
+    EXPECT_FALSE(pump_until([&] { return timer.count.load() > 0; }, 100ms)) << "a detached watcher received a wheel deadline";
+}
+
+// =============================================================================
+// coarse_sleep
+// =============================================================================
+
+TEST_F(TimerWheelTest, CoarseSleepResumesTheCoroutine) {
+    std::atomic<int> step{0};
+
+    async::coro_scheduler().spawn([&]() -> async::task<void> {
+        co_await async::coarse_sleep(20ms);
+        step = 1;
+        co_await async::coarse_sleep(20ms);
+        step = 2;
+    });
+
+    EXPECT_TRUE(pump_until([&] { return step.load() == 2; })) << "coarse_sleep never resumed the coroutine";
+    EXPECT_EQ(async::listener::current.timer_wheel().size(), 0u);
+}
+
+TEST_F(TimerWheelTest, DroppedCoarseSleepNeverFires) {
+    std::atomic<bool> long_completed{false};
+    std::atomic<bool> short_completed{false};
+
+    {
+        auto long_task = [&]() -> async::task<void> {
+            co_await async::coarse_sleep(150ms);
+            long_completed = true;
+        };
+        auto dropped = long_task();
+        (void) dropped;
+
+        async::coro_scheduler().spawn([&]() -> async::task<void> {
+            co_await async::coarse_sleep(20ms);
+            short_completed = true;
+        });
+    }
+
+    EXPECT_TRUE(pump_until([&] { return short_completed.load(); })) << "short coarse_sleep never fired";
+    EXPECT_FALSE(pump_until([] { return false; }, 200ms));
+    EXPECT_FALSE(long_completed.load()) << "a destroyed task's wheel deadline fired";
+}
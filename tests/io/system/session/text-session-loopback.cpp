@@ -62,6 +62,7 @@
 #include <gtest/gtest.h>
 #include <qb/io/async.h>
 #include <qb/io/async/quic.h>
+#include <qb/io/input_pool.h>
 #include <qb/io/protocol/text.h>
 
 #include "../../shared/coroutine_test_support.h"
@@ -523,6 +524,67 @@ TEST(TextSessionBinary16, Binary16EchoOverTcp) {
     async::listener::current.clear();
 }
 
+// =============================================================================
+// POOLED-INPUT CLIENT DISPOSED ON A PROTOCOL ERROR
+// =============================================================================
+
+namespace {
+
+/// Standalone pooled client: `dispose()` stops it without closing its stream.
+class PooledLineClient : public use<PooledLineClient>::tcp::client<> {
+public:
+    using Protocol = qb::protocol::text::command<PooledLineClient>;
+
+    bool disconnected = false;
+    int  reason       = 0;
+
+    PooledLineClient() {
+        set_pooled_input(true);
+        set_max_message_size(4);
+    }
+    void
+    on(Protocol::message &&) {
+        ADD_FAILURE() << "a line over the message limit must not be dispatched";
+    }
+    void
+    on(async::event::disconnected &&event) {
+        disconnected = true;
+        reason       = event.reason;
+    }
+};
+
+} // namespace
+
+/**
+ * @test A pooled standalone client that stops on an oversized line gives the read buffer back
+ * @brief The line overflows `set_max_message_size()`, so the read handler disposes the client. A
+ *        standalone client is only stopped there, not closed, so unless the handler hands the thread's
+ *        scratch buffer back itself, every other pooled stream on the thread reads into its own buffer
+ *        until this one is destroyed.
+ */
+TEST(TextSessionPooledInput, ProtocolErrorGivesTheScratchBack) {
+    async::init();
+    auto &pool = input_pool::local();
+    pool.trim();
+
+    tcp::listener listener;
+    ASSERT_EQ(listener.listen_v4(0, "127.0.0.1"), SocketStatus::Done);
+    const auto port = listener.local_endpoint().port();
+
+    PooledLineClient client;
+    ASSERT_EQ(client.transport().connect_v4("127.0.0.1", port), SocketStatus::Done);
+    client.start();
+    auto peer = listener.accept();
+    ASSERT_TRUE(peer.is_open());
+    constexpr std::string_view line = "much too long\n";
+    ASSERT_EQ(peer.write(line.data(), line.size()), static_cast<int>(line.size()));
+
+    EXPECT_TRUE(pump_until([&] { return client.disconnected; })) << "the oversized line never disposed the client";
+    EXPECT_EQ(client.reason, -2) << "disposed by the message-size guard";
+    EXPECT_FALSE(pool.lent()) << "the disposed client still holds the thread's scratch buffer";
+    async::listener::current.clear();
+}
+
 // =============================================================================
 // PROTOCOL SWITCH text -> binary16 mid-session (exact counts, no sleep race)
 // =============================================================================
@@ -0,0 +1,229 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the specific terms.
+ */
+
+/**
+ * @file system/tcp/listener-reuseport.cpp
+ * @brief `tcp::listener::listen_shared()` / `steer_by_cpu()` and `acceptor::listen_shared()`.
+ *
+ *   - Two shared listeners bind one port; a plain listener on it is refused.
+ *   - Loopback connections land on both members' accept queues, and every one is accepted once.
+ *   - With the CPU steering program attached, a client pinned to one CPU always lands on member
+ *     `cpu % 2` (Linux only).
+ *   - Two `use<>::tcp::server`s sharing a port on one loop both serve echo sessions.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * @ingroup Tests
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qb/io/async.h>
+#include <qb/io/protocol/text.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "../../shared/coroutine_test_support.h"
+
+using namespace std::chrono_literals;
+using qb::io::test::pump_until;
+
+namespace {
+
+constexpr std::size_t kClients = 64;
+
+/// Accept whatever is queued on @p listener without blocking.
+std::size_t
+drain(qb::io::tcp::listener &listener, std::vector<qb::io::tcp::socket> &keep) {
+    std::size_t n = 0;
+    for (;;) {
+        qb::io::tcp::socket accepted;
+        if (listener.accept(accepted) != 0)
+            return n;
+        keep.push_back(std::move(accepted));
+        ++n;
+    }
+}
+
+/// Connect @p count blocking clients to 127.0.0.1:@p port, then accept them all from @p a and @p b.
+void
+connect_and_accept(std::uint16_t port, std::size_t count, qb::io::tcp::listener &a, qb::io::tcp::listener &b, std::size_t &on_a,
+                   std::size_t &on_b) {
+    std::vector<qb::io::tcp::socket> clients(count), accepted;
+    for (auto &client : clients)
+        ASSERT_EQ(client.connect_v4("127.0.0.1", port), qb::io::SocketStatus::Done);
+    on_a = on_b         = 0;
+    const auto deadline = std::chrono::steady_clock::now() + 3s;
+    while (on_a + on_b < count && std::chrono::steady_clock::now() < deadline) {
+        on_a += drain(a, accepted);
+        on_b += drain(b, accepted);
+        std::this_thread::sleep_for(1ms);
+    }
+    for (auto &client : clients)
+        client.disconnect();
+}
+
+} // namespace
+
+#if defined(_WIN32)
+
+TEST(ListenerReusePort, IsRefusedWithoutSoReusePort) {
+    qb::io::tcp::listener listener;
+    EXPECT_NE(listener.listen_shared(qb::io::endpoint().as_in("127.0.0.1", 0)), 0);
+    EXPECT_NE(listener.steer_by_cpu(2), 0);
+}
+
+#else
+
+TEST(ListenerReusePort, SharedListenersBindOnePortAndPlainOnesAreRefused) {
+    qb::io::tcp::listener a, b, plain;
+    ASSERT_EQ(a.listen_shared(qb::io::endpoint().as_in("127.0.0.1", 0)), 0);
+    const auto port = a.local_endpoint().port();
+    ASSERT_NE(port, 0);
+    EXPECT_EQ(b.listen_shared(qb::io::uri("tcp://127.0.0.1:" + std::to_string(port))), 0);
+    EXPECT_EQ(b.local_endpoint().port(), port);
+    EXPECT_NE(plain.listen_v4(port, "127.0.0.1"), 0) << "a listener that did not ask to share must not join the group";
+    EXPECT_NE(plain.listen_shared(qb::io::uri("unix:///tmp/qb-reuseport.sock")), 0) << "a Unix socket cannot be shared";
+}
+
+TEST(ListenerReusePort, ConnectionsSpreadOverEveryMember) {
+    qb::io::tcp::listener a, b;
+    ASSERT_EQ(a.listen_shared(qb::io::endpoint().as_in("127.0.0.1", 0)), 0);
+    const auto port = a.local_endpoint().port();
+    ASSERT_EQ(b.listen_shared(qb::io::endpoint().as_in("127.0.0.1", port)), 0);
+    a.set_nonblocking(true);
+    b.set_nonblocking(true);
+
+    std::size_t on_a = 0, on_b = 0;
+    connect_and_accept(port, kClients, a, b, on_a, on_b);
+    EXPECT_EQ(on_a + on_b, kClients);
+    // The default spread hashes the 4-tuple: 64 distinct source ports all on one member is 2^-63.
+    EXPECT_GT(on_a, 0u);
+    EXPECT_GT(on_b, 0u);
+}
+
+#if defined(__linux__)
+TEST(ListenerReusePort, SteerByCpuKeepsAConnectionOnItsReceivingCpu) {
+    qb::io::tcp::listener a, b;
+    ASSERT_EQ(a.listen_shared(qb::io::endpoint().as_in("127.0.0.1", 0)), 0);
+    const auto port = a.local_endpoint().port();
+    ASSERT_EQ(b.listen_shared(qb::io::endpoint().as_in("127.0.0.1", port)), 0);
+    EXPECT_NE(a.steer_by_cpu(0), 0);
+    ASSERT_EQ(a.steer_by_cpu(2), 0);
+    a.set_nonblocking(true);
+    b.set_nonblocking(true);
+
+    // Loopback delivers the SYN on the sending CPU: pin the client there.
+    cpu_set_t saved;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(saved), &saved), 0);
+    const int cpu = sched_getcpu();
+    ASSERT_GE(cpu, 0);
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+    CPU_SET(cpu, &pinned);
+    ASSERT_EQ(sched_setaffinity(0, sizeof(pinned), &pinned), 0);
+
+    std::size_t on_a = 0, on_b = 0;
+    connect_and_accept(port, kClients, a, b, on_a, on_b);
+    sched_setaffinity(0, sizeof(saved), &saved);
+
+    EXPECT_EQ(on_a + on_b, kClients);
+    EXPECT_EQ(cpu % 2 == 0 ? on_a : on_b, kClients) << "cpu " << cpu;
+}
+#endif
+
+// --- acceptor::listen_shared -------------------------------------------------------------------
+
+class EchoServer;
+
+class EchoSession : public qb::io::use<EchoSession>::tcp::client<EchoServer> {
+public:
+    using Protocol = qb::protocol::text::command<EchoSession>;
+
+    explicit EchoSession(IOServer &server)
+        : client(server) {}
+
+    void
+    on(Protocol::message &&msg) {
+        *this << msg.text << Protocol::end;
+    }
+};
+
+class EchoServer : public qb::io::use<EchoServer>::tcp::server<EchoSession> {
+public:
+    std::size_t accepted = 0;
+
+    void
+    on(IOSession &) {
+        ++accepted;
+    }
+};
+
+class EchoClient : public qb::io::use<EchoClient>::tcp::client<> {
+public:
+    using Protocol = qb::protocol::text::command<EchoClient>;
+
+    std::size_t received = 0;
+
+    void
+    on(Protocol::message &&) {
+        ++received;
+    }
+};
+
+TEST(ListenerReusePort, ServersSharingAPortBothServeSessions) {
+    qb::io::async::init();
+    {
+        EchoServer first, second;
+        ASSERT_TRUE(first.listen_shared(qb::io::uri("tcp://127.0.0.1:0")));
+        const auto port = first.transport().local_endpoint().port();
+        const auto uri  = qb::io::uri("tcp://127.0.0.1:" + std::to_string(port));
+        ASSERT_TRUE(second.listen_shared(uri));
+
+        std::vector<std::unique_ptr<EchoClient>> clients;
+        for (std::size_t i = 0; i < kClients; ++i) {
+            auto &client = *clients.emplace_back(std::make_unique<EchoClient>());
+            ASSERT_EQ(client.transport().connect(uri), qb::io::SocketStatus::Done);
+            client.start();
+            client << "ping" << EchoClient::Protocol::end;
+        }
+        EXPECT_TRUE(pump_until([&] {
+            std::size_t received = 0;
+            for (auto const &client : clients)
+                received += client->received;
+            return received == kClients;
+        })) << "an echo never came back";
+        EXPECT_EQ(first.accepted + second.accepted, kClients);
+        EXPECT_GT(first.accepted, 0u);
+        EXPECT_GT(second.accepted, 0u);
+        clients.clear();
+        qb::io::async::listener::current.clear();
+    }
+}
+
+#endif
@@ -20,7 +20,7 @@
  *     SSL_CTX is wired with `init(create_server_context(...))` + `set_supported_alpn_protocols` +
  *     `listen_v4`. `read()` accepts a pending secure connection and returns the accepted native handle;
  *     `getAccepted()` is the `ssl::socket` on which the server-side handshake is driven to completion;
- *     `flush()` releases the moved-out accepted handle; `close()` shuts the listener; `is_secure()` is
+ *     `flush()` clears the moved-out accepted slot; `close()` shuts the listener; `is_secure()` is
  *     a compile-time `true`. A no-pending-connection `read()` returns `(size_t)-1`.
  *
  *   - `transport::stcp` (transport/stcp.h, `: stream<ssl::socket>`): the client uses `transport()` to
@@ -39,6 +39,7 @@
  *   transport::saccept: ssl::listener& transport(); std::size_t read(); void flush(std::size_t);
  *                       void close(); ssl::socket& getAccepted(); static constexpr bool is_secure();
  *   transport::stcp:    ssl::socket& transport(); int read(); int write(); char* publish(const char*, size_t);
+ *                       bool enqueue(shared_frame); std::size_t pendingFrames(); std::size_t pendingWrite();
  *                       input_buffer& in(); std::size_t pendingRead();
  *   qb::io::ssl::create_server_context(const SSL_METHOD*, std::filesystem::path cert, std::filesystem::path key);
  *   ssl::socket: void set_insecure(); int connect_v4(std::string const&, uint16_t); bool handshake_complete() const;
@@ -77,6 +78,7 @@
 
 #include <qb/io/transport/saccept.h>
 #include <qb/io/transport/stcp.h>
+#include <qb/io/shared_frame.h>
 
 #include "../../shared/loopback_fixture.h"
 #include "../../shared/ssl_fixtures.h"
@@ -308,7 +310,7 @@ TEST(SecureTransport, SacceptAndStcpRoundTripEncryptedPayload) {
 
 // saccept::flush mirrors production: protocol::accept::onMessage() has already
 // std::move()d the accepted ssl::socket into a session, leaving getAccepted() in a
-// moved-from (empty) state; flush() then just release_handle()s that empty slot.
+// moved-from (empty) state; flush() then just clears that empty slot.
 // Here we accept a real secure connection, std::move() the socket out (taking the
 // fd + SSL with it), and assert getAccepted() is already empty and flush() is a
 // harmless no-op leaving it empty.
@@ -368,3 +370,74 @@ TEST(SecureTransport, SacceptFlushReleasesAlreadyMovedOutSlot) {
     owner.disconnect();
     client.disconnect();
 }
+
+// ===========================================================================
+// stcp gather write: enqueued frames interleaved with published bytes
+// ===========================================================================
+
+// `stream<ssl::socket>` takes the gather path too: `ssl::socket::writev()` stages small slices
+// into full records and encrypts large ones in place, resuming after partial writes. The frames
+// here span several 16 KiB records and the client socket is non-blocking, so the kernel buffer
+// fills and the loop below resumes mid-slice; the server must still read back the exact bytes in
+// publish order, and the borrowed frame must be released only once the stream is done with it.
+TEST(SecureTransport, StcpWritesEnqueuedFramesInPublishOrder) {
+    ASSERT_TRUE(require_ssl_files()) << "shipped SSL cert/key not found at " << ssl_resource_path("cert.pem");
+
+    std::string large(40'000, '\0'), borrowed(20'000, '\0');
+    for (std::size_t i = 0; i < large.size(); ++i)
+        large[i] = static_cast<char>('a' + i % 26);
+    for (std::size_t i = 0; i < borrowed.size(); ++i)
+        borrowed[i] = static_cast<char>('0' + i % 10);
+    const std::string expected = "head|" + large + "|mid|" + borrowed + "|tail";
+
+    qb::io::transport::saccept acceptor;
+    acceptor.transport().init(make_server_context());
+    ASSERT_EQ(acceptor.transport().listen_v4(0, "127.0.0.1"), 0);
+    const auto port = acceptor.transport().local_endpoint().port();
+
+    std::string received(expected.size(), '\0');
+    bool        server_ok = false;
+    std::thread server_thread([&] {
+        acceptor.transport().set_nonblocking(true);
+        const auto accept_until = std::chrono::steady_clock::now() + 5s;
+        while (acceptor.read() == static_cast<std::size_t>(-1) && std::chrono::steady_clock::now() < accept_until)
+            std::this_thread::sleep_for(1ms);
+        auto &server_socket = acceptor.getAccepted();
+        if (!server_socket.is_open())
+            return;
+        drive_server_handshake(server_socket);
+        if (server_socket.handshake_complete())
+            server_ok = ssl_read_exactly(server_socket, received.data(), received.size(), 5s);
+    });
+    const qb::io::test::thread_joiner server_joiner{server_thread};
+
+    qb::io::transport::stcp client;
+    client.transport().set_insecure();
+    ASSERT_EQ(client.transport().connect_v4("127.0.0.1", port), 0);
+    ASSERT_EQ(client.transport().set_nonblocking(true), 0);
+
+    bool released = false;
+    ASSERT_NE(client.publish("head|", 5), nullptr);
+    ASSERT_TRUE(client.enqueue(qb::io::shared_frame::adopt(std::string(large))));
+    ASSERT_NE(client.publish("|mid|", 5), nullptr);
+    ASSERT_TRUE(client.enqueue(qb::io::shared_frame::borrow(borrowed.data(), borrowed.size(), [&] { released = true; })));
+    ASSERT_NE(client.publish("|tail", 5), nullptr);
+    EXPECT_EQ(client.pendingFrames(), 2u);
+    EXPECT_EQ(client.pendingWrite(), expected.size());
+
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (client.pendingWrite() > 0 && std::chrono::steady_clock::now() < deadline) {
+        const int ret = client.write();
+        ASSERT_GE(ret, 0) << "stcp.write() reported a fatal error";
+        EXPECT_EQ(released, client.pendingWrite() < 5) << "released with its last byte, not before";
+        if (ret == 0)
+            std::this_thread::sleep_for(1ms);
+    }
+    ASSERT_EQ(client.pendingWrite(), 0u) << "stcp.write() never flushed the queue";
+    EXPECT_TRUE(released);
+
+    server_thread.join();
+    ASSERT_TRUE(server_ok) << "the server never read the whole payload";
+    EXPECT_TRUE(received == expected) << "bytes arrived out of publish order";
+    client.transport().disconnect();
+}
@@ -20,9 +20,11 @@
  *    - `read()` returns the *native handle* of a freshly accepted socket when a client is waiting,
  *      and `getAccepted()` then wraps that connected socket (a real read/write round-trip proves it).
  *    - `read()` with no pending connection (non-blocking listener) returns `(size_t)-1`.
- *    - `flush()` releases the accepted handle so the transport's destructor does not close the
- *      descriptor that was handed off to a session (the moved-out semantics).
+ *    - `flush()` empties the batch, and closes a connection no handler moved out instead of
+ *      leaking its descriptor.
  *    - `close()` shuts the listener so a subsequent `read()` no longer accepts.
+ *    - one `read()` drains a burst of pending connections, never more than `accept_budget()`, and
+ *      (where `accept4()` exists) hands each one out close-on-exec.
  *    - `is_secure()` is a compile-time `false`.
  *
  *  PART B — `qb::io::async::io_handler` (async/io_handler.h), driven through a real async TCP server:
@@ -31,7 +33,9 @@
  *      closes the incoming socket and never grows the registry past N.
  *    - `session(id)` lookup, `sessions()` map access, `extractSession()` removing a session and
  *      returning its live transport, and `unregisterSession()` disconnecting one.
- *    - `stream()` / `stream_if()` broadcast fan-out reaching every (or a filtered subset of) client.
+ *    - an acceptor that declares `on(accepted_batch_type)` gets a queued burst in a single call.
+ *    - `stream()` / `stream_if()` broadcast fan-out reaching every (or a filtered subset of) client, a
+ *      large payload serialized once and queued by reference in every session.
  *
  * The accept half needs no daemon (single accept syscall over a loopback pair); the handler half runs
  * the in-process event loop bound to a loopback listener — no external server. Ephemeral `:0` ports
@@ -75,6 +79,10 @@
 #include <qb/io/protocol/text.h>
 #include <qb/io/transport/accept.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#endif
+
 #include "../../shared/coroutine_test_support.h"
 #include "../../shared/loopback_fixture.h"
 
@@ -148,16 +156,13 @@ TEST(TransportAccept, ReadAcceptsAPendingConnectionAndGetAcceptedRoundTrips) {
 
     client_thread.join();
 
-    // flush() releases the accepted handle: after a handoff to a session the
-    // transport must NOT close the descriptor it gave away. Prove the handle is
-    // detached (native_handle reverts to the invalid sentinel).
+    // Nothing moved the connection out, so flush() owns it: the batch empties
+    // and the descriptor is closed rather than leaked.
     acceptor.flush(0);
-    EXPECT_EQ(acceptor.getAccepted().native_handle(), qb::io::inet::invalid_socket)
-        << "flush() must release the accepted handle (moved-out semantics)";
-
-    // We still own the connection here; close it ourselves.
-    qb::io::socket reclaimed(static_cast<::socket_type>(handle));
-    reclaimed.close();
+    EXPECT_EQ(acceptor.getAccepted().native_handle(), qb::io::inet::invalid_socket) << "flush() must empty the batch";
+#if !defined(_WIN32)
+    EXPECT_EQ(::fcntl(static_cast<int>(handle), F_GETFD), -1) << "flush() must close a connection no handler took";
+#endif
 }
 
 TEST(TransportAccept, ReadWithNoPendingConnectionReportsFailure) {
@@ -185,6 +190,49 @@ TEST(TransportAccept, CloseStopsTheListenerFromAccepting) {
     acceptor.eof();
 }
 
+TEST(TransportAccept, ReadDrainsABurstUpToTheBudget) {
+    qb::io::transport::accept acceptor;
+    ASSERT_EQ(acceptor.transport().listen_v4(0, "127.0.0.1"), qb::io::SocketStatus::Done);
+    const auto port = acceptor.transport().local_endpoint().port();
+    acceptor.transport().set_nonblocking(true);
+    EXPECT_EQ(acceptor.accept_budget(), static_cast<std::size_t>(QB_ACCEPT_BUDGET));
+    acceptor.set_accept_budget(0);
+    EXPECT_EQ(acceptor.accept_budget(), 1u) << "a zero budget would never accept";
+    acceptor.set_accept_budget(2);
+
+    // Loopback connects complete in the kernel: all five are queued before the first read().
+    std::vector<qb::io::tcp::socket> clients(5);
+    for (auto &client : clients)
+        ASSERT_EQ(client.connect_v4("127.0.0.1", port), qb::io::SocketStatus::Done);
+
+    std::vector<std::size_t>         batches;
+    std::vector<qb::io::tcp::socket> owned;
+    const auto                       deadline = std::chrono::steady_clock::now() + 3s;
+    while (owned.size() < clients.size() && std::chrono::steady_clock::now() < deadline) {
+        const auto handle = acceptor.read();
+        if (handle == static_cast<std::size_t>(-1)) {
+            std::this_thread::sleep_for(1ms);
+            continue;
+        }
+        auto batch = acceptor.getAcceptedBatch();
+        EXPECT_EQ(static_cast<std::size_t>(batch.front().native_handle()), handle);
+        EXPECT_EQ(&acceptor.getAccepted(), &batch.front());
+        batches.push_back(batch.size());
+        for (auto &socket : batch) {
+            EXPECT_TRUE(socket.is_open());
+#if defined(SOCK_CLOEXEC)
+            EXPECT_NE(::fcntl(socket.native_handle(), F_GETFD) & FD_CLOEXEC, 0) << "accept4() must create the fd close-on-exec";
+#endif
+            owned.push_back(std::move(socket));
+        }
+        acceptor.flush(0);
+        EXPECT_TRUE(acceptor.getAcceptedBatch().empty());
+        EXPECT_FALSE(acceptor.getAccepted().is_open());
+    }
+    ASSERT_EQ(owned.size(), clients.size());
+    EXPECT_EQ(batches, (std::vector<std::size_t>{2, 2, 1}));
+}
+
 // ===========================================================================
 // PART B — io_handler via a real async TCP server
 // ===========================================================================
@@ -236,8 +284,41 @@ public:
     }
 };
 
+// Declares its own batch handler: takes every connection of a wakeup in one call.
+class BatchAcceptor : public qb::io::use<BatchAcceptor>::tcp::acceptor {
+public:
+    std::vector<std::size_t>          calls;
+    std::vector<accepted_socket_type> kept;
+
+    void
+    on(accepted_batch_type batch) {
+        calls.push_back(batch.size());
+        for (auto &socket : batch)
+            kept.push_back(std::move(socket));
+    }
+};
+
 } // namespace
 
+TEST(Acceptor, DeclaredBatchHandlerGetsAQueuedBurstInOneCall) {
+    qb::io::async::init();
+    {
+        BatchAcceptor acceptor;
+        ASSERT_TRUE(acceptor.listen(qb::io::uri("tcp://127.0.0.1:0")));
+        const auto port = acceptor.transport().local_endpoint().port();
+
+        std::vector<qb::io::tcp::socket> clients(6);
+        for (auto &client : clients)
+            ASSERT_EQ(client.connect_v4("127.0.0.1", port), qb::io::SocketStatus::Done);
+
+        EXPECT_TRUE(pump_until([&] { return acceptor.kept.size() == clients.size(); }, 3s));
+        EXPECT_EQ(acceptor.calls, (std::vector<std::size_t>{clients.size()})) << "one wakeup, one batch";
+        for (auto const &socket : acceptor.kept)
+            EXPECT_TRUE(socket.is_open());
+    }
+    qb::io::async::listener::current.clear();
+}
+
 TEST(IoHandler, MaxSessionsAccountingAndDosCap) {
     qb::io::async::init();
 
@@ -374,3 +455,57 @@ TEST(IoHandler, BroadcastReachesAllSessionsAndExtractRemovesOne) {
 
     qb::io::async::listener::current.clear();
 }
+
+// A broadcast is serialized once: every session queues a reference to the same frame
+// instead of its own copy, and every client still reads the exact line.
+TEST(IoHandler, LargeBroadcastIsSerializedOnceAndShared) {
+    qb::io::async::init();
+
+    HandlerServer server;
+    ASSERT_EQ(server.transport().listen_v4(0, "127.0.0.1"), qb::io::SocketStatus::Done);
+    const auto port = server.transport().local_endpoint().port();
+    server.start();
+
+    constexpr int     kClients = 3;
+    const std::string line(QB_IO_GATHER_MIN_SIZE * 8, 'b');
+    std::atomic<bool> stop{false};
+    std::atomic<int>  matched{0};
+
+    std::thread worker([&] {
+        qb::io::async::init();
+        std::vector<std::unique_ptr<ProbeClient>> clients;
+        for (int i = 0; i < kClients; ++i) {
+            auto c = std::make_unique<ProbeClient>();
+            if (c->transport().connect_v4("127.0.0.1", port) == qb::io::SocketStatus::Done) {
+                c->start();
+                clients.push_back(std::move(c));
+            }
+        }
+        while (!stop.load()) {
+            qb::io::async::run_for(10ms);
+            int sum = 0;
+            for (auto &c : clients)
+                sum += c->received.load() == 1 && c->last == line;
+            matched.store(sum);
+        }
+    });
+
+    EXPECT_TRUE(pump_until([&] { return server.session_count() == static_cast<std::size_t>(kClients); }, 3s));
+
+    server.stream(line, '\n');
+    for (auto &[id, session] : server.sessions()) {
+        EXPECT_EQ(session->pendingFrames(), 1u) << "the line is queued by reference, not copied";
+        EXPECT_EQ(session->out().size(), 0u) << "nothing is copied into the session's own buffer";
+    }
+    EXPECT_TRUE(pump_until([&] { return matched.load() == kClients; }, 3s))
+        << "every client must read the whole line exactly once; matched=" << matched.load();
+    for (auto &[id, session] : server.sessions())
+        EXPECT_EQ(session->pendingFrames(), 0u);
+
+    stop.store(true);
+    worker.join();
+    for (int i = 0; i < 20; ++i)
+        qb::io::async::run_for(10ms);
+
+    qb::io::async::listener::current.clear();
+}
@@ -0,0 +1,208 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/stream/stream-output-queue.cpp
+ * @brief `stream::enqueue()` and the gather-write path of `stream::write()`.
+ *
+ *   - Frames and bytes published around them reach the transport in publish order, in one
+ *     `writev()` of interleaved slices.
+ *   - Partial writes that stop anywhere — inside a buffer run, inside a frame, on a boundary —
+ *     resume exactly there; a frame's reference (and a borrowed frame's release callback) is
+ *     dropped only once its last byte is written.
+ *   - One write gathers at most `QB_IO_MAX_SLICES` slices.
+ *   - Frames under `QB_IO_GATHER_MIN_SIZE` are copied and released at once; the output limit
+ *     counts queued frames; `close()` releases whatever is still queued.
+ *
+ * The transport is `ScriptedStreamTransport` plus a `writev()` honouring the same per-call write
+ * limits, so every branch is deterministic.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * @ingroup Tests
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <qb/io/stream.h>
+
+#include "../../shared/scripted_stream_transport.h"
+
+using qb::io::shared_frame;
+using qb::io::test::ScriptedStreamTransport;
+
+namespace {
+
+/// `ScriptedStreamTransport` that can also gather-write; records the slice count of every call.
+class ScriptedGatherTransport : public ScriptedStreamTransport {
+    std::vector<std::size_t> _limits;
+    std::size_t              _index = 0;
+
+public:
+    std::vector<std::size_t> slices_per_call;
+
+    ScriptedGatherTransport() = default;
+    explicit ScriptedGatherTransport(std::vector<std::size_t> limits)
+        : _limits(std::move(limits)) {}
+
+    int
+    writev(const qb::io::io_slice *slices, std::size_t count) noexcept {
+        slices_per_call.push_back(count);
+        std::size_t budget = _index < _limits.size() ? _limits[_index++] : static_cast<std::size_t>(-1);
+        std::size_t total  = 0;
+        for (std::size_t i = 0; i < count && budget; ++i) {
+            const auto take = std::min(budget, slices[i].size);
+            written.append(static_cast<const char *>(slices[i].data), take);
+            budget -= take;
+            total += take;
+        }
+        return static_cast<int>(total);
+    }
+};
+
+class GatherStream : public qb::io::stream<ScriptedGatherTransport> {};
+
+static_assert(GatherStream::has_gather_write);
+static_assert(!qb::io::stream<ScriptedStreamTransport>::has_gather_write);
+
+std::string
+pattern(std::size_t size, char seed) {
+    std::string bytes(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+        bytes[i] = static_cast<char>(seed + i % 23);
+    return bytes;
+}
+
+void
+drain(GatherStream &stream) {
+    for (int turns = 0; stream.pendingWrite() && turns < 10'000; ++turns)
+        ASSERT_GE(stream.write(), 0);
+    ASSERT_EQ(stream.pendingWrite(), 0u);
+}
+
+} // namespace
+
+TEST(StreamOutputQueue, FramesAndBufferedBytesGoOutInPublishOrderInOneCall) {
+    const auto first  = shared_frame::copy_of(pattern(QB_IO_GATHER_MIN_SIZE + 100, 'A'));
+    const auto second = shared_frame::adopt(pattern(QB_IO_GATHER_MIN_SIZE * 3, 'a'));
+
+    GatherStream stream;
+    ASSERT_NE(stream.publish("head|", 5), nullptr);
+    ASSERT_TRUE(stream.enqueue(first));
+    stream.out() << "|mid|";
+    ASSERT_TRUE(stream.enqueue(second));
+    ASSERT_NE(stream.publish("|tail", 5), nullptr);
+
+    EXPECT_EQ(stream.pendingFrames(), 2u);
+    EXPECT_EQ(stream.pendingWrite(), 15u + first.size() + second.size());
+    EXPECT_EQ(first.use_count(), 2) << "the queue holds a reference, not a copy";
+
+    EXPECT_EQ(stream.write(), static_cast<int>(15u + first.size() + second.size()));
+    const auto &io = stream.transport();
+    EXPECT_EQ(io.written, "head|" + std::string(first.view()) + "|mid|" + std::string(second.view()) + "|tail");
+    EXPECT_EQ(io.slices_per_call, std::vector<std::size_t>{5u});
+    EXPECT_EQ(stream.pendingWrite(), 0u);
+    EXPECT_EQ(stream.pendingFrames(), 0u);
+    EXPECT_EQ(first.use_count(), 1) << "a written frame is released";
+}
+
+TEST(StreamOutputQueue, PartialWritesResumeWhereverTheyStop) {
+    const auto body     = pattern(4000, 'k');
+    bool       released = false;
+    auto       borrowed = shared_frame::borrow(body.data(), body.size(), [&] { released = true; });
+    const auto owned    = shared_frame::adopt(pattern(3000, 'Q'));
+
+    // Stops: inside the first run, on its end, inside the frame, across frame -> run -> frame, ...
+    GatherStream stream;
+    stream.transport() = ScriptedGatherTransport{{3, 7, 1500, 2600, 1, 2, 1999, 10, 1, 5000}};
+    ASSERT_NE(stream.publish("0123456789", 10), nullptr);
+    ASSERT_TRUE(stream.enqueue(owned));
+    ASSERT_NE(stream.publish("abc", 3), nullptr);
+    ASSERT_TRUE(stream.enqueue(std::move(borrowed))); // the queue holds the only reference
+    ASSERT_NE(stream.publish("xyz", 3), nullptr);
+    const auto expected = "0123456789" + std::string(owned.view()) + "abc" + body + "xyz";
+
+    std::size_t sent = 0;
+    while (stream.pendingWrite()) {
+        const int ret = stream.write();
+        ASSERT_GT(ret, 0);
+        sent += static_cast<std::size_t>(ret);
+        ASSERT_EQ(stream.pendingWrite(), expected.size() - sent);
+        ASSERT_EQ(stream.transport().written, expected.substr(0, sent));
+        EXPECT_EQ(released, sent >= expected.size() - 3) << "the borrowed bytes are released with their last byte, not before";
+    }
+    EXPECT_EQ(stream.transport().written, expected);
+    EXPECT_TRUE(released);
+    EXPECT_EQ(owned.use_count(), 1);
+}
+
+TEST(StreamOutputQueue, OneWriteGathersAtMostTheSliceLimit) {
+    const auto frame = shared_frame::copy_of(pattern(QB_IO_GATHER_MIN_SIZE, 'z'));
+
+    GatherStream stream;
+    constexpr std::size_t frames = QB_IO_MAX_SLICES + 10;
+    for (std::size_t i = 0; i < frames; ++i)
+        ASSERT_TRUE(stream.enqueue(frame));
+    EXPECT_EQ(frame.use_count(), static_cast<long>(frames + 1));
+
+    drain(stream);
+    EXPECT_EQ(stream.transport().slices_per_call, (std::vector<std::size_t>{QB_IO_MAX_SLICES, 10u}));
+    EXPECT_EQ(stream.transport().written.size(), frames * frame.size());
+    EXPECT_EQ(frame.use_count(), 1);
+}
+
+TEST(StreamOutputQueue, SmallFramesAreCopiedAndReleasedAtOnce) {
+    bool       released = false;
+    const char bytes[]  = "short frame";
+    GatherStream stream;
+    ASSERT_TRUE(stream.enqueue(shared_frame::borrow(bytes, sizeof(bytes) - 1, [&] { released = true; })));
+    EXPECT_TRUE(released) << "a frame under QB_IO_GATHER_MIN_SIZE is copied, so its bytes are free at once";
+    EXPECT_EQ(stream.pendingFrames(), 0u);
+    EXPECT_EQ(stream.pendingWrite(), sizeof(bytes) - 1);
+
+    drain(stream);
+    EXPECT_EQ(stream.transport().written, "short frame");
+    EXPECT_TRUE(stream.transport().slices_per_call.empty()) << "with nothing queued, write() is the single-buffer path";
+}
+
+TEST(StreamOutputQueue, TheOutputLimitCountsQueuedFrames) {
+    const auto frame = shared_frame::copy_of(pattern(QB_IO_GATHER_MIN_SIZE * 2, 'L'));
+
+    GatherStream stream;
+    stream.set_max_write_buffer_size(frame.size() * 2 + 4);
+    ASSERT_TRUE(stream.enqueue(frame));
+    ASSERT_TRUE(stream.enqueue(frame));
+    EXPECT_FALSE(stream.enqueue(frame)) << "a third frame would cross the limit";
+    EXPECT_EQ(stream.publish("12345", 5), nullptr) << "so would five buffered bytes";
+    EXPECT_NE(stream.publish("1234", 4), nullptr);
+    EXPECT_EQ(stream.pendingFrames(), 2u);
+    EXPECT_EQ(frame.use_count(), 3);
+}
+
+TEST(StreamOutputQueue, CloseReleasesWhatIsStillQueued) {
+    const auto body     = pattern(QB_IO_GATHER_MIN_SIZE * 4, 'c');
+    int        released = 0;
+
+    GatherStream stream;
+    stream.transport() = ScriptedGatherTransport{{100}};
+    ASSERT_NE(stream.publish("x", 1), nullptr);
+    ASSERT_TRUE(stream.enqueue(shared_frame::borrow(body.data(), body.size(), [&] { ++released; })));
+    ASSERT_EQ(stream.write(), 100);
+    EXPECT_EQ(released, 0);
+
+    stream.close();
+    EXPECT_EQ(released, 1);
+    EXPECT_EQ(stream.pendingWrite(), 0u);
+    EXPECT_EQ(stream.pendingFrames(), 0u);
+}
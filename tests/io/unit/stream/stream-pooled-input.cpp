@@ -0,0 +1,252 @@
+/*
+ * qb - C++ Actor Framework
+ * Copyright (c) 2011-2026 qb - isndev (cpp.actor). All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * See the License for the specific terms.
+ */
+
+/**
+ * @file unit/stream/stream-pooled-input.cpp
+ * @brief `istream::set_pooled_input()` and `qb::io::input_pool`: reads into the thread's scratch
+ *        buffer, unconsumed tails into pooled buffers, nothing held while idle.
+ *
+ *   - An idle pooled stream owns no input storage.
+ *   - `read()` borrows the scratch buffer, and `eof()` (which `io<>` calls after every dispatch)
+ *     gives it back. An unconsumed tail moves into a pooled buffer of its size class.
+ *   - The next `read()` puts the tail in front of the new bytes and returns the pooled buffer.
+ *   - A tail over `QB_IO_INPUT_POOL_MAX_TAIL` keeps the scratch buffer as the stream's own
+ *     until it drains.
+ *   - A read while the scratch is lent (nested dispatch) uses a buffer of its own.
+ *   - A failed read (no `eof()` follows) and `close()` give a lent scratch back.
+ *   - So does a `file_watcher::read_all()` that stops on a protocol error.
+ *   - With the mode off, nothing changes: the buffer stays allocated.
+ *
+ * @author qb - C++ Actor Framework
+ * @copyright Copyright (c) 2011-2026 qb - isndev (cpp.actor)
+ * @ingroup Tests
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <qb/io/async.h>
+#include <qb/io/input_pool.h>
+#include <qb/io/stream.h>
+
+#include "../../shared/scripted_stream_transport.h"
+
+using qb::io::input_pool;
+using qb::io::test::ScriptedStreamTransport;
+
+namespace {
+
+class PooledStream : public qb::io::stream<ScriptedStreamTransport> {
+public:
+    PooledStream() {
+        set_pooled_input(true);
+    }
+};
+
+/// `file_watcher` also wants a descriptor to rewind a truncated file; there is none here.
+class ScriptedFileTransport : public ScriptedStreamTransport {
+public:
+    using ScriptedStreamTransport::ScriptedStreamTransport;
+
+    [[nodiscard]] int
+    native_handle() const noexcept {
+        return -1;
+    }
+};
+
+/// A `file_watcher` reading through a pooled stream, the way `async::file` composes one.
+class PooledFileWatcher
+    : public qb::io::async::file_watcher<PooledFileWatcher>
+    , public qb::io::stream<ScriptedFileTransport> {
+public:
+    using base_io_t = qb::io::async::file_watcher<PooledFileWatcher>;
+
+    PooledFileWatcher() {
+        set_pooled_input(true);
+    }
+};
+
+/// Frames the whole input as one message, then refuses it.
+class RejectingProtocol : public qb::io::async::AProtocol<PooledFileWatcher> {
+public:
+    explicit RejectingProtocol(PooledFileWatcher &io) noexcept
+        : AProtocol(io) {}
+
+    std::size_t
+    getMessageSize() noexcept final {
+        return this->_io.in().size();
+    }
+    void
+    onMessage(std::size_t) noexcept final {
+        not_ok();
+    }
+    void
+    reset() noexcept final {}
+};
+
+class StreamPooledInput : public ::testing::Test {
+protected:
+    input_pool &pool = input_pool::local();
+
+    void
+    SetUp() override {
+        ASSERT_FALSE(pool.lent());
+        pool.trim();
+    }
+};
+
+} // namespace
+
+TEST_F(StreamPooledInput, AnIdleStreamOwnsNoInputBuffer) {
+    PooledStream stream;
+    EXPECT_TRUE(stream.pooled_input());
+    EXPECT_EQ(stream.in().capacity(), 0u);
+
+    qb::io::stream<ScriptedStreamTransport> classic;
+    EXPECT_FALSE(classic.pooled_input());
+    EXPECT_GT(classic.in().capacity(), 0u);
+}
+
+TEST_F(StreamPooledInput, ReadBorrowsTheScratchAndEofKeepsOnlyTheTail) {
+    PooledStream stream;
+    stream.transport() = ScriptedStreamTransport{"one\ntw"};
+
+    ASSERT_EQ(stream.read(), 6);
+    EXPECT_TRUE(pool.lent());
+    EXPECT_GE(stream.in().capacity(), static_cast<std::size_t>(QB_DEFAULT_READ_BUFFER_SIZE));
+
+    stream.flush(4); // the protocol consumed "one\n" straight from the scratch
+    stream.eof();
+    EXPECT_FALSE(pool.lent());
+    EXPECT_EQ(std::string(stream.in().begin(), stream.in().size()), "tw");
+    EXPECT_EQ(stream.in().capacity(), input_pool::min_capacity) << "a 2-byte tail takes the smallest class";
+
+    // The tail goes in front of the next bytes, and its buffer goes back to the pool.
+    stream.transport() = ScriptedStreamTransport{"o\n"};
+    const auto cached  = pool.cached();
+    ASSERT_EQ(stream.read(), 2);
+    EXPECT_EQ(std::string(stream.in().begin(), stream.in().size()), "two\n");
+    EXPECT_EQ(pool.cached(), cached + 1);
+
+    stream.flush(4);
+    stream.eof();
+    EXPECT_EQ(stream.in().capacity(), 0u) << "nothing left, nothing held";
+    EXPECT_FALSE(pool.lent());
+}
+
+TEST_F(StreamPooledInput, TailsAreCopiedIntoTheirSizeClass) {
+    PooledStream stream;
+    stream.transport() = ScriptedStreamTransport{std::string(6000, 'x')};
+    ASSERT_EQ(stream.read(), 6000);
+    stream.eof();
+    EXPECT_EQ(stream.in().size(), 6000u);
+    EXPECT_EQ(stream.in().capacity(), 2 * input_pool::min_capacity);
+
+    const auto cached = pool.cached();
+    stream.flush(6000);
+    stream.eof();
+    EXPECT_EQ(stream.in().capacity(), 0u);
+    EXPECT_EQ(pool.cached(), cached + 1) << "the drained buffer is kept for the next tail";
+
+    // The next tail of that class reuses it instead of allocating.
+    PooledStream other;
+    other.transport()  = ScriptedStreamTransport{std::string(5000, 'y')};
+    const auto before = pool.cached();
+    ASSERT_EQ(other.read(), 5000);
+    other.eof();
+    EXPECT_EQ(pool.cached(), before - 1);
+    EXPECT_EQ(other.in().capacity(), 2 * input_pool::min_capacity);
+}
+
+TEST_F(StreamPooledInput, ATailOverTheLimitKeepsTheScratchUntilItDrains) {
+    const std::string big(QB_IO_INPUT_POOL_MAX_TAIL + 1, 'b');
+
+    PooledStream stream;
+    stream.transport() = ScriptedStreamTransport{big};
+    ASSERT_EQ(stream.read(), static_cast<int>(big.size()));
+    stream.eof();
+    EXPECT_FALSE(pool.lent()) << "the stream keeps the scratch, the pool makes a new one";
+    EXPECT_EQ(stream.in().size(), big.size());
+
+    // Further reads go straight into that buffer, and the pool stays free for other streams.
+    stream.transport() = ScriptedStreamTransport{"\n"};
+    ASSERT_EQ(stream.read(), 1);
+    EXPECT_FALSE(pool.lent());
+    EXPECT_EQ(stream.in().size(), big.size() + 1);
+
+    stream.flush(big.size() + 1);
+    stream.eof();
+    EXPECT_EQ(stream.in().capacity(), 0u);
+}
+
+TEST_F(StreamPooledInput, AReadWhileTheScratchIsLentUsesItsOwnBuffer) {
+    PooledStream outer, nested;
+    outer.transport()  = ScriptedStreamTransport{"outer"};
+    nested.transport() = ScriptedStreamTransport{"nested"};
+
+    ASSERT_EQ(outer.read(), 5);
+    ASSERT_TRUE(pool.lent());
+    ASSERT_EQ(nested.read(), 6);
+    EXPECT_EQ(std::string(nested.in().begin(), nested.in().size()), "nested");
+    nested.flush(6);
+    nested.eof();
+    EXPECT_EQ(nested.in().capacity(), 0u);
+    EXPECT_TRUE(pool.lent()) << "still with the outer stream";
+
+    outer.flush(5);
+    outer.eof();
+    EXPECT_FALSE(pool.lent());
+}
+
+TEST_F(StreamPooledInput, AFailedReadGivesTheScratchBackAndKeepsTheTail) {
+    PooledStream stream;
+    stream.transport() = ScriptedStreamTransport{"half"};
+    ASSERT_EQ(stream.read(), 4);
+    stream.eof();
+
+    stream.transport() = ScriptedStreamTransport{"", {}, true};
+    EXPECT_EQ(stream.read(), -1);
+    EXPECT_FALSE(pool.lent()) << "io<> returns without eof() on a would-block read";
+    EXPECT_EQ(std::string(stream.in().begin(), stream.in().size()), "half");
+}
+
+TEST_F(StreamPooledInput, CloseGivesALentScratchBack) {
+    PooledStream stream;
+    stream.transport() = ScriptedStreamTransport{"bytes"};
+    ASSERT_EQ(stream.read(), 5);
+    ASSERT_TRUE(pool.lent());
+
+    stream.close();
+    EXPECT_FALSE(pool.lent());
+    EXPECT_EQ(stream.pendingRead(), 0u);
+}
+
+TEST_F(StreamPooledInput, AReadAllStoppedByTheProtocolGivesTheScratchBack) {
+    qb::io::async::init();
+    {
+        PooledFileWatcher watcher;
+        ASSERT_NE(watcher.switch_protocol<RejectingProtocol>(watcher), nullptr);
+        watcher.transport() = ScriptedFileTransport{"record"};
+
+        EXPECT_EQ(watcher.read_all(), -1);
+        EXPECT_FALSE(pool.lent()) << "the protocol exit must not keep the thread's scratch";
+        EXPECT_EQ(std::string(watcher.in().begin(), watcher.in().size()), "record");
+    }
+    qb::io::async::listener::current.clear();
+}
+
+TEST_F(StreamPooledInput, TheDefaultModeKeepsItsBuffer) {
+    qb::io::stream<ScriptedStreamTransport> stream;
+    stream.transport() = ScriptedStreamTransport{"line\n"};
+    ASSERT_EQ(stream.read(), 5);
+    EXPECT_FALSE(pool.lent());
+    stream.flush(5);
+    stream.eof();
+    EXPECT_GE(stream.in().capacity(), static_cast<std::size_t>(QB_DEFAULT_READ_BUFFER_SIZE));
+}